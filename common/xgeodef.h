@@ -25,6 +25,19 @@
 #define MATH_EPSILON	0.001f	/* epsilon*/
 #endif
 
+/////////////////////////////////////////////////////////////////////////////////////
+// SIMD instruction set used by batch kernels (define GEO_NO_SIMD to use scalar)
+
+#if !defined(GEO_NO_SIMD) && (defined(__AVX__) || defined(__AVX2__))
+#define GEO_SIMD_AVX
+#define GEO_SIMD_WIDTH	8
+#elif !defined(GEO_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define GEO_SIMD_SSE
+#define GEO_SIMD_WIDTH	4
+#else
+#define GEO_SIMD_WIDTH	1
+#endif
+
 #define GTrue  true
 #define GFalse false
 
@@ -0,0 +1,128 @@
+////////////////////////////////////////////////////////////////////////////////////
+/*!*********************************************************************************
+* @Copyright (C) 2021-2023 thuong.nv <thuong.nv.mta@gmail.com>
+*            All rights reserved.
+************************************************************************************
+* @file     bench_pool.cpp
+* @create   Oct 17, 2026
+* @brief    Benchmark batch clip_polygon_hodgman on GeoThreadPool (1 .. n threads)
+* @note     Console program, link with zgeolib. One pool is created and reused for
+*           nThread = 1 .. hardware_concurrency. Prints time (best of runs), the
+*           speedup to the serial (GeoScratch) call and if the result is the same
+************************************************************************************/
+
+#include "x2dalgo.h"
+#include "x2dpool.h"
+
+#include <chrono>
+#include <random>
+#include <thread>
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+#include <algorithm>
+
+using namespace geo::v2;
+
+static GBool is_same(const MultiPolygon2D& a, const MultiPolygon2D& b)
+{
+	if (a.poly_count() != b.poly_count() || a.ring_count() != b.ring_count() || a.point_count() != b.point_count())
+		return GFalse;
+
+	for (size_t r = 0; r < a.ring_count(); r++)
+	{
+		if (a.ring_begin(r) != b.ring_begin(r)) return GFalse;
+	}
+
+	return std::memcmp(a.points().data(), b.points().data(), a.point_count() * sizeof(Point2D)) == 0;
+}
+
+template<typename Func>
+static double time_ms(Func func, int nRun)
+{
+	double dBest = 1e30;
+
+	for (int i = 0; i < nRun; i++)
+	{
+		auto t = std::chrono::high_resolution_clock::now();
+		func();
+		dBest = std::min(dBest, std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - t).count());
+	}
+
+	return dBest;
+}
+
+int main()
+{
+	const int nPoly = 8000;
+	const int nRun  = 7;
+
+	std::mt19937 rng(7);
+	std::uniform_real_distribution<float> dist(0.f, 1000.f);
+
+	// Star polygons (half CW), hole in some of them
+	MultiPolygon2D mpoly;
+
+	for (int i = 0; i < nPoly; i++)
+	{
+		float cx = dist(rng), cy = dist(rng), r = 5.f + dist(rng) / 40.f;
+		int   k  = 32 + static_cast<int>(rng() % 64);
+
+		VecPoint2D poly;
+
+		for (int j = 0; j < k; j++)
+		{
+			float a  = 6.2831853f * j / k;
+			float rr = r * (0.5f + 0.5f * (rng() % 100) / 100.f);
+			poly.push_back(Point2D(cx + rr * cosf(a), cy + rr * sinf(a)));
+		}
+
+		if (i % 2) std::reverse(poly.begin(), poly.end());
+
+		mpoly.add_polygon(poly);
+
+		if (i % 7 == 0)
+		{
+			VecPoint2D hole;
+
+			for (int j = 0; j < 6; j++)
+			{
+				float a = -6.2831853f * j / 6;
+				hole.push_back(Point2D(cx + r * 0.2f * cosf(a), cy + r * 0.2f * sinf(a)));
+			}
+
+			mpoly.add_ring(hole);
+		}
+	}
+
+	VecPoint2D clip;
+
+	for (int j = 0; j < 24; j++)
+	{
+		float a = 6.2831853f * j / 24;
+		clip.push_back(Point2D(500.f + 420.f * cosf(a), 500.f + 420.f * sinf(a)));
+	}
+
+	GeoScratch scratch;
+	MultiPolygon2D ref;
+
+	double t0 = time_ms([&] { ref.clear(); clip_polygon_hodgman(mpoly, RingView2D(clip), ref, scratch); }, nRun);
+
+	printf("polygons %d, points %zu, result %zu polygons\n", nPoly, mpoly.point_count(), ref.poly_count());
+	printf("%8s %10s %8s %6s\n", "threads", "time(ms)", "speedup", "same");
+	printf("%8s %10.2f %7.2fx %6s\n", "serial", t0, 1.0, "-");
+
+	GInt nMaxThread = std::max<GInt>(1, static_cast<GInt>(std::thread::hardware_concurrency()));
+	GeoThreadPool pool(nMaxThread);
+
+	for (GInt nThread = 1; nThread <= nMaxThread; nThread++)
+	{
+		MultiPolygon2D out;
+
+		double t1 = time_ms([&] { out.clear(); clip_polygon_hodgman(mpoly, RingView2D(clip), out, pool, nThread); }, nRun);
+
+		printf("%8d %10.2f %7.2fx %6s\n", nThread, t1, t0 / t1, is_same(out, ref) ? "yes" : "NO");
+	}
+
+	return 0;
+}
@@ -0,0 +1,93 @@
+////////////////////////////////////////////////////////////////////////////////////
+/*!*********************************************************************************
+* @Copyright (C) 2021-2023 thuong.nv <thuong.nv.mta@gmail.com>
+*            All rights reserved.
+************************************************************************************
+* @file     bench_prep.cpp
+* @create   Oct 17, 2026
+* @brief    Benchmark PreparedPolygon::contains against is_point_in_polygon
+* @note     Console program, link with zgeolib. Prints time of both functions, the
+*           speedup and the number of different results (random points and points
+*           put on the boundary)
+************************************************************************************/
+
+#include "x2dprep.h"
+#include "x2dpoly.h"
+
+#include <chrono>
+#include <random>
+#include <cstdio>
+#include <cmath>
+
+using namespace geo::v2;
+
+static VecPoint2D make_star(int nCnt, float fR1, float fR2)
+{
+	VecPoint2D poly;
+
+	for (int i = 0; i < nCnt; i++)
+	{
+		float a = 6.2831853f * i / nCnt;
+		float r = (i % 2) ? fR1 : fR2;
+		poly.push_back(Point2D(r * cosf(a), r * sinf(a)));
+	}
+
+	return poly;
+}
+
+template<typename Func>
+static double time_ms(Func func)
+{
+	auto t = std::chrono::high_resolution_clock::now();
+	func();
+	return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - t).count();
+}
+
+int main()
+{
+	const size_t nPoint = 200000;
+
+	std::mt19937 rng(1);
+	std::uniform_real_distribution<float> dist(-110.f, 110.f);
+
+	VecPoint2D pts(nPoint);
+	for (auto& pt : pts) pt = Point2D(dist(rng), dist(rng));
+
+	struct { const char* szName; VecPoint2D poly; } arCase[] =
+	{
+		{ "star   64", make_star(64, 50.f, 100.f) },
+		{ "star 1000", make_star(1000, 60.f, 100.f) },
+		{ "convex   64", make_star(64, 100.f, 100.f) },
+		{ "convex 1000", make_star(1000, 100.f, 100.f) },
+	};
+
+	printf("%-12s %10s %10s %8s %8s %8s\n", "polygon", "ref(ms)", "prep(ms)", "speedup", "diff", "diff-bd");
+
+	for (auto& c : arCase)
+	{
+		PreparedPolygon prep(c.poly);
+		std::vector<uint8_t> vecRef(nPoint), vecOut(nPoint);
+
+		double t0 = time_ms([&] { for (size_t i = 0; i < nPoint; i++) vecRef[i] = is_point_in_polygon(pts[i], c.poly); });
+		double t1 = time_ms([&] { prep.contains(pts.data(), nPoint, vecOut.data()); });
+
+		size_t nDiff = 0;
+		for (size_t i = 0; i < nPoint; i++) nDiff += (vecRef[i] != vecOut[i]);
+
+		// Points on the boundary : vertices and edge midpoints
+		size_t nDiffBd = 0;
+		for (size_t i = 0; i < c.poly.size(); i++)
+		{
+			const Point2D& p0 = c.poly[i];
+			const Point2D& p1 = c.poly[(i + 1) % c.poly.size()];
+			const Point2D  pm((p0.x + p1.x) * 0.5f, (p0.y + p1.y) * 0.5f);
+
+			nDiffBd += (is_point_in_polygon(p0, c.poly) != prep.contains(p0));
+			nDiffBd += (is_point_in_polygon(pm, c.poly) != prep.contains(pm));
+		}
+
+		printf("%-12s %10.2f %10.2f %7.1fx %8zu %8zu\n", c.szName, t0, t1, t0 / t1, nDiff, nDiffBd);
+	}
+
+	return 0;
+}
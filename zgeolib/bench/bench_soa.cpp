@@ -0,0 +1,94 @@
+////////////////////////////////////////////////////////////////////////////////////
+/*!*********************************************************************************
+* @Copyright (C) 2021-2023 thuong.nv <thuong.nv.mta@gmail.com>
+*            All rights reserved.
+************************************************************************************
+* @file     bench_soa.cpp
+* @create   Oct 17, 2026
+* @brief    Benchmark SIMD batch point-in-polygon (PointSoA2D) against scalar
+* @note     Console program, link with zgeolib. The instruction set is the one of
+*           the build (xgeodef.h) : build with AVX2 (/arch:AVX2, -mavx2), SSE only
+*           (-mno-avx) and GEO_NO_SIMD to compare the three kernels. Also prints
+*           the point throughput and the bytes read per second
+************************************************************************************/
+
+#include "x2dprep.h"
+#include "x2dpoly.h"
+#include "x2dsoa.h"
+
+#include <chrono>
+#include <random>
+#include <cstdio>
+#include <cmath>
+
+using namespace geo::v2;
+
+static VecPoint2D make_star(int nCnt, float fR1, float fR2)
+{
+	VecPoint2D poly;
+
+	for (int i = 0; i < nCnt; i++)
+	{
+		float a = 6.2831853f * i / nCnt;
+		float r = (i % 2) ? fR1 : fR2;
+		poly.push_back(Point2D(r * cosf(a), r * sinf(a)));
+	}
+
+	return poly;
+}
+
+template<typename Func>
+static double time_ms(Func func)
+{
+	auto t = std::chrono::high_resolution_clock::now();
+	func();
+	return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - t).count();
+}
+
+int main()
+{
+#if defined(GEO_SIMD_AVX)
+	printf("kernel : AVX (%d lanes)\n", GEO_SIMD_WIDTH);
+#elif defined(GEO_SIMD_SSE)
+	printf("kernel : SSE (%d lanes)\n", GEO_SIMD_WIDTH);
+#else
+	printf("kernel : scalar\n");
+#endif
+
+	const size_t nPoint = 1000003;
+
+	std::mt19937 rng(1);
+	std::uniform_real_distribution<float> dist(-110.f, 110.f);
+
+	VecPoint2D pts(nPoint);
+	for (auto& pt : pts) pt = Point2D(dist(rng), dist(rng));
+
+	PointSoA2D soa;
+	convert_points_to_soa(pts, soa);
+
+	const int arEdge[] = { 16, 64, 1000 };
+
+	printf("%6s %10s %10s %10s %8s %12s %10s %6s\n", "edges", "ref(ms)", "aos(ms)", "soa(ms)", "x(aos)", "Mpoint/s", "MB/s", "diff");
+
+	for (int nEdge : arEdge)
+	{
+		VecPoint2D poly = make_star(nEdge, 50.f, 100.f);
+		PreparedPolygon prep(poly);
+
+		std::vector<uint8_t> vecRef(nPoint), vecAos(nPoint), vecSoa(nPoint);
+
+		double t0 = time_ms([&] { for (size_t i = 0; i < nPoint; i++) vecRef[i] = is_point_in_polygon(pts[i], poly); });
+		double t1 = time_ms([&] { prep.contains(pts.data(), nPoint, vecAos.data()); });
+		double t2 = time_ms([&] { prep.contains(soa, vecSoa.data()); });
+
+		size_t nDiff = 0;
+		for (size_t i = 0; i < nPoint; i++) nDiff += (vecRef[i] != vecSoa[i]);
+
+		const double dPointRate = nPoint / (t2 * 1e3);						// Mpoint/s
+		const double dByteRate  = nPoint * (2 * sizeof(GFloat) + 1) / (t2 * 1e3);	// MB/s (x, y in, mask out)
+
+		printf("%6d %10.1f %10.1f %10.1f %7.1fx %12.1f %10.1f %6zu\n", nEdge, t0, t1, t2, t1 / t2, dPointRate, dByteRate, nDiff);
+	}
+
+	return 0;
+}
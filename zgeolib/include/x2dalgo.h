@@ -13,16 +13,36 @@
 #define X2D_ALOGO_H
 
 #include "x2dbase.h"
+#include "x2dmpoly.h"
+#include "x2dscratch.h"
 
 namespace geo {	namespace v2
 {
+	class GeoThreadPool;
+
 	/********************************************************************************
-	*! @brief  :Reverse polygon cw -> ccw | ccw -> cw
-	*! @param  : [in] poly : polygon
+	*! @brief  : shape in which all of its sides are pointing or protruding outwards
+	*! @param  : [in] vecPoints : point list
+	*! @return : VecPoint2D convex hull (CCW, start at leftmost point)
 	*! @author : thuong.nv			- [Date] : 25/10/2023
+	*! @note   : Keep for compatibility, use convex_hull_monotone
 	********************************************************************************/
 	Dllexport VecPoint2D convex_hull_giftwap(const VecPoint2D& vecPoints);
 
+	/********************************************************************************
+	*! @brief  : Convex hull use Andrew monotone chain algorithm O(n log n)
+	*! @param  : [in] vecPoints : point list
+	*! @param  : [in] nThread   : number of thread (<= 0 : hardware concurrency)
+	*! @return : VecPoint2D convex hull (CCW, start at leftmost point, no collinear point)
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Points inside the Akl-Toussaint octagon (8 extreme points) are
+	*!           discarded before sorting. With nThread > 1 each thread builds the
+	*!           hull of one chunk, then the chunk hulls are merged
+	*! @refer  : https://en.wikibooks.org/wiki/Algorithm_Implementation/Geometry/Convex_hull/Monotone_chain
+	********************************************************************************/
+	Dllexport VecPoint2D convex_hull_monotone(const VecPoint2D& vecPoints, GInt nThread = 1);
+	Dllexport VecPoint2D convex_hull_monotone(const RingView2D& vecPoints, GInt nThread = 1);
+
 	/********************************************************************************
 	*! @brief  : Clipping Polygons use SutherlandHodgman algorithm [rect]
 	*! @param  : [in]  poly           : polygon
@@ -36,6 +56,58 @@ namespace geo {	namespace v2
 	********************************************************************************/
 	Dllexport VecPoint2D clip_polygon_hodgman(const VecPoint2D& poly, const VecPoint2D& clipConvexPoly);
 
+	/********************************************************************************
+	*! @brief  : Clipping Polygons use Sutherland-Hodgman algorithm (caller buffers)
+	*! @param  : [in ] poly           : polygon
+	*! @param  : [in ] clipConvexPoly : convex clip polygon
+	*! @param  : [out] vecOut         : clip polygon (replaced)
+	*! @param  : [in ] vecWork        : work buffer
+	*! @return : number of point of clip polygon
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Same result as clip_polygon_hodgman. No heap allocation when vecOut
+	*!           and vecWork have enough capacity (reuse them between calls)
+	*!           Polygon also convex (CCW clip) : O'Rourke intersection O(n + m)
+	*!           Degenerate contact (vertex on edge, collinear edges) uses Hodgman
+	*********************************************************************************/
+	Dllexport GInt clip_polygon_hodgman(const RingView2D& poly, const RingView2D& clipConvexPoly, VecPoint2D& vecOut, VecPoint2D& vecWork);
+
+	/********************************************************************************
+	*! @brief  : Clipping all rings of multipolygon use Sutherland-Hodgman algorithm
+	*! @param  : [in ] mpoly          : multipolygon
+	*! @param  : [in ] clipConvexPoly : convex clip polygon
+	*! @param  : [out] result         : clip multipolygon (appended)
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Orientation of each ring is kept. Polygon whose outer ring is
+	*!           outside the clip polygon is removed. Convex ring : O'Rourke O(n + m)
+	*********************************************************************************/
+	Dllexport void clip_polygon_hodgman(const MultiPolygon2D& mpoly, const VecPoint2D& clipConvexPoly, MultiPolygon2D& result);
+
+	/********************************************************************************
+	*! @brief  : Clipping all rings of multipolygon use Sutherland-Hodgman (scratch memory)
+	*! @param  : [in ] mpoly          : multipolygon
+	*! @param  : [in ] clipConvexPoly : convex clip polygon
+	*! @param  : [out] result         : clip multipolygon (appended)
+	*! @param  : [in ] scratch        : temporary memory (ring buffers)
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Same result as clip_polygon_hodgman(mpoly). Temporary memory is given
+	*!           back to scratch on return
+	*********************************************************************************/
+	Dllexport void clip_polygon_hodgman(const MultiPolygon2D& mpoly, const RingView2D& clipConvexPoly, MultiPolygon2D& result, GeoScratch& scratch);
+
+	/********************************************************************************
+	*! @brief  : Clipping all rings of multipolygon use Sutherland-Hodgman (parallel)
+	*! @param  : [in ] mpoly          : multipolygon
+	*! @param  : [in ] clipConvexPoly : convex clip polygon
+	*! @param  : [out] result         : clip multipolygon (appended)
+	*! @param  : [in ] pool           : thread pool (scratch memory of each worker is used)
+	*! @param  : [in ] nThread        : max number of worker (<= 0 : all workers of pool)
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Same result (and order) as clip_polygon_hodgman(mpoly) for any number
+	*!           of thread. Keep the pool between frames (threads and scratch reused)
+	*********************************************************************************/
+	Dllexport void clip_polygon_hodgman(const MultiPolygon2D& mpoly, const RingView2D& clipConvexPoly, MultiPolygon2D& result,
+										GeoThreadPool& pool, GInt nThread = 0);
+
 	/********************************************************************************
 	*! @brief  : Clipping Polygons use Weiler Atherton  algorithm
 	*! @param  : [in]  _poly     : polygon
@@ -47,17 +119,82 @@ namespace geo {	namespace v2
 	*********************************************************************************/
 	Dllexport VecPolyList clip_polygon_weiler(const VecPoint2D& poly, const VecPoint2D& clipPoly);
 
+	/********************************************************************************
+	*! @brief  : Clipping Polygons use Weiler Atherton algorithm (caller buffer)
+	*! @param  : [in ] poly     : polygon
+	*! @param  : [in ] clipPoly : clip (polygon)
+	*! @param  : [out] result   : clip polygons (appended, one polygon per piece)
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Same result as clip_polygon_weiler, input is not copied by caller
+	*********************************************************************************/
+	Dllexport void clip_polygon_weiler(const RingView2D& poly, const RingView2D& clipPoly, MultiPolygon2D& result);
+
+	/********************************************************************************
+	*! @brief  : Clipping Polygons use Weiler Atherton algorithm (scratch memory)
+	*! @param  : [in ] poly     : polygon
+	*! @param  : [in ] clipPoly : clip (polygon)
+	*! @param  : [out] result   : clip polygons (appended, one polygon per piece)
+	*! @param  : [in ] scratch  : temporary memory (maps, mark lists, sweep line)
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Same result as clip_polygon_weiler. Temporary memory is given back
+	*!           to scratch on return, reuse scratch and result between calls
+	*********************************************************************************/
+	Dllexport void clip_polygon_weiler(const RingView2D& poly, const RingView2D& clipPoly, MultiPolygon2D& result, GeoScratch& scratch);
+
+	/********************************************************************************
+	*! @brief  : Clipping multipolygon with polygon (holes are supported)
+	*! @param  : [in ] mpoly    : multipolygon
+	*! @param  : [in ] clipPoly : clip polygon
+	*! @param  : [out] result   : clip multipolygon (replaced)
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Same as boolean_polygon(BOOL_INTERSECT)
+	*********************************************************************************/
+	Dllexport void clip_polygon_weiler(const MultiPolygon2D& mpoly, const VecPoint2D& clipPoly, MultiPolygon2D& result);
+
+	/********************************************************************************
+	*! @brief  : Clipping multipolygon with polygon (scratch memory)
+	*! @param  : [in ] mpoly    : multipolygon
+	*! @param  : [in ] clipPoly : clip polygon
+	*! @param  : [out] result   : clip multipolygon (replaced)
+	*! @param  : [in ] scratch  : temporary memory (sweep queue, status, result rings)
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Same as boolean_polygon(BOOL_INTERSECT, scratch)
+	*********************************************************************************/
+	Dllexport void clip_polygon_weiler(const MultiPolygon2D& mpoly, const RingView2D& clipPoly, MultiPolygon2D& result, GeoScratch& scratch);
+
 	/********************************************************************************
 	*! @brief  : Union two convex polygon (without hole)
 	*! @param  : [in]  poly1 : convex polygon
 	*! @param  : [in]  poly2 : convex polygon
-	*! @return : VecPolyList list poly clip
+	*! @return : VecPoint2D outer ring of union (empty : two polygons are separated)
 	*! @author : thuong.nv   - [Date] : 13/11/2023
 	*! @note   : Polygon input is counterclockwise (CCW). without holes
+	*!           Holes of union are skipped (see boolean_polygon)
 	*! @refer  : https://stackoverflow.com/questions/6844462/polygon-union-without-holes
 	*********************************************************************************/
 	Dllexport VecPoint2D union_polygon(const VecPoint2D& poly1, const VecPoint2D& poly2);
 
+	/********************************************************************************
+	*! @brief  : Union two multipolygons (holes are supported)
+	*! @param  : [in ] mpoly1 : multipolygon
+	*! @param  : [in ] mpoly2 : multipolygon
+	*! @param  : [out] result : union multipolygon (replaced)
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Same as boolean_polygon(BOOL_UNION)
+	*********************************************************************************/
+	Dllexport void union_polygon(const MultiPolygon2D& mpoly1, const MultiPolygon2D& mpoly2, MultiPolygon2D& result);
+
+	/********************************************************************************
+	*! @brief  : Union two multipolygons (scratch memory)
+	*! @param  : [in ] mpoly1  : multipolygon
+	*! @param  : [in ] mpoly2  : multipolygon
+	*! @param  : [out] result  : union multipolygon (replaced)
+	*! @param  : [in ] scratch : temporary memory (sweep queue, status, result rings)
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Same as boolean_polygon(BOOL_UNION, scratch)
+	*********************************************************************************/
+	Dllexport void union_polygon(const MultiPolygon2D& mpoly1, const MultiPolygon2D& mpoly2, MultiPolygon2D& result, GeoScratch& scratch);
+
 	/********************************************************************************
 	*! @brief  : Cut line and polygon
 	*! @param  : [in]  pt1  : Point in line
@@ -69,13 +206,64 @@ namespace geo {	namespace v2
 	*********************************************************************************/
 	Dllexport VecPolyList cut_line2poly(const Point2D& pt1, const Point2D& pt2, const VecPoint2D& poly);
 
+	/********************************************************************************
+	*! @brief  : Cut line and polygon (caller buffer)
+	*! @param  : [in ] pt1    : Point in line
+	*! @param  : [in ] pt2    : Point in line
+	*! @param  : [in ] poly   : polygon
+	*! @param  : [out] result : polygon pieces (appended, one polygon per piece)
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Same result as cut_line2poly, input is not copied by caller
+	*********************************************************************************/
+	Dllexport void cut_line2poly(const Point2D& pt1, const Point2D& pt2, const RingView2D& poly, MultiPolygon2D& result);
+
+	/********************************************************************************
+	*! @brief  : Cut line and polygon (scratch memory)
+	*! @param  : [in ] pt1     : Point in line
+	*! @param  : [in ] pt2     : Point in line
+	*! @param  : [in ] poly    : polygon
+	*! @param  : [out] result  : polygon pieces (appended, one polygon per piece)
+	*! @param  : [in ] scratch : temporary memory
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Same result as cut_line2poly. Temporary memory is given back to
+	*!           scratch on return
+	*********************************************************************************/
+	Dllexport void cut_line2poly(const Point2D& pt1, const Point2D& pt2, const RingView2D& poly, MultiPolygon2D& result, GeoScratch& scratch);
+
+	/********************************************************************************
+	*! @brief  : Cut line and all polygons of multipolygon
+	*! @param  : [in ] pt1    : Point in line
+	*! @param  : [in ] pt2    : Point in line
+	*! @param  : [in ] mpoly  : multipolygon
+	*! @param  : [out] result : polygon pieces (appended, one polygon per piece)
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Only outer rings are cut (holes are not supported by cut_line2poly)
+	*********************************************************************************/
+	Dllexport void cut_line2poly(const Point2D& pt1, const Point2D& pt2, const MultiPolygon2D& mpoly, MultiPolygon2D& result);
+	Dllexport void cut_line2poly(const Point2D& pt1, const Point2D& pt2, const MultiPolygon2D& mpoly, MultiPolygon2D& result, GeoScratch& scratch);
+
+	/********************************************************************************
+	*! @brief  : Cut line and all polygons of multipolygon on integer grid (snap rounding)
+	*! @param  : [in ] pt1    : Point in line
+	*! @param  : [in ] pt2    : Point in line
+	*! @param  : [in ] mpoly  : multipolygon (outer ring + holes)
+	*! @param  : [in ] dScale : grid unit per world unit (ex : 1000 -> grid 0.001)
+	*! @param  : [out] result : polygon pieces (appended, with holes)
+	*! @return : TRUE : OK | FALSE : pt1 = pt2 or coordinate out of snap range
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : The whole line through pt1, pt2 cuts. Pieces are on grid and share
+	*!           their cut points exactly (see boolean_polygon_snap)
+	*********************************************************************************/
+	Dllexport GBool cut_line2poly_snap(const Point2D& pt1, const Point2D& pt2, const MultiPolygon2D& mpoly, GDouble dScale, MultiPolygon2D& result);
+
 	/********************************************************************************
 	*! @brief  : The partition of a polygonal area (simple polygon) P into a set of triangles
 	*! @param  : [in]  poly : polygon
 	*! @return : VecPolyList (Every 3 consecutive points will be a triangle)
 	*! @author : thuong.nv   - [Date] : 11/07/2023
 	*! @note   : Polygon input is counterclockwise (CCW winding).
-	*!           For convex or concave polygon
+	*!           For convex or concave polygon. Use triangulate_polygon (linked ring +
+	*!           z-order) for indexed triangle list
 	*********************************************************************************/
 	Dllexport VecPoint2D poly2trig_ear_clipping(const VecPoint2D& poly);
 
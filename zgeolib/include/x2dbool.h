@@ -0,0 +1,143 @@
+////////////////////////////////////////////////////////////////////////////////////
+/*!*********************************************************************************
+* @Copyright (C) 2021-2023 thuong.nv <thuong.nv.mta@gmail.com>
+*            All rights reserved.
+************************************************************************************
+* @file     x2dbool.h
+* @create   Oct 17, 2026
+* @brief    Geometry2D polygon boolean operation (union, intersection, difference, xor)
+* @note     For conditions of distribution and use, see copyright notice in readme.txt
+************************************************************************************/
+
+#ifndef X2D_BOOL_H
+#define X2D_BOOL_H
+
+#include "x2dbase.h"
+#include "x2dmpoly.h"
+#include "x2dscratch.h"
+
+namespace geo { namespace v2
+{
+	enum EnumBoolOp
+	{
+		BOOL_INTERSECT,	// subject AND clip
+		BOOL_UNION,		// subject OR clip
+		BOOL_DIFF,		// subject - clip
+		BOOL_XOR,		// subject XOR clip
+	};
+
+	enum EnumFillRule
+	{
+		FILL_EVENODD,	// inside : odd number of ring around point
+		FILL_NONZERO,	// inside : winding number != 0
+		FILL_POSITIVE,	// inside : winding number > 0 (CCW ring : +1 | CW ring : -1)
+	};
+
+	/*******************************************************************************
+	*! @brief  : Boolean operation of two multipolygons
+	*! @param  : [in ] subject : subject polygons (outer ring + holes)
+	*! @param  : [in ] clip    : clip polygons (outer ring + holes)
+	*! @param  : [in ] eOp     : operation
+	*! @param  : [out] result  : result polygons (outer ring CCW, hole CW)
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Input rings use even-odd rule (orientation of rings is not used).
+	*!           Edges are split at intersections by sweep line, then labeled by a
+	*!           second sweep. O((n + k) log n) : n edges, k intersections
+	********************************************************************************/
+	Dllexport void boolean_polygon(const MultiPolygon2D& subject, const MultiPolygon2D& clip, EnumBoolOp eOp, MultiPolygon2D& result);
+
+	/*******************************************************************************
+	*! @brief  : Boolean operation of two multipolygons (scratch memory)
+	*! @param  : [in ] subject : subject polygons (outer ring + holes)
+	*! @param  : [in ] clip    : clip polygons (outer ring + holes)
+	*! @param  : [in ] eOp     : operation
+	*! @param  : [out] result  : result polygons (outer ring CCW, hole CW)
+	*! @param  : [in ] scratch : temporary memory (sweep queue, status, result rings)
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Same result as boolean_polygon. Temporary memory is given back to
+	*!           scratch on return, reuse scratch and result between calls
+	********************************************************************************/
+	Dllexport void boolean_polygon(const MultiPolygon2D& subject, const MultiPolygon2D& clip, EnumBoolOp eOp, MultiPolygon2D& result,
+								   GeoScratch& scratch);
+
+	/*******************************************************************************
+	*! @brief  : Boolean operation of multipolygon and polygon (scratch memory)
+	*! @param  : [in ] subject : subject polygons (outer ring + holes)
+	*! @param  : [in ] clip    : clip polygon
+	*! @param  : [in ] eOp     : operation
+	*! @param  : [out] result  : result polygons (outer ring CCW, hole CW)
+	*! @param  : [in ] scratch : temporary memory (sweep queue, status, result rings)
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	********************************************************************************/
+	Dllexport void boolean_polygon(const MultiPolygon2D& subject, const RingView2D& clip, EnumBoolOp eOp, MultiPolygon2D& result,
+								   GeoScratch& scratch);
+
+	/*******************************************************************************
+	*! @brief  : Boolean operation of two ring lists (even-odd rule)
+	*! @param  : [in ] subject : subject rings
+	*! @param  : [in ] clip    : clip rings
+	*! @param  : [in ] eOp     : operation
+	*! @param  : [out] result  : result polygons (outer ring CCW, hole CW)
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	********************************************************************************/
+	Dllexport void boolean_polygon(const VecPolyList& subject, const VecPolyList& clip, EnumBoolOp eOp, MultiPolygon2D& result);
+	Dllexport void boolean_polygon(const VecPolyList& subject, const VecPolyList& clip, EnumBoolOp eOp, MultiPolygon2D& result,
+								   GeoScratch& scratch);
+
+	/*******************************************************************************
+	*! @brief  : Boolean operation of two polygons
+	*! @param  : [in ] subject : subject polygon
+	*! @param  : [in ] clip    : clip polygon
+	*! @param  : [in ] eOp     : operation
+	*! @param  : [out] result  : result polygons (outer ring CCW, hole CW)
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	********************************************************************************/
+	Dllexport void boolean_polygon(const VecPoint2D& subject, const VecPoint2D& clip, EnumBoolOp eOp, MultiPolygon2D& result);
+	Dllexport void boolean_polygon(const RingView2D& subject, const RingView2D& clip, EnumBoolOp eOp, MultiPolygon2D& result);
+	Dllexport void boolean_polygon(const RingView2D& subject, const RingView2D& clip, EnumBoolOp eOp, MultiPolygon2D& result,
+								   GeoScratch& scratch);
+
+	/*******************************************************************************
+	*! @brief  : Union of all rings of multipolygon by fill rule
+	*! @param  : [in ] mpoly  : rings (polygon structure is not used)
+	*! @param  : [in ] eFill  : fill rule
+	*! @param  : [out] result : result polygons (outer ring CCW, hole CW)
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Removes self-intersections and overlaps (same sweep as
+	*!           boolean_polygon). FILL_EVENODD : same as boolean_polygon union with
+	*!           empty clip
+	********************************************************************************/
+	Dllexport void union_polygon(const MultiPolygon2D& mpoly, EnumFillRule eFill, MultiPolygon2D& result);
+
+	/*******************************************************************************
+	*! @brief  : Boolean operation of two multipolygons on integer grid (snap rounding)
+	*! @param  : [in ] subject : subject polygons (outer ring + holes)
+	*! @param  : [in ] clip    : clip polygons (outer ring + holes)
+	*! @param  : [in ] eOp     : operation
+	*! @param  : [in ] dScale  : grid unit per world unit (ex : 1000 -> grid 0.001)
+	*! @param  : [out] result  : result polygons (outer ring CCW, hole CW)
+	*! @return : TRUE : OK | FALSE : coordinate * dScale out of GSNAP_COORD_MAX
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Input is rounded to grid and edges are noded by snap rounding
+	*!           (x2dsnap.h) : all points of result are grid points, rings do not
+	*!           cross, no sliver or near duplicate point. No cleanup is needed.
+	*!           Distinct grid points stay distinct in float while
+	*!           |coordinate| * dScale < 2^24
+	********************************************************************************/
+	Dllexport GBool boolean_polygon_snap(const MultiPolygon2D& subject, const MultiPolygon2D& clip, EnumBoolOp eOp, GDouble dScale, MultiPolygon2D& result);
+
+	/*******************************************************************************
+	*! @brief  : Boolean operation of two polygons on integer grid (snap rounding)
+	*! @param  : [in ] subject : subject polygon
+	*! @param  : [in ] clip    : clip polygon
+	*! @param  : [in ] eOp     : operation
+	*! @param  : [in ] dScale  : grid unit per world unit (ex : 1000 -> grid 0.001)
+	*! @param  : [out] result  : result polygons (outer ring CCW, hole CW)
+	*! @return : TRUE : OK | FALSE : coordinate * dScale out of GSNAP_COORD_MAX
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	********************************************************************************/
+	Dllexport GBool boolean_polygon_snap(const VecPoint2D& subject, const VecPoint2D& clip, EnumBoolOp eOp, GDouble dScale, MultiPolygon2D& result);
+	Dllexport GBool boolean_polygon_snap(const RingView2D& subject, const RingView2D& clip, EnumBoolOp eOp, GDouble dScale, MultiPolygon2D& result);
+}}
+
+#endif // !X2D_BOOL_H
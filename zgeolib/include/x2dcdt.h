@@ -0,0 +1,199 @@
+////////////////////////////////////////////////////////////////////////////////////
+/*!*********************************************************************************
+* @Copyright (C) 2021-2023 thuong.nv <thuong.nv.mta@gmail.com>
+*            All rights reserved.
+************************************************************************************
+* @file     x2dcdt.h
+* @create   Oct 17, 2026
+* @brief    Geometry2D constrained Delaunay triangulation and Voronoi diagram
+* @note     For conditions of distribution and use, see copyright notice in readme.txt
+************************************************************************************/
+
+#ifndef X2D_CDT_H
+#define X2D_CDT_H
+
+#include "x2dbase.h"
+#include "x2dmpoly.h"
+#include "x2dpool.h"
+#include <cstdint>
+#include <cstddef>
+
+namespace geo { namespace v2
+{
+	/**********************************************************************************
+	* ⮟⮟ Class name: DelaunayMesh2D
+	* Delaunay triangulation by sweep hull (points sorted by distance from a seed
+	* circle, each point is connected to the visible hull edges then edges are flipped).
+	* Half-edge e goes from vertex m_vecTri[e] to m_vecTri[next(e)] (next : same
+	* triangle, e / 3), m_vecHalfEdge[e] is the opposite half-edge (DELAUNAY_NONE :
+	* hull edge). Triangles are counterclockwise (CCW).
+	* Constraints (polygon edges) are inserted by flipping crossed edges (Sloan), then
+	* Delaunay is restored on the other edges. Predicates are exact (x2dpred)
+	* @refer : https://github.com/mapbox/delaunator
+	***********************************************************************************/
+	class Dllexport DelaunayMesh2D
+	{
+	public:
+		static const uint32_t DELAUNAY_NONE = 0xFFFFFFFF;
+
+	protected:
+		VecPoint2D				m_vecPoint;			// input points (copied)
+		std::vector<uint32_t>	m_vecTri;			// 3 vertices per triangle (CCW)
+		std::vector<uint32_t>	m_vecHalfEdge;		// opposite half-edge (DELAUNAY_NONE : hull)
+		std::vector<uint8_t>	m_vecConstrained;	// 1 : half-edge is a constraint
+		std::vector<uint8_t>	m_vecInside;		// 1 : triangle inside constraint rings
+		std::vector<uint32_t>	m_vecVertEdge;		// one half-edge starting at vertex
+		std::vector<uint32_t>	m_vecAlias;			// vertex used for point (duplicate : first point)
+
+		std::vector<uint32_t>	m_vecHullNext;		// hull (CCW), m_vecHullNext[v] == v : not on hull
+		std::vector<uint32_t>	m_vecHullPrev;
+		std::vector<uint32_t>	m_vecHullTri;		// hull half-edge starting at vertex
+		uint32_t				m_nHullStart;
+
+		std::vector<uint32_t>	m_vecEdgeStack;		// legalize stack
+
+	public:
+		DelaunayMesh2D();
+
+	public:
+		/*******************************************************************************
+		*! @brief  : Delaunay triangulation of points
+		*! @param  : [in] pts  : points (copied)
+		*! @param  : [in] nCnt : number of point
+		*! @return : TRUE : success | FALSE : less than 3 points or all points collinear
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		*! @note   : O(n log n). Duplicate points use the vertex of the first one
+		*!           (see vertex_of). All triangles are inside (no constraint)
+		********************************************************************************/
+		GBool build(const Point2D* pts, size_t nCnt);
+		GBool build(const VecPoint2D& vecPoints);
+
+		/*******************************************************************************
+		*! @brief  : Constrained Delaunay triangulation of multipolygon
+		*! @param  : [in] mpoly : multipolygon (vertex i : mpoly.points()[i])
+		*! @return : TRUE : success | FALSE : triangulation failed or some ring edges
+		*!           cross each other (those constraints are skipped)
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		*! @note   : All ring edges are constraints. Inside : even-odd rule over all
+		*!           rings (same as boolean_polygon), see is_inside
+		********************************************************************************/
+		GBool build(const MultiPolygon2D& mpoly);
+
+		/*******************************************************************************
+		*! @brief  : Insert constraint edge (vertex a -> vertex b)
+		*! @param  : [in] a, b : point index
+		*! @return : TRUE : edge is in mesh | FALSE : edge crosses another constraint
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		*! @note   : Vertices on the segment split it. Inside flags are not updated
+		*!           (call mark_inside after the last constraint)
+		********************************************************************************/
+		GBool insert_constraint(uint32_t a, uint32_t b);
+
+		/*******************************************************************************
+		*! @brief  : Classify triangles by constraints (even-odd from outside of hull)
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		void mark_inside();
+
+		/*******************************************************************************
+		*! @brief  : Remove all triangles
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		void clear();
+
+		/*******************************************************************************
+		*! @brief  : Triangle list
+		*! @param  : [out] vecIndex    : 3 point indices per triangle (appended)
+		*! @param  : [in ] bInsideOnly : TRUE : only triangles inside constraint rings
+		*! @return : number of triangle
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		GInt get_triangles(std::vector<uint32_t>& vecIndex, GBool bInsideOnly = GTrue) const;
+
+		/*******************************************************************************
+		*! @brief  : Hull vertices (counterclockwise)
+		*! @param  : [out] vecHull : vertex list (replaced)
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		void get_hull(std::vector<uint32_t>& vecHull) const;
+
+		/*******************************************************************************
+		*! @brief  : Circumcenter of triangle (Voronoi vertex)
+		*! @param  : [in] t : triangle index
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		Point2D circumcenter(uint32_t t) const;
+
+	public:
+		GBool			empty() const			{ return m_vecTri.empty(); }
+		size_t			point_count() const		{ return m_vecPoint.size(); }
+		size_t			triangle_count() const	{ return m_vecTri.size() / 3; }
+		const Point2D&	point(uint32_t v) const { return m_vecPoint[v]; }
+		uint32_t		vertex_of(uint32_t v) const { return m_vecAlias[v]; }
+		uint32_t		vertex_edge(uint32_t v) const { return m_vecVertEdge[v]; }
+		uint32_t		hull_edge(uint32_t v) const { return (m_vecHullNext[v] != v) ? m_vecHullTri[v] : DELAUNAY_NONE; }
+		GBool			is_constrained(uint32_t e) const { return m_vecConstrained[e] != 0; }
+		GBool			is_inside(uint32_t t) const { return m_vecInside[t] != 0; }
+
+		const VecPoint2D&				points() const		{ return m_vecPoint; }
+		const std::vector<uint32_t>&	triangles() const	{ return m_vecTri; }
+		const std::vector<uint32_t>&	halfedges() const	{ return m_vecHalfEdge; }
+
+		static uint32_t next_edge(uint32_t e) { return (e % 3 == 2) ? e - 2 : e + 1; }
+		static uint32_t prev_edge(uint32_t e) { return (e % 3 == 0) ? e + 2 : e - 1; }
+
+	protected:
+		GBool		triangulate();
+		GBool		insert_inside(uint32_t i, uint32_t nStartTri);
+		uint32_t	legalize(uint32_t a);
+		void		flip_edge(uint32_t a);
+		uint32_t	add_triangle(uint32_t i0, uint32_t i1, uint32_t i2, uint32_t a, uint32_t b, uint32_t c);
+		void		set_triangle(uint32_t t, uint32_t i0, uint32_t i1, uint32_t i2, uint32_t a, uint32_t b, uint32_t c);
+		void		link(uint32_t a, uint32_t b);
+		void		fix_hull_edge(uint32_t nOld, uint32_t nNew);
+		void		restore_delaunay(std::vector<uint32_t>& vecEdge);
+		GBool		find_crossing(uint32_t a, uint32_t b, std::vector<uint32_t>& vecCross, uint32_t& nStop) const;
+	};
+
+	/*******************************************************************************
+	*! @brief  : Delaunay triangulation of points
+	*! @param  : [in ] vecPoints : points
+	*! @param  : [out] vecIndex  : triangle list (3 indices into vecPoints per triangle)
+	*! @return : number of triangle
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Triangles are counterclockwise (CCW)
+	********************************************************************************/
+	Dllexport GInt triangulate_delaunay(const VecPoint2D& vecPoints, std::vector<uint32_t>& vecIndex);
+	Dllexport GInt triangulate_delaunay(const RingView2D& vecPoints, std::vector<uint32_t>& vecIndex);
+
+	/*******************************************************************************
+	*! @brief  : Constrained Delaunay triangulation of all polygons of multipolygon
+	*! @param  : [in ] mpoly    : multipolygon
+	*! @param  : [out] vecIndex : triangle list (3 indices into mpoly.points() per triangle)
+	*! @param  : [in ] pool     : thread pool (one task per polygon)
+	*! @param  : [in ] nThread  : max number of worker (<= 0 : all)
+	*! @return : number of triangle
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Same input and output as triangulate_polygon (ear clipping) without
+	*!           sliver triangles. Each polygon (outer + holes) is triangulated alone,
+	*!           pool result is the same as the serial one (polygon order)
+	********************************************************************************/
+	Dllexport GInt triangulate_cdt(const MultiPolygon2D& mpoly, std::vector<uint32_t>& vecIndex);
+	Dllexport GInt triangulate_cdt(const MultiPolygon2D& mpoly, std::vector<uint32_t>& vecIndex,
+								   GeoThreadPool& pool, GInt nThread = 0);
+
+	/*******************************************************************************
+	*! @brief  : Voronoi cells of mesh points clipped by rectangle
+	*! @param  : [in ] mesh  : Delaunay triangulation (constraints are not used)
+	*! @param  : [in ] rect  : clip rectangle
+	*! @param  : [out] cells : polygon i : cell of point i (replaced, CCW, no ring if
+	*!                         empty or duplicate point)
+	*! @return : number of non empty cell
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Cell vertices are circumcenters of triangles around the point. Cells
+	*!           of hull points are open, they are closed outside rect before clip
+	********************************************************************************/
+	Dllexport GInt get_voronoi_cells(const DelaunayMesh2D& mesh, const Rect2D& rect, MultiPolygon2D& cells);
+}}
+
+#endif // !X2D_CDT_H
@@ -0,0 +1,107 @@
+////////////////////////////////////////////////////////////////////////////////////
+/*!*********************************************************************************
+* @Copyright (C) 2021-2023 thuong.nv <thuong.nv.mta@gmail.com>
+*            All rights reserved.
+************************************************************************************
+* @file     x2dclip.h
+* @create   Oct 17, 2026
+* @brief    Geometry2D clipping by axis-aligned rectangle (viewport culling)
+* @note     For conditions of distribution and use, see copyright notice in readme.txt
+************************************************************************************/
+
+#ifndef X2D_CLIP_H
+#define X2D_CLIP_H
+
+#include "x2dbase.h"
+#include "x2dmpoly.h"
+#include <cstdint>
+
+namespace geo { namespace v2
+{
+	/////////////////////////////////////////////////////////////////////////////////
+	// Cohen-Sutherland outcode of point (rect : [x, x + width] x [y, y + height])
+
+	#define GEO_OUT_LEFT		0x01
+	#define GEO_OUT_RIGHT		0x02
+	#define GEO_OUT_BOTTOM		0x04
+	#define GEO_OUT_TOP			0x08
+
+	enum EnumRectClip
+	{
+		RECT_OUTSIDE,	// all points outside on one side (trivial reject)
+		RECT_INSIDE,	// all points inside (trivial accept)
+		RECT_CROSS,		// need clipping
+	};
+
+	/*******************************************************************************
+	*! @brief  : Outcode of all points of ring
+	*! @param  : [in ] poly     : ring points
+	*! @param  : [in ] rect     : rectangle
+	*! @param  : [out] pAndCode : AND of outcodes (!= 0 : all outside on one side)
+	*! @return : OR of outcodes (0 : all inside)
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Classify GEO_SIMD_WIDTH / 2 points per iteration (AVX : 4 | SSE : 2)
+	********************************************************************************/
+	Dllexport GInt get_outcode_rect(const RingView2D& poly, const Rect2D& rect, GInt* pAndCode = NULL);
+
+	/*******************************************************************************
+	*! @brief  : Classify ring with rectangle (trivial accept / reject)
+	*! @param  : [in] poly : ring points
+	*! @param  : [in] rect : rectangle
+	*! @return : EnumRectClip
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : RECT_CROSS is conservative (ring may be outside near a corner)
+	********************************************************************************/
+	Dllexport EnumRectClip classify_polygon_rect(const RingView2D& poly, const Rect2D& rect);
+
+	/*******************************************************************************
+	*! @brief  : Clipping polygon by rectangle (caller buffers)
+	*! @param  : [in ] poly    : polygon (any orientation, orientation is kept)
+	*! @param  : [in ] rect    : clip rectangle
+	*! @param  : [out] vecOut  : clip polygon (replaced, empty if outside)
+	*! @param  : [in ] vecWork : work buffer
+	*! @return : number of point of clip polygon
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Sutherland-Hodgman only on the rectangle sides crossed by the
+	*!           polygon (outcode). Intersection is computed from the lower point of
+	*!           edge, polygons sharing an edge get the same clip point
+	********************************************************************************/
+	Dllexport GInt clip_polygon_rect(const RingView2D& poly, const Rect2D& rect, VecPoint2D& vecOut, VecPoint2D& vecWork);
+
+	/*******************************************************************************
+	*! @brief  : Clipping polygon by rectangle
+	*! @param  : [in] poly : polygon
+	*! @param  : [in] rect : clip rectangle
+	*! @return : clip polygon (empty if outside)
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	********************************************************************************/
+	Dllexport VecPoint2D clip_polygon_rect(const VecPoint2D& poly, const Rect2D& rect);
+
+	/*******************************************************************************
+	*! @brief  : Clipping all polygons of multipolygon by rectangle (batch)
+	*! @param  : [in ] mpoly     : multipolygon
+	*! @param  : [in ] rect      : clip rectangle
+	*! @param  : [out] result    : clip multipolygon (appended)
+	*! @param  : [out] pVecIndex : index of source polygon for each result polygon
+	*!                             (appended, NULL : not used)
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Outer ring decides for the whole polygon : outside -> skipped,
+	*!           inside -> copied. Polygon whose outer ring is clipped away is removed
+	********************************************************************************/
+	Dllexport void clip_polygon_rect(const MultiPolygon2D& mpoly, const Rect2D& rect, MultiPolygon2D& result,
+									 std::vector<uint32_t>* pVecIndex = NULL);
+
+	/*******************************************************************************
+	*! @brief  : Clipping polygon list by rectangle (batch, one polygon per ring)
+	*! @param  : [in ] polys     : polygon list
+	*! @param  : [in ] rect      : clip rectangle
+	*! @param  : [out] result    : clip multipolygon (appended)
+	*! @param  : [out] pVecIndex : index of source polygon for each result polygon
+	*!                             (appended, NULL : not used)
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	********************************************************************************/
+	Dllexport void clip_polygon_rect(const VecPolyList& polys, const Rect2D& rect, MultiPolygon2D& result,
+									 std::vector<uint32_t>* pVecIndex = NULL);
+}}
+
+#endif // !X2D_CLIP_H
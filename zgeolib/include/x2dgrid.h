@@ -0,0 +1,108 @@
+////////////////////////////////////////////////////////////////////////////////////
+/*!*********************************************************************************
+* @Copyright (C) 2021-2023 thuong.nv <thuong.nv.mta@gmail.com>
+*            All rights reserved.
+************************************************************************************
+* @file     x2dgrid.h
+* @create   Oct 17, 2026
+* @brief    Geometry2D uniform grid polygon index (point location for huge polygon)
+* @note     For conditions of distribution and use, see copyright notice in readme.txt
+************************************************************************************/
+
+#ifndef X2D_GRID_H
+#define X2D_GRID_H
+
+#include "x2dbase.h"
+#include "x2dmpoly.h"
+#include <cstdint>
+#include <cstddef>
+
+namespace geo { namespace v2
+{
+	/**********************************************************************************
+	* ⮟⮟ Class name: GridPolygon
+	* Polygon edges bucketed into a uniform grid over the bounding box. Each cell keeps
+	* its edges and the inside state of the cell center, so a point query only counts
+	* crossings between the point and the cell center with the edges of one cell
+	***********************************************************************************/
+	class Dllexport GridPolygon
+	{
+	protected:
+		VecPoint2D				m_vecPoly;		// copy of polygon (edge i : point i -> i + 1)
+		std::vector<uint32_t>	m_vecCellStart;	// cell offsets into m_vecCellEdge (cell count + 1)
+		std::vector<uint32_t>	m_vecCellEdge;	// edge index list of all cells
+		std::vector<uint8_t>	m_vecCellState;	// bit 0 : cell center is inside polygon
+												// bit 1 : cell center is on an edge (full test)
+
+		GDouble		m_dMinX;					// bounding box min
+		GDouble		m_dMinY;
+		GDouble		m_dMaxX;					// bounding box max
+		GDouble		m_dMaxY;
+		GDouble		m_dCellW;					// cell size
+		GDouble		m_dCellH;
+		uint32_t	m_nCellX;					// number of column
+		uint32_t	m_nCellY;					// number of row
+
+	public:
+		GridPolygon();
+		explicit GridPolygon(const VecPoint2D& poly, uint32_t nCellX = 0, uint32_t nCellY = 0);
+		explicit GridPolygon(const RingView2D& poly, uint32_t nCellX = 0, uint32_t nCellY = 0);
+
+	public:
+		/*******************************************************************************
+		*! @brief  : Build grid from polygon (can be called again to rebuild)
+		*! @param  : [in] poly   : polygon (CW or CCW)
+		*! @param  : [in] nCellX : number of column (0 : auto from vertex count)
+		*! @param  : [in] nCellY : number of row    (0 : auto from vertex count)
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		*! @note   : Auto resolution : about 2 cells per vertex, square cells
+		********************************************************************************/
+		void build(const VecPoint2D& poly, uint32_t nCellX = 0, uint32_t nCellY = 0);
+		void build(const RingView2D& poly, uint32_t nCellX = 0, uint32_t nCellY = 0);
+
+		/*******************************************************************************
+		*! @brief  : Release grid data
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		void clear();
+
+		/*******************************************************************************
+		*! @brief  : Check point inside polygon
+		*! @param  : [in] pt : point check
+		*! @return : TRUE : inside | FALSE : outside
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		*! @note   : Crossing rule of is_point_in_polygon with exact sign (orient2d).
+		*!           Points on the boundary are inside
+		********************************************************************************/
+		GBool contains(const Point2D& pt) const;
+
+		/*******************************************************************************
+		*! @brief  : Check list point inside polygon
+		*! @param  : [in ] pts : point list
+		*! @param  : [in ] n   : number of point
+		*! @param  : [out] out : 1 : inside | 0 : outside (size >= n)
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		void contains(const Point2D* pts, size_t n, uint8_t* out) const;
+
+	public:
+		GBool	 empty() const		{ return m_vecCellState.empty(); }
+		uint32_t cell_count_x() const { return m_nCellX; }
+		uint32_t cell_count_y() const { return m_nCellY; }
+
+		/*******************************************************************************
+		*! @brief  : Number of edge stored in cell (col, row)
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		size_t	 cell_edge_count(uint32_t col, uint32_t row) const;
+
+		void	 get_bounding_box(Point2D& ptMin, Point2D& ptMax) const;
+
+	protected:
+		void	 bucket_edges();
+		void	 compute_cell_state();
+		GBool	 contains_full(GDouble px, GDouble py) const;
+	};
+}}
+
+#endif // !X2D_GRID_H
@@ -13,6 +13,7 @@
 #define X2D_INT_H
 
 #include "x2dbase.h"
+#include "x2dmpoly.h"
 
 namespace geo { namespace v2
 {
@@ -83,6 +84,7 @@ namespace geo { namespace v2
 	@return		INT : intersection number.
 	*********************************************************************************/
 	Dllexport GInt  intersect_line_polygon(const Point2D& ptLine1, const Point2D& ptLine2, const VecPoint2D& poly, VecPoint2D* vecInter = NULL, GBool bOnlyCheck = GFalse);
+	Dllexport GInt  intersect_line_polygon(const Point2D& ptLine1, const Point2D& ptLine2, const RingView2D& poly, VecPoint2D* vecInter = NULL, GBool bOnlyCheck = GFalse);
 
 	/********************************************************************************
 	@brief		Get intersection points between line and rect (line = two point)
@@ -91,6 +93,7 @@ namespace geo { namespace v2
 	@param		[in]  rect    : rectangle
 	@param		[out] vecInter: point list of intersections
 	@return		INT : intersection number.
+	@note		No heap allocation (vecInter is filled by push_back)
 	*********************************************************************************/
 	Dllexport GInt  intersect_line_rectangle(const Point2D& ptLine1, const Point2D& ptLine2, const Rect2D& rect, VecPoint2D* vecInter = NULL, GBool bOnlyCheck = GFalse);
 
@@ -104,6 +107,7 @@ namespace geo { namespace v2
 	@return		INT : intersection number.
 	********************************************************************************/
 	Dllexport GInt intersect_lsegment_polygon(const Point2D& pt1, const Point2D& pt2, const VecPoint2D& poly, VecPoint2D* vecInter = NULL, GBool bOnlyCheck = GFalse);
+	Dllexport GInt intersect_lsegment_polygon(const Point2D& pt1, const Point2D& pt2, const RingView2D& poly, VecPoint2D* vecInter = NULL, GBool bOnlyCheck = GFalse);
 }}
 
 #endif // !X2D_INT_H
\ No newline at end of file
@@ -0,0 +1,164 @@
+////////////////////////////////////////////////////////////////////////////////////
+/*!*********************************************************************************
+* @Copyright (C) 2021-2023 thuong.nv <thuong.nv.mta@gmail.com>
+*            All rights reserved.
+************************************************************************************
+* @file     x2dkdtree.h
+* @create   Oct 17, 2026
+* @brief    Geometry2D implicit KD-tree over points (nearest, radius, k-nearest)
+* @note     For conditions of distribution and use, see copyright notice in readme.txt
+************************************************************************************/
+
+#ifndef X2D_KDTREE_H
+#define X2D_KDTREE_H
+
+#include "x2dbase.h"
+#include "x2dmpoly.h"
+#include "x2dpool.h"
+#include <cstdint>
+#include <cstddef>
+#include <cfloat>
+
+namespace geo { namespace v2
+{
+	typedef struct tagKdHit
+	{
+		uint32_t	m_nIndex;	// index of point in input of build (KDTREE_NONE : not found)
+		GFloat		m_fDist;	// distance to query point
+
+	} KdHit;
+
+	typedef std::vector<KdHit> VecKdHit;
+
+	/**********************************************************************************
+	* ⮟⮟ Class name: KdTree2D
+	* KD-tree without node : points are reordered so that the median of range [lo, hi)
+	* is at lo + (hi - lo) / 2, left subtree is [lo, mid), right subtree is (mid, hi).
+	* Split axis (longer side of range) is stored for each slot. Points of a subtree
+	* are contiguous in memory, small ranges are scanned linearly.
+	* Equal distance : lower index is returned (result does not depend on build)
+	***********************************************************************************/
+	class Dllexport KdTree2D
+	{
+	public:
+		static const uint32_t KDTREE_NONE	= 0xFFFFFFFF;
+		static const uint32_t KDTREE_LEAF	= 8;	// range scanned linearly
+
+	protected:
+		VecPoint2D				m_vecPoint;		// points in tree order
+		std::vector<uint32_t>	m_vecIndex;		// input index of each slot
+		std::vector<uint8_t>	m_vecAxis;		// split axis of node at slot (0 : x | 1 : y)
+
+	public:
+		KdTree2D();
+
+	public:
+		/*******************************************************************************
+		*! @brief  : Build tree (can be called again to rebuild)
+		*! @param  : [in] pts     : points (copied)
+		*! @param  : [in] nCnt    : number of point
+		*! @param  : [in] pool    : thread pool, subtrees below the top levels are built
+		*!                          in parallel
+		*! @param  : [in] nThread : max number of worker (<= 0 : all)
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		*! @note   : O(n log n), median by nth_element. Same tree for any thread count
+		********************************************************************************/
+		void build(const Point2D* pts, size_t nCnt);
+		void build(const VecPoint2D& vecPoints);
+		void build(const VecPoint2D& vecPoints, GeoThreadPool& pool, GInt nThread = 0);
+
+		/*******************************************************************************
+		*! @brief  : Remove all points
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		void clear();
+
+		/*******************************************************************************
+		*! @brief  : Nearest point
+		*! @param  : [in ] pt       : query point
+		*! @param  : [in ] fMaxDist : search radius (points farther are ignored)
+		*! @param  : [out] result   : nearest point (not changed if not found)
+		*! @return : TRUE : found | FALSE : no point within fMaxDist
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		GBool query_nearest(const Point2D& pt, GFloat fMaxDist, KdHit& result) const;
+
+		/*******************************************************************************
+		*! @brief  : All points within radius
+		*! @param  : [in ] pt        : query point
+		*! @param  : [in ] fRadius   : radius (point at distance == fRadius is included)
+		*! @param  : [out] vecResult : points (appended, order not defined)
+		*! @return : number of point found
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		size_t query_radius(const Point2D& pt, GFloat fRadius, VecKdHit& vecResult) const;
+
+		/*******************************************************************************
+		*! @brief  : k nearest points
+		*! @param  : [in ] pt        : query point
+		*! @param  : [in ] nK        : number of point
+		*! @param  : [out] vecResult : min(nK, size()) points (replaced, nearest first)
+		*! @param  : [in ] fMaxDist  : search radius (points farther are ignored)
+		*! @return : number of point found
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		size_t query_knn(const Point2D& pt, size_t nK, VecKdHit& vecResult, GFloat fMaxDist = FLT_MAX) const;
+
+		/*******************************************************************************
+		*! @brief  : Nearest point of each query point
+		*! @param  : [in ] vecQuery  : query points
+		*! @param  : [in ] fMaxDist  : search radius
+		*! @param  : [out] vecResult : result of query i in slot i (replaced,
+		*!                             m_nIndex = KDTREE_NONE : not found)
+		*! @param  : [in ] pool      : thread pool
+		*! @param  : [in ] nThread   : max number of worker (<= 0 : all)
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		void query_nearest(const VecPoint2D& vecQuery, GFloat fMaxDist, VecKdHit& vecResult) const;
+		void query_nearest(const VecPoint2D& vecQuery, GFloat fMaxDist, VecKdHit& vecResult,
+						   GeoThreadPool& pool, GInt nThread = 0) const;
+
+		/*******************************************************************************
+		*! @brief  : k nearest points of each query point
+		*! @param  : [in ] vecQuery  : query points
+		*! @param  : [in ] nK        : number of point
+		*! @param  : [out] vecResult : results of query i in [i * nK, (i + 1) * nK) (replaced,
+		*!                             nearest first, m_nIndex = KDTREE_NONE : not found)
+		*! @param  : [in ] pool      : thread pool
+		*! @param  : [in ] nThread   : max number of worker (<= 0 : all)
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		void query_knn(const VecPoint2D& vecQuery, size_t nK, VecKdHit& vecResult) const;
+		void query_knn(const VecPoint2D& vecQuery, size_t nK, VecKdHit& vecResult,
+					   GeoThreadPool& pool, GInt nThread = 0) const;
+
+	public:
+		GBool			empty() const	{ return m_vecPoint.empty(); }
+		size_t			size() const	{ return m_vecPoint.size(); }
+
+		const VecPoint2D&				points() const	{ return m_vecPoint; }	// tree order
+		const std::vector<uint32_t>&	indices() const	{ return m_vecIndex; }	// tree order
+
+	protected:
+		typedef std::pair<GDouble, uint32_t> KnnItem;	// squared distance, input index
+
+		size_t knn_search(const Point2D& pt, size_t nK, GFloat fMaxDist, std::vector<KnnItem>& vecHeap) const;
+	};
+
+	/*******************************************************************************
+	*! @brief  : Merge points closer than tolerance (weld vertices)
+	*! @param  : [in ] vecPoints : points
+	*! @param  : [in ] fTol      : points within fTol of a kept point are merged to it
+	*! @param  : [out] vecOut    : kept points (replaced, input order)
+	*! @param  : [out] pMap      : index in vecOut of each input point (NULL : not used)
+	*! @return : number of removed point
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Greedy in input order, O(n log n) with KdTree2D (not O(n^2))
+	********************************************************************************/
+	Dllexport size_t remove_duplicate_points(const VecPoint2D& vecPoints, GFloat fTol, VecPoint2D& vecOut,
+											 std::vector<uint32_t>* pMap = NULL);
+	Dllexport size_t remove_duplicate_points(const RingView2D& vecPoints, GFloat fTol, VecPoint2D& vecOut,
+											 std::vector<uint32_t>* pMap = NULL);
+}}
+
+#endif // !X2D_KDTREE_H
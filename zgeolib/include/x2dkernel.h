@@ -0,0 +1,391 @@
+////////////////////////////////////////////////////////////////////////////////////
+/*!*********************************************************************************
+* @Copyright (C) 2021-2023 thuong.nv <thuong.nv.mta@gmail.com>
+*            All rights reserved.
+************************************************************************************
+* @file     x2dkernel.h
+* @create   Oct 17, 2026
+* @brief    Geometry2D kernels templated on point type (float, double, fixed int64)
+* @note     For conditions of distribution and use, see copyright notice in readme.txt
+************************************************************************************/
+
+#ifndef X2D_KERNEL_H
+#define X2D_KERNEL_H
+
+#include "x2dbase.h"
+#include "x2dpred.h"
+#include <cstdint>
+#include <cstddef>
+#include <cfloat>
+
+namespace geo { namespace v2
+{
+	/////////////////////////////////////////////////////////////////////////////////
+	// Fixed point : coordinate = round(value * scale) stored in int64.
+	// Predicates are exact while coordinates are in [-GFIXED_COORD_MAX, GFIXED_COORD_MAX]
+	// (difference <= 2^31 - 2, product < 2^62, cross product < 2^63). Sums over a
+	// ring (area, orientation) are accumulated in 128 bits : exact for any ring size
+
+	typedef int64_t GFixed;
+
+	#define GFIXED_COORD_MAX	((int64_t(1) << 30) - 1)
+
+	typedef tagVec<2, GDouble>		Point2Dd;		// double precision point
+	typedef tagVec<2, GFixed>		Point2Dx;		// fixed point (int64) point
+	typedef std::vector<Point2Dd>	VecPoint2Dd;
+	typedef std::vector<Point2Dx>	VecPoint2Dx;
+
+	/**********************************************************************************
+	* ⮟⮟ Struct name: ScalarTraits
+	* calc_type : type of cross product of legacy formulas (float stays float)
+	* wide_type : type of robust products (hull, intersection)
+	* real_type : type of length, projection and tolerance (fixed point : double)
+	* exact     : no tolerance, comparisons are exact
+	***********************************************************************************/
+	template<typename T> struct ScalarTraits;
+
+	template<> struct ScalarTraits<GFloat>
+	{
+		typedef GFloat	calc_type;
+		typedef GDouble	wide_type;
+		typedef GFloat	real_type;
+
+		static const bool exact = false;
+		static GFloat epsilon() { return MATH_EPSILON; }
+	};
+
+	template<> struct ScalarTraits<GDouble>
+	{
+		typedef GDouble	calc_type;
+		typedef GDouble	wide_type;
+		typedef GDouble	real_type;
+
+		static const bool exact = false;
+		// MATH_EPSILON scaled from float to double precision (0.001 * 2^-29 ~ 1.9e-12)
+		static GDouble epsilon() { return GDouble(MATH_EPSILON) * (DBL_EPSILON / FLT_EPSILON); }
+	};
+
+	template<> struct ScalarTraits<GFixed>
+	{
+		typedef GFixed	calc_type;
+		typedef GFixed	wide_type;
+		typedef GDouble	real_type;
+
+		static const bool exact = true;
+		static GFixed epsilon() { return 0; }
+	};
+
+	/*******************************************************************************
+	*! @brief  : Convert point list to fixed point
+	*! @param  : [in ] pts    : point list
+	*! @param  : [in ] nCnt   : number of point
+	*! @param  : [in ] dScale : fixed unit per world unit (ex : 1000 -> 0.001)
+	*! @param  : [out] out    : fixed point list (size >= nCnt)
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Round to nearest (snap rounding to grid 1 / dScale)
+	********************************************************************************/
+	Dllexport void to_fixed(const Point2D* pts, size_t nCnt, GDouble dScale, Point2Dx* out);
+
+	/*******************************************************************************
+	*! @brief  : Convert fixed point list to point
+	*! @param  : [in ] pts    : fixed point list
+	*! @param  : [in ] nCnt   : number of point
+	*! @param  : [in ] dScale : fixed unit per world unit (same as to_fixed)
+	*! @param  : [out] out    : point list (size >= nCnt)
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	********************************************************************************/
+	Dllexport void from_fixed(const Point2Dx* pts, size_t nCnt, GDouble dScale, Point2D* out);
+
+namespace kernel
+{
+	/*******************************************************************************
+	*! @brief  : Cross product of (a - o) and (b - o) in calc_type
+	*! @return : > 0 : b on the left of oa | < 0 : right | 0 : collinear
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	********************************************************************************/
+	template<typename P>
+	inline typename ScalarTraits<typename P::value_type>::calc_type cross(const P& o, const P& a, const P& b)
+	{
+		typedef typename ScalarTraits<typename P::value_type>::calc_type C;
+
+		return (C(a.x) - C(o.x)) * (C(b.y) - C(o.y)) - (C(b.x) - C(o.x)) * (C(a.y) - C(o.y));
+	}
+
+	/*******************************************************************************
+	*! @brief  : Cross product of (a - o) and (b - o) in wide_type
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	********************************************************************************/
+	template<typename P>
+	inline typename ScalarTraits<typename P::value_type>::wide_type cross_wide(const P& o, const P& a, const P& b)
+	{
+		typedef typename ScalarTraits<typename P::value_type>::wide_type W;
+
+		return (W(a.x) - W(o.x)) * (W(b.y) - W(o.y)) - (W(a.y) - W(o.y)) * (W(b.x) - W(o.x));
+	}
+
+	/*******************************************************************************
+	*! @brief  : Orientation of point c to vector p1p2 (tolerance of ScalarTraits)
+	*! @return : EnumOrien (same rule as get_orientation_point_vector)
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Float, double : exact sign when predicate is PRED_EXACT (set_predicate)
+	********************************************************************************/
+	template<typename P>
+	inline EnumOrien orientation(const P& p1, const P& p2, const P& c)
+	{
+		typedef typename P::value_type T;
+		typedef typename ScalarTraits<T>::calc_type C;
+
+		if (!ScalarTraits<T>::exact && get_predicate() == PRED_EXACT)
+		{
+			const GDouble dOrin = orient2d(GDouble(p1.x), GDouble(p1.y), GDouble(p2.x), GDouble(p2.y),
+										   GDouble(c.x), GDouble(c.y));
+
+			if (dOrin == 0.0) return EnumOrien::COLLINEAR;
+			else if (dOrin < 0.0) return EnumOrien::RIGHT;
+			else return EnumOrien::LEFT;
+		}
+
+		const C cOrin = cross(p1, p2, c);
+		const C cEps  = ScalarTraits<T>::epsilon();
+
+		if ((cOrin < 0 ? -cOrin : cOrin) <= cEps) return EnumOrien::COLLINEAR;
+		else if (cOrin < 0) return EnumOrien::RIGHT;
+		else return EnumOrien::LEFT;
+	}
+
+	/*******************************************************************************
+	*! @brief  : Check polygon is counterclockwise
+	*! @param  : [in] poly : ring points
+	*! @param  : [in] nCnt : number of point
+	*! @return : TRUE : is CCW | FALSE : CW
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Fixed point : exact (128-bit sum)
+	********************************************************************************/
+	template<typename P> Dllexport GBool is_ccw(const P* poly, size_t nCnt);
+
+	/*******************************************************************************
+	*! @brief  : Check polygon is convex
+	*! @param  : [in] poly : ring points
+	*! @param  : [in] nCnt : number of point
+	*! @return : TRUE : is convex | FALSE : no convex
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	********************************************************************************/
+	template<typename P> Dllexport GBool is_convex_polygon(const P* poly, size_t nCnt);
+
+	/*******************************************************************************
+	*! @brief  : Check two point is the same
+	*! @param  : [in] p1, p2 : point
+	*! @param  : [in] tTol   : tolerance of each coordinate
+	*! @return : TRUE : same | FALSE : not same
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	********************************************************************************/
+	template<typename P> Dllexport GBool is_same(const P& p1, const P& p2,
+												 typename ScalarTraits<typename P::value_type>::real_type tTol);
+
+	/*******************************************************************************
+	*! @brief  : Check two vector is the same direction (parallel, same sign)
+	*! @param  : [in] v1, v2 : vector (not normal)
+	*! @param  : [in] tTol   : tolerance of cross product of unit vectors
+	*! @return : TRUE : same | FALSE : not same
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	********************************************************************************/
+	template<typename P> Dllexport GBool is_same_direction(const P& v1, const P& v2,
+														   typename ScalarTraits<typename P::value_type>::real_type tTol);
+
+	/*******************************************************************************
+	*! @brief  : Check two vector have the same sign on x and y
+	*! @param  : [in] v1, v2 : vector
+	*! @return : TRUE : same sign | FALSE : not same
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	********************************************************************************/
+	template<typename P> Dllexport GBool is_same_sign(const P& v1, const P& v2);
+
+	/*******************************************************************************
+	*! @brief  : Relation of point and line segment
+	*! @param  : [in] pt1, pt2 : line segment
+	*! @param  : [in] pt       : point check
+	*! @return : 0 : not in line segment | 1 : in line segment | 2 : same pt1 or pt2
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Fixed point or PRED_EXACT : exact sign (orient2d)
+	********************************************************************************/
+	template<typename P> Dllexport GInt rel_point_lsegment(const P& pt1, const P& pt2, const P& pt);
+
+	/*******************************************************************************
+	*! @brief  : Check point on line segment / on line (line = 2 point)
+	*! @param  : [in] pt1, pt2 : line segment or line
+	*! @param  : [in] pt       : point check
+	*! @return : TRUE : inside | FALSE : outside
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Fixed point or PRED_EXACT : exact sign (orient2d)
+	********************************************************************************/
+	template<typename P> Dllexport GBool is_point_in_lsegment(const P& pt1, const P& pt2, const P& pt);
+	template<typename P> Dllexport GBool is_point_in_line(const P& pt1, const P& pt2, const P& pt);
+
+	/*******************************************************************************
+	*! @brief  : Check distance of point to line segment / line is not over snap
+	*! @param  : [in] pt1, pt2 : line segment or line
+	*! @param  : [in] pt       : point check
+	*! @param  : [in] tSnap    : snap distance
+	*! @return : TRUE : snap | FALSE : not snap
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Projection is not rounded (fixed point : distance in double)
+	********************************************************************************/
+	template<typename P> Dllexport GBool is_snap_point_to_lsegment(const P& pt1, const P& pt2, const P& pt,
+																   typename ScalarTraits<typename P::value_type>::real_type tSnap);
+	template<typename P> Dllexport GBool is_snap_point_to_line(const P& pt1, const P& pt2, const P& pt,
+															   typename ScalarTraits<typename P::value_type>::real_type tSnap);
+
+	/*******************************************************************************
+	*! @brief  : Check point is in ray (ray : start point and direction)
+	*! @param  : [in] pt  : start point of ray
+	*! @param  : [in] vn  : direction of ray (float : unit vector)
+	*! @param  : [in] ptc : point check
+	*! @return : TRUE : in ray | FALSE : out ray
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	********************************************************************************/
+	template<typename P> Dllexport GBool is_point_in_ray(const P& pt, const P& vn, const P& ptc);
+
+	/*******************************************************************************
+	*! @brief  : Perpendicular projection of point onto line (line = 2 point)
+	*! @param  : [in] ptLine1, ptLine2 : line
+	*! @param  : [in] pt               : point
+	*! @return : projection (fixed point : rounded to the nearest grid point)
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	********************************************************************************/
+	template<typename P> Dllexport P get_projection_point_to_line(const P& ptLine1, const P& ptLine2, const P& pt);
+
+	/*******************************************************************************
+	*! @brief  : Perpendicular projection of point onto line segment
+	*! @param  : [in ] ptSeg1, ptSeg2 : line segment
+	*! @param  : [in ] pt             : point
+	*! @param  : [out] pptPerp        : projection, or nearest end point (can be NULL)
+	*! @param  : [in ] bCheckNearest  : get nearest end point if no projection
+	*! @return : 1 : projection | 2 : nearly ptSeg1 | 3 : nearly ptSeg2 | 0 : none
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	********************************************************************************/
+	template<typename P> Dllexport GInt get_projection_point_to_lsegment(const P& ptSeg1, const P& ptSeg2, const P& pt,
+																		 P* pptPerp, GBool bCheckNearest);
+
+	/*******************************************************************************
+	*! @brief  : Intersection of two lines (line = 2 point)
+	*! @param  : [in ] pt1, pt2 : line 1
+	*! @param  : [in ] pt3, pt4 : line 2
+	*! @param  : [out] pInter   : intersection (max value of scalar if not intersect)
+	*! @return : TRUE : Intersect | FALSE : parallel
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Fixed point or PRED_EXACT : exact parallel test, point computed in
+	*!           double (fixed point : rounded to the nearest grid point)
+	********************************************************************************/
+	template<typename P> Dllexport GBool intersect_2line(const P& pt1, const P& pt2, const P& pt3, const P& pt4, P* pInter);
+
+	/*******************************************************************************
+	*! @brief  : Checks if two line segments intersect and get intersection point
+	*! @param  : [in ] pt1, pt2 : line segment 1
+	*! @param  : [in ] pt3, pt4 : line segment 2
+	*! @param  : [out] pInter   : intersection (not changed if not intersect)
+	*! @return : TRUE : Intersect | FALSE : not intersect or parallel
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Fixed point or PRED_EXACT : exact side tests (orient2d), point is
+	*!           rounded to the nearest grid point
+	********************************************************************************/
+	template<typename P> Dllexport GBool intersect_2lsegment(const P& pt1, const P& pt2, const P& pt3, const P& pt4, P* pInter);
+
+	/*******************************************************************************
+	*! @brief  : Intersection of line (2 point) and line segment
+	*! @param  : [in ] ptLine1, ptLine2 : line
+	*! @param  : [in ] ptSeg1, ptSeg2   : line segment
+	*! @param  : [out] pInter           : intersection (not changed if not intersect)
+	*! @return : TRUE : Intersect | FALSE : not intersect
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	********************************************************************************/
+	template<typename P> Dllexport GBool intersect_line_lsegment(const P& ptLine1, const P& ptLine2,
+																 const P& ptSeg1, const P& ptSeg2, P* pInter);
+
+	/*******************************************************************************
+	*! @brief  : Intersection points of line (2 point) / line segment and polygon
+	*! @param  : [in ] pt1, pt2   : line or line segment
+	*! @param  : [in ] poly       : ring points
+	*! @param  : [in ] nCnt       : number of point
+	*! @param  : [out] vecInter   : intersection points (appended, can be NULL)
+	*! @param  : [in ] bOnlyCheck : stop at the first intersection
+	*! @return : number of intersection
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	********************************************************************************/
+	template<typename P> Dllexport GInt intersect_line_polygon(const P& pt1, const P& pt2, const P* poly, size_t nCnt,
+															   std::vector<P>* vecInter, GBool bOnlyCheck);
+	template<typename P> Dllexport GInt intersect_lsegment_polygon(const P& pt1, const P& pt2, const P* poly, size_t nCnt,
+																   std::vector<P>* vecInter, GBool bOnlyCheck);
+
+	/*******************************************************************************
+	*! @brief  : Signed area * 2 of polygon (> 0 : CCW)
+	*! @param  : [in] poly : ring points
+	*! @param  : [in] nCnt : number of point
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Sum in calc_type. Fixed point : exact, 128-bit sum, result of a
+	*!           simple ring fits int64 (|area * 2| < 2^63 in GFIXED_COORD_MAX)
+	********************************************************************************/
+	template<typename P> Dllexport typename ScalarTraits<typename P::value_type>::calc_type
+		get_area2_polygon(const P* poly, size_t nCnt);
+
+	/*******************************************************************************
+	*! @brief  : Get bounding box of point list
+	*! @param  : [in ] poly  : point list
+	*! @param  : [in ] nCnt  : number of point
+	*! @param  : [out] ptMin : min point
+	*! @param  : [out] ptMax : max point
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	********************************************************************************/
+	template<typename P> Dllexport void get_bounding_box(const P* poly, size_t nCnt, P& ptMin, P& ptMax);
+
+	/*******************************************************************************
+	*! @brief  : Check point inside polygon (crossing number)
+	*! @param  : [in] pt   : point check
+	*! @param  : [in] poly : ring points
+	*! @param  : [in] nCnt : number of point
+	*! @return : TRUE : inside | FALSE : outside
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Fixed point : crossing is compared by products (no division)
+	********************************************************************************/
+	template<typename P> Dllexport GBool is_point_in_polygon(const P& pt, const P* poly, size_t nCnt);
+
+	/*******************************************************************************
+	*! @brief  : Clipping polygon use Sutherland-Hodgman algorithm
+	*! @param  : [in ] poly    : polygon
+	*! @param  : [in ] nCnt    : number of point
+	*! @param  : [in ] clip    : convex clip polygon (CCW)
+	*! @param  : [in ] nClip   : number of point of clip
+	*! @param  : [out] vecOut  : clip polygon (replaced, CCW)
+	*! @param  : [in ] vecWork : work buffer
+	*! @return : number of point of clip polygon
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	********************************************************************************/
+	template<typename P> Dllexport size_t clip_polygon_hodgman(const P* poly, size_t nCnt, const P* clip, size_t nClip,
+															   std::vector<P>& vecOut, std::vector<P>& vecWork);
+
+	/*******************************************************************************
+	*! @brief  : Sutherland-Hodgman clipping of ring by all edges of convex polygon
+	*! @param  : [in    ] clip    : convex clip polygon (CCW)
+	*! @param  : [in    ] nClip   : number of point of clip
+	*! @param  : [in,out] vecRing : ring (CCW) -> clip ring
+	*! @param  : [in    ] vecWork : work buffer
+	*! @return : number of point of clip ring
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Core of clip_polygon_hodgman. TVec : std::vector<P> or
+	*!           ScratchVecPoint2D (scratch memory of batch clipping)
+	********************************************************************************/
+	template<typename P, typename TVec> Dllexport size_t clip_ring_hodgman(const P* clip, size_t nClip, TVec& vecRing, TVec& vecWork);
+
+	/*******************************************************************************
+	*! @brief  : Convex hull use Andrew monotone chain algorithm
+	*! @param  : [in ] pts     : point list
+	*! @param  : [in ] nCnt    : number of point
+	*! @param  : [out] vecHull : convex hull (replaced, CCW, start at leftmost point)
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Turn test in wide_type (float, double : exact sign when predicate
+	*!           is PRED_EXACT)
+	********************************************************************************/
+	template<typename P> Dllexport void convex_hull_monotone(const P* pts, size_t nCnt, std::vector<P>& vecHull);
+}
+}}
+
+#endif // !X2D_KERNEL_H
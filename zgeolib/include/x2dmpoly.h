@@ -0,0 +1,148 @@
+////////////////////////////////////////////////////////////////////////////////////
+/*!*********************************************************************************
+* @Copyright (C) 2021-2023 thuong.nv <thuong.nv.mta@gmail.com>
+*            All rights reserved.
+************************************************************************************
+* @file     x2dmpoly.h
+* @create   Oct 17, 2026
+* @brief    Geometry2D flat multipolygon (one point array + offset arrays)
+* @note     For conditions of distribution and use, see copyright notice in readme.txt
+************************************************************************************/
+
+#ifndef X2D_MPOLY_H
+#define X2D_MPOLY_H
+
+#include "x2dbase.h"
+#include <cstdint>
+#include <cstddef>
+
+namespace geo { namespace v2
+{
+	/**********************************************************************************
+	* ⮟⮟ Struct name: RingView2D
+	* Read only view of ring points (pointer + count, no copy)
+	* Exported functions reading a point list take RingView2D (VecPoint2D overload
+	* forwards to it). Kept VecPoint2D only : legacy functions returning a new list
+	* or modifying the input (convex_hull_giftwap, union_polygon, infact_polygon(x),
+	* reverse_polygon, poly2trig_ear_clipping, value returning clip_polygon_hodgman /
+	* clip_polygon_weiler / clip_polygon_rect / cut_line2poly) : they allocate the
+	* result anyway, use the view overloads writing into caller buffers instead
+	***********************************************************************************/
+	typedef struct tagRingView2D
+	{
+		const Point2D*	m_pData;
+		size_t			m_nSize;
+
+		tagRingView2D() : m_pData(NULL), m_nSize(0) {}
+		tagRingView2D(const Point2D* pData, size_t nSize) : m_pData(pData), m_nSize(nSize) {}
+		tagRingView2D(const VecPoint2D& vec) : m_pData(vec.data()), m_nSize(vec.size()) {}
+
+		const Point2D*	data() const  { return m_pData; }
+		size_t			size() const  { return m_nSize; }
+		GBool			empty() const { return m_nSize == 0; }
+		const Point2D*	begin() const { return m_pData; }
+		const Point2D*	end() const   { return m_pData + m_nSize; }
+
+		const Point2D&	operator[](size_t i) const { return m_pData[i]; }
+
+	} RingView2D;
+
+	/**********************************************************************************
+	* ⮟⮟ Class name: MultiPolygon2D
+	* Polygons with holes stored in one coordinate array.
+	* Ring r     : points [ring_begin(r), ring_end(r))
+	* Polygon p  : rings  [poly_ring_begin(p), poly_ring_end(p)), first ring is outer
+	***********************************************************************************/
+	class Dllexport MultiPolygon2D
+	{
+	protected:
+		VecPoint2D				m_vecPoint;		// coordinates of all rings
+		std::vector<uint32_t>	m_vecRing;		// ring offsets into m_vecPoint (ring count + 1)
+		std::vector<uint32_t>	m_vecPoly;		// polygon offsets into m_vecRing (polygon count + 1)
+
+	public:
+		MultiPolygon2D();
+
+	public:
+		/*******************************************************************************
+		*! @brief  : Remove all polygons (keep memory)
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		void clear();
+
+		/*******************************************************************************
+		*! @brief  : Reserve memory
+		*! @param  : [in] nPoint : number of point
+		*! @param  : [in] nRing  : number of ring
+		*! @param  : [in] nPoly  : number of polygon
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		void reserve(size_t nPoint, size_t nRing, size_t nPoly);
+
+		/*******************************************************************************
+		*! @brief  : Start new polygon (next ring is outer ring)
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		void begin_polygon();
+
+		/*******************************************************************************
+		*! @brief  : Add ring to the current polygon (first ring : outer | other : hole)
+		*! @param  : [in] pts  : ring points
+		*! @param  : [in] nCnt : number of point
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		void add_ring(const Point2D* pts, size_t nCnt);
+		void add_ring(const VecPoint2D& ring);
+		void add_ring(const RingView2D& ring);
+
+		/*******************************************************************************
+		*! @brief  : Add polygon without hole
+		*! @param  : [in] poly : outer ring
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		void add_polygon(const VecPoint2D& poly);
+
+		/*******************************************************************************
+		*! @brief  : Add polygon with holes
+		*! @param  : [in] rings : rings[0] : outer ring | other : holes
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		void add_polygon(const VecPolyList& rings);
+
+		/*******************************************************************************
+		*! @brief  : Add each ring of list as polygon without hole
+		*! @param  : [in] polys : polygon list
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		void add_polygons(const VecPolyList& polys);
+
+		/*******************************************************************************
+		*! @brief  : Add all polygons of other multipolygon (same order)
+		*! @param  : [in] mpoly : multipolygon
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		void append(const MultiPolygon2D& mpoly);
+
+	public:
+		size_t	poly_count() const  { return m_vecPoly.size() - 1; }
+		size_t	ring_count() const  { return m_vecRing.size() - 1; }
+		size_t	point_count() const { return m_vecPoint.size(); }
+		GBool	empty() const		{ return m_vecRing.size() <= 1; }
+
+		size_t	poly_ring_begin(size_t p) const { return m_vecPoly[p]; }
+		size_t	poly_ring_end(size_t p) const   { return m_vecPoly[p + 1]; }
+
+		size_t	ring_begin(size_t r) const { return m_vecRing[r]; }
+		size_t	ring_end(size_t r) const   { return m_vecRing[r + 1]; }
+		size_t	ring_size(size_t r) const  { return m_vecRing[r + 1] - m_vecRing[r]; }
+
+		const Point2D*	ring_data(size_t r) const { return m_vecPoint.data() + m_vecRing[r]; }
+		Point2D*		ring_data(size_t r)		  { return m_vecPoint.data() + m_vecRing[r]; }
+		RingView2D		ring(size_t r) const	  { return RingView2D(ring_data(r), ring_size(r)); }
+		RingView2D		outer_ring(size_t p) const { return ring(m_vecPoly[p]); }
+
+		const VecPoint2D& points() const { return m_vecPoint; }
+	};
+}}
+
+#endif // !X2D_MPOLY_H
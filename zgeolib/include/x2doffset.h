@@ -0,0 +1,181 @@
+////////////////////////////////////////////////////////////////////////////////////
+/*!*********************************************************************************
+* @Copyright (C) 2021-2023 thuong.nv <thuong.nv.mta@gmail.com>
+*            All rights reserved.
+************************************************************************************
+* @file     x2doffset.h
+* @create   Oct 17, 2026
+* @brief    Geometry2D offset (buffer) of polygons and polylines with join types
+* @note     For conditions of distribution and use, see copyright notice in readme.txt
+************************************************************************************/
+
+#ifndef X2D_OFFSET_H
+#define X2D_OFFSET_H
+
+#include "x2dbase.h"
+#include "x2dmpoly.h"
+#include "x2dscratch.h"
+#include <cstdint>
+#include <cstddef>
+
+namespace geo { namespace v2
+{
+	enum EnumJoinType
+	{
+		JOIN_SQUARE,	// corner cut at distance delta from vertex
+		JOIN_ROUND,		// arc around vertex
+		JOIN_MITER,		// edges extended (square when miter limit is exceeded)
+	};
+
+	enum EnumEndType
+	{
+		END_POLYGON,	// closed polygon (outer ring grows, hole shrinks)
+		END_JOINED,		// closed polyline (both sides offset)
+		END_BUTT,		// open polyline, end cut at end point
+		END_SQUARE,		// open polyline, end extended by delta
+		END_ROUND,		// open polyline, half circle at end point
+	};
+
+	/**********************************************************************************
+	* ⮟⮟ Class name: PolygonOffset2D
+	* Offset of many paths in one call. Each path is offset to a raw ring (edges moved
+	* by delta, vertices joined by square / round / miter, ends capped), then all raw
+	* rings are merged by union_polygon (FILL_POSITIVE) : self-intersection loops of
+	* concave corners and overlaps of paths are removed.
+	* Input copy and work buffers are allocated on GeoScratch (NULL : heap) and kept
+	* between calls
+	* @refer : http://www.angusj.com/delphi/clipper.php (ClipperOffset)
+	***********************************************************************************/
+	class Dllexport PolygonOffset2D
+	{
+	protected:
+		typedef struct tagOffsetPath
+		{
+			uint32_t		m_nBegin;	// first point in m_vecInput
+			uint32_t		m_nCnt;		// number of point
+			EnumJoinType	m_eJoin;
+			EnumEndType		m_eEnd;
+			GBool			m_bHole;	// END_POLYGON : ring is oriented clockwise
+
+		} OffsetPath;
+
+		typedef std::vector<OffsetPath, ScratchAllocator<OffsetPath>>	VecOffsetPath;
+		typedef std::vector<GDouble, ScratchAllocator<GDouble>>			VecOffsetNormal;
+
+	protected:
+		VecOffsetPath		m_vecPath;		// paths
+		ScratchVecPoint2D	m_vecInput;		// points of all paths
+		ScratchVecPoint2D	m_vecClean;		// path without duplicate point (work)
+		VecOffsetNormal		m_vecNormal;	// unit normal of each edge : x, y (work)
+		ScratchVecPoint2D	m_vecRing;		// raw ring (work)
+		MultiPolygon2D		m_mpolyRaw;		// raw rings of all paths
+
+		GFloat				m_fMiterLimit;	// max miter length / delta
+		GFloat				m_fArcTol;		// max distance of round join to true arc
+
+		GDouble				m_dArcTol;		// arc tolerance of current execute
+		GDouble				m_dStepPerRad;	// round join : number of step per radian
+		GDouble				m_dMiterLim;	// miter if 1 + cos(angle) >= m_dMiterLim
+
+	public:
+		explicit PolygonOffset2D(GFloat fMiterLimit = 2.f, GFloat fArcTol = 0.f, GeoScratch* pScratch = NULL);
+
+	public:
+		/*******************************************************************************
+		*! @brief  : Add path
+		*! @param  : [in] pts   : points (copied, closing point not repeated)
+		*! @param  : [in] nCnt  : number of point
+		*! @param  : [in] eJoin : join type
+		*! @param  : [in] eEnd  : end type (END_POLYGON : ring is oriented CCW)
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		void add_path(const Point2D* pts, size_t nCnt, EnumJoinType eJoin, EnumEndType eEnd);
+		void add_path(const VecPoint2D& path, EnumJoinType eJoin, EnumEndType eEnd);
+
+		/*******************************************************************************
+		*! @brief  : Add all rings of multipolygon
+		*! @param  : [in] mpoly : polygons (outer ring + holes) or paths
+		*! @param  : [in] eJoin : join type
+		*! @param  : [in] eEnd  : end type
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		*! @note   : END_POLYGON : first ring of polygon is oriented CCW, other rings
+		*!           CW (input orientation is not used)
+		********************************************************************************/
+		void add_paths(const MultiPolygon2D& mpoly, EnumJoinType eJoin, EnumEndType eEnd);
+
+		/*******************************************************************************
+		*! @brief  : Offset all paths
+		*! @param  : [in ] fDelta : offset (polygon : > 0 grow | < 0 shrink, open and
+		*!                          joined path : |fDelta| is used)
+		*! @param  : [out] result : result polygons (outer ring CCW, hole CW)
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		*! @note   : Paths are kept (execute can be called again with other delta).
+		*!           fDelta == 0 : polygons are only cleaned (union)
+		********************************************************************************/
+		void execute(GFloat fDelta, MultiPolygon2D& result);
+
+		/*******************************************************************************
+		*! @brief  : Remove all paths
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		void clear();
+
+	public:
+		GBool	empty() const			{ return m_vecPath.empty(); }
+		size_t	path_count() const		{ return m_vecPath.size(); }
+		GFloat	miter_limit() const		{ return m_fMiterLimit; }
+		GFloat	arc_tolerance() const	{ return m_fArcTol; }
+
+		void	set_miter_limit(GFloat fMiterLimit) { m_fMiterLimit = fMiterLimit; }
+		void	set_arc_tolerance(GFloat fArcTol)	{ m_fArcTol = fArcTol; }
+
+		const MultiPolygon2D& raw_rings() const { return m_mpolyRaw; }	// before union
+
+	protected:
+		size_t	clean_path(const OffsetPath& path);
+		void	build_normals(size_t nCnt, GBool bClosed);
+		void	offset_closed(size_t nCnt, EnumJoinType eJoin, GDouble dDelta);
+		void	offset_open(size_t nCnt, EnumJoinType eJoin, EnumEndType eEnd, GDouble dDelta);
+		void	offset_point(const Point2D& pt, EnumEndType eEnd, GDouble dDelta);
+		void	add_join(const Point2D& pt, size_t nPrev, size_t nCur, GDouble dSign, EnumJoinType eJoin, GDouble dDelta);
+		void	add_cap(const Point2D& pt, size_t nEdge, GDouble dSign, EnumEndType eEnd, GDouble dDelta);
+		void	add_arc(const Point2D& pt, GDouble nx, GDouble ny, GDouble dAngle, GDouble dDelta);
+		void	add_raw_ring();
+	};
+
+	/*******************************************************************************
+	*! @brief  : Offset of multipolygon
+	*! @param  : [in ] mpoly       : polygons (outer ring + holes)
+	*! @param  : [in ] fDelta      : offset (> 0 grow | < 0 shrink)
+	*! @param  : [in ] eJoin       : join type
+	*! @param  : [out] result      : result polygons (outer ring CCW, hole CW)
+	*! @param  : [in ] fMiterLimit : max miter length / |fDelta| (JOIN_MITER)
+	*! @param  : [in ] fArcTol     : max distance of round join to true arc
+	*!                               (<= 0 : |fDelta| / 200)
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Unlike infact_polygon, result has no self-intersection (concave
+	*!           corners, near parallel edges, parts that vanish or merge)
+	********************************************************************************/
+	Dllexport void offset_polygon(const MultiPolygon2D& mpoly, GFloat fDelta, EnumJoinType eJoin, MultiPolygon2D& result,
+								  GFloat fMiterLimit = 2.f, GFloat fArcTol = 0.f);
+	Dllexport void offset_polygon(const MultiPolygon2D& mpoly, GFloat fDelta, EnumJoinType eJoin, MultiPolygon2D& result,
+								  GeoScratch& scratch, GFloat fMiterLimit = 2.f, GFloat fArcTol = 0.f);
+
+	/*******************************************************************************
+	*! @brief  : Buffer of open polylines
+	*! @param  : [in ] vecLines    : polylines
+	*! @param  : [in ] fDelta      : half width of buffer (> 0)
+	*! @param  : [in ] eJoin       : join type
+	*! @param  : [in ] eEnd        : end type (END_BUTT | END_SQUARE | END_ROUND)
+	*! @param  : [out] result      : result polygons (outer ring CCW, hole CW)
+	*! @param  : [in ] fMiterLimit : max miter length / fDelta (JOIN_MITER)
+	*! @param  : [in ] fArcTol     : max distance of round join to true arc
+	*!                               (<= 0 : fDelta / 200)
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : All lines are merged (crossing lines give one polygon)
+	********************************************************************************/
+	Dllexport void offset_polyline(const VecPolyList& vecLines, GFloat fDelta, EnumJoinType eJoin, EnumEndType eEnd,
+								   MultiPolygon2D& result, GFloat fMiterLimit = 2.f, GFloat fArcTol = 0.f);
+}}
+
+#endif // !X2D_OFFSET_H
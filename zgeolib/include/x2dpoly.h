@@ -13,6 +13,8 @@
 #define X2D_POLY_H
 
 #include "x2dbase.h"
+#include "x2dmpoly.h"
+#include "x2dscratch.h"
 
 namespace geo {	namespace v2
 {
@@ -23,6 +25,21 @@ namespace geo {	namespace v2
 	********************************************************************************/
 	Dllexport void reverse_polygon(VecPoint2D& poly);
 
+	/********************************************************************************
+	*! @brief  : Reverse ring in place (first point is kept)
+	*! @param  : [in] poly : ring points
+	*! @param  : [in] nCnt : number of point
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	********************************************************************************/
+	Dllexport void reverse_polygon(Point2D* poly, size_t nCnt);
+
+	/********************************************************************************
+	*! @brief  : Reverse all rings of multipolygon (in place)
+	*! @param  : [in] mpoly : multipolygon
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	********************************************************************************/
+	Dllexport void reverse_polygon(MultiPolygon2D& mpoly);
+
 	/********************************************************************************
 	*! @brief  : Inflat polygon certain distance
 	*! @param  : [in ] poly    : poly inflat (CCW)
@@ -41,6 +58,14 @@ namespace geo {	namespace v2
 	********************************************************************************/
 	Dllexport void infact_polygonx(VecPoint2D& poly, const GFloat& fOffset);
 
+	/********************************************************************************
+	*! @brief  : Inflat all rings of multipolygon certain distance (no copy)
+	*! @param  : [in] mpoly   : multipolygon (outer ring CCW, holes CW)
+	*! @param  : [in] fOffset : distance away from center
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	********************************************************************************/
+	Dllexport void infact_polygonx(MultiPolygon2D& mpoly, const GFloat& fOffset);
+
 	/*******************************************************************************
 	*! @brief  : Area of a polygon with given n ordered vertices
 	*! @param  : [in] points : list point polygon
@@ -49,6 +74,15 @@ namespace geo {	namespace v2
 	*! @note   : shoelace formula | no hold
 	********************************************************************************/
 	Dllexport GFloat get_area_polygon(const VecPoint2D& points);
+	Dllexport GFloat get_area_polygon(const RingView2D& ring);
+
+	/*******************************************************************************
+	*! @brief  : Area of multipolygon (outer rings minus holes)
+	*! @param  : [in] mpoly : multipolygon
+	*! @return : float : area
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	********************************************************************************/
+	Dllexport GFloat get_area_polygon(const MultiPolygon2D& mpoly);
 
 	/*******************************************************************************
 	*! @brief  : bounding box of a vector of points
@@ -58,6 +92,8 @@ namespace geo {	namespace v2
 	*! @author : thuong.nv			- [Date] : 05/19/2023
 	********************************************************************************/
 	Dllexport void  get_bounding_box(const VecPoint2D& points, Point2D& ptMin, Point2D& ptMax);
+	Dllexport void  get_bounding_box(const RingView2D& ring, Point2D& ptMin, Point2D& ptMax);
+	Dllexport void  get_bounding_box(const MultiPolygon2D& mpoly, Point2D& ptMin, Point2D& ptMax);
 
 	/***********************************************************************************
 	*! @brief	: check point inside polygon
@@ -67,6 +103,16 @@ namespace geo {	namespace v2
 	*! @note	: ref : https://wrf.ecse.rpi.edu/Research/Short_Notes/pnpoly.html
 	***********************************************************************************/
 	Dllexport GBool is_point_in_polygon(const Point2D& pt, const VecPoint2D& poly);
+	Dllexport GBool is_point_in_polygon(const Point2D& pt, const RingView2D& ring);
+
+	/*******************************************************************************
+	*! @brief  : Check point inside multipolygon
+	*! @param  : [in] pt    : point check
+	*! @param  : [in] mpoly : multipolygon
+	*! @return : TRUE : inside outer ring and outside holes of one polygon | FALSE
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	********************************************************************************/
+	Dllexport GBool is_point_in_polygon(const Point2D& pt, const MultiPolygon2D& mpoly);
 
 	/*******************************************************************************
 	*! @brief	:Get the relationship between 2 polygons
@@ -80,6 +126,17 @@ namespace geo {	namespace v2
 	*!@note		poly1 and poly 2 have number points greater than 3
 	*!********************************************************************************/
 	Dllexport GInt rel_2polygon(const VecPoint2D& poly1, const VecPoint2D& poly2);
+
+	/*******************************************************************************
+	*! @brief  : Get the relationship between 2 polygons (scratch memory)
+	*! @param  : [in] poly1   : first polygon
+	*! @param  : [in] poly2   : second polygon
+	*! @param  : [in] scratch : temporary memory of sweep line
+	*! @return : same as rel_2polygon
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Temporary memory is given back to scratch on return
+	********************************************************************************/
+	Dllexport GInt rel_2polygon(const RingView2D& poly1, const RingView2D& poly2, GeoScratch& scratch);
 }}
 
 #endif // !X2D_POLY_H
\ No newline at end of file
@@ -0,0 +1,110 @@
+////////////////////////////////////////////////////////////////////////////////////
+/*!*********************************************************************************
+* @Copyright (C) 2021-2023 thuong.nv <thuong.nv.mta@gmail.com>
+*            All rights reserved.
+************************************************************************************
+* @file     x2dpool.h
+* @create   Oct 17, 2026
+* @brief    Geometry2D work-stealing thread pool for batch algorithms
+* @note     For conditions of distribution and use, see copyright notice in readme.txt
+************************************************************************************/
+
+#ifndef X2D_POOL_H
+#define X2D_POOL_H
+
+#include "x2dbase.h"
+#include "x2dscratch.h"
+
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <exception>
+#include <functional>
+#include <condition_variable>
+
+namespace geo { namespace v2
+{
+	/**********************************************************************************
+	* ⮟⮟ Class name: GeoThreadPool
+	* Persistent worker threads (created once, reused every call). The caller thread
+	* is worker 0. Tasks [0, n) are split in one contiguous range per worker, a worker
+	* whose range is empty steals the upper half of the range of another worker.
+	* Each worker owns a GeoScratch which is kept between calls
+	***********************************************************************************/
+	class Dllexport GeoThreadPool
+	{
+	public:
+		typedef std::function<void(size_t nTask, GInt nWorker)> TaskFunc;
+
+	protected:
+		typedef struct tagWorkRange
+		{
+			std::mutex	m_mtx;
+			size_t		m_nBegin;	// next task
+			size_t		m_nEnd;		// end of range
+
+		} WorkRange;
+
+		std::vector<std::thread>	m_vecThread;	// worker 1 .. n - 1
+		std::vector<WorkRange*>		m_vecRange;		// range of each worker
+		std::vector<GeoScratch*>	m_vecScratch;	// scratch of each worker
+
+		std::mutex					m_mtxRun;		// one parallel_for at a time
+		std::mutex					m_mtx;			// state below
+		std::condition_variable		m_cvStart;
+		std::condition_variable		m_cvDone;
+
+		const TaskFunc*				m_pTask;		// current task function
+		size_t						m_nJob;			// job counter (wake up threads)
+		GInt						m_nActive;		// number of worker of current job
+		GInt						m_nBusy;		// threads not done with current job
+		GBool						m_bStop;
+		std::exception_ptr			m_pError;		// first exception of current job
+
+		std::atomic<bool>			m_bCancel;		// a task threw : skip tasks not started
+
+	public:
+		/*******************************************************************************
+		*! @brief  : Create pool
+		*! @param  : [in] nThread : number of worker (caller included)
+		*!                          <= 0 : std::thread::hardware_concurrency()
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		explicit GeoThreadPool(GInt nThread = 0);
+		~GeoThreadPool();
+
+	private:
+		GeoThreadPool(const GeoThreadPool&);
+		GeoThreadPool& operator=(const GeoThreadPool&);
+
+	public:
+		/*******************************************************************************
+		*! @brief  : Run func(nTask, nWorker) for all task in [0, nTaskCnt), return when done
+		*! @param  : [in] nTaskCnt : number of task
+		*! @param  : [in] func     : task function (called concurrently)
+		*! @param  : [in] nThread  : max number of worker (<= 0 : all)
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		*! @note   : Order of execution is not defined, write result of task i in slot i
+		*!           to get deterministic output. Concurrent calls are serialized
+		*!           A task which throws (any worker) : tasks not started are skipped,
+		*!           all workers finish, then the first exception is rethrown
+		********************************************************************************/
+		void parallel_for(size_t nTaskCnt, const TaskFunc& func, GInt nThread = 0);
+
+		/*******************************************************************************
+		*! @brief  : Scratch memory of worker (only used by this worker in parallel_for)
+		*! @param  : [in] nWorker : worker index (argument of task function)
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		GeoScratch& scratch(GInt nWorker) { return *m_vecScratch[nWorker]; }
+
+		GInt thread_count() const { return static_cast<GInt>(m_vecScratch.size()); }
+
+	protected:
+		void thread_main(GInt nWorker);
+		void run_worker(GInt nWorker);
+		GBool steal_range(GInt nWorker);
+	};
+}}
+
+#endif // !X2D_POOL_H
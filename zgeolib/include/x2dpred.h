@@ -0,0 +1,168 @@
+////////////////////////////////////////////////////////////////////////////////////
+/*!*********************************************************************************
+* @Copyright (C) 2021-2023 thuong.nv <thuong.nv.mta@gmail.com>
+*            All rights reserved.
+************************************************************************************
+* @file     x2dpred.h
+* @create   Oct 17, 2026
+* @brief    Geometry2D robust predicates (adaptive precision orient2d, incircle)
+* @note     For conditions of distribution and use, see copyright notice in readme.txt
+************************************************************************************/
+
+#ifndef X2D_PRED_H
+#define X2D_PRED_H
+
+#include "x2dbase.h"
+#include <cmath>
+
+namespace geo { namespace v2
+{
+	enum EnumPredicate
+	{
+		PRED_EPSILON,	// float cross product compared with MATH_EPSILON (default)
+		PRED_EXACT,		// adaptive precision : sign is always exact
+	};
+
+	/*******************************************************************************
+	*! @brief  : Select predicate used by x2drel / x2dint / x2dalgo
+	*! @param  : [in] ePred : predicate
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Set once before use (not synchronized with running threads)
+	********************************************************************************/
+	Dllexport void set_predicate(EnumPredicate ePred);
+
+	/*******************************************************************************
+	*! @brief  : Get predicate used by x2drel / x2dint / x2dalgo
+	*! @return : EnumPredicate
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	********************************************************************************/
+	Dllexport EnumPredicate get_predicate();
+
+	/*******************************************************************************
+	*! @brief  : Exact orientation when the fast filter fails (don't call directly)
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	********************************************************************************/
+	Dllexport GDouble orient2d_adapt(GDouble ax, GDouble ay, GDouble bx, GDouble by,
+									 GDouble cx, GDouble cy, GDouble dDetSum);
+
+	/*******************************************************************************
+	*! @brief  : Exact in-circle when the fast filter fails (don't call directly)
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	********************************************************************************/
+	Dllexport GDouble incircle_exact(GDouble ax, GDouble ay, GDouble bx, GDouble by,
+									 GDouble cx, GDouble cy, GDouble dx, GDouble dy);
+
+	/*******************************************************************************
+	*! @brief  : Exact cross product when the fast filter fails (don't call directly)
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	********************************************************************************/
+	Dllexport GDouble cross2d_exact(GDouble ax, GDouble ay, GDouble bx, GDouble by,
+									GDouble cx, GDouble cy, GDouble dx, GDouble dy);
+
+	/*******************************************************************************
+	*! @brief  : Orientation of three points (Shewchuk adaptive precision)
+	*! @param  : [in] ax, ay : point a
+	*! @param  : [in] bx, by : point b
+	*! @param  : [in] cx, cy : point c
+	*! @return : > 0 : a, b, c counterclockwise (c on the left of ab)
+	*!           < 0 : clockwise | 0 : collinear
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Sign is exact. Common case only costs the float filter
+	********************************************************************************/
+	inline GDouble orient2d(GDouble ax, GDouble ay, GDouble bx, GDouble by, GDouble cx, GDouble cy)
+	{
+		const GDouble dEps = 1.1102230246251565e-16;	// 2^-53
+		const GDouble dErrBoundA = (3.0 + 16.0 * dEps) * dEps;
+
+		GDouble dDetLeft  = (ax - cx) * (by - cy);
+		GDouble dDetRight = (ay - cy) * (bx - cx);
+		GDouble dDet      = dDetLeft - dDetRight;
+
+		// Error bound filter : exact stages only when |det| is below the bound
+		GDouble dDetSum   = std::fabs(dDetLeft) + std::fabs(dDetRight);
+
+		if (std::fabs(dDet) >= dErrBoundA * dDetSum)
+			return dDet;
+
+		return orient2d_adapt(ax, ay, bx, by, cx, cy, dDetSum);
+	}
+
+	inline GDouble orient2d(const Point2D& pa, const Point2D& pb, const Point2D& pc)
+	{
+		return orient2d(pa.x, pa.y, pb.x, pb.y, pc.x, pc.y);
+	}
+
+	/*******************************************************************************
+	*! @brief  : Cross product of two vectors (b - a) x (d - c)
+	*! @return : > 0 : cd turns left of ab | < 0 : right | 0 : parallel
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Sign is exact (same filter as orient2d : a = c gives orient2d)
+	********************************************************************************/
+	inline GDouble cross2d(GDouble ax, GDouble ay, GDouble bx, GDouble by,
+						   GDouble cx, GDouble cy, GDouble dx, GDouble dy)
+	{
+		const GDouble dEps = 1.1102230246251565e-16;	// 2^-53
+		const GDouble dErrBoundA = (3.0 + 16.0 * dEps) * dEps;
+
+		GDouble dDetLeft  = (bx - ax) * (dy - cy);
+		GDouble dDetRight = (by - ay) * (dx - cx);
+		GDouble dDet      = dDetLeft - dDetRight;
+		GDouble dDetSum   = std::fabs(dDetLeft) + std::fabs(dDetRight);
+
+		if (std::fabs(dDet) >= dErrBoundA * dDetSum && dDet != 0.0)
+			return dDet;
+
+		return cross2d_exact(ax, ay, bx, by, cx, cy, dx, dy);
+	}
+
+	inline GDouble cross2d(const Point2D& pa, const Point2D& pb, const Point2D& pc, const Point2D& pd)
+	{
+		return cross2d(pa.x, pa.y, pb.x, pb.y, pc.x, pc.y, pd.x, pd.y);
+	}
+
+	/*******************************************************************************
+	*! @brief  : Check point d with the circle through a, b, c (Shewchuk)
+	*! @param  : [in] a, b, c : counterclockwise points of circle
+	*! @param  : [in] d       : point check
+	*! @return : > 0 : d inside | < 0 : d outside | 0 : d on circle
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Sign is exact (a, b, c clockwise : sign is reversed)
+	********************************************************************************/
+	inline GDouble incircle(GDouble ax, GDouble ay, GDouble bx, GDouble by,
+							GDouble cx, GDouble cy, GDouble dx, GDouble dy)
+	{
+		const GDouble dEps = 1.1102230246251565e-16;	// 2^-53
+		const GDouble dErrBoundA = (10.0 + 96.0 * dEps) * dEps;
+
+		GDouble adx = ax - dx, bdx = bx - dx, cdx = cx - dx;
+		GDouble ady = ay - dy, bdy = by - dy, cdy = cy - dy;
+
+		GDouble bdxcdy = bdx * cdy, cdxbdy = cdx * bdy;
+		GDouble cdxady = cdx * ady, adxcdy = adx * cdy;
+		GDouble adxbdy = adx * bdy, bdxady = bdx * ady;
+
+		GDouble alift = adx * adx + ady * ady;
+		GDouble blift = bdx * bdx + bdy * bdy;
+		GDouble clift = cdx * cdx + cdy * cdy;
+
+		GDouble dDet = alift * (bdxcdy - cdxbdy) + blift * (cdxady - adxcdy) + clift * (adxbdy - bdxady);
+
+		GDouble dPermanent = (std::fabs(bdxcdy) + std::fabs(cdxbdy)) * alift +
+							 (std::fabs(cdxady) + std::fabs(adxcdy)) * blift +
+							 (std::fabs(adxbdy) + std::fabs(bdxady)) * clift;
+
+		GDouble dErrBound = dErrBoundA * dPermanent;
+
+		if (dDet > dErrBound || -dDet > dErrBound)
+			return dDet;
+
+		return incircle_exact(ax, ay, bx, by, cx, cy, dx, dy);
+	}
+
+	inline GDouble incircle(const Point2D& pa, const Point2D& pb, const Point2D& pc, const Point2D& pd)
+	{
+		return incircle(pa.x, pa.y, pb.x, pb.y, pc.x, pc.y, pd.x, pd.y);
+	}
+}}
+
+#endif // !X2D_PRED_H
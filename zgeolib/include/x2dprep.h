@@ -0,0 +1,129 @@
+////////////////////////////////////////////////////////////////////////////////////
+/*!*********************************************************************************
+* @Copyright (C) 2021-2023 thuong.nv <thuong.nv.mta@gmail.com>
+*            All rights reserved.
+************************************************************************************
+* @file     x2dprep.h
+* @create   Oct 17, 2026
+* @brief    Geometry2D prepared polygon (cached data for repeated queries)
+* @note     For conditions of distribution and use, see copyright notice in readme.txt
+************************************************************************************/
+
+#ifndef X2D_PREP_H
+#define X2D_PREP_H
+
+#include "x2dbase.h"
+#include "x2dsoa.h"
+#include "x2dmpoly.h"
+#include "x2dscratch.h"
+#include <cstdint>
+#include <cstddef>
+
+namespace geo { namespace v2
+{
+	/**********************************************************************************
+	* ⮟⮟ Class name: PreparedPolygon
+	* Polygon built once and queried many times (bbox, orientation, convexity and
+	* edge coefficients are cached)
+	***********************************************************************************/
+	class Dllexport PreparedPolygon
+	{
+	protected:
+		typedef struct tagEdgeCoef
+		{
+			GFloat	m_x0;		// start point x
+			GFloat	m_y0;		// start point y
+			GFloat	m_x1;		// end point x
+			GFloat	m_y1;		// end point y
+			GFloat	m_fSlope;	// dx / dy (0 for horizontal edge)
+
+		} EdgeCoef;
+
+		typedef std::vector<EdgeCoef, ScratchAllocator<EdgeCoef>> VecEdgeCoef;
+
+	protected:
+		ScratchVecPoint2D m_vecPoly;	// copy of polygon (CCW, no consecutive duplicate)
+		VecEdgeCoef	m_vecEdge;		// edge table used by crossing number test
+		Point2D		m_ptMin;		// bounding box min
+		Point2D		m_ptMax;		// bounding box max
+		GBool		m_bCCW;			// input polygon is counter-clockwise
+		GBool		m_bConvex;		// polygon is convex (use O(log n) test)
+
+	public:
+		PreparedPolygon();
+		explicit PreparedPolygon(const VecPoint2D& poly);
+		explicit PreparedPolygon(GeoScratch* pScratch);
+		PreparedPolygon(const RingView2D& poly, GeoScratch* pScratch);
+
+	public:
+		/*******************************************************************************
+		*! @brief  : Build cached data from polygon (can be called again to rebuild)
+		*! @param  : [in] poly : polygon (CW or CCW)
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		void build(const VecPoint2D& poly);
+		void build(const RingView2D& poly);
+
+		/*******************************************************************************
+		*! @brief  : Release cached data
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		void clear();
+
+		/*******************************************************************************
+		*! @brief  : Check point inside polygon
+		*! @param  : [in] pt : point check
+		*! @return : TRUE : inside | FALSE : outside
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		*! @note   : Same result as is_point_in_polygon for points not on the boundary.
+		*!           Boundary point can differ : convex polygon -> always inside (fan
+		*!           test, >= 0) | other polygon -> same crossing rule, but the cached
+		*!           slope rounds differently (see bench/bench_prep.cpp)
+		********************************************************************************/
+		GBool contains(const Point2D& pt) const;
+
+		/*******************************************************************************
+		*! @brief  : Check point inside polygon with the rule of is_point_in_polygon
+		*! @param  : [in] pt : point check
+		*! @return : TRUE : inside | FALSE : outside
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		*! @note   : Same result as is_point_in_polygon, boundary point included (no
+		*!           fan test, x of edge at pt.y is divided as is_point_in_polygon does).
+		*!           Use it where the old boundary result is kept (clip_polygon_weiler)
+		********************************************************************************/
+		GBool contains_legacy(const Point2D& pt) const;
+
+		/*******************************************************************************
+		*! @brief  : Check list point inside polygon
+		*! @param  : [in ] pts : point list
+		*! @param  : [in ] n   : number of point
+		*! @param  : [out] out : 1 : inside | 0 : outside (size >= n)
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		void contains(const Point2D* pts, size_t n, uint8_t* out) const;
+
+		/*******************************************************************************
+		*! @brief  : Check point buffer (SoA) inside polygon
+		*! @param  : [in ] pts : point buffer
+		*! @param  : [out] out : 1 : inside | 0 : outside (size >= pts.size())
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		*! @note   : Test GEO_SIMD_WIDTH points per edge iteration (AVX : 8 | SSE : 4)
+		********************************************************************************/
+		void contains(const PointSoA2D& pts, uint8_t* out) const;
+
+	public:
+		GBool	empty() const { return m_vecEdge.empty(); }
+		size_t	size() const { return m_vecEdge.size(); }
+		GBool	is_ccw() const { return m_bCCW; }
+		GBool	is_convex() const { return m_bConvex; }
+
+		void	get_bounding_box(Point2D& ptMin, Point2D& ptMax) const;
+
+	protected:
+		GBool	contains_crossing(const Point2D& pt) const;
+		GBool	contains_convex(const Point2D& pt) const;
+		void	contains_crossing_block(const GFloat* px, const GFloat* py, uint8_t* out) const;
+	};
+}}
+
+#endif // !X2D_PREP_H
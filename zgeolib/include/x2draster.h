@@ -0,0 +1,153 @@
+////////////////////////////////////////////////////////////////////////////////////
+/*!*********************************************************************************
+* @Copyright (C) 2021-2023 thuong.nv <thuong.nv.mta@gmail.com>
+*            All rights reserved.
+************************************************************************************
+* @file     x2draster.h
+* @create   Oct 17, 2026
+* @brief    Geometry2D scanline rasterizer (anti-aliased polygon coverage mask)
+* @note     For conditions of distribution and use, see copyright notice in readme.txt
+************************************************************************************/
+
+#ifndef X2D_RASTER_H
+#define X2D_RASTER_H
+
+#include "x2dbase.h"
+#include "x2dmpoly.h"
+#include "x2dbool.h"
+#include "x2dpool.h"
+#include <cstdint>
+#include <cstddef>
+
+namespace geo { namespace v2
+{
+	typedef struct tagRasterEdge
+	{
+		GFloat	m_x0;		// x at m_y0
+		GFloat	m_y0;		// top (pixel space, m_y0 < m_y1)
+		GFloat	m_y1;		// bottom
+		GFloat	m_fDxDy;	// dx / dy
+		GFloat	m_fDir;		// +1 : input edge goes up (y decreasing) | -1 : down
+
+	} RasterEdge;
+
+	/**********************************************************************************
+	* ⮟⮟ Class name: ScanlineRasterizer2D
+	* Polygon coverage mask. Edges are sorted by top, an active edge table is updated
+	* row by row. Each active edge adds its exact signed area to the cells of the row
+	* (split at pixel borders), then the row is scanned left to right accumulating
+	* the winding : coverage = fill rule of accumulated winding (AGG / font-rs cell
+	* model). Pixel (i, j) is [i, i + 1] x [j, j + 1] in pixel space,
+	* pixel = (world - origin) * scale.
+	* Tiled mode : canvas is split in bands of rows, edges are binned to bands and
+	* each band is rasterized by a pool worker with its own row buffer
+	* @refer : https://github.com/raphlinus/font-rs
+	***********************************************************************************/
+	class Dllexport ScanlineRasterizer2D
+	{
+	protected:
+		std::vector<RasterEdge>	m_vecEdge;		// edges (sorted by top at render)
+		GInt					m_nWidth;		// canvas size (pixel)
+		GInt					m_nHeight;
+		Point2D					m_ptOrigin;		// world point of pixel (0, 0) corner
+		GFloat					m_fScale;		// pixel per world unit
+		GBool					m_bSorted;
+
+	public:
+		ScanlineRasterizer2D(GInt nWidth = 0, GInt nHeight = 0);
+
+	public:
+		/*******************************************************************************
+		*! @brief  : Remove edges and set canvas size
+		*! @param  : [in] nWidth  : width (pixel)
+		*! @param  : [in] nHeight : height (pixel)
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		void reset(GInt nWidth, GInt nHeight);
+
+		/*******************************************************************************
+		*! @brief  : World to pixel transform of next added rings
+		*! @param  : [in] ptOrigin : world point at pixel (0, 0) corner
+		*! @param  : [in] fScale   : pixel per world unit
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		*! @note   : Default : origin (0, 0), scale 1 (input is in pixel space)
+		********************************************************************************/
+		void set_transform(const Point2D& ptOrigin, GFloat fScale);
+
+		/*******************************************************************************
+		*! @brief  : Add ring (closed, closing point not repeated)
+		*! @param  : [in] pts  : points
+		*! @param  : [in] nCnt : number of point
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		*! @note   : Horizontal edges and edges out of canvas rows are skipped
+		********************************************************************************/
+		void add_ring(const Point2D* pts, size_t nCnt);
+		void add_ring(const VecPoint2D& ring);
+
+		/*******************************************************************************
+		*! @brief  : Add all rings
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		void add_polygons(const VecPolyList& vecPoly);
+		void add_polygons(const MultiPolygon2D& mpoly);
+
+		/*******************************************************************************
+		*! @brief  : Remove all edges (canvas size and transform are kept)
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		void clear();
+
+		/*******************************************************************************
+		*! @brief  : Coverage mask of added rings
+		*! @param  : [out] pBuffer : canvas (all pixels written, 0 : empty)
+		*! @param  : [in ] nStride : element count between rows (>= width)
+		*! @param  : [in ] eFill   : fill rule (FILL_POSITIVE : ring with positive
+		*!                           area, CCW in world, is filled)
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		*! @note   : uint8_t : 0 - 255 | GFloat : 0 - 1
+		********************************************************************************/
+		void render(uint8_t* pBuffer, GInt nStride, EnumFillRule eFill = FILL_NONZERO);
+		void render(GFloat* pBuffer, GInt nStride, EnumFillRule eFill = FILL_NONZERO);
+
+		/*******************************************************************************
+		*! @brief  : Coverage mask of added rings (tiled, multithread)
+		*! @param  : [out] pBuffer   : canvas (all pixels written, 0 : empty)
+		*! @param  : [in ] nStride   : element count between rows (>= width)
+		*! @param  : [in ] eFill     : fill rule
+		*! @param  : [in ] pool      : thread pool
+		*! @param  : [in ] nThread   : max number of worker (<= 0 : all)
+		*! @param  : [in ] nTileRows : number of row of a tile (band)
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		*! @note   : Same output as serial render
+		********************************************************************************/
+		void render(uint8_t* pBuffer, GInt nStride, EnumFillRule eFill, GeoThreadPool& pool,
+					GInt nThread = 0, GInt nTileRows = 64);
+		void render(GFloat* pBuffer, GInt nStride, EnumFillRule eFill, GeoThreadPool& pool,
+					GInt nThread = 0, GInt nTileRows = 64);
+
+	public:
+		GInt	width() const		{ return m_nWidth; }
+		GInt	height() const		{ return m_nHeight; }
+		size_t	edge_count() const	{ return m_vecEdge.size(); }
+		GBool	empty() const		{ return m_vecEdge.empty(); }
+
+	protected:
+		void	sort_edges();
+	};
+
+	/*******************************************************************************
+	*! @brief  : Coverage mask of polygons (8 bit)
+	*! @param  : [in ] vecPoly  : rings (world)
+	*! @param  : [in ] rect     : world window of canvas (x, y : pixel (0, 0) corner)
+	*! @param  : [in ] nWidth   : width (pixel)
+	*! @param  : [in ] nHeight  : height (pixel)
+	*! @param  : [out] vecMask  : nWidth * nHeight values (replaced, row 0 at rect.y)
+	*! @param  : [in ] eFill    : fill rule
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Scale is nWidth / rect.width (rect.height is not used)
+	********************************************************************************/
+	Dllexport void rasterize_polygon(const VecPolyList& vecPoly, const Rect2D& rect, GInt nWidth, GInt nHeight,
+									 std::vector<uint8_t>& vecMask, EnumFillRule eFill = FILL_NONZERO);
+}}
+
+#endif // !X2D_RASTER_H
@@ -13,6 +13,7 @@
 #define X2D_REL_H
 
 #include "x2dbase.h"
+#include "x2dmpoly.h"
 
 namespace geo{ namespace v2
 {
@@ -48,6 +49,7 @@ namespace geo{ namespace v2
 	@return		TRUE : is CCW | FALSE : CW
 	********************************************************************************/
 	Dllexport GBool	is_ccw(const VecPoint2D& poly);
+	Dllexport GBool	is_ccw(const RingView2D& poly);
 
 	/********************************************************************************
 	*! @brief  : Determine the orientation of these three points
@@ -58,6 +60,7 @@ namespace geo{ namespace v2
 	*!					   | RIGHT     : ptc on the right p1p2
 	*!					   | LEFT      : ptc on the left  p1p2
 	*! @author : thuong.nv			- [Date] : 08/07/2023
+	*! @note   : Use exact sign when predicate is PRED_EXACT (set_predicate)
 	********************************************************************************/
 	Dllexport EnumOrien get_orientation_point_vector(const Point2D& pt1, const Point2D& pt2, const Point2D& ptC);
 
@@ -80,6 +83,7 @@ namespace geo{ namespace v2
 	@return		TRUE : is convex | FALSE : no convex
 	********************************************************************************/
 	Dllexport GBool	is_convex_polygon(const VecPoint2D& poly);
+	Dllexport GBool	is_convex_polygon(const RingView2D& poly);
 
 	/********************************************************************************
 	@brief		Check point on a line segment given by two points
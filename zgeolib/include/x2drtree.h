@@ -0,0 +1,152 @@
+////////////////////////////////////////////////////////////////////////////////////
+/*!*********************************************************************************
+* @Copyright (C) 2021-2023 thuong.nv <thuong.nv.mta@gmail.com>
+*            All rights reserved.
+************************************************************************************
+* @file     x2drtree.h
+* @create   Oct 17, 2026
+* @brief    Geometry2D packed static R-tree (STR bulk load)
+* @note     For conditions of distribution and use, see copyright notice in readme.txt
+************************************************************************************/
+
+#ifndef X2D_RTREE_H
+#define X2D_RTREE_H
+
+#include "x2dbase.h"
+#include "x2dmpoly.h"
+#include <cstdint>
+#include <cstddef>
+#include <cfloat>
+
+namespace geo { namespace v2
+{
+	/**********************************************************************************
+	* ⮟⮟ Class name: PackedRTree
+	* Static R-tree over polygon bounding boxes, built once by Sort-Tile-Recursive.
+	* All nodes are stored in one array : leaves (one per item) first, root last.
+	* Children of a node are contiguous : [m_nIndex, m_nIndex + node size)
+	***********************************************************************************/
+	class Dllexport PackedRTree
+	{
+	public:
+		typedef struct tagNode
+		{
+			GFloat		m_fMinX;	// bounding box min x
+			GFloat		m_fMinY;	// bounding box min y
+			GFloat		m_fMaxX;	// bounding box max x
+			GFloat		m_fMaxY;	// bounding box max y
+			uint32_t	m_nIndex;	// leaf : item index | other : first child node
+
+		} Node;
+
+		typedef std::vector<Node> VecNode;
+
+	protected:
+		VecNode					m_vecNode;		// all levels (leaves first, root last)
+		std::vector<uint32_t>	m_vecLevel;		// level offsets into m_vecNode (level count + 1)
+		uint32_t				m_nNodeSize;	// max children per node
+
+	public:
+		PackedRTree();
+
+	public:
+		/*******************************************************************************
+		*! @brief  : Build tree from polygon list (item i : polys[i])
+		*! @param  : [in] polys     : polygon list
+		*! @param  : [in] nNodeSize : max children per node [2 ~ 65535]
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		*! @note   : Empty polygon is kept as item but never returned by query
+		********************************************************************************/
+		void build(const VecPolyList& polys, uint32_t nNodeSize = 16);
+
+		/*******************************************************************************
+		*! @brief  : Build tree from multipolygon (item i : polygon i, use outer ring)
+		*! @param  : [in] mpoly     : multipolygon
+		*! @param  : [in] nNodeSize : max children per node [2 ~ 65535]
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		void build(const MultiPolygon2D& mpoly, uint32_t nNodeSize = 16);
+
+		/*******************************************************************************
+		*! @brief  : Build tree from bounding box list (item i : [arMin[i], arMax[i]])
+		*! @param  : [in] arMin     : box min list
+		*! @param  : [in] arMax     : box max list
+		*! @param  : [in] nCnt      : number of box
+		*! @param  : [in] nNodeSize : max children per node [2 ~ 65535]
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		void build(const Point2D* arMin, const Point2D* arMax, size_t nCnt, uint32_t nNodeSize = 16);
+
+		/*******************************************************************************
+		*! @brief  : Remove all nodes
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		void clear();
+
+		/*******************************************************************************
+		*! @brief  : Find items whose bounding box overlaps window
+		*! @param  : [in ] ptMin     : window min
+		*! @param  : [in ] ptMax     : window max
+		*! @param  : [out] vecResult : item index list (appended)
+		*! @return : number of item found
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		size_t query_window(const Point2D& ptMin, const Point2D& ptMax, std::vector<uint32_t>& vecResult) const;
+
+		/*******************************************************************************
+		*! @brief  : Find items whose bounding box contains point
+		*! @param  : [in ] pt        : point
+		*! @param  : [out] vecResult : item index list (appended)
+		*! @return : number of item found
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		*! @note   : Candidates only. Check is_point_in_polygon on results for exact test
+		********************************************************************************/
+		size_t query_point(const Point2D& pt, std::vector<uint32_t>& vecResult) const;
+
+		/*******************************************************************************
+		*! @brief  : Find k items nearest to point (distance to bounding box)
+		*! @param  : [in ] pt        : point
+		*! @param  : [in ] nK        : number of item
+		*! @param  : [out] vecResult : item index list, nearest first (appended)
+		*! @param  : [in ] fMaxDist  : max distance
+		*! @return : number of item found
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		*! @note   : Best first search. Items containing pt have distance 0
+		********************************************************************************/
+		size_t query_nearest(const Point2D& pt, size_t nK, std::vector<uint32_t>& vecResult,
+							 GFloat fMaxDist = FLT_MAX) const;
+
+		/*******************************************************************************
+		*! @brief  : Write tree to flat binary blob
+		*! @param  : [out] vecBlob : blob data (replaced)
+		*! @return : blob size (byte)
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		*! @note   : Host byte order. Layout : header | level offsets | nodes
+		********************************************************************************/
+		size_t serialize(std::vector<uint8_t>& vecBlob) const;
+
+		/*******************************************************************************
+		*! @brief  : Read tree from flat binary blob (written by serialize)
+		*! @param  : [in] pData : blob data
+		*! @param  : [in] nSize : blob size (byte)
+		*! @return : TRUE : success | FALSE : invalid blob (tree is cleared)
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		GBool deserialize(const uint8_t* pData, size_t nSize);
+
+	public:
+		GBool	empty() const		{ return m_vecNode.empty(); }
+		size_t	item_count() const	{ return m_vecLevel.size() > 1 ? m_vecLevel[1] : 0; }
+		size_t	node_count() const	{ return m_vecNode.size(); }
+		size_t	level_count() const { return m_vecLevel.size() > 0 ? m_vecLevel.size() - 1 : 0; }
+		uint32_t node_size() const	{ return m_nNodeSize; }
+
+		const VecNode& nodes() const { return m_vecNode; }
+
+	protected:
+		void	 build_levels(uint32_t nNodeSize);
+		uint32_t child_end(uint32_t nFirst) const;
+	};
+}}
+
+#endif // !X2D_RTREE_H
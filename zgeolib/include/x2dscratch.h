@@ -0,0 +1,190 @@
+////////////////////////////////////////////////////////////////////////////////////
+/*!*********************************************************************************
+* @Copyright (C) 2021-2023 thuong.nv <thuong.nv.mta@gmail.com>
+*            All rights reserved.
+************************************************************************************
+* @file     x2dscratch.h
+* @create   Oct 17, 2026
+* @brief    Geometry2D scratch arena (temporary memory of algorithms)
+* @note     For conditions of distribution and use, see copyright notice in readme.txt
+************************************************************************************/
+
+#ifndef X2D_SCRATCH_H
+#define X2D_SCRATCH_H
+
+#include "x2dbase.h"
+#include <cstdint>
+#include <cstddef>
+#include <new>
+
+namespace geo { namespace v2
+{
+	/**********************************************************************************
+	* ⮟⮟ Class name: GeoScratch
+	* Linear bump allocator. Memory is taken from blocks and given back all at once by
+	* reset (or rewind to a mark). Blocks are kept, so once the arena has grown to the
+	* working set of a loop, the loop does not hit the heap anymore
+	***********************************************************************************/
+	class Dllexport GeoScratch
+	{
+	public:
+		typedef struct tagMark
+		{
+			size_t	m_nBlock;	// current block
+			size_t	m_nOffset;	// offset in current block
+			size_t	m_nUsed;	// byte used
+
+		} Mark;
+
+	protected:
+		typedef struct tagBlock
+		{
+			uint8_t*	m_pData;
+			size_t		m_nSize;
+
+		} Block;
+
+		std::vector<Block>	m_vecBlock;
+		size_t				m_nBlock;		// current block
+		size_t				m_nOffset;		// offset in current block
+		size_t				m_nBlockSize;	// min size of new block
+
+		size_t				m_nUsed;		// byte used (include padding)
+		size_t				m_nPeak;		// max byte used
+		size_t				m_nAllocCnt;	// number of alloc since created
+		size_t				m_nHeapCnt;		// number of heap allocation since created
+
+	public:
+		explicit GeoScratch(size_t nBlockSize = 64 * 1024);
+		~GeoScratch();
+
+	private:
+		GeoScratch(const GeoScratch&);
+		GeoScratch& operator=(const GeoScratch&);
+
+	public:
+		/*******************************************************************************
+		*! @brief  : Allocate memory from arena
+		*! @param  : [in] nSize  : byte count
+		*! @param  : [in] nAlign : alignment (power of 2)
+		*! @return : memory (valid until reset or rewind)
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		*! @note   : New block (heap) only when all blocks are full
+		********************************************************************************/
+		void* alloc(size_t nSize, size_t nAlign = alignof(std::max_align_t));
+
+		/*******************************************************************************
+		*! @brief  : Give back memory (only the last allocation is reclaimed)
+		*! @param  : [in] pData : memory return by alloc
+		*! @param  : [in] nSize : byte count
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		*! @note   : Vector growth in arena reuses the released top of block
+		********************************************************************************/
+		void free(void* pData, size_t nSize);
+
+		/*******************************************************************************
+		*! @brief  : Give back all memory (blocks are kept)
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		*! @note   : Many blocks are merged into one block of the total size, the
+		*!           next cycle then fits in one block
+		********************************************************************************/
+		void reset();
+
+		/*******************************************************************************
+		*! @brief  : Free all blocks
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		void release();
+
+		/*******************************************************************************
+		*! @brief  : Get / restore allocation state (nested use)
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		*! @note   : Memory allocated after mark is given back by rewind
+		********************************************************************************/
+		Mark mark() const;
+		void rewind(const Mark& mark);
+
+		template<typename T>
+		T* alloc_array(size_t nCnt)
+		{
+			return static_cast<T*>(alloc(nCnt * sizeof(T), alignof(T)));
+		}
+
+	public:
+		size_t	used() const		{ return m_nUsed; }
+		size_t	peak() const		{ return m_nPeak; }
+		size_t	capacity() const;
+		size_t	block_count() const { return m_vecBlock.size(); }
+		size_t	alloc_count() const { return m_nAllocCnt; }
+		size_t	heap_count() const	{ return m_nHeapCnt; }
+
+		void	reset_counter()		{ m_nPeak = m_nUsed; m_nAllocCnt = 0; m_nHeapCnt = 0; }
+
+	protected:
+		void*	alloc_block(size_t nSize, size_t nAlign);
+	};
+
+	/**********************************************************************************
+	* ⮟⮟ Class name: GeoScratchFrame
+	* Rewind arena to the state at construction when going out of scope
+	***********************************************************************************/
+	class GeoScratchFrame
+	{
+	protected:
+		GeoScratch&			m_scratch;
+		GeoScratch::Mark	m_mark;
+
+	public:
+		explicit GeoScratchFrame(GeoScratch& scratch) : m_scratch(scratch), m_mark(scratch.mark()) {}
+		~GeoScratchFrame() { m_scratch.rewind(m_mark); }
+
+	private:
+		GeoScratchFrame(const GeoScratchFrame&);
+		GeoScratchFrame& operator=(const GeoScratchFrame&);
+	};
+
+	/**********************************************************************************
+	* ⮟⮟ Class name: ScratchAllocator
+	* STL allocator on GeoScratch (NULL arena : global heap)
+	***********************************************************************************/
+	template<typename T>
+	class ScratchAllocator
+	{
+	public:
+		typedef T value_type;
+
+		GeoScratch*	m_pScratch;
+
+	public:
+		ScratchAllocator(GeoScratch* pScratch = NULL) throw() : m_pScratch(pScratch) {}
+
+		template<typename U>
+		ScratchAllocator(const ScratchAllocator<U>& other) throw() : m_pScratch(other.m_pScratch) {}
+
+		T* allocate(size_t nCnt)
+		{
+			if (m_pScratch)
+				return m_pScratch->alloc_array<T>(nCnt);
+
+			return static_cast<T*>(::operator new(nCnt * sizeof(T)));
+		}
+
+		void deallocate(T* p, size_t nCnt)
+		{
+			if (m_pScratch)
+				m_pScratch->free(p, nCnt * sizeof(T));
+			else
+				::operator delete(p);
+		}
+
+		template<typename U>
+		bool operator==(const ScratchAllocator<U>& other) const { return m_pScratch == other.m_pScratch; }
+
+		template<typename U>
+		bool operator!=(const ScratchAllocator<U>& other) const { return m_pScratch != other.m_pScratch; }
+	};
+
+	typedef std::vector<Point2D, ScratchAllocator<Point2D>> ScratchVecPoint2D;
+}}
+
+#endif // !X2D_SCRATCH_H
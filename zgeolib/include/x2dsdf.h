@@ -0,0 +1,171 @@
+////////////////////////////////////////////////////////////////////////////////////
+/*!*********************************************************************************
+* @Copyright (C) 2021-2023 thuong.nv <thuong.nv.mta@gmail.com>
+*            All rights reserved.
+************************************************************************************
+* @file     x2dsdf.h
+* @create   Oct 17, 2026
+* @brief    Geometry2D signed distance field baker (polygon / polyline to grid)
+* @note     For conditions of distribution and use, see copyright notice in readme.txt
+************************************************************************************/
+
+#ifndef X2D_SDF_H
+#define X2D_SDF_H
+
+#include "x2dbase.h"
+#include "x2dmpoly.h"
+#include "x2dbool.h"
+#include "x2dpool.h"
+#include "x2draster.h"
+#include "x2dsegtree.h"
+#include <cstdint>
+#include <cstddef>
+
+namespace geo { namespace v2
+{
+	enum EnumSdfMode
+	{
+		SDF_EXACT,		// nearest edge of each pixel by SegmentTree2D
+		SDF_APPROX,		// edge cells are seeded, nearest edges spread by EDT + jump flooding
+	};
+
+	/**********************************************************************************
+	* ⮟⮟ Class name: SdfBaker2D
+	* Distance field of a multipolygon sampled at pixel centers. Closed shape : signed
+	* distance (< 0 inside, same sign as fragment.glsl RoundedBoxSDF), open shape
+	* (polylines) : unsigned distance. Distances are in world unit.
+	* Sign : crossings of the row center line with the edges (fill rule).
+	* Exact  : SegmentTree2D nearest query, radius bounded by the distance of the
+	*          previous pixel + pixel size.
+	* Approx : cells crossed by edges get their nearest edge, each pixel takes the
+	*          edge of its nearest seed cell (separable EDT), then one jump flooding
+	*          pass of step 1 (nearest of the edges of the 8 neighbours). O(W * H),
+	*          error is a fraction of pixel where the nearest edge is missed.
+	* Rows are baked by bands, each band by one pool worker
+	* @refer : https://cs.brown.edu/people/pfelzens/dt/ (distance transforms of
+	*          sampled functions), https://en.wikipedia.org/wiki/Jump_flooding_algorithm
+	***********************************************************************************/
+	class Dllexport SdfBaker2D
+	{
+	public:
+		static const GInt SDF_BAND_ROWS = 16;	// rows of a task
+
+	protected:
+		typedef struct tagSdfCross
+		{
+			GFloat	m_x;		// x of crossing (pixel space)
+			GInt	m_nDir;		// winding (see RasterEdge)
+
+		} SdfCross;
+
+	protected:
+		MultiPolygon2D			m_shape;		// copy of input
+		SegmentTree2D			m_tree;			// edges of m_shape
+		GBool					m_bClosed;		// TRUE : signed distance
+		EnumFillRule			m_eFill;		// inside test of closed shape
+
+		Point2D					m_ptOrigin;		// world point of pixel (0, 0) corner
+		GFloat					m_fScale;		// pixel per world unit
+		GInt					m_nWidth;		// grid size (pixel)
+		GInt					m_nHeight;
+		GFloat					m_fMaxDist;		// distance clamp (world, <= 0 : none)
+
+		std::vector<RasterEdge>	m_vecEdge;		// edges in pixel space sorted by top (sign)
+		std::vector<uint32_t>	m_vecBandBegin;	// edges of band b : [begin[b], begin[b + 1])
+		std::vector<uint32_t>	m_vecBandEdge;
+
+	public:
+		SdfBaker2D();
+
+	public:
+		/*******************************************************************************
+		*! @brief  : Set shape (copied, edge tree is built)
+		*! @param  : [in] mpoly   : polygons or polylines
+		*! @param  : [in] bClosed : TRUE : rings are closed, signed distance
+		*!                          FALSE : rings are polylines, unsigned distance
+		*! @param  : [in] eFill   : fill rule of inside test (bClosed)
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		void set_shape(const MultiPolygon2D& mpoly, GBool bClosed = GTrue, EnumFillRule eFill = FILL_EVENODD);
+
+		/*******************************************************************************
+		*! @brief  : Set grid
+		*! @param  : [in] rect    : world window (x, y : pixel (0, 0) corner)
+		*! @param  : [in] nWidth  : width (pixel)
+		*! @param  : [in] nHeight : height (pixel)
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		*! @note   : Scale is nWidth / rect.width (same as rasterize_polygon)
+		********************************************************************************/
+		void set_grid(const Rect2D& rect, GInt nWidth, GInt nHeight);
+
+		/*******************************************************************************
+		*! @brief  : Distance clamp (world unit)
+		*! @param  : [in] fMaxDist : |distance| <= fMaxDist (<= 0 : no clamp)
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		*! @note   : Also the range of 8-bit output. A small clamp makes exact mode
+		*!           faster (nodes farther are not visited)
+		********************************************************************************/
+		void set_max_distance(GFloat fMaxDist);
+
+		/*******************************************************************************
+		*! @brief  : Bake distance field
+		*! @param  : [out] pBuffer : grid (all pixels written, row 0 at rect.y)
+		*! @param  : [in ] nStride : element count between rows (>= width)
+		*! @param  : [in ] eMode   : exact or approximate
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		*! @note   : GFloat  : distance (world unit)
+		*!           uint8_t : 128 at edge, 255 - 0 for distance -range .. +range
+		*!           (range : max distance, 4 pixels when not set). Ready to upload
+		*!           as GL_R32F / GL_R8 texture
+		********************************************************************************/
+		void bake(GFloat* pBuffer, GInt nStride, EnumSdfMode eMode = SDF_EXACT);
+		void bake(uint8_t* pBuffer, GInt nStride, EnumSdfMode eMode = SDF_EXACT);
+
+		/*******************************************************************************
+		*! @brief  : Bake distance field (multithread)
+		*! @param  : [in] pool    : thread pool
+		*! @param  : [in] nThread : max number of worker (<= 0 : all)
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		*! @note   : Same output as serial bake
+		********************************************************************************/
+		void bake(GFloat* pBuffer, GInt nStride, EnumSdfMode eMode, GeoThreadPool& pool, GInt nThread = 0);
+		void bake(uint8_t* pBuffer, GInt nStride, EnumSdfMode eMode, GeoThreadPool& pool, GInt nThread = 0);
+
+	public:
+		GInt	width() const	{ return m_nWidth; }
+		GInt	height() const	{ return m_nHeight; }
+		GBool	closed() const	{ return m_bClosed; }
+
+	protected:
+		void	bake_field(void* pBuffer, GInt nStride, GBool bByte, EnumSdfMode eMode,
+						   GeoThreadPool* pPool, GInt nThread);
+		void	build_edges();
+		void	row_inside(GInt nRow, const uint32_t* pEdge, size_t nEdge,
+						   std::vector<SdfCross, ScratchAllocator<SdfCross>>& vecCross, uint8_t* pInside) const;
+		void	row_exact(GInt nRow, GFloat* pDist) const;
+		void	approx_field(std::vector<GFloat>& vecDist, GeoThreadPool* pPool, GInt nThread) const;
+	};
+
+	/*******************************************************************************
+	*! @brief  : Distance field of polygons (or polylines)
+	*! @param  : [in ] mpoly    : shape
+	*! @param  : [in ] rect     : world window of grid
+	*! @param  : [in ] nWidth   : width (pixel)
+	*! @param  : [in ] nHeight  : height (pixel)
+	*! @param  : [in ] fMaxDist : distance clamp / 8-bit range (<= 0 : none)
+	*! @param  : [out] vecSdf   : nWidth * nHeight values (replaced)
+	*! @param  : [in ] eMode    : exact or approximate
+	*! @param  : [in ] bClosed  : TRUE : polygons (signed) | FALSE : polylines
+	*! @param  : [in ] pPool    : thread pool (NULL : serial)
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	********************************************************************************/
+	Dllexport void bake_sdf(const MultiPolygon2D& mpoly, const Rect2D& rect, GInt nWidth, GInt nHeight, GFloat fMaxDist,
+							std::vector<GFloat>& vecSdf, EnumSdfMode eMode = SDF_EXACT, GBool bClosed = GTrue,
+							GeoThreadPool* pPool = NULL);
+
+	Dllexport void bake_sdf(const MultiPolygon2D& mpoly, const Rect2D& rect, GInt nWidth, GInt nHeight, GFloat fMaxDist,
+							std::vector<uint8_t>& vecSdf, EnumSdfMode eMode = SDF_EXACT, GBool bClosed = GTrue,
+							GeoThreadPool* pPool = NULL);
+}}
+
+#endif // !X2D_SDF_H
@@ -0,0 +1,147 @@
+////////////////////////////////////////////////////////////////////////////////////
+/*!*********************************************************************************
+* @Copyright (C) 2021-2023 thuong.nv <thuong.nv.mta@gmail.com>
+*            All rights reserved.
+************************************************************************************
+* @file     x2dsegtree.h
+* @create   Oct 17, 2026
+* @brief    Geometry2D segment AABB tree (nearest edge snapping, refit on move)
+* @note     For conditions of distribution and use, see copyright notice in readme.txt
+************************************************************************************/
+
+#ifndef X2D_SEGTREE_H
+#define X2D_SEGTREE_H
+
+#include "x2dbase.h"
+#include "x2dmpoly.h"
+#include <cstdint>
+#include <cstddef>
+
+namespace geo { namespace v2
+{
+	typedef struct tagSegSnap
+	{
+		uint32_t	m_nSeg;		// segment index (= index of start point in points)
+		uint32_t	m_nRing;	// ring of segment
+		Point2D		m_ptProj;	// nearest point on segment
+		GFloat		m_fDist;	// distance from query point to m_ptProj
+		GInt		m_nProj;	// 1 : inside segment | 2 : start point | 3 : end point
+								// (same as get_projection_point_to_lsegment)
+	} SegSnap;
+
+	typedef std::vector<SegSnap> VecSegSnap;
+
+	/**********************************************************************************
+	* ⮟⮟ Class name: SegmentTree2D
+	* Bounding volume hierarchy over the edges of a multipolygon. Segment s goes from
+	* point s to the next point of its ring, so a moved vertex touches two segments.
+	* Nodes are stored in one array (root : 0, children of a node are contiguous),
+	* a leaf holds up to SEGTREE_LEAF_SIZE segments
+	***********************************************************************************/
+	class Dllexport SegmentTree2D
+	{
+	public:
+		static const uint32_t SEGTREE_NONE		= 0xFFFFFFFF;
+		static const uint32_t SEGTREE_LEAF_SIZE	= 4;
+
+		typedef struct tagNode
+		{
+			GFloat		m_fMinX;	// bounding box min x
+			GFloat		m_fMinY;	// bounding box min y
+			GFloat		m_fMaxX;	// bounding box max x
+			GFloat		m_fMaxY;	// bounding box max y
+			uint32_t	m_nFirst;	// leaf : first in m_vecOrder | other : left child (right = left + 1)
+			uint32_t	m_nCount;	// leaf : number of segment | other : 0
+			uint32_t	m_nParent;	// parent node (root : SEGTREE_NONE)
+
+		} Node;
+
+		typedef std::vector<Node> VecNode;
+
+	protected:
+		VecNode					m_vecNode;		// root first
+		VecPoint2D				m_vecPoint;		// copy of points of multipolygon
+		std::vector<uint32_t>	m_vecSegEnd;	// end point of segment s (SEGTREE_NONE : no segment)
+		std::vector<uint32_t>	m_vecSegPrev;	// segment ending at point p (SEGTREE_NONE : none)
+		std::vector<uint32_t>	m_vecSegRing;	// ring of segment s
+		std::vector<uint32_t>	m_vecSegLeaf;	// leaf node of segment s
+		std::vector<uint32_t>	m_vecOrder;		// segments ordered by leaf
+
+	public:
+		SegmentTree2D();
+
+	public:
+		/*******************************************************************************
+		*! @brief  : Build tree from all edges of multipolygon
+		*! @param  : [in] mpoly   : multipolygon (points are copied)
+		*! @param  : [in] bClosed : TRUE : edge last -> first point is added (polygon)
+		*!                          FALSE : rings are polylines
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		*! @note   : Top-down median split on the longer axis, O(n log n)
+		********************************************************************************/
+		void build(const MultiPolygon2D& mpoly, GBool bClosed = GTrue);
+
+		/*******************************************************************************
+		*! @brief  : Remove all nodes
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		void clear();
+
+		/*******************************************************************************
+		*! @brief  : Nearest segment within snap radius
+		*! @param  : [in ] pt     : point (cursor)
+		*! @param  : [in ] fSnap  : snap radius
+		*! @param  : [out] result : nearest segment (not changed if not found)
+		*! @return : TRUE : found | FALSE : no segment within fSnap
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		*! @note   : Same test as is_snap_point_to_lsegment on every segment. Nearer
+		*!           child is visited first, nodes farther than the best are skipped
+		********************************************************************************/
+		GBool query_nearest(const Point2D& pt, GFloat fSnap, SegSnap& result) const;
+
+		/*******************************************************************************
+		*! @brief  : All segments within snap radius
+		*! @param  : [in ] pt        : point (cursor)
+		*! @param  : [in ] fSnap     : snap radius
+		*! @param  : [out] vecResult : segments (appended, nearest first)
+		*! @return : number of segment found
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		size_t query_radius(const Point2D& pt, GFloat fSnap, VecSegSnap& vecResult) const;
+
+		/*******************************************************************************
+		*! @brief  : Move point and refit boxes of its segments up to the root
+		*! @param  : [in] nPoint : point index (index in points of multipolygon)
+		*! @param  : [in] pt     : new position
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		*! @note   : O(log n). Refit stops at the first node whose box is unchanged.
+		*!           Tree is not rebalanced, build again after large edits
+		********************************************************************************/
+		void move_point(uint32_t nPoint, const Point2D& pt);
+
+		/*******************************************************************************
+		*! @brief  : Update all points (same topology) and refit all nodes
+		*! @param  : [in] mpoly : multipolygon used by build (points moved)
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		*! @note   : O(n), bottom-up
+		********************************************************************************/
+		void refit(const MultiPolygon2D& mpoly);
+		void refit();
+
+	public:
+		GBool			empty() const		  { return m_vecNode.empty(); }
+		size_t			node_count() const	  { return m_vecNode.size(); }
+		size_t			point_count() const	  { return m_vecPoint.size(); }
+		const Point2D&	point(uint32_t nPoint) const { return m_vecPoint[nPoint]; }
+		uint32_t		segment_end(uint32_t nSeg) const { return m_vecSegEnd[nSeg]; }
+
+		const VecNode&	nodes() const { return m_vecNode; }
+
+	protected:
+		void	refit_leaf(uint32_t nNode);
+		GBool	refit_inner(uint32_t nNode);
+		void	segment_snap(uint32_t nSeg, const Point2D& pt, SegSnap& snap, GDouble& dDist2) const;
+	};
+}}
+
+#endif // !X2D_SEGTREE_H
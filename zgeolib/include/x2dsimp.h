@@ -0,0 +1,138 @@
+////////////////////////////////////////////////////////////////////////////////////
+/*!*********************************************************************************
+* @Copyright (C) 2021-2023 thuong.nv <thuong.nv.mta@gmail.com>
+*            All rights reserved.
+************************************************************************************
+* @file     x2dsimp.h
+* @create   Oct 17, 2026
+* @brief    Geometry2D polyline / polygon simplification and level of detail
+* @note     For conditions of distribution and use, see copyright notice in readme.txt
+************************************************************************************/
+
+#ifndef X2D_SIMP_H
+#define X2D_SIMP_H
+
+#include "x2dbase.h"
+#include "x2dmpoly.h"
+
+namespace geo { namespace v2
+{
+	enum EnumSimplify
+	{
+		SIMPLIFY_DP,	// Douglas-Peucker (tolerance : distance)
+		SIMPLIFY_VW,	// Visvalingam-Whyatt (tolerance : area of triangle)
+	};
+
+	/*******************************************************************************
+	*! @brief  : Significance of each point (point is kept for threshold < value)
+	*! @param  : [in ] line    : points
+	*! @param  : [in ] bClosed : TRUE : ring (closing point is ignored) | FALSE : polyline
+	*! @param  : [in ] eMethod : DP : squared distance | VW : effective area
+	*! @param  : [out] vecSig  : value of each point (replaced, size of line)
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Values are nested : the points kept by a larger threshold are also
+	*!           kept by a smaller one. End points of polyline (and 3 points of ring)
+	*!           are always kept
+	********************************************************************************/
+	Dllexport void get_simplify_significance(const RingView2D& line, GBool bClosed, EnumSimplify eMethod,
+											 std::vector<GDouble>& vecSig);
+
+	/*******************************************************************************
+	*! @brief  : Simplify polyline / ring use Douglas-Peucker algorithm
+	*! @param  : [in ] line       : points
+	*! @param  : [in ] fTolerance : max distance of removed point to result
+	*! @param  : [in ] bClosed    : TRUE : ring | FALSE : polyline
+	*! @param  : [out] vecOut     : simplified points (replaced)
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Ring keeps its closing point if input has it. Result may self-intersect
+	*! @refer  : https://en.wikipedia.org/wiki/Ramer-Douglas-Peucker_algorithm
+	********************************************************************************/
+	Dllexport void simplify_douglas_peucker(const RingView2D& line, GFloat fTolerance, GBool bClosed, VecPoint2D& vecOut);
+	Dllexport VecPoint2D simplify_douglas_peucker(const VecPoint2D& line, GFloat fTolerance, GBool bClosed = GFalse);
+
+	/*******************************************************************************
+	*! @brief  : Simplify polyline / ring use Visvalingam-Whyatt algorithm
+	*! @param  : [in ] line   : points
+	*! @param  : [in ] fArea  : points of effective area <= fArea are removed
+	*! @param  : [in ] bClosed: TRUE : ring | FALSE : polyline
+	*! @param  : [out] vecOut : simplified points (replaced)
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Ring keeps its closing point if input has it. Result may self-intersect
+	*! @refer  : https://en.wikipedia.org/wiki/Visvalingam-Whyatt_algorithm
+	********************************************************************************/
+	Dllexport void simplify_visvalingam(const RingView2D& line, GFloat fArea, GBool bClosed, VecPoint2D& vecOut);
+	Dllexport VecPoint2D simplify_visvalingam(const VecPoint2D& line, GFloat fArea, GBool bClosed = GFalse);
+
+	/**********************************************************************************
+	* ⮟⮟ Class name: PolygonLod2D
+	* Level of detail pyramid of multipolygon, built once. Level 0 is the source, level
+	* k is simplified with tolerance fMinTol * 2^(k - 1) (DP : distance | VW : area is
+	* tolerance^2). Levels with the same points are merged. Level is selected from the
+	* camera zoom (pixel per unit, see gp::Camera2D::GetZoom)
+	***********************************************************************************/
+	class Dllexport PolygonLod2D
+	{
+	protected:
+		std::vector<MultiPolygon2D>	m_vecLevel;		// level 0 : source
+		std::vector<GFloat>			m_vecTol;		// tolerance of each level (increasing)
+		EnumSimplify				m_eMethod;
+
+	public:
+		PolygonLod2D();
+
+	public:
+		/*******************************************************************************
+		*! @brief  : Build levels (can be called again to rebuild)
+		*! @param  : [in] mpoly     : source multipolygon
+		*! @param  : [in] fMinTol   : tolerance of level 1 (unit of mpoly)
+		*! @param  : [in] eMethod   : simplification method
+		*! @param  : [in] nMaxLevel : max number of level (source included)
+		*! @param  : [in] bClosed   : TRUE : rings | FALSE : rings are polylines
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		*! @note   : Significance of points is computed once, each level only filters.
+		*!           Building stops when no ring can be simplified anymore
+		********************************************************************************/
+		void build(const MultiPolygon2D& mpoly, GFloat fMinTol, EnumSimplify eMethod = SIMPLIFY_DP,
+				   GInt nMaxLevel = 16, GBool bClosed = GTrue);
+
+		/*******************************************************************************
+		*! @brief  : Release levels
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		void clear();
+
+		/*******************************************************************************
+		*! @brief  : Coarsest level whose tolerance <= fTolerance
+		*! @param  : [in] fTolerance : allowed error (unit of mpoly)
+		*! @return : level index (0 : source)
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		GInt get_level(GFloat fTolerance) const;
+
+		/*******************************************************************************
+		*! @brief  : Level for camera zoom
+		*! @param  : [in] fZoom     : pixel per unit (gp::Camera2D::GetZoom)
+		*! @param  : [in] fPixelTol : allowed error on screen (pixel)
+		*! @return : level index (0 : source)
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		GInt get_level_zoom(GFloat fZoom, GFloat fPixelTol = 0.5f) const;
+
+		/*******************************************************************************
+		*! @brief  : Multipolygon for camera zoom (render / hit test)
+		*! @param  : [in] fZoom     : pixel per unit (gp::Camera2D::GetZoom)
+		*! @param  : [in] fPixelTol : allowed error on screen (pixel)
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		const MultiPolygon2D& select(GFloat fZoom, GFloat fPixelTol = 0.5f) const;
+
+	public:
+		GBool					empty() const { return m_vecLevel.empty(); }
+		GInt					level_count() const { return static_cast<GInt>(m_vecLevel.size()); }
+		const MultiPolygon2D&	level(GInt nLevel) const { return m_vecLevel[nLevel]; }
+		GFloat					level_tolerance(GInt nLevel) const { return m_vecTol[nLevel]; }
+		EnumSimplify			method() const { return m_eMethod; }
+	};
+}}
+
+#endif // !X2D_SIMP_H
@@ -0,0 +1,87 @@
+////////////////////////////////////////////////////////////////////////////////////
+/*!*********************************************************************************
+* @Copyright (C) 2021-2023 thuong.nv <thuong.nv.mta@gmail.com>
+*            All rights reserved.
+************************************************************************************
+* @file     x2dslice.h
+* @create   Oct 17, 2026
+* @brief    Geometry2D polygon slicing and hatching by many lines in one sweep
+* @note     For conditions of distribution and use, see copyright notice in readme.txt
+************************************************************************************/
+
+#ifndef X2D_SLICE_H
+#define X2D_SLICE_H
+
+#include "x2dbase.h"
+#include "x2dmpoly.h"
+#include <cstdint>
+#include <cstddef>
+
+namespace geo { namespace v2
+{
+	/*******************************************************************************
+	*! @brief  : Hatch segments of multipolygon by parallel lines
+	*! @param  : [in ] mpoly      : multipolygon (even-odd rule over all rings)
+	*! @param  : [in ] ptOrigin   : point on line 0
+	*! @param  : [in ] vDir       : line direction
+	*! @param  : [in ] fSpacing   : distance between lines (> 0)
+	*! @param  : [out] vecSegment : segments inside mpoly (appended, line by line from
+	*!                              the right side of vDir, along vDir on each line)
+	*! @param  : [out] pLine      : line k of each segment (NULL : not used). Line k
+	*!                              passes through ptOrigin + k * fSpacing * left normal
+	*!                              (k < 0 : right side of ptOrigin)
+	*! @return : number of segment
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Edges are bucketed to the lines they cross and all crossings are
+	*!           sorted once : O((n + c) log(n + c)), n edges, c crossings (not one
+	*!           cut per line). Parts of a line on a ring edge give no segment
+	********************************************************************************/
+	Dllexport size_t hatch_polygon(const MultiPolygon2D& mpoly, const Point2D& ptOrigin, const Vec2D& vDir, GFloat fSpacing,
+								   VecLine2D& vecSegment, std::vector<GInt>* pLine = NULL);
+
+	/*******************************************************************************
+	*! @brief  : Hatch segments of multipolygon by line set
+	*! @param  : [in ] mpoly      : multipolygon (even-odd rule over all rings)
+	*! @param  : [in ] vecLines   : lines (infinite line through ptStart, ptEnd)
+	*! @param  : [out] vecSegment : segments inside mpoly (appended)
+	*! @param  : [out] pLine      : index in vecLines of each segment (NULL : not used)
+	*! @return : number of segment
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Parallel lines are grouped, one sweep per direction
+	********************************************************************************/
+	Dllexport size_t hatch_polygon(const MultiPolygon2D& mpoly, const VecLine2D& vecLines,
+								   VecLine2D& vecSegment, std::vector<GInt>* pLine = NULL);
+
+	/*******************************************************************************
+	*! @brief  : Slice multipolygon into strips between parallel lines
+	*! @param  : [in ] mpoly    : polygons (outer ring + holes, rings do not cross)
+	*! @param  : [in ] ptOrigin : point on line 0
+	*! @param  : [in ] vDir     : line direction
+	*! @param  : [in ] fSpacing : distance between lines (> 0)
+	*! @param  : [out] result   : pieces (appended, outer ring CCW, hole CW, strip by
+	*!                            strip from the right side of vDir)
+	*! @param  : [out] pStrip   : strip k of each piece (NULL : not used). Strip k is
+	*!                            between line k and line k + 1 (see hatch_polygon)
+	*! @return : number of piece
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Edges are split at the lines and linked with the hatch segments in
+	*!           one pass (no repeated cut_line2poly). Pieces of neighbour strips
+	*!           share their cut points exactly
+	********************************************************************************/
+	Dllexport size_t slice_polygon(const MultiPolygon2D& mpoly, const Point2D& ptOrigin, const Vec2D& vDir, GFloat fSpacing,
+								   MultiPolygon2D& result, std::vector<GInt>* pStrip = NULL);
+
+	/*******************************************************************************
+	*! @brief  : Slice multipolygon by line set
+	*! @param  : [in ] mpoly    : polygons (outer ring + holes, rings do not cross)
+	*! @param  : [in ] vecLines : lines (infinite line through ptStart, ptEnd)
+	*! @param  : [out] result   : pieces (appended, outer ring CCW, hole CW)
+	*! @return : number of piece
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Parallel lines are grouped, pieces of one direction are sliced by
+	*!           the next direction
+	********************************************************************************/
+	Dllexport size_t slice_polygon(const MultiPolygon2D& mpoly, const VecLine2D& vecLines, MultiPolygon2D& result);
+}}
+
+#endif // !X2D_SLICE_H
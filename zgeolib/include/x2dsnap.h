@@ -0,0 +1,52 @@
+////////////////////////////////////////////////////////////////////////////////////
+/*!*********************************************************************************
+* @Copyright (C) 2021-2023 thuong.nv <thuong.nv.mta@gmail.com>
+*            All rights reserved.
+************************************************************************************
+* @file     x2dsnap.h
+* @create   Oct 17, 2026
+* @brief    Geometry2D snap rounding of segments on integer grid
+* @note     For conditions of distribution and use, see copyright notice in readme.txt
+************************************************************************************/
+
+#ifndef X2D_SNAP_H
+#define X2D_SNAP_H
+
+#include "x2dkernel.h"
+
+namespace geo { namespace v2
+{
+	/////////////////////////////////////////////////////////////////////////////////
+	// Snap rounding works on doubled coordinates (pixel border = center +/- 0.5),
+	// all predicates are exact in int64 while coordinates are in
+	// [-GSNAP_COORD_MAX, GSNAP_COORD_MAX]
+
+	#define GSNAP_COORD_MAX		(int64_t(1) << 29)
+
+	typedef struct tagSnapSegment
+	{
+		Point2Dx	pt1;
+		Point2Dx	pt2;
+		GInt		nTag;	// user data (copied to all pieces)
+
+	} SnapSegment;
+
+	typedef std::vector<SnapSegment> VecSnapSegment;
+
+	/*******************************************************************************
+	*! @brief  : Snap rounding of segments (iterated snap rounding)
+	*! @param  : [in ] vecSeg   : segments (fixed point)
+	*! @param  : [out] vecOut   : pieces (replaced) : endpoints on grid, pieces only
+	*!                            meet at endpoints or overlap completely
+	*! @param  : [in ] nMaxIter : max number of rounds
+	*! @return : TRUE : OK | FALSE : coordinate out of GSNAP_COORD_MAX (vecOut empty)
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Hot pixel : unit square around an endpoint or a rounded crossing.
+	*!           Each segment is rerouted through the centers of all hot pixels it
+	*!           touches. A round is repeated on its output until nothing changes,
+	*!           so a vertex is never left on (or very near) a foreign piece
+	********************************************************************************/
+	Dllexport GBool snap_round_segments(const VecSnapSegment& vecSeg, VecSnapSegment& vecOut, GInt nMaxIter = 4);
+}}
+
+#endif // !X2D_SNAP_H
@@ -0,0 +1,73 @@
+////////////////////////////////////////////////////////////////////////////////////
+/*!*********************************************************************************
+* @Copyright (C) 2021-2023 thuong.nv <thuong.nv.mta@gmail.com>
+*            All rights reserved.
+************************************************************************************
+* @file     x2dsoa.h
+* @create   Oct 17, 2026
+* @brief    Geometry2D structure-of-arrays point buffer (batch / SIMD input)
+* @note     For conditions of distribution and use, see copyright notice in readme.txt
+************************************************************************************/
+
+#ifndef X2D_SOA_H
+#define X2D_SOA_H
+
+#include "x2dbase.h"
+#include "x2dmpoly.h"
+#include <cstdint>
+#include <cstddef>
+
+namespace geo { namespace v2
+{
+	/**********************************************************************************
+	* ⮟⮟ Struct name: PointSoA2D
+	* Point list stored as separate x[] and y[] arrays
+	***********************************************************************************/
+	typedef struct tagPointSoA2D
+	{
+		std::vector<GFloat>	x;
+		std::vector<GFloat>	y;
+
+	public:
+		size_t	size() const { return x.size(); }
+		GBool	empty() const { return x.empty(); }
+
+		void	reserve(size_t n) { x.reserve(n); y.reserve(n); }
+		void	resize(size_t n) { x.resize(n); y.resize(n); }
+		void	clear() { x.clear(); y.clear(); }
+
+		void	push_back(const Point2D& pt) { x.push_back(pt.x); y.push_back(pt.y); }
+		Point2D	get(size_t i) const { return Point2D(x[i], y[i]); }
+
+	} PointSoA2D;
+
+	/*******************************************************************************
+	*! @brief  : Convert point list (AoS) to structure-of-arrays buffer
+	*! @param  : [in ] points : point list
+	*! @param  : [out] soa    : buffer (resized to points.size())
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	********************************************************************************/
+	Dllexport void convert_points_to_soa(const VecPoint2D& points, PointSoA2D& soa);
+	Dllexport void convert_points_to_soa(const RingView2D& points, PointSoA2D& soa);
+
+	/*******************************************************************************
+	*! @brief  : Convert structure-of-arrays buffer to point list (AoS)
+	*! @param  : [in ] soa    : buffer
+	*! @param  : [out] points : point list (resized to soa.size())
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	********************************************************************************/
+	Dllexport void convert_soa_to_points(const PointSoA2D& soa, VecPoint2D& points);
+
+	/***********************************************************************************
+	*! @brief	: check list point inside polygon (SIMD when available)
+	*! @param	: [in ] pts  : point buffer
+	*! @param	: [in ] poly : Polygon
+	*! @param	: [out] out  : 1 : inside | 0 : outside (size >= pts.size())
+	*! @author	: thuong.nv			- [Date] : 10/17/2026
+	*! @note	: Build PreparedPolygon once and call contains() when the polygon is reused
+	***********************************************************************************/
+	Dllexport void is_point_in_polygon(const PointSoA2D& pts, const VecPoint2D& poly, uint8_t* out);
+	Dllexport void is_point_in_polygon(const PointSoA2D& pts, const RingView2D& poly, uint8_t* out);
+}}
+
+#endif // !X2D_SOA_H
@@ -0,0 +1,161 @@
+////////////////////////////////////////////////////////////////////////////////////
+/*!*********************************************************************************
+* @Copyright (C) 2021-2023 thuong.nv <thuong.nv.mta@gmail.com>
+*            All rights reserved.
+************************************************************************************
+* @file     x2dsweep.h
+* @create   Oct 17, 2026
+* @brief    Geometry2D sweep-line segment intersection (Bentley-Ottmann)
+* @note     For conditions of distribution and use, see copyright notice in readme.txt
+************************************************************************************/
+
+#ifndef X2D_SWEEP_H
+#define X2D_SWEEP_H
+
+#include "x2dbase.h"
+#include "x2dmpoly.h"
+#include "x2dscratch.h"
+
+namespace geo { namespace v2
+{
+	/**********************************************************************************
+	* ⮟⮟ Struct name: SegInter
+	* Intersection between two segments
+	***********************************************************************************/
+	typedef struct tagSegInter
+	{
+		GInt	nSeg1;	// index of first segment (nSeg1 < nSeg2)
+		GInt	nSeg2;	// index of second segment
+		Point2D	pt;		// intersection point
+
+	} SegInter;
+
+	typedef std::vector<SegInter> VecSegInter;
+	typedef std::vector<SegInter, ScratchAllocator<SegInter>> ScratchVecSegInter;
+
+	/**********************************************************************************
+	* ⮟⮟ Class name: SweepIntersector
+	* Report every intersecting segment pair in O((n + k) log n)
+	***********************************************************************************/
+	class Dllexport SweepIntersector
+	{
+	protected:
+		typedef struct tagSweepSeg
+		{
+			GDouble	x1, y1;		// left (lower) end point
+			GDouble	x2, y2;		// right (upper) end point
+			GInt	nGroup;		// group id (pair of the same group can be skipped)
+
+		} SweepSeg;
+
+		typedef std::vector<SweepSeg, ScratchAllocator<SweepSeg>> VecSweepSeg;
+
+	protected:
+		VecSweepSeg	m_vecSeg;
+		GeoScratch*	m_pScratch;	// memory of segments and sweep status (NULL : heap)
+
+		// Current event point (status order is evaluated at this point)
+		GDouble		m_dSweepX;
+		GDouble		m_dSweepY;
+		GDouble		m_dEps;
+
+	public:
+		explicit SweepIntersector(GeoScratch* pScratch = NULL);
+
+	public:
+		/*******************************************************************************
+		*! @brief  : Remove all segments
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		void clear();
+
+		/*******************************************************************************
+		*! @brief  : Reserve memory for segments
+		*! @param  : [in] nCnt : number of segment
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		void reserve(size_t nCnt);
+
+		/*******************************************************************************
+		*! @brief  : Add segment
+		*! @param  : [in] pt1    : first point
+		*! @param  : [in] pt2    : second point
+		*! @param  : [in] nGroup : group id
+		*! @return : index of segment
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		GInt add_segment(const Point2D& pt1, const Point2D& pt2, GInt nGroup = 0);
+
+		/*******************************************************************************
+		*! @brief  : Add all edges of polygon (edge i : poly[i] -> poly[i + 1])
+		*! @param  : [in] poly   : polygon
+		*! @param  : [in] nGroup : group id
+		*! @return : index of first edge
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		GInt add_polygon(const VecPoint2D& poly, GInt nGroup = 0);
+		GInt add_polygon(const RingView2D& poly, GInt nGroup = 0);
+
+		/*******************************************************************************
+		*! @brief  : Number of segment
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		********************************************************************************/
+		GInt size() const { return static_cast<GInt>(m_vecSeg.size()); }
+
+		/*******************************************************************************
+		*! @brief  : Run sweep line and report intersections
+		*! @param  : [out] vecInter   : intersection list (sorted by x then y)
+		*! @param  : [in ] bOnlyCheck : stop at the first intersection
+		*! @param  : [in ] bDiffGroup : only report pair of segments of different group
+		*! @param  : [in ] bSkipParallel : don't report pair of parallel segments
+		*! @return : number of intersecting pair
+		*! @author : thuong.nv			- [Date] : 10/17/2026
+		*! @note   : Segments sharing an end point are reported at that point.
+		*!           Collinear overlapping segments are reported at the end points of
+		*!           the overlapping part
+		********************************************************************************/
+		GInt run(VecSegInter* vecInter = NULL, GBool bOnlyCheck = GFalse, GBool bDiffGroup = GFalse, GBool bSkipParallel = GFalse);
+		GInt run(ScratchVecSegInter* vecInter, GBool bOnlyCheck = GFalse, GBool bDiffGroup = GFalse, GBool bSkipParallel = GFalse);
+
+	protected:
+		template<typename TVecInter>
+		GInt	run_sweep(TVecInter* vecInter, GBool bOnlyCheck, GBool bDiffGroup, GBool bSkipParallel);
+
+		GDouble y_at(const SweepSeg& seg) const;
+		GBool	less(GInt nSeg1, GInt nSeg2) const;
+		GBool	intersect(GInt nSeg1, GInt nSeg2, GDouble& x, GDouble& y) const;
+		GBool	is_parallel(GInt nSeg1, GInt nSeg2) const;
+
+		friend struct SweepStatusLess;
+	};
+
+	/*******************************************************************************
+	*! @brief  : Get intersections between edges of two polygons (sweep line)
+	*! @param  : [in ] poly1      : first polygon
+	*! @param  : [in ] poly2      : second polygon
+	*! @param  : [out] vecInter   : nSeg1 : edge index of poly1 | nSeg2 : edge index of poly2
+	*! @param  : [in ] bOnlyCheck : stop at the first intersection
+	*! @return : INT : intersection number.
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Edge i : poly[i] -> poly[i + 1]. Parallel edges are not reported
+	*!           (same as intersect_2lsegment)
+	********************************************************************************/
+	Dllexport GInt intersect_2polygon(const VecPoint2D& poly1, const VecPoint2D& poly2, VecSegInter* vecInter = NULL, GBool bOnlyCheck = GFalse);
+
+	/*******************************************************************************
+	*! @brief  : Get intersections between edges of two polygons (scratch memory)
+	*! @param  : [in ] poly1      : first polygon
+	*! @param  : [in ] poly2      : second polygon
+	*! @param  : [in ] scratch    : temporary memory (event queue, sweep status)
+	*! @param  : [out] vecInter   : nSeg1 : edge index of poly1 | nSeg2 : edge index of poly2
+	*! @param  : [in ] bOnlyCheck : stop at the first intersection
+	*! @return : INT : intersection number.
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Same result as intersect_2polygon. Temporary memory is kept in
+	*!           scratch until the caller rewinds it (vecInter may use the same scratch)
+	********************************************************************************/
+	Dllexport GInt intersect_2polygon(const RingView2D& poly1, const RingView2D& poly2, GeoScratch& scratch,
+									  ScratchVecSegInter* vecInter = NULL, GBool bOnlyCheck = GFalse);
+}}
+
+#endif // !X2D_SWEEP_H
@@ -0,0 +1,80 @@
+////////////////////////////////////////////////////////////////////////////////////
+/*!*********************************************************************************
+* @Copyright (C) 2021-2023 thuong.nv <thuong.nv.mta@gmail.com>
+*            All rights reserved.
+************************************************************************************
+* @file     x2dtrig.h
+* @create   Oct 17, 2026
+* @brief    Geometry2D polygon triangulation (ear clipping on linked ring)
+* @note     For conditions of distribution and use, see copyright notice in readme.txt
+************************************************************************************/
+
+#ifndef X2D_TRIG_H
+#define X2D_TRIG_H
+
+#include "x2dbase.h"
+#include "x2dmpoly.h"
+#include "x2dscratch.h"
+#include <cstdint>
+
+namespace geo { namespace v2
+{
+	/*******************************************************************************
+	*! @brief  : Triangulate polygon without hole
+	*! @param  : [in ] poly     : polygon (CW or CCW)
+	*! @param  : [out] vecIndex : triangle list (3 indices into poly per triangle)
+	*! @return : number of triangle
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Triangles are counterclockwise (CCW)
+	********************************************************************************/
+	Dllexport GInt triangulate_polygon(const VecPoint2D& poly, std::vector<uint32_t>& vecIndex);
+	Dllexport GInt triangulate_polygon(const RingView2D& poly, std::vector<uint32_t>& vecIndex);
+
+	/*******************************************************************************
+	*! @brief  : Triangulate polygon without hole (scratch memory)
+	*! @param  : [in ] poly     : polygon (CW or CCW)
+	*! @param  : [out] vecIndex : triangle list (3 indices into poly per triangle)
+	*! @param  : [in ] scratch  : temporary memory (ring nodes, hole queue)
+	*! @return : number of triangle
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Same result as triangulate_polygon. Temporary memory is given back
+	*!           to scratch on return, reuse scratch and vecIndex between calls
+	********************************************************************************/
+	Dllexport GInt triangulate_polygon(const RingView2D& poly, std::vector<uint32_t>& vecIndex, GeoScratch& scratch);
+
+	/*******************************************************************************
+	*! @brief  : Triangulate polygon with holes
+	*! @param  : [in ] rings     : rings[0] : outer ring | other : holes
+	*! @param  : [out] vecVertex : vertex array (all rings in order)
+	*! @param  : [out] vecIndex  : triangle list (3 indices into vecVertex per triangle)
+	*! @return : number of triangle
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Triangles are counterclockwise (CCW)
+	********************************************************************************/
+	Dllexport GInt triangulate_polygon(const VecPolyList& rings, VecPoint2D& vecVertex, std::vector<uint32_t>& vecIndex);
+	Dllexport GInt triangulate_polygon(const VecPolyList& rings, VecPoint2D& vecVertex, std::vector<uint32_t>& vecIndex, GeoScratch& scratch);
+
+	/*******************************************************************************
+	*! @brief  : Triangulate all polygons of multipolygon
+	*! @param  : [in ] mpoly    : multipolygon
+	*! @param  : [out] vecIndex : triangle list (3 indices into mpoly.points() per triangle)
+	*! @return : number of triangle
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Triangles are counterclockwise (CCW)
+	********************************************************************************/
+	Dllexport GInt triangulate_polygon(const MultiPolygon2D& mpoly, std::vector<uint32_t>& vecIndex);
+
+	/*******************************************************************************
+	*! @brief  : Triangulate all polygons of multipolygon (scratch memory)
+	*! @param  : [in ] mpoly    : multipolygon
+	*! @param  : [out] vecIndex : triangle list (3 indices into mpoly.points() per triangle)
+	*! @param  : [in ] scratch  : temporary memory (ring nodes, hole queue)
+	*! @return : number of triangle
+	*! @author : thuong.nv			- [Date] : 10/17/2026
+	*! @note   : Same result as triangulate_polygon. Nodes of each polygon are given
+	*!           back to scratch before the next polygon
+	********************************************************************************/
+	Dllexport GInt triangulate_polygon(const MultiPolygon2D& mpoly, std::vector<uint32_t>& vecIndex, GeoScratch& scratch);
+}}
+
+#endif // !X2D_TRIG_H
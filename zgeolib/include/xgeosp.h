@@ -31,6 +31,13 @@ namespace geo {
 	********************************************************************************/
 	Dllexport VecPoint2D	 convert_rectf_to_points(const Rect2D& rect);
 
+	/*******************************************************************************
+	@brief		Convert a rect into 4 points (no allocation)
+	@param		[in]  rect	  : RectF
+	@param		[out] arPoint : 4 points (same order as convert_rectf_to_points)
+	********************************************************************************/
+	Dllexport void			 convert_rectf_to_points(const Rect2D& rect, Point2D* arPoint);
+
 	/*******************************************************************************
 	*! @brief  : Convert from Radian to Degree
 	*! @param  : [in] fRad : angle float (radian)
@@ -2,19 +2,125 @@
 #include "x2drel.h"
 #include "x2dpoly.h"
 #include "x2dint.h"
+#include "x2dprep.h"
+#include "x2dsweep.h"
+#include "x2dbool.h"
+#include "x2dtrig.h"
+#include "x2dpred.h"
+#include "x2dkernel.h"
+#include "x2dpool.h"
 
 #include <map>
 #include <set>
+#include <thread>
+#include <algorithm>
+#include <functional>
 #include "xgeosp.h"
 
 #pragma warning(disable : 26812)
 
 namespace geo {	namespace v2 {
 
+/***********************************************************************************
+*! @brief  : Orientation of point b to vector oa (double precision)
+*! @return : > 0 : left (ccw) | < 0 : right (cw) | 0 : collinear
+***********************************************************************************/
+static inline GDouble hull_cross(const Point2D& o, const Point2D& a, const Point2D& b)
+{
+	if (get_predicate() == PRED_EXACT)
+		return orient2d(o, a, b);
+
+	return (GDouble(a.x) - o.x) * (GDouble(b.y) - o.y) -
+		   (GDouble(a.y) - o.y) * (GDouble(b.x) - o.x);
+}
+
+/***********************************************************************************
+*! @brief  : Akl-Toussaint heuristic : discard points inside the octagon of the
+*!           extreme points (min/max of x, y, x + y, x - y)
+*! @param  : [in ] pts     : point list
+*! @param  : [in ] nCnt    : number of point
+*! @param  : [out] vecKeep : points which can be on the hull
+***********************************************************************************/
+static void hull_prefilter(const Point2D* pts, size_t nCnt, VecPoint2D& vecKeep)
+{
+	// Index : 0 min x | 1 min x+y | 2 min y | 3 max x-y | 4 max x | 5 max x+y | 6 max y | 7 min x-y
+	size_t arIdx[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+
+	for (size_t i = 1; i < nCnt; i++)
+	{
+		const Point2D& pt = pts[i];
+
+		if (pt.x < pts[arIdx[0]].x) arIdx[0] = i;
+		if (pt.x + pt.y < pts[arIdx[1]].x + pts[arIdx[1]].y) arIdx[1] = i;
+		if (pt.y < pts[arIdx[2]].y) arIdx[2] = i;
+		if (pt.x - pt.y > pts[arIdx[3]].x - pts[arIdx[3]].y) arIdx[3] = i;
+		if (pt.x > pts[arIdx[4]].x) arIdx[4] = i;
+		if (pt.x + pt.y > pts[arIdx[5]].x + pts[arIdx[5]].y) arIdx[5] = i;
+		if (pt.y > pts[arIdx[6]].y) arIdx[6] = i;
+		if (pt.x - pt.y < pts[arIdx[7]].x - pts[arIdx[7]].y) arIdx[7] = i;
+	}
+
+	// Octagon (CCW) without duplicate vertex
+	Point2D arOct[8]; int nOctCnt = 0;
+
+	for (int k = 0; k < 8; k++)
+	{
+		const Point2D& pt = pts[arIdx[k]];
+
+		if (nOctCnt > 0 && arOct[nOctCnt - 1].x == pt.x && arOct[nOctCnt - 1].y == pt.y)
+			continue;
+
+		arOct[nOctCnt++] = pt;
+	}
+
+	while (nOctCnt > 1 && arOct[nOctCnt - 1].x == arOct[0].x && arOct[nOctCnt - 1].y == arOct[0].y)
+		nOctCnt--;
+
+	vecKeep.reserve(vecKeep.size() + nCnt / 4 + 8);
+
+	// Degenerate octagon : keep all
+	if (nOctCnt < 3)
+	{
+		vecKeep.insert(vecKeep.end(), pts, pts + nCnt);
+		return;
+	}
+
+	for (size_t i = 0; i < nCnt; i++)
+	{
+		GBool bInside = GTrue;
+
+		for (int k = 0, l = nOctCnt - 1; k < nOctCnt; l = k++)
+		{
+			if (hull_cross(arOct[l], arOct[k], pts[i]) <= 0.0)
+			{
+				bInside = GFalse;
+				break;
+			}
+		}
+
+		if (bInside == GFalse)
+		{
+			vecKeep.push_back(pts[i]);
+		}
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Convex hull of a chunk (prefilter + monotone chain)
+***********************************************************************************/
+static void hull_chunk(const Point2D* pts, size_t nCnt, VecPoint2D& vecHull)
+{
+	VecPoint2D vecKeep;
+	hull_prefilter(pts, nCnt, vecKeep);
+	kernel::convex_hull_monotone(vecKeep.data(), vecKeep.size(), vecHull);
+}
+
 /***********************************************************************************
 *! @brief  : shape in which all of its sides are pointing or protruding outwards
 *! @param  : [in] vecPoints : point list
+*! @return : VecPoint2D convex hull (CCW, start at leftmost point)
 *! @author : thuong.nv			- [Date] : 25/10/2023
+*! @note   : Keep for compatibility, use convex_hull_monotone
 ***********************************************************************************/
 Dllexport VecPoint2D convex_hull_giftwap(const VecPoint2D& vecPoints)
 {
@@ -24,57 +130,330 @@ Dllexport VecPoint2D convex_hull_giftwap(const VecPoint2D& vecPoints)
 		return vecPoints;
 	}
 
-	int nPointCnt = static_cast<int>(vecPoints.size());
+	return convex_hull_monotone(vecPoints);
+}
+
+/***********************************************************************************
+*! @brief  : Convex hull use Andrew monotone chain algorithm O(n log n)
+*! @param  : [in] vecPoints : point list
+*! @param  : [in] nThread   : number of thread (<= 0 : hardware concurrency)
+*! @return : VecPoint2D convex hull (CCW, start at leftmost point, no collinear point)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Points inside the Akl-Toussaint octagon (8 extreme points) are
+*!           discarded before sorting. With nThread > 1 each thread builds the
+*!           hull of one chunk, then the chunk hulls are merged
+***********************************************************************************/
+Dllexport VecPoint2D convex_hull_monotone(const VecPoint2D& vecPoints, GInt nThread /*= 1*/)
+{
+	return convex_hull_monotone(RingView2D(vecPoints), nThread);
+}
+
+Dllexport VecPoint2D convex_hull_monotone(const RingView2D& vecPoints, GInt nThread /*= 1*/)
+{
+	// Minimum point number of a chunk (smaller input is not worth a thread)
+	const size_t nMinChunk = 65536;
+
+	VecPoint2D vecHull;
+	size_t nPointCnt = vecPoints.size();
+
+	if (nPointCnt < 3)
+	{
+		return VecPoint2D(vecPoints.begin(), vecPoints.end());
+	}
+
+	if (nThread <= 0)
+	{
+		nThread = std::max<GInt>(1, static_cast<GInt>(std::thread::hardware_concurrency()));
+	}
+
+	nThread = static_cast<GInt>(std::min<size_t>(static_cast<size_t>(nThread), nPointCnt / nMinChunk));
+
+	if (nThread <= 1)
+	{
+		hull_chunk(vecPoints.data(), nPointCnt, vecHull);
+		return vecHull;
+	}
+
+	// 1. Hull of each chunk
+	std::vector<VecPoint2D> vecChunkHull(nThread);
+	std::vector<std::thread> vecWorker; vecWorker.reserve(nThread);
+
+	size_t nChunk = (nPointCnt + nThread - 1) / nThread;
 
-	// Find the leftmost point
-	int nIdxLeftMost = 0;
-	for (int i = 1; i < nPointCnt; i++)
+	for (GInt t = 0; t < nThread; t++)
 	{
-		if (vecPoints[i].x < vecPoints[nIdxLeftMost].x)
-			nIdxLeftMost = i;
+		size_t nStart = nChunk * t;
+		size_t nCnt   = std::min(nChunk, nPointCnt - nStart);
+
+		vecWorker.push_back(std::thread(hull_chunk, vecPoints.data() + nStart, nCnt, std::ref(vecChunkHull[t])));
 	}
 
-	VecPoint2D vecHull; vecHull.reserve(nPointCnt);
-	bool* arrMarkCheck = new bool[nPointCnt]{ false };
+	for (auto& worker : vecWorker) worker.join();
+
+	// 2. Merge : hull of all chunk hull vertices
+	VecPoint2D vecMerge;
+
+	for (auto& vecChunk : vecChunkHull)
+	{
+		vecMerge.insert(vecMerge.end(), vecChunk.begin(), vecChunk.end());
+	}
+
+	kernel::convex_hull_monotone(vecMerge.data(), vecMerge.size(), vecHull);
+
+	return vecHull;
+}
+
+/***********************************************************************************
+*! @brief  : Number of point of ring without the closing point (last == first)
+***********************************************************************************/
+static inline size_t convex_ring_size(const Point2D* pts, size_t nCnt)
+{
+	if (nCnt > 1 && pts[0].x == pts[nCnt - 1].x && pts[0].y == pts[nCnt - 1].y)
+		return nCnt - 1;
+
+	return nCnt;
+}
+
+/***********************************************************************************
+*! @brief  : Check ring is strictly convex and counterclockwise
+*! @param  : [in] pts  : ring points
+*! @param  : [in] nCnt : number of point (without closing point)
+*! @return : TRUE : no repeated point, no right turn and turn once around
+*! @note   : is_convex_polygon does not check the closing vertices and star rings
+***********************************************************************************/
+static GBool convex_ring_ccw(const Point2D* pts, size_t nCnt)
+{
+	if (nCnt < 3)
+		return GFalse;
+
+	GBool bTurn = GFalse;
+	GInt nPreSign = 0, nFlip = 0;
+
+	// Sign of x direction of the last edge which is not vertical
+	for (size_t i = nCnt; i > 0 && nPreSign == 0; i--)
+	{
+		GFloat fDx = pts[i % nCnt].x - pts[i - 1].x;
+		nPreSign = (fDx > 0.f) ? 1 : (fDx < 0.f) ? -1 : 0;
+	}
+
+	for (size_t i = 0; i < nCnt; i++)
+	{
+		const Point2D& pt1 = pts[i];
+		const Point2D& pt2 = pts[(i + 1) % nCnt];
+		const Point2D& pt3 = pts[(i + 2) % nCnt];
+
+		if (pt1.x == pt2.x && pt1.y == pt2.y)
+			return GFalse;
+
+		GDouble dCross = hull_cross(pt1, pt2, pt3);
+
+		if (dCross < 0.0)
+			return GFalse;
+
+		if (dCross > 0.0) bTurn = GTrue;
+
+		GFloat fDx  = pt2.x - pt1.x;
+		GInt   nSign = (fDx > 0.f) ? 1 : (fDx < 0.f) ? -1 : 0;
+
+		if (nSign != 0 && nSign != nPreSign)
+		{
+			nFlip++;
+			nPreSign = nSign;
+		}
+	}
+
+	return (bTurn && nFlip == 2) ? GTrue : GFalse;
+}
+
+// O'Rourke is used when n * m reaches this value (Hodgman is faster for small rings)
+static const size_t CONVEX_INTERSECT_MIN = 64;
+
+// Batch clipping : min number of point per chunk | number of chunk per worker
+static const size_t CLIP_BATCH_MIN_POINT = 2048;
+static const size_t CLIP_BATCH_CHUNK     = 8;
+
+enum EnumConvexIn
+{
+	CONVEX_IN_UNKNOWN,
+	CONVEX_IN_P,
+	CONVEX_IN_Q,
+};
+
+/***********************************************************************************
+*! @brief  : Intersection of two edges for O'Rourke algorithm
+*! @param  : [in ] a1, a2  : edge of P
+*! @param  : [in ] b1, b2  : edge of Q
+*! @param  : [in ] dAHB    : side of a2 to edge b1b2 (!= 0)
+*! @param  : [in ] dBHA    : side of b2 to edge a1a2 (!= 0)
+*! @param  : [out] ptInter : intersection (proper crossing only)
+*! @return : 0 : separated | 1 : proper crossing | 2 : touch
+***********************************************************************************/
+static GInt convex_edge_intersect(const Point2D& a1, const Point2D& a2, const Point2D& b1, const Point2D& b2,
+								  GDouble dAHB, GDouble dBHA, Point2D& ptInter)
+{
+	GDouble d1 = hull_cross(b1, b2, a1);
+
+	if ((d1 > 0.0) == (dAHB > 0.0) && d1 != 0.0)
+		return 0;
+
+	GDouble d3 = hull_cross(a1, a2, b1);
+
+	if ((d3 > 0.0) == (dBHA > 0.0) && d3 != 0.0)
+		return 0;
+
+	if (d1 == 0.0 || d3 == 0.0)
+		return 2;
+
+	GDouble t = d1 / (d1 - dAHB);
+
+	ptInter.x = static_cast<GFloat>(a1.x + t * (GDouble(a2.x) - a1.x));
+	ptInter.y = static_cast<GFloat>(a1.y + t * (GDouble(a2.y) - a1.y));
+
+	return 1;
+}
+
+/***********************************************************************************
+*! @brief  : Intersection of two convex polygons use O'Rourke algorithm O(n + m)
+*! @param  : [in ] P, nP  : convex polygon (CCW, see convex_ring_ccw)
+*! @param  : [in ] Q, nQ  : convex polygon (CCW, see convex_ring_ccw)
+*! @param  : [out] vecOut : intersection (CCW, replaced, empty : not intersect)
+*! @return : FALSE : degenerate contact (vertex on edge, collinear edges), the
+*!           caller must use Sutherland-Hodgman
+*! @refer  : O'Rourke, Computational Geometry in C (2nd ed.), section 7.6
+***********************************************************************************/
+template<typename TVecPoint>
+static GBool convex_intersect_ring(const Point2D* P, size_t nP, const Point2D* Q, size_t nQ, TVecPoint& vecOut)
+{
+	vecOut.clear();
+
+	// Bounding box reject : edge chasing of separated polygons visits 2(n + m) edges
+	Point2D ptMinP = P[0], ptMaxP = P[0], ptMinQ = Q[0], ptMaxQ = Q[0];
+
+	for (size_t i = 1; i < nP; i++)
+	{
+		ptMinP.x = std::min(ptMinP.x, P[i].x); ptMaxP.x = std::max(ptMaxP.x, P[i].x);
+		ptMinP.y = std::min(ptMinP.y, P[i].y); ptMaxP.y = std::max(ptMaxP.y, P[i].y);
+	}
+
+	for (size_t i = 1; i < nQ; i++)
+	{
+		ptMinQ.x = std::min(ptMinQ.x, Q[i].x); ptMaxQ.x = std::max(ptMaxQ.x, Q[i].x);
+		ptMinQ.y = std::min(ptMinQ.y, Q[i].y); ptMaxQ.y = std::max(ptMaxQ.y, Q[i].y);
+	}
+
+	if (ptMaxP.x < ptMinQ.x || ptMaxQ.x < ptMinP.x || ptMaxP.y < ptMinQ.y || ptMaxQ.y < ptMinP.y)
+		return GTrue;
+
+	auto add_point = [&vecOut](const Point2D& pt)
+	{
+		if (vecOut.empty() || vecOut.back().x != pt.x || vecOut.back().y != pt.y)
+			vecOut.push_back(pt);
+	};
+
+	size_t a = 0, b = 0, nAdvA = 0, nAdvB = 0;
+	EnumConvexIn eInside = CONVEX_IN_UNKNOWN;
+	GBool bFirst = GTrue;
+
+	Point2D ptInter;
 
-	int p = nIdxLeftMost, q;
 	do
 	{
-		// Add current point to result
-		vecHull.push_back(vecPoints[p]);
-		arrMarkCheck[p] = true;
-
-		// Search for a point 'q' such that orientation(p, q,
-		// x) is counterclockwise for all points 'x'. The idea
-		// is to keep track of last visited most counterclock-
-		// wise point in q. If any point 'i' is more counterclock-
-		// wise than q, then update q.
-		q = (p + 1) % nPointCnt;
-		for (int i = 0; i < nPointCnt; i++)
+		const Point2D& ptA1 = P[(a + nP - 1) % nP];
+		const Point2D& ptA  = P[a];
+		const Point2D& ptB1 = Q[(b + nQ - 1) % nQ];
+		const Point2D& ptB  = Q[b];
+
+		GDouble dCross = (GDouble(ptA.x) - ptA1.x) * (GDouble(ptB.y) - ptB1.y) -
+						 (GDouble(ptA.y) - ptA1.y) * (GDouble(ptB.x) - ptB1.x);
+		GDouble dAHB   = hull_cross(ptB1, ptB, ptA);	// A on left of edge B
+		GDouble dBHA   = hull_cross(ptA1, ptA, ptB);	// B on left of edge A
+
+		if (dAHB == 0.0 || dBHA == 0.0)
+			return GFalse;
+
+		GInt nCode = convex_edge_intersect(ptA1, ptA, ptB1, ptB, dAHB, dBHA, ptInter);
+
+		if (nCode == 2)
+			return GFalse;
+
+		if (nCode == 1)
 		{
-			// If i is more counterclockwise than current q, then
-			// update q
+			if (bFirst)
+			{
+				nAdvA = nAdvB = 0;
+				bFirst = GFalse;
+			}
+
+			add_point(ptInter);
 
-			if (get_orientation_point_vector(vecPoints[i], vecPoints[p], vecPoints[q]) == EnumOrien::RIGHT)
-				q = i;
+			if (dAHB > 0.0) eInside = CONVEX_IN_P;
+			else if (dBHA > 0.0) eInside = CONVEX_IN_Q;
 		}
 
-		// Now q is the most counterclockwise with respect to p
-		// Set p as q for next iteration, so that q is added to
-		// result 'hull'
-		p = q;
+		// Advance the edge which is aiming at the other and is not ahead
+		GBool bAdvA = (dCross >= 0.0) ? (dBHA > 0.0) : (dAHB <= 0.0);
 
-		// Close or over
-		if (arrMarkCheck[p] == true || vecHull.size() > nPointCnt)
+		if (bAdvA)
+		{
+			if (eInside == CONVEX_IN_P) add_point(ptA);
+			a = (a + 1) % nP; nAdvA++;
+		}
+		else
 		{
-			break;
+			if (eInside == CONVEX_IN_Q) add_point(ptB);
+			b = (b + 1) % nQ; nAdvB++;
 		}
 
-	} while (p != nIdxLeftMost);  // While we don't come to first point
+	} while ((nAdvA < nP || nAdvB < nQ) && nAdvA < 2 * nP && nAdvB < 2 * nQ);
 
-	delete[] arrMarkCheck;
+	if (bFirst == GFalse)
+	{
+		while (vecOut.size() > 1 && vecOut.back().x == vecOut[0].x && vecOut.back().y == vecOut[0].y)
+			vecOut.pop_back();
 
-	return vecHull;
+		if (vecOut.size() < 3) vecOut.clear();
+
+		return GTrue;
+	}
+
+	// Boundaries do not cross : P in Q, Q in P or separated
+	auto inside_ring = [](const Point2D& pt, const Point2D* R, size_t nR) -> GInt
+	{
+		GInt nRet = 1;
+
+		for (size_t i = 0; i < nR; i++)
+		{
+			GDouble dSide = hull_cross(R[i], R[(i + 1) % nR], pt);
+
+			if (dSide < 0.0) return -1;
+			if (dSide == 0.0) nRet = 0;
+		}
+
+		return nRet;
+	};
+
+	GInt nPinQ = inside_ring(P[0], Q, nQ);
+
+	if (nPinQ == 0)
+		return GFalse;
+
+	if (nPinQ > 0)
+	{
+		vecOut.assign(P, P + nP);
+		return GTrue;
+	}
+
+	GInt nQinP = inside_ring(Q[0], P, nP);
+
+	if (nQinP == 0)
+		return GFalse;
+
+	if (nQinP > 0)
+	{
+		vecOut.assign(Q, Q + nQ);
+	}
+
+	return GTrue;
 }
 
 /***********************************************************************************
@@ -88,80 +467,249 @@ Dllexport VecPoint2D convex_hull_giftwap(const VecPoint2D& vecPoints)
 ***********************************************************************************/
 Dllexport VecPoint2D clip_polygon_hodgman(const VecPoint2D& poly, const VecPoint2D& clipConvexPoly)
 {
+	VecPoint2D vecOutPoints, vecWork;
+
+	clip_polygon_hodgman(RingView2D(poly), RingView2D(clipConvexPoly), vecOutPoints, vecWork);
+
+	return vecOutPoints;
+}
+
+/***********************************************************************************
+*! @brief  : Clipping Polygons use Sutherland-Hodgman algorithm (caller buffers)
+*! @param  : [in ] poly           : polygon
+*! @param  : [in ] clipConvexPoly : convex clip polygon
+*! @param  : [out] vecOut         : clip polygon (replaced)
+*! @param  : [in ] vecWork        : work buffer
+*! @return : number of point of clip polygon
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Same result as clip_polygon_hodgman. No heap allocation when vecOut
+*!           and vecWork have enough capacity (reuse them between calls)
+*!           Polygon also convex (CCW clip) : O'Rourke intersection O(n + m)
+*!           Degenerate contact (vertex on edge, collinear edges) uses Hodgman
+***********************************************************************************/
+Dllexport GInt clip_polygon_hodgman(const RingView2D& poly, const RingView2D& clipConvexPoly, VecPoint2D& vecOut, VecPoint2D& vecWork)
+{
+	vecOut.assign(poly.begin(), poly.end());
+
 	if (is_convex_polygon(clipConvexPoly) == GFalse)
-		return poly;
+		return static_cast<GInt>(vecOut.size());
 
 	// Allway right (ccw)
 	if (clipConvexPoly.size() < 3 || poly.size() < 3)
 	{
 		_ASSERT(0);
-		return VecPoint2D();
+		vecOut.clear();
+		return 0;
 	}
 
-	VecPoint2D vecOutPoints = poly;
-
 	// If polygon is not counterclockwise will recalculate
-	if (is_ccw(vecOutPoints) == GFalse) reverse_polygon(vecOutPoints);
-
-	int nClipCnt = static_cast<int>(clipConvexPoly.size());
-	int nVertexCnt = 0;
+	if (is_ccw(vecOut) == GFalse) reverse_polygon(vecOut);
 
-	Point2D ptInter, ptSEdge, ptEEdge;
+	// Both convex : O'Rourke O(n + m), Sutherland-Hodgman for degenerate contact
+	size_t nClipCnt = convex_ring_size(clipConvexPoly.data(), clipConvexPoly.size());
+	size_t nPolyCnt = convex_ring_size(vecOut.data(), vecOut.size());
 
-	for (int nEdge = 0; nEdge < nClipCnt; nEdge++)
+	if (nClipCnt * nPolyCnt >= CONVEX_INTERSECT_MIN &&
+		convex_ring_ccw(clipConvexPoly.data(), nClipCnt) &&
+		convex_ring_ccw(vecOut.data(), nPolyCnt))
 	{
-		ptSEdge = clipConvexPoly[nEdge];
-		ptEEdge = clipConvexPoly[(nEdge + 1) % nClipCnt];
+		if (convex_intersect_ring(vecOut.data(), nPolyCnt, clipConvexPoly.data(), nClipCnt, vecWork))
+		{
+			std::swap(vecOut, vecWork);
+			return static_cast<GInt>(vecOut.size());
+		}
+	}
 
-		VecPoint2D vecInputPoints = std::move(vecOutPoints);
-		nVertexCnt = static_cast<int>(vecInputPoints.size());
+	kernel::clip_ring_hodgman(clipConvexPoly.data(), clipConvexPoly.size(), vecOut, vecWork);
 
-		vecOutPoints.clear();
+	return static_cast<GInt>(vecOut.size());
+}
 
-		for (int nVertex = 0; nVertex < nVertexCnt; nVertex++)
+/***********************************************************************************
+*! @brief  : Clipping all rings of multipolygon use Sutherland-Hodgman algorithm
+*! @param  : [in ] mpoly          : multipolygon
+*! @param  : [in ] clipConvexPoly : convex clip polygon
+*! @param  : [out] result         : clip multipolygon (appended)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Orientation of each ring is kept. Polygon whose outer ring is
+*!           outside the clip polygon is removed. Convex ring : O'Rourke O(n + m)
+***********************************************************************************/
+Dllexport void clip_polygon_hodgman(const MultiPolygon2D& mpoly, const VecPoint2D& clipConvexPoly, MultiPolygon2D& result)
+{
+	GeoScratch scratch;
+	clip_polygon_hodgman(mpoly, RingView2D(clipConvexPoly), result, scratch);
+}
+
+/***********************************************************************************
+*! @brief  : Clipping polygons [nPolyBegin, nPolyEnd) of multipolygon by convex polygon
+*! @param  : [in ] mpoly          : multipolygon
+*! @param  : [in ] nPolyBegin     : first polygon
+*! @param  : [in ] nPolyEnd       : end polygon
+*! @param  : [in ] clipConvexPoly : clip polygon (>= 3 points)
+*! @param  : [in ] bConvex        : clip polygon is convex (is_convex_polygon)
+*! @param  : [out] result         : clip multipolygon (appended)
+*! @param  : [in ] scratch        : temporary memory (ring buffers)
+***********************************************************************************/
+static void hodgman_clip_polys(const MultiPolygon2D& mpoly, size_t nPolyBegin, size_t nPolyEnd,
+							   const RingView2D& clipConvexPoly, GBool bConvex,
+							   MultiPolygon2D& result, GeoScratch& scratch)
+{
+	size_t nClipCnt    = convex_ring_size(clipConvexPoly.data(), clipConvexPoly.size());
+	GBool  bClipStrict = bConvex && convex_ring_ccw(clipConvexPoly.data(), nClipCnt);
+
+	GeoScratchFrame frame(scratch);
+	ScratchAllocator<Point2D> alloc(&scratch);
+
+	// Ring buffers are reserved once for the largest ring
+	size_t nMaxRing = 0;
+
+	for (size_t p = nPolyBegin; p < nPolyEnd; p++)
+	{
+		for (size_t r = mpoly.poly_ring_begin(p); r < mpoly.poly_ring_end(p); r++)
+		{
+			nMaxRing = std::max(nMaxRing, mpoly.ring_size(r));
+		}
+	}
+
+	ScratchVecPoint2D vecOutPoints(alloc), vecTemp(alloc);
+	vecOutPoints.reserve(nMaxRing + clipConvexPoly.size());
+	vecTemp.reserve(nMaxRing + clipConvexPoly.size());
+
+	for (size_t p = nPolyBegin; p < nPolyEnd; p++)
+	{
+		for (size_t r = mpoly.poly_ring_begin(p); r < mpoly.poly_ring_end(p); r++)
 		{
-			Point2D ptCur = vecInputPoints[nVertex];
-			Point2D ptNext = vecInputPoints[(nVertex + 1) % nVertexCnt];
+			GBool bOuter = (r == mpoly.poly_ring_begin(p));
 
-			EnumOrien eRetOriCur  = get_orientation_point_vector(ptCur, ptSEdge, ptEEdge);
-			EnumOrien eRetOriNext = get_orientation_point_vector(ptNext, ptSEdge, ptEEdge);
+			vecOutPoints.assign(mpoly.ring(r).begin(), mpoly.ring(r).end());
 
-			if (eRetOriCur == EnumOrien::LEFT) // left
+			if (bConvex && vecOutPoints.size() >= 3)
 			{
-				vecOutPoints.push_back(ptCur);
+				GBool bCCW = is_ccw(RingView2D(vecOutPoints.data(), vecOutPoints.size()));
 
-				if (eRetOriNext == EnumOrien::COLLINEAR ||
-					eRetOriNext == EnumOrien::RIGHT)
+				if (bCCW == GFalse) reverse_polygon(vecOutPoints.data(), vecOutPoints.size());
+
+				size_t nRingCnt = convex_ring_size(vecOutPoints.data(), vecOutPoints.size());
+
+				if (bClipStrict && nClipCnt * nRingCnt >= CONVEX_INTERSECT_MIN &&
+					convex_ring_ccw(vecOutPoints.data(), nRingCnt) &&
+					convex_intersect_ring(vecOutPoints.data(), nRingCnt, clipConvexPoly.data(), nClipCnt, vecTemp))
 				{
-					if (intersect_2line(ptCur, ptNext, ptSEdge, ptEEdge, &ptInter))
-					{
-						vecOutPoints.push_back(ptInter);
-					}
+					std::swap(vecOutPoints, vecTemp);
 				}
-			}
-			else if (eRetOriNext == EnumOrien::LEFT)
-			{
-				if (intersect_2line(ptCur, ptNext, ptSEdge, ptEEdge, &ptInter))
+				else
 				{
-					vecOutPoints.push_back(ptInter);
+					kernel::clip_ring_hodgman(clipConvexPoly.data(), clipConvexPoly.size(), vecOutPoints, vecTemp);
 				}
+
+				if (bCCW == GFalse) reverse_polygon(vecOutPoints.data(), vecOutPoints.size());
+			}
+
+			if (vecOutPoints.size() < 3)
+			{
+				if (bOuter) break;
+				continue;
 			}
+
+			if (bOuter) result.begin_polygon();
+
+			result.add_ring(vecOutPoints.data(), vecOutPoints.size());
 		}
 	}
+}
 
-	return vecOutPoints;
+/***********************************************************************************
+*! @brief  : Clipping all rings of multipolygon use Sutherland-Hodgman (scratch memory)
+*! @param  : [in ] mpoly          : multipolygon
+*! @param  : [in ] clipConvexPoly : convex clip polygon
+*! @param  : [out] result         : clip multipolygon (appended)
+*! @param  : [in ] scratch        : temporary memory (ring buffers)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Same result as clip_polygon_hodgman(mpoly). Temporary memory is given
+*!           back to scratch on return
+***********************************************************************************/
+Dllexport void clip_polygon_hodgman(const MultiPolygon2D& mpoly, const RingView2D& clipConvexPoly, MultiPolygon2D& result, GeoScratch& scratch)
+{
+	if (clipConvexPoly.size() < 3)
+	{
+		_ASSERT(0);
+		return;
+	}
+
+	hodgman_clip_polys(mpoly, 0, mpoly.poly_count(), clipConvexPoly, is_convex_polygon(clipConvexPoly), result, scratch);
 }
 
 /***********************************************************************************
-*! @brief  : Clipping Polygons use Weiler Atherton  algorithm
-*! @param  : [in]  _poly     : polygon
-*! @param  : [in]  _clipPoly : clip (polygon)
-*! @return : VecPolyList list poly clip
-*! @author : thuong.nv   - [Date] : 08/07/2023
-*! @note   : Polygon input is counterclockwise (CCW).
-*! @refer  : https://www.geeksforgeeks.org/weiler-atherton-polygon-clipping-algorithm/
+*! @brief  : Clipping all rings of multipolygon use Sutherland-Hodgman (parallel)
+*! @param  : [in ] mpoly          : multipolygon
+*! @param  : [in ] clipConvexPoly : convex clip polygon
+*! @param  : [out] result         : clip multipolygon (appended)
+*! @param  : [in ] pool           : thread pool (scratch memory of each worker is used)
+*! @param  : [in ] nThread        : max number of worker (<= 0 : all workers of pool)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Same result (and order) as clip_polygon_hodgman(mpoly) for any number
+*!           of thread : chunks of polygons are clipped in parallel to their own
+*!           multipolygon, then appended to result in input order
 ***********************************************************************************/
-VecPolyList clip_polygon_weiler(const VecPoint2D& _poly, const VecPoint2D& _clipPoly)
+Dllexport void clip_polygon_hodgman(const MultiPolygon2D& mpoly, const RingView2D& clipConvexPoly, MultiPolygon2D& result,
+									GeoThreadPool& pool, GInt nThread /*= 0*/)
+{
+	if (clipConvexPoly.size() < 3)
+	{
+		_ASSERT(0);
+		return;
+	}
+
+	GBool bConvex = is_convex_polygon(clipConvexPoly);
+
+	// Chunks of about the same number of point, some chunks per worker for stealing
+	GInt nWorker = (nThread > 0) ? std::min(nThread, pool.thread_count()) : pool.thread_count();
+
+	size_t nChunkPoint = std::max<size_t>(CLIP_BATCH_MIN_POINT, mpoly.point_count() / (nWorker * CLIP_BATCH_CHUNK));
+
+	std::vector<size_t> vecChunk(1, 0);
+
+	for (size_t p = 0, nPoint = 0; p < mpoly.poly_count(); p++)
+	{
+		nPoint += mpoly.ring_begin(mpoly.poly_ring_end(p)) - mpoly.ring_begin(mpoly.poly_ring_begin(p));
+
+		if (nPoint >= nChunkPoint || p + 1 == mpoly.poly_count())
+		{
+			vecChunk.push_back(p + 1);
+			nPoint = 0;
+		}
+	}
+
+	size_t nChunkCnt = vecChunk.size() - 1;
+
+	if (nChunkCnt <= 1)
+	{
+		pool.parallel_for(nChunkCnt, [&](size_t, GInt nIdx)
+		{
+			hodgman_clip_polys(mpoly, 0, mpoly.poly_count(), clipConvexPoly, bConvex, result, pool.scratch(nIdx));
+		});
+
+		return;
+	}
+
+	std::vector<MultiPolygon2D> vecPart(nChunkCnt);
+
+	pool.parallel_for(nChunkCnt, [&](size_t nTask, GInt nIdx)
+	{
+		hodgman_clip_polys(mpoly, vecChunk[nTask], vecChunk[nTask + 1], clipConvexPoly, bConvex,
+						   vecPart[nTask], pool.scratch(nIdx));
+	}, nThread);
+
+	for (size_t c = 0; c < nChunkCnt; c++)
+	{
+		result.append(vecPart[c]);
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Weiler Atherton clipping, result polygons are added to result
+***********************************************************************************/
+static void weiler_clip(const RingView2D& _poly, const RingView2D& _clipPoly, MultiPolygon2D& result, GeoScratch& scratch)
 {
 	typedef struct stMarkPoint
 	{
@@ -171,39 +719,42 @@ VecPolyList clip_polygon_weiler(const VecPoint2D& _poly, const VecPoint2D& _clip
 
 	} MarkPoint;
 
-	typedef std::vector<MarkPoint> VecMarkPoint;
+	typedef std::vector<MarkPoint, ScratchAllocator<MarkPoint>> VecMarkPoint;
+	typedef std::map<int, VecMarkPoint, std::less<int>, ScratchAllocator<std::pair<const int, VecMarkPoint>>> MapMarkPoint;
 
-	if (_poly.size() < 3 || _clipPoly.size() < 3)
-	{
-		_ASSERT(0);
-		return VecPolyList();
-	}
+	// All temporary memory is given back to scratch on return
+	GeoScratchFrame frame(scratch);
+	ScratchAllocator<Point2D> alloc(&scratch);
 
-	VecPoint2D poly		= _poly;
-	VecPoint2D clipPoly = _clipPoly;
+	ScratchVecPoint2D poly(_poly.begin(), _poly.end(), alloc);
+	ScratchVecPoint2D clipPoly(_clipPoly.begin(), _clipPoly.end(), alloc);
+
+	RingView2D viewPoly(poly.data(), poly.size());
+	RingView2D viewClipPoly(clipPoly.data(), clipPoly.size());
 
 	// If polygon is not counterclockwise will recalculate
-	if (is_ccw(poly) == GFalse)  reverse_polygon(poly);
-	if (is_ccw(clipPoly) == GFalse) reverse_polygon(clipPoly);
+	if (is_ccw(viewPoly) == GFalse)  reverse_polygon(poly.data(), poly.size());
+	if (is_ccw(viewClipPoly) == GFalse) reverse_polygon(clipPoly.data(), clipPoly.size());
 
-	int rel = rel_2polygon(poly, clipPoly);
+	int rel = rel_2polygon(viewPoly, viewClipPoly, scratch);
 
 	// Polygon inside clip polygon
 	if (rel == 2)
 	{
-		return VecPolyList({ poly });
+		result.begin_polygon();
+		result.add_ring(viewPoly);
+		return;
 	}
 	else if (rel == 3)
 	{
-		return VecPolyList({ clipPoly });
+		result.begin_polygon();
+		result.add_ring(viewClipPoly);
+		return;
 	}
 
-	VecMarkPoint vecMarkPoly, vecMarkClipPoly;
-	std::map<int, VecMarkPoint> mapInterPoly, mapInterClipPoly;
-	std::set<int> setUsedIndex;
-
-	int nPolyCnt     = static_cast<int>(poly.size());
-	int nClipPolyCnt = static_cast<int>(clipPoly.size());
+	VecMarkPoint vecMarkPoly(alloc), vecMarkClipPoly(alloc);
+	MapMarkPoint mapInterPoly(alloc), mapInterClipPoly(alloc);
+	std::set<int, std::less<int>, ScratchAllocator<int>> setUsedIndex(std::less<int>(), alloc);
 
 	auto funPushInterectionMarKPoint = [&](VecMarkPoint& vecPush, const Point2D& ptInter, const Point2D& ptOri, int nIndex) -> void
 	{
@@ -233,40 +784,43 @@ VecPolyList clip_polygon_weiler(const VecPoint2D& _poly, const VecPoint2D& _clip
 	};
 
 	Point2D ptInter;
-	int nIndexInter = 1; int nNextIdx, nClipNextIdx;
+	int nIndexInter = 1; int nIdx, nClipIdx;
 
-	// 1. Found intersection point, and push map inter
-	for (int nIdx = 0; nIdx < nPolyCnt; nIdx++)
+	// 1. Found intersection point (sweep line), and push map inter
+	ScratchVecSegInter vecSegInter(alloc);
+	intersect_2polygon(viewPoly, viewClipPoly, scratch, &vecSegInter);
+
+	// Same index order as the loop edge by edge
+	std::sort(vecSegInter.begin(), vecSegInter.end(), [](const SegInter& a, const SegInter& b)
 	{
-		nNextIdx = (nIdx + 1) % nPolyCnt;
+		return (a.nSeg1 < b.nSeg1) || (a.nSeg1 == b.nSeg1 && a.nSeg2 < b.nSeg2);
+	});
 
-		for (int nClipIdx = 0; nClipIdx < nClipPolyCnt; nClipIdx++)
-		{
-			nClipNextIdx = (nClipIdx + 1) % nClipPolyCnt; // next point index
+	for (const SegInter& segInter : vecSegInter)
+	{
+		nIdx     = segInter.nSeg1;
+		nClipIdx = segInter.nSeg2;
+		ptInter  = segInter.pt;
 
-			if (intersect_2lsegment(poly[nIdx], poly[nNextIdx], clipPoly[nClipIdx], clipPoly[nClipNextIdx], &ptInter) == GTrue)
-			{
-				// Push to map poly intersection
-				auto itClip = mapInterPoly.insert(std::make_pair(nIdx, VecMarkPoint{ { nIndexInter, false, ptInter} }));
+		// Push to map poly intersection
+		auto itClip = mapInterPoly.insert(std::make_pair(nIdx, VecMarkPoint(1, MarkPoint{ nIndexInter, false, ptInter }, alloc)));
 
-				if (itClip.second == false)
-				{
-					VecMarkPoint& vecInter = itClip.first->second;
-					funPushInterectionMarKPoint(vecInter, ptInter, poly[nIdx], nIndexInter);
-				}
+		if (itClip.second == false)
+		{
+			VecMarkPoint& vecInter = itClip.first->second;
+			funPushInterectionMarKPoint(vecInter, ptInter, poly[nIdx], nIndexInter);
+		}
 
-				// Push map clip poly intersection
-				auto it = mapInterClipPoly.insert(std::make_pair(nClipIdx, VecMarkPoint{ { nIndexInter, false, ptInter } }));
+		// Push map clip poly intersection
+		auto it = mapInterClipPoly.insert(std::make_pair(nClipIdx, VecMarkPoint(1, MarkPoint{ nIndexInter, false, ptInter }, alloc)));
 
-				if (it.second == false)
-				{
-					VecMarkPoint& vecInter = it.first->second;
-					funPushInterectionMarKPoint(vecInter, ptInter, clipPoly[nClipIdx], nIndexInter);
-				}
-
-				nIndexInter++;
-			}
+		if (it.second == false)
+		{
+			VecMarkPoint& vecInter = it.first->second;
+			funPushInterectionMarKPoint(vecInter, ptInter, clipPoly[nClipIdx], nIndexInter);
 		}
+
+		nIndexInter++;
 	}
 
 	vecMarkPoly.reserve(poly.size() + static_cast<size_t>(nIndexInter) * 2);
@@ -275,9 +829,9 @@ VecPolyList clip_polygon_weiler(const VecPoint2D& _poly, const VecPoint2D& _clip
 	// 2. Create two mark poly and clip poly data set enter and leaving flag
 
 	auto funCreateMarkListPoly = [](VecMarkPoint& outvecMarkPoint,
-									const VecPoint2D& _poly1,
-									const VecPoint2D& _poly2,
-									const std::map<int, VecMarkPoint>& mapMarkInter) -> void
+									const ScratchVecPoint2D& _poly1,
+									const PreparedPolygon& _poly2,
+									const MapMarkPoint& mapMarkInter) -> void
 	{
 		MarkPoint markPoint;
 		Point2D ptMid, ptTemp;
@@ -311,7 +865,7 @@ VecPolyList clip_polygon_weiler(const VecPoint2D& _poly, const VecPoint2D& _clip
 
 					ptMid = mid_point(vecInters[ii].pt, ptTemp);
 
-					if (is_point_in_polygon(ptMid, _poly2) == GTrue)
+					if (_poly2.contains_legacy(ptMid) == GTrue)
 					{
 						markPoint.bEnter = true;
 					}
@@ -322,8 +876,12 @@ VecPolyList clip_polygon_weiler(const VecPoint2D& _poly, const VecPoint2D& _clip
 		}
 	};
 
-	funCreateMarkListPoly(vecMarkPoly, poly, clipPoly, mapInterPoly);
-	funCreateMarkListPoly(vecMarkClipPoly, clipPoly, poly, mapInterClipPoly);
+	// Edge tables are built once and reused for every intersection point. Keep the
+	// boundary rule of is_point_in_polygon (touching / collinear edge inputs)
+	PreparedPolygon prepPoly(viewPoly, &scratch), prepClipPoly(viewClipPoly, &scratch);
+
+	funCreateMarkListPoly(vecMarkPoly, poly, prepClipPoly, mapInterPoly);
+	funCreateMarkListPoly(vecMarkClipPoly, clipPoly, prepPoly, mapInterClipPoly);
 
 	auto funIsMarkPointEnter = [&](const MarkPoint& mark_point) -> bool
 	{
@@ -335,7 +893,7 @@ VecPolyList clip_polygon_weiler(const VecPoint2D& _poly, const VecPoint2D& _clip
 		return (mark_point.nIndex >= 0 && !mark_point.bEnter);
 	};
 
-	auto funFindVertexEnd = [&](VecPoint2D& _vecResultClip, int _nSIndex, int _nEIndex) -> bool
+	auto funFindVertexEnd = [&](ScratchVecPoint2D& _vecResultClip, int _nSIndex, int _nEIndex) -> bool
 	{
 		bool bRet = false, bContinue = false;
 		int nStartIdx = _nSIndex, nEndIdx = _nEIndex;
@@ -403,7 +961,7 @@ VecPolyList clip_polygon_weiler(const VecPoint2D& _poly, const VecPoint2D& _clip
 	};
 
 	// 3. emplement Weiler Atherton algorithm 
-	VecPolyList vecClips; VecPoint2D vecClip;
+	ScratchVecPoint2D vecClip(alloc);
 
 	int nMarkPolyCnt = static_cast<int>(vecMarkPoly.size());
 
@@ -432,50 +990,166 @@ VecPolyList clip_polygon_weiler(const VecPoint2D& _poly, const VecPoint2D& _clip
 
 			if (bClose)
 			{
-				vecClips.push_back(vecClip);
+				result.begin_polygon();
+				result.add_ring(vecClip.data(), vecClip.size());
 			}
 
 			vecClip.clear();
 		}
 	}
+}
+
+/***********************************************************************************
+*! @brief  : Clipping Polygons use Weiler Atherton  algorithm
+*! @param  : [in]  _poly     : polygon
+*! @param  : [in]  _clipPoly : clip (polygon)
+*! @return : VecPolyList list poly clip
+*! @author : thuong.nv   - [Date] : 08/07/2023
+*! @note   : Polygon input is counterclockwise (CCW).
+*! @refer  : https://www.geeksforgeeks.org/weiler-atherton-polygon-clipping-algorithm/
+***********************************************************************************/
+VecPolyList clip_polygon_weiler(const VecPoint2D& _poly, const VecPoint2D& _clipPoly)
+{
+	if (_poly.size() < 3 || _clipPoly.size() < 3)
+	{
+		_ASSERT(0);
+		return VecPolyList();
+	}
+
+	GeoScratch scratch;
+	MultiPolygon2D mpolyClip;
+	weiler_clip(RingView2D(_poly), RingView2D(_clipPoly), mpolyClip, scratch);
+
+	VecPolyList vecClips; vecClips.reserve(mpolyClip.ring_count());
+
+	for (size_t r = 0; r < mpolyClip.ring_count(); r++)
+	{
+		vecClips.push_back(VecPoint2D(mpolyClip.ring(r).begin(), mpolyClip.ring(r).end()));
+	}
 
 	return vecClips;
 }
 
+/***********************************************************************************
+*! @brief  : Clipping Polygons use Weiler Atherton algorithm (caller buffer)
+*! @param  : [in ] poly     : polygon
+*! @param  : [in ] clipPoly : clip (polygon)
+*! @param  : [out] result   : clip polygons (appended, one polygon per piece)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Same result as clip_polygon_weiler, input is not copied by caller
+***********************************************************************************/
+Dllexport void clip_polygon_weiler(const RingView2D& poly, const RingView2D& clipPoly, MultiPolygon2D& result)
+{
+	GeoScratch scratch;
+	clip_polygon_weiler(poly, clipPoly, result, scratch);
+}
+
+/***********************************************************************************
+*! @brief  : Clipping Polygons use Weiler Atherton algorithm (scratch memory)
+*! @param  : [in ] poly     : polygon
+*! @param  : [in ] clipPoly : clip (polygon)
+*! @param  : [out] result   : clip polygons (appended, one polygon per piece)
+*! @param  : [in ] scratch  : temporary memory (maps, mark lists, sweep line)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Same result as clip_polygon_weiler. Temporary memory is given back
+*!           to scratch on return, reuse scratch and result between calls
+***********************************************************************************/
+Dllexport void clip_polygon_weiler(const RingView2D& poly, const RingView2D& clipPoly, MultiPolygon2D& result, GeoScratch& scratch)
+{
+	if (poly.size() < 3 || clipPoly.size() < 3)
+	{
+		_ASSERT(0);
+		return;
+	}
+
+	weiler_clip(poly, clipPoly, result, scratch);
+}
+
+/***********************************************************************************
+*! @brief  : Clipping multipolygon with polygon (holes are supported)
+*! @param  : [in ] mpoly    : multipolygon
+*! @param  : [in ] clipPoly : clip polygon
+*! @param  : [out] result   : clip multipolygon (replaced)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Same as boolean_polygon(BOOL_INTERSECT)
+***********************************************************************************/
+Dllexport void clip_polygon_weiler(const MultiPolygon2D& mpoly, const VecPoint2D& clipPoly, MultiPolygon2D& result)
+{
+	GeoScratch scratch;
+	clip_polygon_weiler(mpoly, RingView2D(clipPoly), result, scratch);
+}
+
+/***********************************************************************************
+*! @brief  : Clipping multipolygon with polygon (scratch memory)
+*! @param  : [in ] mpoly    : multipolygon
+*! @param  : [in ] clipPoly : clip polygon
+*! @param  : [out] result   : clip multipolygon (replaced)
+*! @param  : [in ] scratch  : temporary memory (sweep queue, status, result rings)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Same as boolean_polygon(BOOL_INTERSECT, scratch)
+***********************************************************************************/
+Dllexport void clip_polygon_weiler(const MultiPolygon2D& mpoly, const RingView2D& clipPoly, MultiPolygon2D& result, GeoScratch& scratch)
+{
+	boolean_polygon(mpoly, clipPoly, BOOL_INTERSECT, result, scratch);
+}
+
 /***********************************************************************************
 *! @brief  : Union two convex polygon (without hole)
 *! @param  : [in]  poly1 : convex polygon
 *! @param  : [in]  poly2 : convex polygon
-*! @return : VecPolyList list poly clip
+*! @return : VecPoint2D outer ring of union (empty : two polygons are separated)
 *! @author : thuong.nv   - [Date] : 13/11/2023
 *! @note   : Polygon input is counterclockwise (CCW). without holes
+*!           Holes of union are skipped (see boolean_polygon)
 *! @refer  : https://stackoverflow.com/questions/6844462/polygon-union-without-holes
 ************************************************************************************/
 Dllexport VecPoint2D union_polygon(const VecPoint2D& poly1, const VecPoint2D& poly2)
 {
-	return VecPoint2D();
+	MultiPolygon2D mpoly;
+	boolean_polygon(poly1, poly2, BOOL_UNION, mpoly);
+
+	if (mpoly.poly_count() != 1)
+		return VecPoint2D();
+
+	size_t nRing = mpoly.poly_ring_begin(0);
+
+	return VecPoint2D(mpoly.ring_data(nRing), mpoly.ring_data(nRing) + mpoly.ring_size(nRing));
 }
 
 /***********************************************************************************
-*! @brief  : Cut line and polygon
-*! @param  : [in]  line : Line
-*! @param  : [in]  poly : polygon
-*! @return : VecPolyList list poly clip
-*! @author : thuong.nv   - [Date] : 29/10/2023
-*! @note   : Polygon input is counterclockwise (CCW).
+*! @brief  : Union two multipolygons (holes are supported)
+*! @param  : [in ] mpoly1 : multipolygon
+*! @param  : [in ] mpoly2 : multipolygon
+*! @param  : [out] result : union multipolygon (replaced)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Same as boolean_polygon(BOOL_UNION)
 ***********************************************************************************/
-Dllexport VecPolyList cut_line2poly(const Point2D& pt1, const Point2D& pt2, const VecPoint2D& _poly)
+Dllexport void union_polygon(const MultiPolygon2D& mpoly1, const MultiPolygon2D& mpoly2, MultiPolygon2D& result)
 {
-	VecPolyList vec_poly_split;
-	VecPoint2D poly = _poly; // copy data
+	GeoScratch scratch;
+	union_polygon(mpoly1, mpoly2, result, scratch);
+}
 
-	if (_poly.size() < 3)
-	{
-		vec_poly_split.push_back(_poly);
-		_ASSERT(0);
-		return vec_poly_split;
-	}
+/***********************************************************************************
+*! @brief  : Union two multipolygons (scratch memory)
+*! @param  : [in ] mpoly1  : multipolygon
+*! @param  : [in ] mpoly2  : multipolygon
+*! @param  : [out] result  : union multipolygon (replaced)
+*! @param  : [in ] scratch : temporary memory (sweep queue, status, result rings)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Same as boolean_polygon(BOOL_UNION, scratch)
+***********************************************************************************/
+Dllexport void union_polygon(const MultiPolygon2D& mpoly1, const MultiPolygon2D& mpoly2, MultiPolygon2D& result, GeoScratch& scratch)
+{
+	boolean_polygon(mpoly1, mpoly2, BOOL_UNION, result, scratch);
+}
 
+/***********************************************************************************
+*! @brief  : Cut line and ring (CCW after copy), pieces are added to result
+***********************************************************************************/
+static void cut_line_ring(const Point2D& pt1, const Point2D& pt2, const Point2D* _poly, size_t _nPolyCnt,
+						  MultiPolygon2D& result, GeoScratch& scratch)
+{
 	struct MarkPointInterPoly
 	{
 		Point2D		pt;
@@ -483,14 +1157,20 @@ Dllexport VecPolyList cut_line2poly(const Point2D& pt1, const Point2D& pt2, cons
 		int			idx_end;
 	};
 
-	typedef std::vector<MarkPointInterPoly> VecMarkPointInterPoly;
+	typedef std::vector<MarkPointInterPoly, ScratchAllocator<MarkPointInterPoly>> VecMarkPointInterPoly;
+
+	// All temporary memory is given back to scratch on return
+	GeoScratchFrame frame(scratch);
+	ScratchAllocator<Point2D> alloc(&scratch);
+
+	ScratchVecPoint2D poly(_poly, _poly + _nPolyCnt, alloc); // copy data
 
 	GBool bExist; Point2D ptInter;
-	VecMarkPointInterPoly vMarkInters;
+	VecMarkPointInterPoly vMarkInters(alloc);
 	GFloat fDis = 0.f;
 
 	// Polygon input is counterclockwise
-	if (is_ccw(poly) == GFalse) reverse_polygon(poly);
+	if (is_ccw(RingView2D(poly.data(), poly.size())) == GFalse) reverse_polygon(poly.data(), poly.size());
 
 	// seek all intersection point and index polygon between line and polygon
 	int nPolyCnt = static_cast<int>(poly.size());
@@ -518,7 +1198,7 @@ Dllexport VecPolyList cut_line2poly(const Point2D& pt1, const Point2D& pt2, cons
 		}
 	}
 
-	bool* arMark = new bool[nPolyCnt];
+	bool* arMark = scratch.alloc_array<bool>(nPolyCnt);
 	std::memset(arMark, 0, sizeof(bool)*nPolyCnt);
 
 	// check existed intersection point in line segment of polygon
@@ -566,12 +1246,14 @@ Dllexport VecPolyList cut_line2poly(const Point2D& pt1, const Point2D& pt2, cons
 	EnumOrien or_pfirst = EnumOrien::LEFT;
 	int nIdx, nIdxNext, i, x, y;
 
+	ScratchVecPoint2D poly_split(alloc);
+
 	// loop to seek all polygon after cutting
 	for (i = 0; i < nPolyCnt; i++)
 	{
 		if (arMark[i] == true) continue;
 
-		VecPoint2D poly_split;
+		poly_split.clear();
 		int idx = i, count = 0;
 
 		while (count < nPolyCnt) //PS: Prevents infinite looping
@@ -608,94 +1290,237 @@ Dllexport VecPolyList cut_line2poly(const Point2D& pt1, const Point2D& pt2, cons
 
 			if (i == idx) break;
 		}
-		vec_poly_split.push_back(poly_split);
-	}
 
-	delete[] arMark;
+		result.begin_polygon();
+		result.add_ring(poly_split.data(), poly_split.size());
+	}
 
 	//for (INT i = 0; i < vec_poly_split.size(); i++)
 	//{
 	//	V2remove_double_point(vec_poly_split[i]);
 	//}
+}
+
+/***********************************************************************************
+*! @brief  : Cut line and polygon
+*! @param  : [in]  line : Line
+*! @param  : [in]  poly : polygon
+*! @return : VecPolyList list poly clip
+*! @author : thuong.nv   - [Date] : 29/10/2023
+*! @note   : Polygon input is counterclockwise (CCW).
+***********************************************************************************/
+Dllexport VecPolyList cut_line2poly(const Point2D& pt1, const Point2D& pt2, const VecPoint2D& _poly)
+{
+	VecPolyList vec_poly_split;
+
+	if (_poly.size() < 3)
+	{
+		vec_poly_split.push_back(_poly);
+		_ASSERT(0);
+		return vec_poly_split;
+	}
+
+	GeoScratch scratch;
+	MultiPolygon2D mpolySplit;
+	cut_line_ring(pt1, pt2, _poly.data(), _poly.size(), mpolySplit, scratch);
+
+	vec_poly_split.reserve(mpolySplit.ring_count());
+
+	for (size_t r = 0; r < mpolySplit.ring_count(); r++)
+	{
+		vec_poly_split.push_back(VecPoint2D(mpolySplit.ring(r).begin(), mpolySplit.ring(r).end()));
+	}
 
 	return vec_poly_split;
 }
 
 /***********************************************************************************
-*! @brief  : is the partition of a polygonal area (simple polygon) P into a set of triangles
-*! @param  : [in]  poly : polygon
-*! @return : VecPolyList (Every 3 consecutive points will be a triangle)
-*! @author : thuong.nv   - [Date] : 11/07/2023
-*! @note   : Polygon input is counterclockwise (CCW winding).
-*!           For convex or concave polygon
-************************************************************************************/
-Dllexport VecPoint2D poly2trig_ear_clipping(const VecPoint2D& poly)
+*! @brief  : Cut line and polygon (caller buffer)
+*! @param  : [in ] pt1    : Point in line
+*! @param  : [in ] pt2    : Point in line
+*! @param  : [in ] poly   : polygon
+*! @param  : [out] result : polygon pieces (appended, one polygon per piece)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Same result as cut_line2poly, input is not copied by caller
+***********************************************************************************/
+Dllexport void cut_line2poly(const Point2D& pt1, const Point2D& pt2, const RingView2D& poly, MultiPolygon2D& result)
 {
-	VecPoint2D list_trig; VecPoint2D vecPolyTemp;
+	GeoScratch scratch;
+	cut_line2poly(pt1, pt2, poly, result, scratch);
+}
 
-	int nPolyCnt = static_cast<int>(poly.size());
-	if (nPolyCnt < 3)
+/***********************************************************************************
+*! @brief  : Cut line and polygon (scratch memory)
+*! @param  : [in ] pt1     : Point in line
+*! @param  : [in ] pt2     : Point in line
+*! @param  : [in ] poly    : polygon
+*! @param  : [out] result  : polygon pieces (appended, one polygon per piece)
+*! @param  : [in ] scratch : temporary memory
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Same result as cut_line2poly. Temporary memory is given back to
+*!           scratch on return
+***********************************************************************************/
+Dllexport void cut_line2poly(const Point2D& pt1, const Point2D& pt2, const RingView2D& poly, MultiPolygon2D& result, GeoScratch& scratch)
+{
+	if (poly.size() < 3)
 	{
-		//_ASSERT(0);
+		_ASSERT(0);
+		result.begin_polygon();
+		result.add_ring(poly);
+		return;
+	}
 
-		return poly;
+	cut_line_ring(pt1, pt2, poly.data(), poly.size(), result, scratch);
+}
+
+/***********************************************************************************
+*! @brief  : Cut line and all polygons of multipolygon
+*! @param  : [in ] pt1    : Point in line
+*! @param  : [in ] pt2    : Point in line
+*! @param  : [in ] mpoly  : multipolygon
+*! @param  : [out] result : polygon pieces (appended, one polygon per piece)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Only outer rings are cut (holes are not supported by cut_line2poly)
+***********************************************************************************/
+Dllexport void cut_line2poly(const Point2D& pt1, const Point2D& pt2, const MultiPolygon2D& mpoly, MultiPolygon2D& result)
+{
+	GeoScratch scratch;
+	cut_line2poly(pt1, pt2, mpoly, result, scratch);
+}
+
+/***********************************************************************************
+*! @brief  : Cut line and all polygons of multipolygon (scratch memory)
+*! @param  : [in ] pt1     : Point in line
+*! @param  : [in ] pt2     : Point in line
+*! @param  : [in ] mpoly   : multipolygon
+*! @param  : [out] result  : polygon pieces (appended, one polygon per piece)
+*! @param  : [in ] scratch : temporary memory
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Only outer rings are cut (holes are not supported by cut_line2poly)
+***********************************************************************************/
+Dllexport void cut_line2poly(const Point2D& pt1, const Point2D& pt2, const MultiPolygon2D& mpoly, MultiPolygon2D& result, GeoScratch& scratch)
+{
+	for (size_t p = 0; p < mpoly.poly_count(); p++)
+	{
+		if (mpoly.poly_ring_begin(p) == mpoly.poly_ring_end(p))
+			continue;
+
+		RingView2D ring = mpoly.outer_ring(p);
+
+		if (ring.size() < 3)
+			continue;
+
+		cut_line_ring(pt1, pt2, ring.data(), ring.size(), result, scratch);
 	}
+}
+
+/***********************************************************************************
+*! @brief  : Cut line and all polygons of multipolygon on integer grid (snap rounding)
+*! @param  : [in ] pt1    : Point in line
+*! @param  : [in ] pt2    : Point in line
+*! @param  : [in ] mpoly  : multipolygon (outer ring + holes)
+*! @param  : [in ] dScale : grid unit per world unit (ex : 1000 -> grid 0.001)
+*! @param  : [out] result : polygon pieces (appended, with holes)
+*! @return : TRUE : OK | FALSE : pt1 = pt2 or coordinate out of snap range
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Pieces are the intersection of mpoly and the two half planes of the
+*!           line. Both sides are snap rounded with the same cut edges, so pieces
+*!           share their cut points exactly (no duplicate point cleanup)
+***********************************************************************************/
+Dllexport GBool cut_line2poly_snap(const Point2D& pt1, const Point2D& pt2, const MultiPolygon2D& mpoly, GDouble dScale, MultiPolygon2D& result)
+{
+	GDouble dx = GDouble(pt2.x) - pt1.x, dy = GDouble(pt2.y) - pt1.y;
+	GDouble dLen = std::sqrt(dx * dx + dy * dy);
 
-	list_trig.reserve(nPolyCnt * 2);
+	if (dLen <= 0.0)
+		return GFalse;
 
-	vecPolyTemp = poly;
+	if (mpoly.point_count() == 0)
+		return GTrue;
 
-	EnumOrien orien, orp12, orp23, orp31;
-	auto funCheckPointInTrigIdx = [&](VecPoint2D& _poly, int idx1, int idx2, int idx3)
+	const VecPoint2D& vecPoint = mpoly.points();
+
+	GDouble dMinX = vecPoint[0].x, dMaxX = dMinX;
+	GDouble dMinY = vecPoint[0].y, dMaxY = dMinY;
+
+	for (const Point2D& pt : vecPoint)
 	{
-		int _nPolyCnt = static_cast<int>(_poly.size());
+		dMinX = std::min(dMinX, GDouble(pt.x)); dMaxX = std::max(dMaxX, GDouble(pt.x));
+		dMinY = std::min(dMinY, GDouble(pt.y)); dMaxY = std::max(dMaxY, GDouble(pt.y));
+	}
 
-		for (int i = 0; i < _nPolyCnt; i++)
-		{
-			// don't check index input
-			if (i == idx1 || i == idx2 || i == idx3)
-				continue;
+	// Half plane rectangles cover mpoly with a margin of some grid units
+	GDouble ux = dx / dLen, uy = dy / dLen;
+	GDouble cx = (dMinX + dMaxX) / 2.0, cy = (dMinY + dMaxY) / 2.0;
 
-			orp12 = get_orientation_point_vector(_poly[idx1], _poly[idx2], _poly[i]);
-			orp23 = get_orientation_point_vector(_poly[idx2], _poly[idx3], _poly[i]);
-			orp31 = get_orientation_point_vector(_poly[idx3], _poly[idx1], _poly[i]);
+	GDouble dRadius = std::sqrt((dMaxX - dMinX) * (dMaxX - dMinX) + (dMaxY - dMinY) * (dMaxY - dMinY)) / 2.0;
+	dRadius += dRadius * 0.01 + 4.0 / dScale;
 
-			if (orp12 == orp23 && orp23 == orp31)
-				return true;
-		}
+	GDouble dProj   = (cx - pt1.x) * ux + (cy - pt1.y) * uy;
+	GDouble dHeight = dRadius + std::fabs((cy - pt1.y) * ux - (cx - pt1.x) * uy);
 
-		return false;
-	};
+	Point2D ptBegin(pt1.x + (dProj - dRadius) * ux, pt1.y + (dProj - dRadius) * uy);
+	Point2D ptEnd  (pt1.x + (dProj + dRadius) * ux, pt1.y + (dProj + dRadius) * uy);
+	Point2D ptNor  (-uy * dHeight, ux * dHeight);
 
-	int i, nOldSize, nCur, nNex, nPre;
+	MultiPolygon2D mpolyHalf, mpolyPiece;
 
-	while (vecPolyTemp.size() > 0)
+	for (GInt nSide = 0; nSide < 2; nSide++)
 	{
-		//PS: prevent in case of infinite loops 
-		nPolyCnt = nOldSize = static_cast<int>(vecPolyTemp.size());
+		// Left side then right side (CCW)
+		VecPoint2D vecHalf = (nSide == 0) ? VecPoint2D{ ptBegin, ptEnd, ptEnd + ptNor, ptBegin + ptNor }
+										  : VecPoint2D{ ptEnd, ptBegin, ptBegin - ptNor, ptEnd - ptNor };
+		mpolyHalf.clear();
+		mpolyHalf.add_polygon(vecHalf);
 
-		for (i = 0; i < nPolyCnt; i++)
-		{
-			nCur = i; nPre = ((i - 1) < 0) ? (nPolyCnt - 1) : (i - 1);
-			nNex = ((i + 1) >= nPolyCnt) ? 0 : (i + 1);
+		if (boolean_polygon_snap(mpoly, mpolyHalf, BOOL_INTERSECT, dScale, mpolyPiece) == GFalse)
+			return GFalse;
 
-			orien = get_orientation_point_vector(vecPolyTemp[nPre], vecPolyTemp[nCur], vecPolyTemp[nNex]);
+		for (size_t p = 0; p < mpolyPiece.poly_count(); p++)
+		{
+			result.begin_polygon();
 
-			if ((orien == EnumOrien::LEFT || orien == EnumOrien::COLLINEAR)
-				&& funCheckPointInTrigIdx(vecPolyTemp, nPre, nCur, nNex) == false)
+			for (size_t r = mpolyPiece.poly_ring_begin(p); r < mpolyPiece.poly_ring_end(p); r++)
 			{
-				list_trig.push_back(vecPolyTemp[nPre]);
-				list_trig.push_back(vecPolyTemp[nCur]);
-				list_trig.push_back(vecPolyTemp[nNex]);
-				vecPolyTemp.erase(vecPolyTemp.begin() + nCur);
+				result.add_ring(mpolyPiece.ring(r));
 			}
-
-			nPolyCnt = static_cast<int>(vecPolyTemp.size());
 		}
+	}
+
+	return GTrue;
+}
 
-		if (vecPolyTemp.size() == nOldSize)
-			break;
+/***********************************************************************************
+*! @brief  : is the partition of a polygonal area (simple polygon) P into a set of triangles
+*! @param  : [in]  poly : polygon
+*! @return : VecPolyList (Every 3 consecutive points will be a triangle)
+*! @author : thuong.nv   - [Date] : 11/07/2023
+*! @note   : Polygon input is counterclockwise (CCW winding).
+*!           For convex or concave polygon. Use triangulate_polygon (linked ring +
+*!           z-order) for indexed triangle list
+************************************************************************************/
+Dllexport VecPoint2D poly2trig_ear_clipping(const VecPoint2D& poly)
+{
+	VecPoint2D list_trig;
+
+	int nPolyCnt = static_cast<int>(poly.size());
+	if (nPolyCnt < 3)
+	{
+		//_ASSERT(0);
+
+		return poly;
 	}
+
+	std::vector<uint32_t> vecIndex;
+	triangulate_polygon(poly, vecIndex);
+
+	list_trig.reserve(vecIndex.size());
+
+	for (uint32_t idx : vecIndex)
+	{
+		list_trig.push_back(poly[idx]);
+	}
+
 	return list_trig;
 }
 
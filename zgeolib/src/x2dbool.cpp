@@ -0,0 +1,1017 @@
+#include "x2dbool.h"
+#include "x2dsweep.h"
+#include "x2dsnap.h"
+
+#include <set>
+#include <cmath>
+#include <algorithm>
+
+namespace geo { namespace v2 {
+
+/***********************************************************************************
+*! @brief  : Input ring (subject or clip)
+***********************************************************************************/
+typedef struct tagBoolRing
+{
+	const Point2D*	pts;
+	size_t			nCnt;
+
+} BoolRing;
+
+typedef std::vector<BoolRing, ScratchAllocator<BoolRing>> VecBoolRing;
+
+/***********************************************************************************
+*! @brief  : Split point of an input edge
+***********************************************************************************/
+typedef struct tagBoolSplit
+{
+	GInt	nSeg;	// input edge
+	GDouble	t;		// position on edge (projection)
+	Point2D	pt;
+
+} BoolSplit;
+
+typedef std::vector<BoolSplit, ScratchAllocator<BoolSplit>> VecBoolSplit;
+
+/***********************************************************************************
+*! @brief  : Edge of the noded arrangement (pt1 : left point | pt2 : right point)
+***********************************************************************************/
+typedef struct tagBoolEdge
+{
+	Point2D	pt1;
+	Point2D	pt2;
+	GInt	nMask;	// bit 0 : subject boundary | bit 1 : clip boundary (winding : +1 left to right | -1)
+
+} BoolEdge;
+
+typedef std::vector<BoolEdge, ScratchAllocator<BoolEdge>> VecBoolEdge;
+
+/***********************************************************************************
+*! @brief  : Event of labeling sweep
+***********************************************************************************/
+typedef struct tagBoolEvent
+{
+	GDouble	x;
+	GDouble	y;
+	GInt	nEdge;
+	GBool	bLeft;	// left point : insert | right point : remove
+
+} BoolEvent;
+
+typedef std::vector<BoolEvent, ScratchAllocator<BoolEvent>> VecBoolEvent;
+typedef std::vector<GInt, ScratchAllocator<GInt>> VecBoolIndex;
+
+/***********************************************************************************
+*! @brief  : Sweep of noded edges (no crossing) : reuse order of SweepIntersector
+***********************************************************************************/
+class BoolSweep : public SweepIntersector
+{
+public:
+	explicit BoolSweep(GeoScratch* pScratch) : SweepIntersector(pScratch) {}
+
+public:
+	void set_sweep(GDouble x, GDouble y) { m_dSweepX = x; m_dSweepY = y; }
+	void set_eps(GDouble dEps) { m_dEps = dEps; }
+
+	GBool status_less(GInt nSeg1, GInt nSeg2) const { return less(nSeg1, nSeg2); }
+};
+
+struct BoolStatusLess
+{
+	const BoolSweep* m_pSweep;
+
+	bool operator()(GInt nSeg1, GInt nSeg2) const
+	{
+		return m_pSweep->status_less(nSeg1, nSeg2) == GTrue;
+	}
+};
+
+static inline GBool is_same_point(const Point2D& pt1, const Point2D& pt2)
+{
+	return (pt1.x == pt2.x && pt1.y == pt2.y) ? GTrue : GFalse;
+}
+
+static inline GBool is_less_point(const Point2D& pt1, const Point2D& pt2)
+{
+	return (pt1.x < pt2.x || (pt1.x == pt2.x && pt1.y < pt2.y)) ? GTrue : GFalse;
+}
+
+/***********************************************************************************
+*! @brief  : Region is inside result
+*! @param  : [in] nRegion : bit 0 : inside subject | bit 1 : inside clip
+***********************************************************************************/
+static inline GBool bool_in_result(GInt nRegion, EnumBoolOp eOp)
+{
+	GBool bSubj = (nRegion & 1) ? GTrue : GFalse;
+	GBool bClip = (nRegion & 2) ? GTrue : GFalse;
+
+	switch (eOp)
+	{
+	case BOOL_INTERSECT: return (bSubj && bClip) ? GTrue : GFalse;
+	case BOOL_UNION:	 return (bSubj || bClip) ? GTrue : GFalse;
+	case BOOL_DIFF:		 return (bSubj && !bClip) ? GTrue : GFalse;
+	case BOOL_XOR:		 return (bSubj != bClip) ? GTrue : GFalse;
+	default:
+		break;
+	}
+
+	return GFalse;
+}
+
+/***********************************************************************************
+*! @brief  : Region is inside result
+*! @param  : [in] nRegion : even-odd : mask (see bool_in_result) | other : winding number
+***********************************************************************************/
+static inline GBool bool_in_result(GInt nRegion, EnumBoolOp eOp, EnumFillRule eFill)
+{
+	switch (eFill)
+	{
+	case FILL_NONZERO:	return (nRegion != 0) ? GTrue : GFalse;
+	case FILL_POSITIVE: return (nRegion > 0) ? GTrue : GFalse;
+	default:
+		break;
+	}
+
+	return bool_in_result(nRegion, eOp);
+}
+
+/***********************************************************************************
+*! @brief  : Remove duplicate and collinear points of ring
+***********************************************************************************/
+static void bool_clean_ring(ScratchVecPoint2D& ring)
+{
+	auto funCollinear = [](const Point2D& a, const Point2D& b, const Point2D& c)
+	{
+		GDouble dCrs = (GDouble(b.x) - a.x) * (GDouble(c.y) - a.y) -
+					   (GDouble(b.y) - a.y) * (GDouble(c.x) - a.x);
+		return dCrs == 0.0;
+	};
+
+	ScratchVecPoint2D vecOut(ring.get_allocator());
+	vecOut.reserve(ring.size());
+
+	for (const Point2D& pt : ring)
+	{
+		if (!vecOut.empty() && is_same_point(vecOut.back(), pt))
+			continue;
+
+		while (vecOut.size() >= 2 && funCollinear(vecOut[vecOut.size() - 2], vecOut.back(), pt))
+		{
+			vecOut.pop_back();
+		}
+
+		vecOut.push_back(pt);
+	}
+
+	// Wrap around (last -> first)
+	size_t nStart = 0;
+
+	while (vecOut.size() - nStart >= 3)
+	{
+		size_t nCnt = vecOut.size();
+
+		if (is_same_point(vecOut[nCnt - 1], vecOut[nStart]))
+		{
+			vecOut.pop_back();
+		}
+		else if (funCollinear(vecOut[nCnt - 2], vecOut[nCnt - 1], vecOut[nStart]))
+		{
+			vecOut.pop_back();
+		}
+		else if (funCollinear(vecOut[nCnt - 1], vecOut[nStart], vecOut[nStart + 1]))
+		{
+			nStart++;
+		}
+		else
+		{
+			break;
+		}
+	}
+
+	if (vecOut.size() - nStart < 3)
+	{
+		ring.clear();
+		return;
+	}
+
+	ring.assign(vecOut.begin() + nStart, vecOut.end());
+}
+
+/***********************************************************************************
+*! @brief  : Add edge of arrangement (pt1 : left point)
+*! @param  : [in] bWinding : mask is the direction of input edge (+1 : pt1 -> pt2 goes
+*!                           left to right | -1 : right to left) instead of group bit
+***********************************************************************************/
+static inline void bool_add_edge(VecBoolEdge& vecEdge, const Point2D& pt1, const Point2D& pt2, GInt nGroup,
+								 GBool bWinding = GFalse)
+{
+	if (is_same_point(pt1, pt2))
+		return;
+
+	if (is_less_point(pt1, pt2))
+		vecEdge.push_back(BoolEdge{ pt1, pt2, bWinding ? 1 : 1 << nGroup });
+	else
+		vecEdge.push_back(BoolEdge{ pt2, pt1, bWinding ? -1 : 1 << nGroup });
+}
+
+/***********************************************************************************
+*! @brief  : Edges of rings split at intersections (Bentley-Ottmann)
+*! @param  : [in ] vecRing   : rings [0, nSubjRing) : subject | other : clip
+*! @param  : [in ] nSubjRing : number of subject ring
+*! @param  : [out] vecEdge   : noded edges
+*! @param  : [in ] bWinding  : edge mask is the edge direction (see bool_add_edge)
+***********************************************************************************/
+static void bool_node_edges(const VecBoolRing& vecRing, size_t nSubjRing, VecBoolEdge& vecEdge,
+							GBool bWinding = GFalse)
+{
+	ScratchAllocator<Point2D> alloc(vecEdge.get_allocator());
+
+	// 1. Input edges
+	SweepIntersector sweep(alloc.m_pScratch);
+	ScratchVecPoint2D vecSegPt1(alloc), vecSegPt2(alloc);
+	VecBoolIndex vecSegGroup(alloc);
+
+	size_t nTotal = 0;
+
+	for (const BoolRing& ring : vecRing)
+	{
+		nTotal += ring.nCnt;
+	}
+
+	sweep.reserve(nTotal);
+	vecSegPt1.reserve(nTotal);
+	vecSegPt2.reserve(nTotal);
+	vecSegGroup.reserve(nTotal);
+
+	for (size_t r = 0; r < vecRing.size(); r++)
+	{
+		const BoolRing& ring = vecRing[r];
+		GInt nGroup = (r < nSubjRing) ? 0 : 1;
+
+		if (ring.nCnt < 3)
+			continue;
+
+		for (size_t i = 0; i < ring.nCnt; i++)
+		{
+			const Point2D& pt1 = ring.pts[i];
+			const Point2D& pt2 = ring.pts[(i + 1) % ring.nCnt];
+
+			if (is_same_point(pt1, pt2))
+				continue;
+
+			sweep.add_segment(pt1, pt2, nGroup);
+			vecSegPt1.push_back(pt1);
+			vecSegPt2.push_back(pt2);
+			vecSegGroup.push_back(nGroup);
+		}
+	}
+
+	GInt nSegCnt = sweep.size();
+
+	if (nSegCnt == 0)
+		return;
+
+	// 2. Split edges at intersection points
+	ScratchVecSegInter vecInter(alloc);
+	sweep.run(&vecInter);
+
+	VecBoolSplit vecSplit(alloc);
+	vecSplit.reserve(vecInter.size());
+
+	auto funAddSplit = [&](GInt nSeg, const Point2D& pt)
+	{
+		const Point2D& pt1 = vecSegPt1[nSeg];
+		const Point2D& pt2 = vecSegPt2[nSeg];
+
+		if (is_same_point(pt, pt1) || is_same_point(pt, pt2))
+			return;
+
+		GDouble dx = GDouble(pt2.x) - pt1.x, dy = GDouble(pt2.y) - pt1.y;
+		GDouble t  = (GDouble(pt.x) - pt1.x) * dx + (GDouble(pt.y) - pt1.y) * dy;
+
+		// Rounded point is out of edge
+		if (t <= 0.0 || t >= dx * dx + dy * dy)
+			return;
+
+		vecSplit.push_back(BoolSplit{ nSeg, t, pt });
+	};
+
+	for (const SegInter& inter : vecInter)
+	{
+		funAddSplit(inter.nSeg1, inter.pt);
+		funAddSplit(inter.nSeg2, inter.pt);
+	}
+
+	std::sort(vecSplit.begin(), vecSplit.end(), [](const BoolSplit& a, const BoolSplit& b)
+	{
+		return (a.nSeg < b.nSeg) || (a.nSeg == b.nSeg && a.t < b.t);
+	});
+
+	vecEdge.reserve(nSegCnt + vecSplit.size());
+
+	size_t nSplit = 0;
+
+	for (GInt i = 0; i < nSegCnt; i++)
+	{
+		Point2D ptPrev = vecSegPt1[i];
+
+		while (nSplit < vecSplit.size() && vecSplit[nSplit].nSeg == i)
+		{
+			bool_add_edge(vecEdge, ptPrev, vecSplit[nSplit].pt, vecSegGroup[i], bWinding);
+			ptPrev = vecSplit[nSplit].pt;
+			nSplit++;
+		}
+
+		bool_add_edge(vecEdge, ptPrev, vecSegPt2[i], vecSegGroup[i], bWinding);
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Edges of rings snap rounded on grid 1 / dScale
+*! @param  : [in ] vecRing   : rings [0, nSubjRing) : subject | other : clip
+*! @param  : [in ] nSubjRing : number of subject ring
+*! @param  : [in ] dScale    : fixed unit per world unit
+*! @param  : [out] vecEdge   : noded edges
+*! @return : TRUE : OK | FALSE : coordinate out of snap range
+*! @note   : Noding is exact on grid, points are converted back to float only
+*!           when edges are built (same grid point -> same float point)
+***********************************************************************************/
+static GBool bool_snap_edges(const VecBoolRing& vecRing, size_t nSubjRing, GDouble dScale, VecBoolEdge& vecEdge)
+{
+	size_t nTotal = 0;
+
+	for (const BoolRing& ring : vecRing)
+	{
+		nTotal += ring.nCnt;
+	}
+
+	VecPoint2Dx vecFixed;
+	VecSnapSegment vecSeg, vecPiece;
+	vecSeg.reserve(nTotal);
+
+	for (size_t r = 0; r < vecRing.size(); r++)
+	{
+		const BoolRing& ring = vecRing[r];
+		GInt nGroup = (r < nSubjRing) ? 0 : 1;
+
+		if (ring.nCnt < 3)
+			continue;
+
+		vecFixed.resize(ring.nCnt);
+
+		for (size_t i = 0; i < ring.nCnt; i++)
+		{
+			const GDouble dx = std::round(GDouble(ring.pts[i].x) * dScale);
+			const GDouble dy = std::round(GDouble(ring.pts[i].y) * dScale);
+
+			if (std::fabs(dx) > GDouble(GSNAP_COORD_MAX) || std::fabs(dy) > GDouble(GSNAP_COORD_MAX))
+				return GFalse;
+
+			vecFixed[i] = Point2Dx(static_cast<GFixed>(dx), static_cast<GFixed>(dy));
+		}
+
+		for (size_t i = 0; i < ring.nCnt; i++)
+		{
+			vecSeg.push_back(SnapSegment{ vecFixed[i], vecFixed[(i + 1) % ring.nCnt], nGroup });
+		}
+	}
+
+	if (snap_round_segments(vecSeg, vecPiece) == GFalse)
+		return GFalse;
+
+	vecEdge.reserve(vecPiece.size());
+
+	Point2D pts[2];
+
+	for (const SnapSegment& seg : vecPiece)
+	{
+		from_fixed(&seg.pt1, 1, dScale, &pts[0]);
+		from_fixed(&seg.pt2, 1, dScale, &pts[1]);
+
+		bool_add_edge(vecEdge, pts[0], pts[1], seg.nTag);
+	}
+
+	return GTrue;
+}
+
+/***********************************************************************************
+*! @brief  : Result rings of noded edges
+*! @param  : [in ] vecEdge : noded edges (edges only meet at end points)
+*! @param  : [in ] eOp     : operation
+*! @param  : [in ] eFill   : FILL_EVENODD : masks are xor-ed | other : masks are winding
+*!                           deltas and added (eOp is not used)
+*! @param  : [out] result  : result polygons
+*! @note   : 1. Merge overlapping edges, sweep and label the region above each edge
+*!           2. Keep edges that separate result and not result, link them to rings
+*!              (result on the left side) and attach holes by the sweep order
+***********************************************************************************/
+static void bool_build_result(VecBoolEdge& vecEdge, EnumBoolOp eOp, EnumFillRule eFill, MultiPolygon2D& result)
+{
+	const GBool bWinding = (eFill != FILL_EVENODD) ? GTrue : GFalse;
+
+	ScratchAllocator<Point2D> alloc(vecEdge.get_allocator());
+
+	// 1. Merge overlapping edges (even-odd : boundary of the same ring twice cancels |
+	//    winding : opposite edges cancel)
+	std::sort(vecEdge.begin(), vecEdge.end(), [](const BoolEdge& a, const BoolEdge& b)
+	{
+		if (!is_same_point(a.pt1, b.pt1)) return is_less_point(a.pt1, b.pt1) == GTrue;
+		return is_less_point(a.pt2, b.pt2) == GTrue;
+	});
+
+	size_t nEdgeCnt = 0;
+
+	for (size_t i = 0; i < vecEdge.size(); )
+	{
+		BoolEdge edge = vecEdge[i++];
+
+		while (i < vecEdge.size() && is_same_point(vecEdge[i].pt1, edge.pt1) &&
+									 is_same_point(vecEdge[i].pt2, edge.pt2))
+		{
+			edge.nMask = bWinding ? edge.nMask + vecEdge[i].nMask : edge.nMask ^ vecEdge[i].nMask;
+			i++;
+		}
+
+		if (edge.nMask != 0)
+		{
+			vecEdge[nEdgeCnt++] = edge;
+		}
+	}
+
+	vecEdge.resize(nEdgeCnt);
+
+	if (nEdgeCnt == 0)
+		return;
+
+	// 2. Label sweep : region above edge = region below edge xor mask (winding : + mask)
+	BoolSweep label(alloc.m_pScratch);
+	label.reserve(nEdgeCnt);
+
+	VecBoolEvent vecEvent(alloc);
+	vecEvent.reserve(nEdgeCnt * 2);
+
+	GDouble dMax = 1.0;
+
+	for (size_t i = 0; i < nEdgeCnt; i++)
+	{
+		const BoolEdge& edge = vecEdge[i];
+
+		label.add_segment(edge.pt1, edge.pt2);
+
+		vecEvent.push_back(BoolEvent{ edge.pt1.x, edge.pt1.y, GInt(i), GTrue  });
+		vecEvent.push_back(BoolEvent{ edge.pt2.x, edge.pt2.y, GInt(i), GFalse });
+
+		dMax = std::max(dMax, GDouble(std::max(std::max(std::fabs(edge.pt1.x), std::fabs(edge.pt1.y)),
+											   std::max(std::fabs(edge.pt2.x), std::fabs(edge.pt2.y)))));
+	}
+
+	label.set_eps(dMax * 1e-9);
+
+	std::sort(vecEvent.begin(), vecEvent.end(), [](const BoolEvent& a, const BoolEvent& b)
+	{
+		if (a.x != b.x) return a.x < b.x;
+		if (a.y != b.y) return a.y < b.y;
+		return a.bLeft < b.bLeft;		// remove before insert
+	});
+
+	typedef std::set<GInt, BoolStatusLess, ScratchAllocator<GInt>> SetStatus;
+	typedef std::vector<SetStatus::iterator, ScratchAllocator<SetStatus::iterator>> VecStatusIter;
+
+	BoolStatusLess cmpStatus; cmpStatus.m_pSweep = &label;
+	SetStatus setStatus(cmpStatus, alloc);
+
+	VecStatusIter vecIter(nEdgeCnt, setStatus.end(), alloc);
+	VecBoolIndex vecAbove(nEdgeCnt, 0, alloc);		// region above edge
+	VecBoolIndex vecPrevRes(nEdgeCnt, -1, alloc);	// nearest result edge below
+	VecBoolIndex vecSeq(nEdgeCnt, 0, alloc);		// order of insertion
+	std::vector<GBool, ScratchAllocator<GBool>> vecInRes(nEdgeCnt, GFalse, alloc);
+	VecBoolIndex vecInsert(alloc);
+
+	GInt nSeq = 0;
+
+	for (size_t i = 0; i < vecEvent.size(); )
+	{
+		const BoolEvent& ev = vecEvent[i];
+		label.set_sweep(ev.x, ev.y);
+
+		vecInsert.clear();
+
+		for (; i < vecEvent.size() && vecEvent[i].x == ev.x && vecEvent[i].y == ev.y; i++)
+		{
+			GInt nEdge = vecEvent[i].nEdge;
+
+			if (vecEvent[i].bLeft)
+			{
+				vecIter[nEdge] = setStatus.insert(nEdge).first;
+				vecInsert.push_back(nEdge);
+			}
+			else
+			{
+				setStatus.erase(vecIter[nEdge]);
+			}
+		}
+
+		// Label from bottom to top
+		std::sort(vecInsert.begin(), vecInsert.end(), cmpStatus);
+
+		for (GInt nEdge : vecInsert)
+		{
+			auto it = vecIter[nEdge];
+
+			GInt nPrev  = (it == setStatus.begin()) ? -1 : *std::prev(it);
+			GInt nBelow = (nPrev < 0) ? 0 : vecAbove[nPrev];
+
+			vecAbove[nEdge] = bWinding ? nBelow + vecEdge[nEdge].nMask : nBelow ^ vecEdge[nEdge].nMask;
+			vecInRes[nEdge] = (bool_in_result(nBelow, eOp, eFill) != bool_in_result(vecAbove[nEdge], eOp, eFill)) ? GTrue : GFalse;
+			vecSeq[nEdge]   = nSeq++;
+
+			if (nPrev >= 0)
+			{
+				vecPrevRes[nEdge] = vecInRes[nPrev] ? nPrev : vecPrevRes[nPrev];
+			}
+		}
+	}
+
+	// 3. Result edges directed with result on the left side (above : left of pt1 -> pt2)
+	VecBoolIndex vecResEdge(alloc);
+	vecResEdge.reserve(nEdgeCnt);
+
+	for (size_t i = 0; i < nEdgeCnt; i++)
+	{
+		if (vecInRes[i])
+		{
+			vecResEdge.push_back(GInt(i));
+		}
+	}
+
+	std::sort(vecResEdge.begin(), vecResEdge.end(), [&](GInt a, GInt b)
+	{
+		return vecSeq[a] < vecSeq[b];
+	});
+
+	ScratchVecPoint2D vecNode(alloc);
+	vecNode.reserve(vecResEdge.size() * 2);
+
+	for (GInt nEdge : vecResEdge)
+	{
+		vecNode.push_back(vecEdge[nEdge].pt1);
+		vecNode.push_back(vecEdge[nEdge].pt2);
+	}
+
+	auto funLessPt = [](const Point2D& a, const Point2D& b) { return is_less_point(a, b) == GTrue; };
+
+	std::sort(vecNode.begin(), vecNode.end(), funLessPt);
+	vecNode.erase(std::unique(vecNode.begin(), vecNode.end(), [](const Point2D& a, const Point2D& b)
+	{
+		return is_same_point(a, b) == GTrue;
+	}), vecNode.end());
+
+	auto funNodeId = [&](const Point2D& pt)
+	{
+		return GInt(std::lower_bound(vecNode.begin(), vecNode.end(), pt, funLessPt) - vecNode.begin());
+	};
+
+	VecBoolIndex vecFrom(nEdgeCnt, -1, alloc), vecTo(nEdgeCnt, -1, alloc);
+	VecBoolIndex vecOutBegin(vecNode.size() + 1, 0, alloc);
+
+	for (GInt nEdge : vecResEdge)
+	{
+		GInt n1 = funNodeId(vecEdge[nEdge].pt1);
+		GInt n2 = funNodeId(vecEdge[nEdge].pt2);
+
+		if (bool_in_result(vecAbove[nEdge], eOp, eFill))
+		{
+			vecFrom[nEdge] = n1; vecTo[nEdge] = n2;
+		}
+		else
+		{
+			vecFrom[nEdge] = n2; vecTo[nEdge] = n1;
+		}
+
+		vecOutBegin[vecFrom[nEdge] + 1]++;
+	}
+
+	for (size_t i = 1; i < vecOutBegin.size(); i++)
+	{
+		vecOutBegin[i] += vecOutBegin[i - 1];
+	}
+
+	VecBoolIndex vecOut(vecResEdge.size(), 0, alloc);
+	VecBoolIndex vecOutPos(vecOutBegin.begin(), vecOutBegin.end() - 1, alloc);
+
+	for (GInt nEdge : vecResEdge)
+	{
+		vecOut[vecOutPos[vecFrom[nEdge]]++] = nEdge;
+	}
+
+	// Next edge at node : first edge clockwise from the incoming edge (smallest ring)
+	auto funNextEdge = [&](GInt nEdge)
+	{
+		GInt nNode  = vecTo[nEdge];
+		GInt nBegin = vecOutBegin[nNode];
+		GInt nEnd   = vecOutBegin[nNode + 1];
+
+		if (nEnd - nBegin == 1)
+			return vecOut[nBegin];
+
+		const Point2D& ptNode = vecNode[nNode];
+		const Point2D& ptBack = vecNode[vecFrom[nEdge]];
+
+		GDouble rx = GDouble(ptBack.x) - ptNode.x, ry = GDouble(ptBack.y) - ptNode.y;
+
+		GInt    nBest = -1;
+		GDouble dBest = 0.0;
+
+		for (GInt k = nBegin; k < nEnd; k++)
+		{
+			const Point2D& ptNext = vecNode[vecTo[vecOut[k]]];
+
+			GDouble dx = GDouble(ptNext.x) - ptNode.x, dy = GDouble(ptNext.y) - ptNode.y;
+			GDouble dAngle = -std::atan2(rx * dy - ry * dx, rx * dx + ry * dy);
+
+			if (dAngle <= 0.0)
+				dAngle += 6.283185307179586;	// 2 * PI
+
+			if (nBest < 0 || dAngle < dBest)
+			{
+				nBest = vecOut[k];
+				dBest = dAngle;
+			}
+		}
+
+		return nBest;
+	};
+
+	// 4. Link rings (ring is found from its first edge in sweep order)
+	VecBoolIndex vecRingOf(nEdgeCnt, -1, alloc);
+	std::vector<ScratchVecPoint2D, ScratchAllocator<ScratchVecPoint2D>> vecResRing(alloc);
+	VecBoolIndex vecRingParent(alloc);
+	std::vector<GBool, ScratchAllocator<GBool>> vecRingHole(alloc);
+
+	for (GInt nFirst : vecResEdge)
+	{
+		if (vecRingOf[nFirst] >= 0)
+			continue;
+
+		GInt nRing = GInt(vecResRing.size());
+		vecResRing.push_back(ScratchVecPoint2D(alloc));
+		ScratchVecPoint2D& ring = vecResRing.back();
+
+		GBool bClosed = GFalse;
+		GInt  nEdge = nFirst;
+
+		while (true)
+		{
+			vecRingOf[nEdge] = nRing;
+			ring.push_back(vecNode[vecFrom[nEdge]]);
+
+			GInt nNext = funNextEdge(nEdge);
+
+			if (nNext == nFirst)
+			{
+				bClosed = GTrue;
+				break;
+			}
+
+			if (nNext < 0 || vecRingOf[nNext] >= 0)
+				break;
+
+			nEdge = nNext;
+		}
+
+		// Hole : region below first edge is inside result
+		GInt nPrev   = vecPrevRes[nFirst];
+		GInt nParent = -1;
+		GBool bHole  = GFalse;
+
+		if (nPrev >= 0 && bool_in_result(vecAbove[nPrev], eOp, eFill))
+		{
+			GInt nPrevRing = vecRingOf[nPrev];
+
+			bHole   = GTrue;
+			nParent = vecRingHole[nPrevRing] ? vecRingParent[nPrevRing] : nPrevRing;
+		}
+
+		if (bClosed == GFalse || (bHole && nParent < 0))
+		{
+			ring.clear();
+		}
+
+		bool_clean_ring(ring);
+
+		vecRingParent.push_back(nParent);
+		vecRingHole.push_back(bHole);
+	}
+
+	// 5. Output : outer ring then its holes
+	GInt nResRing = GInt(vecResRing.size());
+	VecBoolIndex vecHoleBegin(nResRing + 1, 0, alloc), vecHole(alloc);
+
+	for (GInt r = 0; r < nResRing; r++)
+	{
+		if (vecRingHole[r] && !vecResRing[r].empty())
+			vecHoleBegin[vecRingParent[r] + 1]++;
+	}
+
+	for (GInt r = 0; r < nResRing; r++)
+	{
+		vecHoleBegin[r + 1] += vecHoleBegin[r];
+	}
+
+	vecHole.resize(vecHoleBegin[nResRing]);
+	VecBoolIndex vecHolePos(vecHoleBegin.begin(), vecHoleBegin.end() - 1, alloc);
+
+	size_t nPointCnt = 0;
+
+	for (GInt r = 0; r < nResRing; r++)
+	{
+		nPointCnt += vecResRing[r].size();
+
+		if (vecRingHole[r] && !vecResRing[r].empty())
+			vecHole[vecHolePos[vecRingParent[r]]++] = r;
+	}
+
+	result.reserve(nPointCnt, nResRing, nResRing - vecHole.size());
+
+	for (GInt r = 0; r < nResRing; r++)
+	{
+		if (vecRingHole[r] || vecResRing[r].empty())
+			continue;
+
+		result.begin_polygon();
+		result.add_ring(vecResRing[r].data(), vecResRing[r].size());
+
+		for (GInt k = vecHoleBegin[r]; k < vecHoleBegin[r + 1]; k++)
+		{
+			result.add_ring(vecResRing[vecHole[k]].data(), vecResRing[vecHole[k]].size());
+		}
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Boolean operation of rings (even-odd rule)
+*! @param  : [in ] vecRing   : rings [0, nSubjRing) : subject | other : clip
+*! @param  : [in ] nSubjRing : number of subject ring
+*! @param  : [in ] eOp       : operation
+*! @param  : [out] result    : result polygons
+*! @note   : Working sets use the memory of vecRing (scratch or heap)
+***********************************************************************************/
+static void boolean_rings(const VecBoolRing& vecRing, size_t nSubjRing, EnumBoolOp eOp, MultiPolygon2D& result)
+{
+	result.clear();
+
+	VecBoolEdge vecEdge(vecRing.get_allocator());
+	bool_node_edges(vecRing, nSubjRing, vecEdge);
+
+	bool_build_result(vecEdge, eOp, FILL_EVENODD, result);
+}
+
+/***********************************************************************************
+*! @brief  : Boolean operation of rings snap rounded on grid (even-odd rule)
+*! @param  : [in ] vecRing   : rings [0, nSubjRing) : subject | other : clip
+*! @param  : [in ] nSubjRing : number of subject ring
+*! @param  : [in ] eOp       : operation
+*! @param  : [in ] dScale    : fixed unit per world unit
+*! @param  : [out] result    : result polygons
+***********************************************************************************/
+static GBool boolean_rings_snap(const VecBoolRing& vecRing, size_t nSubjRing, EnumBoolOp eOp, GDouble dScale, MultiPolygon2D& result)
+{
+	result.clear();
+
+	VecBoolEdge vecEdge;
+
+	if (bool_snap_edges(vecRing, nSubjRing, dScale, vecEdge) == GFalse)
+		return GFalse;
+
+	bool_build_result(vecEdge, eOp, FILL_EVENODD, result);
+
+	return GTrue;
+}
+
+/***********************************************************************************
+*! @brief  : Boolean operation of two multipolygons
+*! @param  : [in ] subject : subject polygons (outer ring + holes)
+*! @param  : [in ] clip    : clip polygons (outer ring + holes)
+*! @param  : [in ] eOp     : operation
+*! @param  : [out] result  : result polygons (outer ring CCW, hole CW)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Input rings use even-odd rule (orientation of rings is not used).
+*!           Edges are split at intersections by sweep line, then labeled by a
+*!           second sweep. O((n + k) log n) : n edges, k intersections
+***********************************************************************************/
+Dllexport void boolean_polygon(const MultiPolygon2D& subject, const MultiPolygon2D& clip, EnumBoolOp eOp, MultiPolygon2D& result)
+{
+	GeoScratch scratch;
+	boolean_polygon(subject, clip, eOp, result, scratch);
+}
+
+/***********************************************************************************
+*! @brief  : Boolean operation of two multipolygons (scratch memory)
+*! @param  : [in ] subject : subject polygons (outer ring + holes)
+*! @param  : [in ] clip    : clip polygons (outer ring + holes)
+*! @param  : [in ] eOp     : operation
+*! @param  : [out] result  : result polygons (outer ring CCW, hole CW)
+*! @param  : [in ] scratch : temporary memory (sweep queue, status, result rings)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Same result as boolean_polygon. Temporary memory is given back to
+*!           scratch on return, reuse scratch and result between calls
+***********************************************************************************/
+Dllexport void boolean_polygon(const MultiPolygon2D& subject, const MultiPolygon2D& clip, EnumBoolOp eOp, MultiPolygon2D& result,
+							   GeoScratch& scratch)
+{
+	GeoScratchFrame frame(scratch);
+
+	VecBoolRing vecRing{ ScratchAllocator<BoolRing>(&scratch) };
+	vecRing.reserve(subject.ring_count() + clip.ring_count());
+
+	for (size_t r = 0; r < subject.ring_count(); r++)
+	{
+		vecRing.push_back(BoolRing{ subject.ring_data(r), subject.ring_size(r) });
+	}
+
+	for (size_t r = 0; r < clip.ring_count(); r++)
+	{
+		vecRing.push_back(BoolRing{ clip.ring_data(r), clip.ring_size(r) });
+	}
+
+	boolean_rings(vecRing, subject.ring_count(), eOp, result);
+}
+
+/***********************************************************************************
+*! @brief  : Boolean operation of multipolygon and polygon (scratch memory)
+*! @param  : [in ] subject : subject polygons (outer ring + holes)
+*! @param  : [in ] clip    : clip polygon
+*! @param  : [in ] eOp     : operation
+*! @param  : [out] result  : result polygons (outer ring CCW, hole CW)
+*! @param  : [in ] scratch : temporary memory (sweep queue, status, result rings)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+Dllexport void boolean_polygon(const MultiPolygon2D& subject, const RingView2D& clip, EnumBoolOp eOp, MultiPolygon2D& result,
+							   GeoScratch& scratch)
+{
+	GeoScratchFrame frame(scratch);
+
+	VecBoolRing vecRing{ ScratchAllocator<BoolRing>(&scratch) };
+	vecRing.reserve(subject.ring_count() + 1);
+
+	for (size_t r = 0; r < subject.ring_count(); r++)
+	{
+		vecRing.push_back(BoolRing{ subject.ring_data(r), subject.ring_size(r) });
+	}
+
+	vecRing.push_back(BoolRing{ clip.data(), clip.size() });
+
+	boolean_rings(vecRing, subject.ring_count(), eOp, result);
+}
+
+/***********************************************************************************
+*! @brief  : Boolean operation of two ring lists (even-odd rule)
+*! @param  : [in ] subject : subject rings
+*! @param  : [in ] clip    : clip rings
+*! @param  : [in ] eOp     : operation
+*! @param  : [out] result  : result polygons (outer ring CCW, hole CW)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+Dllexport void boolean_polygon(const VecPolyList& subject, const VecPolyList& clip, EnumBoolOp eOp, MultiPolygon2D& result)
+{
+	GeoScratch scratch;
+	boolean_polygon(subject, clip, eOp, result, scratch);
+}
+
+Dllexport void boolean_polygon(const VecPolyList& subject, const VecPolyList& clip, EnumBoolOp eOp, MultiPolygon2D& result,
+							   GeoScratch& scratch)
+{
+	GeoScratchFrame frame(scratch);
+
+	VecBoolRing vecRing{ ScratchAllocator<BoolRing>(&scratch) };
+	vecRing.reserve(subject.size() + clip.size());
+
+	for (const VecPoint2D& ring : subject)
+	{
+		vecRing.push_back(BoolRing{ ring.data(), ring.size() });
+	}
+
+	for (const VecPoint2D& ring : clip)
+	{
+		vecRing.push_back(BoolRing{ ring.data(), ring.size() });
+	}
+
+	boolean_rings(vecRing, subject.size(), eOp, result);
+}
+
+/***********************************************************************************
+*! @brief  : Boolean operation of two polygons
+*! @param  : [in ] subject : subject polygon
+*! @param  : [in ] clip    : clip polygon
+*! @param  : [in ] eOp     : operation
+*! @param  : [out] result  : result polygons (outer ring CCW, hole CW)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+Dllexport void boolean_polygon(const VecPoint2D& subject, const VecPoint2D& clip, EnumBoolOp eOp, MultiPolygon2D& result)
+{
+	boolean_polygon(RingView2D(subject), RingView2D(clip), eOp, result);
+}
+
+Dllexport void boolean_polygon(const RingView2D& subject, const RingView2D& clip, EnumBoolOp eOp, MultiPolygon2D& result)
+{
+	GeoScratch scratch;
+	boolean_polygon(subject, clip, eOp, result, scratch);
+}
+
+Dllexport void boolean_polygon(const RingView2D& subject, const RingView2D& clip, EnumBoolOp eOp, MultiPolygon2D& result,
+							   GeoScratch& scratch)
+{
+	GeoScratchFrame frame(scratch);
+
+	VecBoolRing vecRing{ ScratchAllocator<BoolRing>(&scratch) };
+	vecRing.reserve(2);
+
+	vecRing.push_back(BoolRing{ subject.data(), subject.size() });
+	vecRing.push_back(BoolRing{ clip.data(), clip.size() });
+
+	boolean_rings(vecRing, 1, eOp, result);
+}
+
+/***********************************************************************************
+*! @brief  : Union of all rings of multipolygon by fill rule
+*! @param  : [in ] mpoly  : rings (polygon structure is not used)
+*! @param  : [in ] eFill  : fill rule
+*! @param  : [out] result : result polygons (outer ring CCW, hole CW)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Removes self-intersections and overlaps. Winding number : +1 inside
+*!           CCW ring, -1 inside CW ring, summed over all rings
+***********************************************************************************/
+Dllexport void union_polygon(const MultiPolygon2D& mpoly, EnumFillRule eFill, MultiPolygon2D& result)
+{
+	VecBoolRing vecRing;
+	vecRing.reserve(mpoly.ring_count());
+
+	for (size_t r = 0; r < mpoly.ring_count(); r++)
+	{
+		vecRing.push_back(BoolRing{ mpoly.ring_data(r), mpoly.ring_size(r) });
+	}
+
+	result.clear();
+
+	VecBoolEdge vecEdge;
+	bool_node_edges(vecRing, vecRing.size(), vecEdge, (eFill != FILL_EVENODD) ? GTrue : GFalse);
+
+	bool_build_result(vecEdge, BOOL_UNION, eFill, result);
+}
+
+/***********************************************************************************
+*! @brief  : Boolean operation of two multipolygons on integer grid (snap rounding)
+*! @param  : [in ] subject : subject polygons (outer ring + holes)
+*! @param  : [in ] clip    : clip polygons (outer ring + holes)
+*! @param  : [in ] eOp     : operation
+*! @param  : [in ] dScale  : grid unit per world unit (ex : 1000 -> grid 0.001)
+*! @param  : [out] result  : result polygons (outer ring CCW, hole CW)
+*! @return : TRUE : OK | FALSE : coordinate * dScale out of GSNAP_COORD_MAX
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : All points of result are grid points (input is rounded to grid),
+*!           no sliver or near duplicate point from float intersection
+***********************************************************************************/
+Dllexport GBool boolean_polygon_snap(const MultiPolygon2D& subject, const MultiPolygon2D& clip, EnumBoolOp eOp, GDouble dScale, MultiPolygon2D& result)
+{
+	VecBoolRing vecRing;
+	vecRing.reserve(subject.ring_count() + clip.ring_count());
+
+	for (size_t r = 0; r < subject.ring_count(); r++)
+	{
+		vecRing.push_back(BoolRing{ subject.ring_data(r), subject.ring_size(r) });
+	}
+
+	for (size_t r = 0; r < clip.ring_count(); r++)
+	{
+		vecRing.push_back(BoolRing{ clip.ring_data(r), clip.ring_size(r) });
+	}
+
+	return boolean_rings_snap(vecRing, subject.ring_count(), eOp, dScale, result);
+}
+
+/***********************************************************************************
+*! @brief  : Boolean operation of two polygons on integer grid (snap rounding)
+*! @param  : [in ] subject : subject polygon
+*! @param  : [in ] clip    : clip polygon
+*! @param  : [in ] eOp     : operation
+*! @param  : [in ] dScale  : grid unit per world unit (ex : 1000 -> grid 0.001)
+*! @param  : [out] result  : result polygons (outer ring CCW, hole CW)
+*! @return : TRUE : OK | FALSE : coordinate * dScale out of GSNAP_COORD_MAX
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+Dllexport GBool boolean_polygon_snap(const VecPoint2D& subject, const VecPoint2D& clip, EnumBoolOp eOp, GDouble dScale, MultiPolygon2D& result)
+{
+	return boolean_polygon_snap(RingView2D(subject), RingView2D(clip), eOp, dScale, result);
+}
+
+Dllexport GBool boolean_polygon_snap(const RingView2D& subject, const RingView2D& clip, EnumBoolOp eOp, GDouble dScale, MultiPolygon2D& result)
+{
+	VecBoolRing vecRing;
+
+	vecRing.push_back(BoolRing{ subject.data(), subject.size() });
+	vecRing.push_back(BoolRing{ clip.data(), clip.size() });
+
+	return boolean_rings_snap(vecRing, 1, eOp, dScale, result);
+}
+
+}}
@@ -0,0 +1,1488 @@
+#include "x2dcdt.h"
+#include "x2dpred.h"
+
+#include <cmath>
+#include <cfloat>
+#include <deque>
+#include <algorithm>
+
+namespace geo { namespace v2 {
+
+const uint32_t DelaunayMesh2D::DELAUNAY_NONE;
+
+#define CDT_NONE	DelaunayMesh2D::DELAUNAY_NONE
+
+typedef struct tagCdtSortItem
+{
+	GDouble		m_dDist2;	// squared distance to seed circumcenter
+	uint32_t	m_nIndex;
+
+} CdtSortItem;
+
+static inline GDouble cdt_dist2(GDouble ax, GDouble ay, GDouble bx, GDouble by)
+{
+	GDouble dx = ax - bx, dy = ay - by;
+	return dx * dx + dy * dy;
+}
+
+static inline GBool cdt_equal(const Point2D& pt1, const Point2D& pt2)
+{
+	return (pt1.x == pt2.x && pt1.y == pt2.y) ? GTrue : GFalse;
+}
+
+/***********************************************************************************
+*! @brief  : Circumcenter of triangle, relative to a (FALSE : collinear)
+***********************************************************************************/
+static GBool cdt_circumcenter(const Point2D& a, const Point2D& b, const Point2D& c, GDouble& dX, GDouble& dY)
+{
+	GDouble dx = GDouble(b.x) - a.x, dy = GDouble(b.y) - a.y;
+	GDouble ex = GDouble(c.x) - a.x, ey = GDouble(c.y) - a.y;
+
+	GDouble bl = dx * dx + dy * dy;
+	GDouble cl = ex * ex + ey * ey;
+	GDouble d  = dx * ey - dy * ex;
+
+	if (d == 0.0)
+		return GFalse;
+
+	dX = (ey * bl - dy * cl) * 0.5 / d;
+	dY = (dx * cl - ex * bl) * 0.5 / d;
+
+	return GTrue;
+}
+
+/***********************************************************************************
+*! @brief  : Monotonic angle in [0, 1) without trigonometry (hull hash key)
+***********************************************************************************/
+static inline GDouble cdt_pseudo_angle(GDouble dx, GDouble dy)
+{
+	GDouble dSum = std::fabs(dx) + std::fabs(dy);
+
+	if (dSum == 0.0)
+		return 0.0;
+
+	GDouble p = dx / dSum;
+
+	return (dy > 0.0 ? 3.0 - p : 1.0 + p) / 4.0;
+}
+
+DelaunayMesh2D::DelaunayMesh2D() : m_nHullStart(CDT_NONE)
+{
+
+}
+
+/***********************************************************************************
+*! @brief  : Delaunay triangulation of points
+*! @param  : [in] pts  : points (copied)
+*! @param  : [in] nCnt : number of point
+*! @return : TRUE : success | FALSE : less than 3 points or all points collinear
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : O(n log n). Duplicate points use the vertex of the first one
+*!           (see vertex_of). All triangles are inside (no constraint)
+***********************************************************************************/
+GBool DelaunayMesh2D::build(const Point2D* pts, size_t nCnt)
+{
+	clear();
+
+	m_vecPoint.assign(pts, pts + nCnt);
+
+	return triangulate();
+}
+
+GBool DelaunayMesh2D::build(const VecPoint2D& vecPoints)
+{
+	return build(vecPoints.data(), vecPoints.size());
+}
+
+/***********************************************************************************
+*! @brief  : Constrained Delaunay triangulation of multipolygon
+*! @param  : [in] mpoly : multipolygon (vertex i : mpoly.points()[i])
+*! @return : TRUE : success | FALSE : triangulation failed or some ring edges
+*!           cross each other (those constraints are skipped)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : All ring edges are constraints. Inside : even-odd rule over all
+*!           rings (same as boolean_polygon), see is_inside
+***********************************************************************************/
+GBool DelaunayMesh2D::build(const MultiPolygon2D& mpoly)
+{
+	clear();
+
+	m_vecPoint = mpoly.points();
+
+	if (triangulate() == GFalse)
+		return GFalse;
+
+	GBool bRet = GTrue;
+
+	for (size_t r = 0; r < mpoly.ring_count(); r++)
+	{
+		uint32_t nBegin = static_cast<uint32_t>(mpoly.ring_begin(r));
+		uint32_t nEnd   = static_cast<uint32_t>(mpoly.ring_end(r));
+
+		if (nEnd - nBegin < 2)
+			continue;
+
+		for (uint32_t i = nBegin; i < nEnd; i++)
+		{
+			uint32_t j = (i + 1 < nEnd) ? i + 1 : nBegin;
+
+			if (insert_constraint(i, j) == GFalse)
+			{
+				bRet = GFalse;
+			}
+		}
+	}
+
+	mark_inside();
+
+	return bRet;
+}
+
+/***********************************************************************************
+*! @brief  : Remove all triangles
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+void DelaunayMesh2D::clear()
+{
+	m_vecPoint.clear();
+	m_vecTri.clear();
+	m_vecHalfEdge.clear();
+	m_vecConstrained.clear();
+	m_vecInside.clear();
+	m_vecVertEdge.clear();
+	m_vecAlias.clear();
+	m_vecHullNext.clear();
+	m_vecHullPrev.clear();
+	m_vecHullTri.clear();
+	m_nHullStart = CDT_NONE;
+}
+
+void DelaunayMesh2D::link(uint32_t a, uint32_t b)
+{
+	m_vecHalfEdge[a] = b;
+
+	if (b != CDT_NONE)
+	{
+		m_vecHalfEdge[b] = a;
+	}
+}
+
+uint32_t DelaunayMesh2D::add_triangle(uint32_t i0, uint32_t i1, uint32_t i2, uint32_t a, uint32_t b, uint32_t c)
+{
+	uint32_t t = static_cast<uint32_t>(m_vecTri.size());
+
+	m_vecTri.push_back(i0);
+	m_vecTri.push_back(i1);
+	m_vecTri.push_back(i2);
+
+	m_vecHalfEdge.push_back(CDT_NONE);
+	m_vecHalfEdge.push_back(CDT_NONE);
+	m_vecHalfEdge.push_back(CDT_NONE);
+
+	link(t, a);
+	link(t + 1, b);
+	link(t + 2, c);
+
+	return t;
+}
+
+/***********************************************************************************
+*! @brief  : Overwrite triangle t (index of triangle, not of half-edge)
+***********************************************************************************/
+void DelaunayMesh2D::set_triangle(uint32_t t, uint32_t i0, uint32_t i1, uint32_t i2, uint32_t a, uint32_t b, uint32_t c)
+{
+	uint32_t e = 3 * t;
+
+	if (e >= m_vecTri.size())
+	{
+		m_vecTri.resize(e + 3);
+		m_vecHalfEdge.resize(e + 3);
+	}
+
+	m_vecTri[e] = i0; m_vecTri[e + 1] = i1; m_vecTri[e + 2] = i2;
+
+	m_vecHalfEdge[e] = m_vecHalfEdge[e + 1] = m_vecHalfEdge[e + 2] = CDT_NONE;
+
+	link(e, a);
+	link(e + 1, b);
+	link(e + 2, c);
+}
+
+/***********************************************************************************
+*! @brief  : Hull half-edge moved from nOld to nNew (same start vertex)
+***********************************************************************************/
+void DelaunayMesh2D::fix_hull_edge(uint32_t nOld, uint32_t nNew)
+{
+	uint32_t v = m_vecTri[nNew];
+
+	if (m_vecHullTri[v] == nOld)
+	{
+		m_vecHullTri[v] = nNew;
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Flip edge a (shared by triangles a / 3 and opposite / 3)
+*! @note   : Edges at bl and ar move to a and b, other half-edges keep their index.
+*!           New diagonal : ar (p0 -> p1) and bl (p1 -> p0)
+***********************************************************************************/
+void DelaunayMesh2D::flip_edge(uint32_t a)
+{
+	uint32_t b = m_vecHalfEdge[a];
+
+	uint32_t a0 = a - a % 3;
+	uint32_t b0 = b - b % 3;
+	uint32_t al = a0 + (a + 1) % 3;
+	uint32_t ar = a0 + (a + 2) % 3;
+	uint32_t bl = b0 + (b + 2) % 3;
+	uint32_t br = b0 + (b + 1) % 3;
+
+	uint32_t p0 = m_vecTri[ar];
+	uint32_t pr = m_vecTri[a];
+	uint32_t pl = m_vecTri[al];
+	uint32_t p1 = m_vecTri[bl];
+
+	uint32_t hbl = m_vecHalfEdge[bl];
+	uint32_t har = m_vecHalfEdge[ar];
+
+	m_vecTri[a] = p1;
+	m_vecTri[b] = p0;
+
+	if (hbl == CDT_NONE) fix_hull_edge(bl, a);
+	if (har == CDT_NONE) fix_hull_edge(ar, b);
+
+	link(a, hbl);
+	link(b, har);
+	link(ar, bl);
+
+	if (!m_vecConstrained.empty())
+	{
+		m_vecConstrained[a]  = m_vecConstrained[bl];
+		m_vecConstrained[b]  = m_vecConstrained[ar];
+		m_vecConstrained[ar] = m_vecConstrained[bl] = 0;
+	}
+
+	if (!m_vecVertEdge.empty())
+	{
+		if (m_vecVertEdge[pr] == a) m_vecVertEdge[pr] = br;
+		if (m_vecVertEdge[pl] == b) m_vecVertEdge[pl] = al;
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Flip edges until Delaunay around the new point (opposite of edge a)
+*! @return : half-edge after a in its triangle (hull edge of the new point)
+***********************************************************************************/
+uint32_t DelaunayMesh2D::legalize(uint32_t a)
+{
+	size_t   i  = 0;
+	uint32_t ar = 0;
+
+	while (true)
+	{
+		uint32_t b  = m_vecHalfEdge[a];
+		uint32_t a0 = a - a % 3;
+
+		ar = a0 + (a + 2) % 3;
+
+		GBool bConstrained = (!m_vecConstrained.empty() && m_vecConstrained[a]) ? GTrue : GFalse;
+
+		if (b == CDT_NONE || bConstrained)
+		{
+			if (i == 0) break;
+			a = m_vecEdgeStack[--i];
+			continue;
+		}
+
+		uint32_t b0 = b - b % 3;
+		uint32_t al = a0 + (a + 1) % 3;
+		uint32_t bl = b0 + (b + 2) % 3;
+
+		const Point2D& pt0 = m_vecPoint[m_vecTri[ar]];
+		const Point2D& ptR = m_vecPoint[m_vecTri[a]];
+		const Point2D& ptL = m_vecPoint[m_vecTri[al]];
+		const Point2D& pt1 = m_vecPoint[m_vecTri[bl]];
+
+		if (incircle(pt0, ptR, ptL, pt1) > 0.0)
+		{
+			flip_edge(a);
+
+			uint32_t br = b0 + (b + 1) % 3;
+
+			if (i < m_vecEdgeStack.size()) m_vecEdgeStack[i] = br;
+			else						   m_vecEdgeStack.push_back(br);
+			i++;
+		}
+		else
+		{
+			if (i == 0) break;
+			a = m_vecEdgeStack[--i];
+		}
+	}
+
+	return ar;
+}
+
+/***********************************************************************************
+*! @brief  : Sweep hull triangulation of m_vecPoint
+***********************************************************************************/
+GBool DelaunayMesh2D::triangulate()
+{
+	uint32_t nCnt = static_cast<uint32_t>(m_vecPoint.size());
+
+	m_vecAlias.resize(nCnt);
+
+	for (uint32_t i = 0; i < nCnt; i++)
+	{
+		m_vecAlias[i] = i;
+	}
+
+	if (nCnt < 3)
+		return GFalse;
+
+	// 1. Seed triangle : point nearest to center, its nearest point, smallest circle
+	GDouble dMinX = DBL_MAX, dMinY = DBL_MAX, dMaxX = -DBL_MAX, dMaxY = -DBL_MAX;
+
+	for (uint32_t i = 0; i < nCnt; i++)
+	{
+		dMinX = std::min<GDouble>(dMinX, m_vecPoint[i].x); dMaxX = std::max<GDouble>(dMaxX, m_vecPoint[i].x);
+		dMinY = std::min<GDouble>(dMinY, m_vecPoint[i].y); dMaxY = std::max<GDouble>(dMaxY, m_vecPoint[i].y);
+	}
+
+	GDouble dCenX = (dMinX + dMaxX) * 0.5, dCenY = (dMinY + dMaxY) * 0.5;
+	GDouble dMin  = DBL_MAX;
+
+	uint32_t i0 = CDT_NONE, i1 = CDT_NONE, i2 = CDT_NONE;
+
+	for (uint32_t i = 0; i < nCnt; i++)
+	{
+		GDouble d = cdt_dist2(dCenX, dCenY, m_vecPoint[i].x, m_vecPoint[i].y);
+
+		if (d < dMin) { i0 = i; dMin = d; }
+	}
+
+	const Point2D& pt0 = m_vecPoint[i0];
+
+	dMin = DBL_MAX;
+
+	for (uint32_t i = 0; i < nCnt; i++)
+	{
+		GDouble d = cdt_dist2(pt0.x, pt0.y, m_vecPoint[i].x, m_vecPoint[i].y);
+
+		if (d > 0.0 && d < dMin) { i1 = i; dMin = d; }
+	}
+
+	if (i1 == CDT_NONE)
+		return GFalse;
+
+	GDouble dMinRadius = DBL_MAX;
+
+	for (uint32_t i = 0; i < nCnt; i++)
+	{
+		GDouble dX, dY;
+
+		if (orient2d(pt0, m_vecPoint[i1], m_vecPoint[i]) == 0.0 ||
+			cdt_circumcenter(pt0, m_vecPoint[i1], m_vecPoint[i], dX, dY) == GFalse)
+			continue;
+
+		GDouble r = dX * dX + dY * dY;
+
+		if (r < dMinRadius) { i2 = i; dMinRadius = r; }
+	}
+
+	if (i2 == CDT_NONE)
+		return GFalse;
+
+	if (orient2d(pt0, m_vecPoint[i1], m_vecPoint[i2]) < 0.0)
+	{
+		std::swap(i1, i2);
+	}
+
+	GDouble dCCX, dCCY;
+	cdt_circumcenter(pt0, m_vecPoint[i1], m_vecPoint[i2], dCCX, dCCY);
+
+	dCCX += pt0.x;
+	dCCY += pt0.y;
+
+	// 2. Sort by distance to seed circle (equal points are adjacent)
+	std::vector<CdtSortItem> vecSort(nCnt);
+
+	for (uint32_t i = 0; i < nCnt; i++)
+	{
+		vecSort[i].m_dDist2 = cdt_dist2(dCCX, dCCY, m_vecPoint[i].x, m_vecPoint[i].y);
+		vecSort[i].m_nIndex = i;
+	}
+
+	std::sort(vecSort.begin(), vecSort.end(), [this](const CdtSortItem& a, const CdtSortItem& b)
+	{
+		if (a.m_dDist2 != b.m_dDist2) return a.m_dDist2 < b.m_dDist2;
+
+		const Point2D& pa = m_vecPoint[a.m_nIndex];
+		const Point2D& pb = m_vecPoint[b.m_nIndex];
+
+		if (pa.x != pb.x) return pa.x < pb.x;
+		if (pa.y != pb.y) return pa.y < pb.y;
+
+		return a.m_nIndex < b.m_nIndex;
+	});
+
+	// 3. Hull (linked list + angular hash) and seed triangle
+	size_t nHashSize = static_cast<size_t>(std::ceil(std::sqrt(static_cast<GDouble>(nCnt))));
+
+	std::vector<uint32_t> vecHash(nHashSize, CDT_NONE);
+
+	auto hash_key = [&](const Point2D& pt) -> size_t
+	{
+		GDouble dAngle = cdt_pseudo_angle(pt.x - dCCX, pt.y - dCCY);
+
+		return static_cast<size_t>(std::floor(dAngle * nHashSize)) % nHashSize;
+	};
+
+	m_vecHullNext.resize(nCnt);
+	m_vecHullPrev.resize(nCnt);
+	m_vecHullTri.assign(nCnt, CDT_NONE);
+
+	for (uint32_t i = 0; i < nCnt; i++)
+	{
+		m_vecHullNext[i] = m_vecHullPrev[i] = i;
+	}
+
+	m_nHullStart = i0;
+
+	m_vecHullNext[i0] = m_vecHullPrev[i2] = i1;
+	m_vecHullNext[i1] = m_vecHullPrev[i0] = i2;
+	m_vecHullNext[i2] = m_vecHullPrev[i1] = i0;
+
+	m_vecHullTri[i0] = 0;
+	m_vecHullTri[i1] = 1;
+	m_vecHullTri[i2] = 2;
+
+	vecHash[hash_key(m_vecPoint[i0])] = i0;
+	vecHash[hash_key(m_vecPoint[i1])] = i1;
+	vecHash[hash_key(m_vecPoint[i2])] = i2;
+
+	size_t nMaxTri = std::max<size_t>(2 * nCnt, 5) - 5 + 1;
+
+	m_vecTri.reserve(nMaxTri * 3);
+	m_vecHalfEdge.reserve(nMaxTri * 3);
+
+	add_triangle(i0, i1, i2, CDT_NONE, CDT_NONE, CDT_NONE);
+
+	// 4. Add points in order : connect to the visible hull edges, then flip
+	uint32_t nPrev = CDT_NONE;
+
+	for (size_t k = 0; k < nCnt; k++)
+	{
+		uint32_t       i  = vecSort[k].m_nIndex;
+		const Point2D& pt = m_vecPoint[i];
+
+		if (nPrev != CDT_NONE && cdt_equal(pt, m_vecPoint[nPrev]))
+		{
+			m_vecAlias[i] = m_vecAlias[nPrev];
+			continue;
+		}
+
+		nPrev = i;
+
+		if (i == i0 || i == i1 || i == i2)
+			continue;
+
+		// Visible edge : start from hull point near in angle
+		size_t   nKey  = hash_key(pt);
+		uint32_t start = i0;
+
+		for (size_t j = 0; j < nHashSize; j++)
+		{
+			uint32_t s = vecHash[(nKey + j) % nHashSize];
+
+			if (s != CDT_NONE && s != m_vecHullNext[s])
+			{
+				start = s;
+				break;
+			}
+		}
+
+		start = m_vecHullPrev[start];
+
+		uint32_t e = start, q;
+
+		while (q = m_vecHullNext[e], orient2d(m_vecPoint[e], m_vecPoint[q], pt) >= 0.0)
+		{
+			e = q;
+
+			if (e == start)
+			{
+				e = CDT_NONE;
+				break;
+			}
+		}
+
+		// Inside or on hull (rounding of sort distance) : insert by point location
+		if (e == CDT_NONE)
+		{
+			if (insert_inside(i, m_vecHullTri[start] / 3) == GFalse)
+			{
+				m_vecAlias[i] = CDT_NONE;
+			}
+			else if (m_vecHullNext[i] != i)
+			{
+				vecHash[hash_key(pt)] = i;
+			}
+
+			continue;
+		}
+
+		uint32_t t = add_triangle(e, i, m_vecHullNext[e], CDT_NONE, CDT_NONE, m_vecHullTri[e]);
+
+		m_vecHullTri[i] = legalize(t + 2);
+		m_vecHullTri[e] = t;
+
+		// Walk forward through the hull
+		uint32_t n = m_vecHullNext[e];
+
+		while (q = m_vecHullNext[n], orient2d(m_vecPoint[n], m_vecPoint[q], pt) < 0.0)
+		{
+			t = add_triangle(n, i, q, m_vecHullTri[i], CDT_NONE, m_vecHullTri[n]);
+
+			m_vecHullTri[i] = legalize(t + 2);
+			m_vecHullNext[n] = n;
+
+			n = q;
+		}
+
+		// Walk backward from the other side
+		if (e == start)
+		{
+			while (q = m_vecHullPrev[e], orient2d(m_vecPoint[q], m_vecPoint[e], pt) < 0.0)
+			{
+				t = add_triangle(q, i, e, CDT_NONE, m_vecHullTri[e], m_vecHullTri[q]);
+
+				legalize(t + 2);
+
+				m_vecHullTri[q] = t;
+				m_vecHullNext[e] = e;
+
+				e = q;
+			}
+		}
+
+		m_nHullStart = m_vecHullPrev[i] = e;
+		m_vecHullNext[e] = m_vecHullPrev[n] = i;
+		m_vecHullNext[i] = n;
+
+		vecHash[nKey] = i;
+		vecHash[hash_key(m_vecPoint[e])] = e;
+	}
+
+	// 5. Per vertex / edge data for constraints
+	m_vecConstrained.assign(m_vecHalfEdge.size(), 0);
+	m_vecInside.assign(m_vecTri.size() / 3, 1);
+	m_vecVertEdge.assign(nCnt, CDT_NONE);
+
+	for (uint32_t e = 0; e < m_vecTri.size(); e++)
+	{
+		m_vecVertEdge[m_vecTri[e]] = e;
+	}
+
+	uint32_t v = m_nHullStart;
+
+	do
+	{
+		m_vecVertEdge[v] = m_vecHullTri[v];
+		v = m_vecHullNext[v];
+
+	} while (v != m_nHullStart);
+
+	return GTrue;
+}
+
+/***********************************************************************************
+*! @brief  : Insert point i inside the mesh (walk from triangle, split it)
+*! @return : TRUE : inserted or duplicate | FALSE : not found
+***********************************************************************************/
+GBool DelaunayMesh2D::insert_inside(uint32_t i, uint32_t nStartTri)
+{
+	const Point2D& pt = m_vecPoint[i];
+
+	// 1. Visibility walk
+	uint32_t t     = nStartTri;
+	size_t   nIter = 0;
+	size_t   nMax  = m_vecTri.size();
+
+	while (true)
+	{
+		GBool bMove = GFalse;
+
+		for (uint32_t j = 0; j < 3; j++)
+		{
+			uint32_t h = 3 * t + static_cast<uint32_t>((j + nIter) % 3);
+
+			if (orient2d(m_vecPoint[m_vecTri[h]], m_vecPoint[m_vecTri[next_edge(h)]], pt) < 0.0)
+			{
+				if (m_vecHalfEdge[h] == CDT_NONE)
+					return GFalse;
+
+				t = m_vecHalfEdge[h] / 3;
+				bMove = GTrue;
+				break;
+			}
+		}
+
+		if (bMove == GFalse)
+			break;
+
+		if (++nIter > nMax)
+			return GFalse;
+	}
+
+	// 2. Duplicate of vertex | on edge | inside
+	uint32_t nEdge = CDT_NONE;
+
+	for (uint32_t j = 0; j < 3; j++)
+	{
+		uint32_t h = 3 * t + j;
+
+		if (cdt_equal(m_vecPoint[m_vecTri[h]], pt))
+		{
+			m_vecAlias[i] = m_vecAlias[m_vecTri[h]];
+			return GTrue;
+		}
+
+		if (orient2d(m_vecPoint[m_vecTri[h]], m_vecPoint[m_vecTri[next_edge(h)]], pt) == 0.0)
+		{
+			nEdge = h;
+		}
+	}
+
+	if (nEdge == CDT_NONE)
+	{
+		uint32_t h0 = 3 * t;
+		uint32_t a  = m_vecTri[h0], b = m_vecTri[h0 + 1], c = m_vecTri[h0 + 2];
+		uint32_t oa = m_vecHalfEdge[h0], ob = m_vecHalfEdge[h0 + 1], oc = m_vecHalfEdge[h0 + 2];
+		uint32_t t1 = static_cast<uint32_t>(m_vecTri.size() / 3), t2 = t1 + 1;
+
+		set_triangle(t,  a, b, i, oa, CDT_NONE, CDT_NONE);
+		set_triangle(t1, b, c, i, ob, CDT_NONE, CDT_NONE);
+		set_triangle(t2, c, a, i, oc, CDT_NONE, CDT_NONE);
+
+		link(3 * t + 1,  3 * t1 + 2);
+		link(3 * t1 + 1, 3 * t2 + 2);
+		link(3 * t2 + 1, 3 * t + 2);
+
+		if (ob == CDT_NONE) m_vecHullTri[b] = 3 * t1;
+		if (oc == CDT_NONE) m_vecHullTri[c] = 3 * t2;
+
+		legalize(3 * t);
+		legalize(3 * t1);
+		legalize(3 * t2);
+
+		return GTrue;
+	}
+
+	// Split edge a -> b of triangle (a, b, c) and its opposite triangle (b, a, d)
+	uint32_t h   = nEdge;
+	uint32_t ho  = m_vecHalfEdge[h];
+	uint32_t a   = m_vecTri[h], b = m_vecTri[next_edge(h)], c = m_vecTri[prev_edge(h)];
+	uint32_t ohn = m_vecHalfEdge[next_edge(h)];
+	uint32_t ohp = m_vecHalfEdge[prev_edge(h)];
+	uint32_t t1  = static_cast<uint32_t>(m_vecTri.size() / 3);
+
+	set_triangle(t,  c, a, i, ohp, CDT_NONE, CDT_NONE);
+	set_triangle(t1, b, c, i, ohn, CDT_NONE, CDT_NONE);
+	link(3 * t + 2, 3 * t1 + 1);
+
+	if (ohp == CDT_NONE) m_vecHullTri[c] = 3 * t;
+	if (ohn == CDT_NONE) m_vecHullTri[b] = 3 * t1;
+
+	if (ho != CDT_NONE)
+	{
+		uint32_t to    = ho / 3;
+		uint32_t d     = m_vecTri[prev_edge(ho)];
+		uint32_t ohon  = m_vecHalfEdge[next_edge(ho)];
+		uint32_t ohop  = m_vecHalfEdge[prev_edge(ho)];
+		uint32_t t2    = t1 + 1;
+
+		set_triangle(to, d, b, i, ohop, CDT_NONE, CDT_NONE);
+		set_triangle(t2, a, d, i, ohon, CDT_NONE, CDT_NONE);
+
+		link(3 * to + 2, 3 * t2 + 1);
+		link(3 * t + 1,  3 * t2 + 2);
+		link(3 * t1 + 2, 3 * to + 1);
+
+		if (ohop == CDT_NONE) m_vecHullTri[d] = 3 * to;
+		if (ohon == CDT_NONE) m_vecHullTri[a] = 3 * t2;
+
+		legalize(3 * t);
+		legalize(3 * t1);
+		legalize(3 * to);
+		legalize(3 * t2);
+	}
+	else
+	{
+		// Hull edge : point is added to hull between a and b
+		m_vecHullNext[a] = i; m_vecHullPrev[i] = a;
+		m_vecHullNext[i] = b; m_vecHullPrev[b] = i;
+
+		m_vecHullTri[a] = 3 * t + 1;
+		m_vecHullTri[i] = 3 * t1 + 2;
+
+		legalize(3 * t);
+		legalize(3 * t1);
+	}
+
+	return GTrue;
+}
+
+/***********************************************************************************
+*! @brief  : Edges crossed by segment a -> b (from vertex a)
+*! @param  : [out] vecCross : crossed half-edges (replaced, in order from a)
+*! @param  : [out] nStop    : end of the part of segment (b or vertex on segment)
+*! @return : FALSE : segment crosses a constraint (or mesh is broken)
+*! @note   : vecCross empty : edge a -> nStop is in mesh
+***********************************************************************************/
+GBool DelaunayMesh2D::find_crossing(uint32_t a, uint32_t b, std::vector<uint32_t>& vecCross, uint32_t& nStop) const
+{
+	const Point2D& ptA = m_vecPoint[a];
+	const Point2D& ptB = m_vecPoint[b];
+
+	vecCross.clear();
+	nStop = CDT_NONE;
+
+	// Vertex w on segment a -> b (same direction)
+	auto on_segment = [&](uint32_t w) -> GBool
+	{
+		if (w == b)
+			return GTrue;
+
+		const Point2D& ptW = m_vecPoint[w];
+
+		if (orient2d(ptA, ptB, ptW) != 0.0)
+			return GFalse;
+
+		GDouble dDot = (GDouble(ptW.x) - ptA.x) * (GDouble(ptB.x) - ptA.x) +
+					   (GDouble(ptW.y) - ptA.y) * (GDouble(ptB.y) - ptA.y);
+
+		return (dDot > 0.0) ? GTrue : GFalse;
+	};
+
+	// 1. Triangle around a containing the start of segment
+	uint32_t nFirst = CDT_NONE;
+	uint32_t start  = m_vecVertEdge[a];
+
+	auto check_edge = [&](uint32_t e) -> GBool
+	{
+		uint32_t w = m_vecTri[next_edge(e)];
+		uint32_t u = m_vecTri[prev_edge(e)];
+
+		if (on_segment(w)) { nStop = w; return GTrue; }
+		if (on_segment(u)) { nStop = u; return GTrue; }
+
+		if (orient2d(ptA, ptB, m_vecPoint[w]) < 0.0 && orient2d(ptA, ptB, m_vecPoint[u]) > 0.0)
+		{
+			nFirst = next_edge(e);
+			return GTrue;
+		}
+
+		return GFalse;
+	};
+
+	GBool    bFound = GFalse;
+	uint32_t e      = start;
+
+	// Counterclockwise, then clockwise when the hull is reached
+	do
+	{
+		if (check_edge(e)) { bFound = GTrue; break; }
+
+		e = m_vecHalfEdge[prev_edge(e)];
+
+	} while (e != CDT_NONE && e != start);
+
+	if (bFound == GFalse && e == CDT_NONE)
+	{
+		e = start;
+
+		while (m_vecHalfEdge[e] != CDT_NONE)
+		{
+			e = next_edge(m_vecHalfEdge[e]);
+
+			if (check_edge(e)) { bFound = GTrue; break; }
+		}
+	}
+
+	if (bFound == GFalse)
+		return GFalse;
+
+	if (nStop != CDT_NONE)
+		return GTrue;
+
+	// 2. Walk through crossed triangles (edge start : right of ab | end : left)
+	uint32_t h = nFirst;
+
+	while (true)
+	{
+		uint32_t o = m_vecHalfEdge[h];
+
+		if (o == CDT_NONE || m_vecConstrained[h])
+			return GFalse;
+
+		vecCross.push_back(h);
+
+		uint32_t x = m_vecTri[prev_edge(o)];
+
+		if (on_segment(x))
+		{
+			nStop = x;
+			break;
+		}
+
+		h = (orient2d(ptA, ptB, m_vecPoint[x]) > 0.0) ? next_edge(o) : prev_edge(o);
+	}
+
+	return GTrue;
+}
+
+/***********************************************************************************
+*! @brief  : Flip new edges until Delaunay (constraints are kept)
+***********************************************************************************/
+void DelaunayMesh2D::restore_delaunay(std::vector<uint32_t>& vecEdge)
+{
+	GBool  bSwap = GTrue;
+	size_t nIter = 0;
+	size_t nMax  = 4 * vecEdge.size() * vecEdge.size() + 64;
+
+	while (bSwap && nIter++ < nMax)
+	{
+		bSwap = GFalse;
+
+		for (size_t k = 0; k < vecEdge.size(); k++)
+		{
+			uint32_t e = vecEdge[k];
+			uint32_t o = m_vecHalfEdge[e];
+
+			if (o == CDT_NONE || m_vecConstrained[e])
+				continue;
+
+			const Point2D& pt0 = m_vecPoint[m_vecTri[prev_edge(e)]];
+			const Point2D& ptR = m_vecPoint[m_vecTri[e]];
+			const Point2D& ptL = m_vecPoint[m_vecTri[next_edge(e)]];
+			const Point2D& pt1 = m_vecPoint[m_vecTri[prev_edge(o)]];
+
+			if (incircle(pt0, ptR, ptL, pt1) <= 0.0)
+				continue;
+
+			uint32_t ar = prev_edge(e);
+			uint32_t bl = prev_edge(o);
+
+			flip_edge(e);
+
+			// Edges at bl / ar moved to e / o
+			for (size_t j = 0; j < vecEdge.size(); j++)
+			{
+				if (vecEdge[j] == ar)	   vecEdge[j] = o;
+				else if (vecEdge[j] == bl) vecEdge[j] = e;
+			}
+
+			vecEdge[k] = ar;
+			bSwap = GTrue;
+		}
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Insert constraint edge (vertex a -> vertex b)
+*! @param  : [in] a, b : point index
+*! @return : TRUE : edge is in mesh | FALSE : edge crosses another constraint
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Vertices on the segment split it. Inside flags are not updated
+*!           (call mark_inside after the last constraint)
+***********************************************************************************/
+GBool DelaunayMesh2D::insert_constraint(uint32_t a, uint32_t b)
+{
+	if (m_vecTri.empty() || a >= m_vecAlias.size() || b >= m_vecAlias.size())
+		return GFalse;
+
+	a = m_vecAlias[a];
+	b = m_vecAlias[b];
+
+	if (a == CDT_NONE || b == CDT_NONE)
+		return GFalse;
+
+	std::vector<uint32_t> vecCross, vecNew;
+	std::deque<uint32_t>  queCross;
+
+	while (a != b)
+	{
+		uint32_t nStop = CDT_NONE;
+
+		if (find_crossing(a, b, vecCross, nStop) == GFalse)
+			return GFalse;
+
+		const Point2D& ptA = m_vecPoint[a];
+		const Point2D& ptS = m_vecPoint[nStop];
+
+		// 1. Remove crossed edges by flipping convex quads (Sloan)
+		queCross.assign(vecCross.begin(), vecCross.end());
+		vecNew.clear();
+
+		size_t nIter = 0;
+		size_t nMax  = 4 * vecCross.size() * vecCross.size() + 64;
+
+		while (!queCross.empty())
+		{
+			if (++nIter > nMax)
+				return GFalse;
+
+			uint32_t e = queCross.front();
+			queCross.pop_front();
+
+			uint32_t o  = m_vecHalfEdge[e];
+			uint32_t p0 = m_vecTri[prev_edge(e)];
+			uint32_t p1 = m_vecTri[prev_edge(o)];
+
+			const Point2D& pt0 = m_vecPoint[p0];
+			const Point2D& pt1 = m_vecPoint[p1];
+
+			GDouble dR = orient2d(pt0, pt1, m_vecPoint[m_vecTri[e]]);
+			GDouble dL = orient2d(pt0, pt1, m_vecPoint[m_vecTri[next_edge(e)]]);
+
+			// Not convex : try again later
+			if (!((dR < 0.0 && dL > 0.0) || (dR > 0.0 && dL < 0.0)))
+			{
+				queCross.push_back(e);
+				continue;
+			}
+
+			uint32_t ar = prev_edge(e);
+			uint32_t bl = prev_edge(o);
+
+			flip_edge(e);
+
+			for (size_t j = 0; j < queCross.size(); j++)
+			{
+				if (queCross[j] == ar)		queCross[j] = o;
+				else if (queCross[j] == bl) queCross[j] = e;
+			}
+
+			for (size_t j = 0; j < vecNew.size(); j++)
+			{
+				if (vecNew[j] == ar)	  vecNew[j] = o;
+				else if (vecNew[j] == bl) vecNew[j] = e;
+			}
+
+			// New diagonal p0 -> p1 at ar
+			GBool bCross = GFalse;
+
+			if (p0 != a && p0 != nStop && p1 != a && p1 != nStop)
+			{
+				GDouble d0 = orient2d(ptA, ptS, pt0);
+				GDouble d1 = orient2d(ptA, ptS, pt1);
+
+				bCross = ((d0 < 0.0 && d1 > 0.0) || (d0 > 0.0 && d1 < 0.0)) ? GTrue : GFalse;
+			}
+
+			if (bCross) queCross.push_back(ar);
+			else		vecNew.push_back(ar);
+		}
+
+		// 2. Mark edge a -> nStop
+		uint32_t start = m_vecVertEdge[a];
+		uint32_t e     = start;
+		GBool    bMark = GFalse;
+
+		auto mark_edge = [&](uint32_t h)
+		{
+			m_vecConstrained[h] = 1;
+
+			if (m_vecHalfEdge[h] != CDT_NONE)
+			{
+				m_vecConstrained[m_vecHalfEdge[h]] = 1;
+			}
+
+			bMark = GTrue;
+		};
+
+		do
+		{
+			if (m_vecTri[next_edge(e)] == nStop)	   { mark_edge(e); break; }
+			if (m_vecTri[prev_edge(e)] == nStop)	   { mark_edge(prev_edge(e)); break; }
+
+			e = m_vecHalfEdge[prev_edge(e)];
+
+		} while (e != CDT_NONE && e != start);
+
+		if (bMark == GFalse && e == CDT_NONE)
+		{
+			e = start;
+
+			while (m_vecHalfEdge[e] != CDT_NONE)
+			{
+				e = next_edge(m_vecHalfEdge[e]);
+
+				if (m_vecTri[next_edge(e)] == nStop) { mark_edge(e); break; }
+				if (m_vecTri[prev_edge(e)] == nStop) { mark_edge(prev_edge(e)); break; }
+			}
+		}
+
+		if (bMark == GFalse)
+			return GFalse;
+
+		// 3. Delaunay on the new edges
+		restore_delaunay(vecNew);
+
+		a = nStop;
+	}
+
+	return GTrue;
+}
+
+/***********************************************************************************
+*! @brief  : Classify triangles by constraints (even-odd from outside of hull)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+void DelaunayMesh2D::mark_inside()
+{
+	size_t nTriCnt = m_vecTri.size() / 3;
+
+	if (nTriCnt == 0)
+		return;
+
+	// 0-1 BFS : crossing a constraint costs 1
+	std::vector<uint32_t> vecDepth(nTriCnt, CDT_NONE);
+	std::deque<uint32_t>  deqTri;
+
+	uint32_t v = m_nHullStart;
+
+	do
+	{
+		uint32_t e = m_vecHullTri[v];
+		uint32_t t = e / 3;
+		uint32_t d = m_vecConstrained[e];
+
+		if (d < vecDepth[t])
+		{
+			vecDepth[t] = d;
+
+			if (d == 0) deqTri.push_front(t);
+			else		deqTri.push_back(t);
+		}
+
+		v = m_vecHullNext[v];
+
+	} while (v != m_nHullStart);
+
+	while (!deqTri.empty())
+	{
+		uint32_t t = deqTri.front();
+		deqTri.pop_front();
+
+		for (uint32_t j = 0; j < 3; j++)
+		{
+			uint32_t e = 3 * t + j;
+			uint32_t o = m_vecHalfEdge[e];
+
+			if (o == CDT_NONE)
+				continue;
+
+			uint32_t nt = o / 3;
+			uint32_t nd = vecDepth[t] + m_vecConstrained[e];
+
+			if (nd < vecDepth[nt])
+			{
+				vecDepth[nt] = nd;
+
+				if (m_vecConstrained[e] == 0) deqTri.push_front(nt);
+				else						  deqTri.push_back(nt);
+			}
+		}
+	}
+
+	for (size_t t = 0; t < nTriCnt; t++)
+	{
+		m_vecInside[t] = static_cast<uint8_t>(vecDepth[t] & 1);
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Triangle list
+*! @param  : [out] vecIndex    : 3 point indices per triangle (appended)
+*! @param  : [in ] bInsideOnly : TRUE : only triangles inside constraint rings
+*! @return : number of triangle
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+GInt DelaunayMesh2D::get_triangles(std::vector<uint32_t>& vecIndex, GBool bInsideOnly /*= GTrue*/) const
+{
+	GInt nTrig = 0;
+
+	for (size_t t = 0; t < m_vecTri.size() / 3; t++)
+	{
+		if (bInsideOnly && m_vecInside[t] == 0)
+			continue;
+
+		vecIndex.push_back(m_vecTri[3 * t]);
+		vecIndex.push_back(m_vecTri[3 * t + 1]);
+		vecIndex.push_back(m_vecTri[3 * t + 2]);
+		nTrig++;
+	}
+
+	return nTrig;
+}
+
+/***********************************************************************************
+*! @brief  : Hull vertices (counterclockwise)
+*! @param  : [out] vecHull : vertex list (replaced)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+void DelaunayMesh2D::get_hull(std::vector<uint32_t>& vecHull) const
+{
+	vecHull.clear();
+
+	if (m_vecTri.empty())
+		return;
+
+	uint32_t v = m_nHullStart;
+
+	do
+	{
+		vecHull.push_back(v);
+		v = m_vecHullNext[v];
+
+	} while (v != m_nHullStart);
+}
+
+/***********************************************************************************
+*! @brief  : Circumcenter of triangle (Voronoi vertex)
+*! @param  : [in] t : triangle index
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+Point2D DelaunayMesh2D::circumcenter(uint32_t t) const
+{
+	const Point2D& a = m_vecPoint[m_vecTri[3 * t]];
+
+	GDouble dX = 0.0, dY = 0.0;
+	cdt_circumcenter(a, m_vecPoint[m_vecTri[3 * t + 1]], m_vecPoint[m_vecTri[3 * t + 2]], dX, dY);
+
+	Point2D pt;
+	pt.x = static_cast<GFloat>(a.x + dX);
+	pt.y = static_cast<GFloat>(a.y + dY);
+
+	return pt;
+}
+
+/***********************************************************************************
+*! @brief  : Delaunay triangulation of points
+*! @param  : [in ] vecPoints : points
+*! @param  : [out] vecIndex  : triangle list (3 indices into vecPoints per triangle)
+*! @return : number of triangle
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Triangles are counterclockwise (CCW)
+***********************************************************************************/
+Dllexport GInt triangulate_delaunay(const VecPoint2D& vecPoints, std::vector<uint32_t>& vecIndex)
+{
+	return triangulate_delaunay(RingView2D(vecPoints), vecIndex);
+}
+
+Dllexport GInt triangulate_delaunay(const RingView2D& vecPoints, std::vector<uint32_t>& vecIndex)
+{
+	vecIndex.clear();
+
+	DelaunayMesh2D mesh;
+
+	if (mesh.build(vecPoints.data(), vecPoints.size()) == GFalse)
+		return 0;
+
+	return mesh.get_triangles(vecIndex, GFalse);
+}
+
+/***********************************************************************************
+*! @brief  : CDT of polygon p of multipolygon, indices into mpoly.points()
+***********************************************************************************/
+static GInt cdt_polygon(const MultiPolygon2D& mpoly, size_t p, std::vector<uint32_t>& vecIndex)
+{
+	size_t nRingBegin = mpoly.poly_ring_begin(p);
+	size_t nRingEnd   = mpoly.poly_ring_end(p);
+
+	if (nRingBegin == nRingEnd)
+		return 0;
+
+	MultiPolygon2D poly;
+	poly.begin_polygon();
+
+	for (size_t r = nRingBegin; r < nRingEnd; r++)
+	{
+		poly.add_ring(mpoly.ring(r));
+	}
+
+	DelaunayMesh2D mesh;
+
+	if (mesh.build(poly) == GFalse && mesh.empty())
+		return 0;
+
+	uint32_t nBase  = static_cast<uint32_t>(mpoly.ring_begin(nRingBegin));
+	size_t   nStart = vecIndex.size();
+	GInt     nTrig  = mesh.get_triangles(vecIndex, GTrue);
+
+	for (size_t i = nStart; i < vecIndex.size(); i++)
+	{
+		vecIndex[i] += nBase;
+	}
+
+	return nTrig;
+}
+
+/***********************************************************************************
+*! @brief  : Constrained Delaunay triangulation of all polygons of multipolygon
+*! @param  : [in ] mpoly    : multipolygon
+*! @param  : [out] vecIndex : triangle list (3 indices into mpoly.points() per triangle)
+*! @param  : [in ] pool     : thread pool (one task per polygon)
+*! @param  : [in ] nThread  : max number of worker (<= 0 : all)
+*! @return : number of triangle
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Same input and output as triangulate_polygon (ear clipping) without
+*!           sliver triangles. Each polygon (outer + holes) is triangulated alone,
+*!           pool result is the same as the serial one (polygon order)
+***********************************************************************************/
+Dllexport GInt triangulate_cdt(const MultiPolygon2D& mpoly, std::vector<uint32_t>& vecIndex)
+{
+	vecIndex.clear();
+	vecIndex.reserve((mpoly.point_count() + 2 * mpoly.ring_count()) * 3);
+
+	GInt nTrig = 0;
+
+	for (size_t p = 0; p < mpoly.poly_count(); p++)
+	{
+		nTrig += cdt_polygon(mpoly, p, vecIndex);
+	}
+
+	return nTrig;
+}
+
+Dllexport GInt triangulate_cdt(const MultiPolygon2D& mpoly, std::vector<uint32_t>& vecIndex,
+							   GeoThreadPool& pool, GInt nThread /*= 0*/)
+{
+	size_t nPolyCnt = mpoly.poly_count();
+
+	std::vector<std::vector<uint32_t>> vecPart(nPolyCnt);
+
+	pool.parallel_for(nPolyCnt, [&](size_t p, GInt)
+	{
+		cdt_polygon(mpoly, p, vecPart[p]);
+	}, nThread);
+
+	size_t nSize = 0;
+
+	for (size_t p = 0; p < nPolyCnt; p++)
+	{
+		nSize += vecPart[p].size();
+	}
+
+	vecIndex.clear();
+	vecIndex.reserve(nSize);
+
+	for (size_t p = 0; p < nPolyCnt; p++)
+	{
+		vecIndex.insert(vecIndex.end(), vecPart[p].begin(), vecPart[p].end());
+	}
+
+	return static_cast<GInt>(nSize / 3);
+}
+
+/***********************************************************************************
+*! @brief  : Clip convex polygon (double) by rectangle, Sutherland-Hodgman
+***********************************************************************************/
+static void voronoi_clip_rect(std::vector<GDouble>& vecPoly, std::vector<GDouble>& vecWork,
+							  GDouble dMinX, GDouble dMinY, GDouble dMaxX, GDouble dMaxY)
+{
+	for (int nSide = 0; nSide < 4 && vecPoly.size() >= 6; nSide++)
+	{
+		// Signed distance inside side (>= 0 : kept)
+		auto dist = [&](size_t i) -> GDouble
+		{
+			switch (nSide)
+			{
+			case 0 : return vecPoly[2 * i] - dMinX;
+			case 1 : return dMaxX - vecPoly[2 * i];
+			case 2 : return vecPoly[2 * i + 1] - dMinY;
+			default: return dMaxY - vecPoly[2 * i + 1];
+			}
+		};
+
+		size_t nCnt = vecPoly.size() / 2;
+
+		vecWork.clear();
+
+		for (size_t i = 0; i < nCnt; i++)
+		{
+			size_t  j  = (i + 1) % nCnt;
+			GDouble di = dist(i), dj = dist(j);
+
+			if (di >= 0.0)
+			{
+				vecWork.push_back(vecPoly[2 * i]);
+				vecWork.push_back(vecPoly[2 * i + 1]);
+			}
+
+			if ((di >= 0.0) != (dj >= 0.0))
+			{
+				GDouble t = di / (di - dj);
+
+				vecWork.push_back(vecPoly[2 * i] + t * (vecPoly[2 * j] - vecPoly[2 * i]));
+				vecWork.push_back(vecPoly[2 * i + 1] + t * (vecPoly[2 * j + 1] - vecPoly[2 * i + 1]));
+			}
+		}
+
+		vecPoly.swap(vecWork);
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Voronoi cells of mesh points clipped by rectangle
+*! @param  : [in ] mesh  : Delaunay triangulation (constraints are not used)
+*! @param  : [in ] rect  : clip rectangle
+*! @param  : [out] cells : polygon i : cell of point i (replaced, CCW, no ring if
+*!                         empty or duplicate point)
+*! @return : number of non empty cell
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Cell vertices are circumcenters of triangles around the point. Cells
+*!           of hull points are open, they are closed outside rect before clip
+***********************************************************************************/
+Dllexport GInt get_voronoi_cells(const DelaunayMesh2D& mesh, const Rect2D& rect, MultiPolygon2D& cells)
+{
+	cells.clear();
+
+	if (mesh.empty())
+		return 0;
+
+	const std::vector<uint32_t>& vecTri  = mesh.triangles();
+	const std::vector<uint32_t>& vecHalf = mesh.halfedges();
+
+	size_t nTriCnt = mesh.triangle_count();
+
+	// 1. Circumcenters (double)
+	std::vector<GDouble> vecCenter(2 * nTriCnt);
+
+	for (size_t t = 0; t < nTriCnt; t++)
+	{
+		const Point2D& a = mesh.point(vecTri[3 * t]);
+
+		GDouble dX = 0.0, dY = 0.0;
+		cdt_circumcenter(a, mesh.point(vecTri[3 * t + 1]), mesh.point(vecTri[3 * t + 2]), dX, dY);
+
+		vecCenter[2 * t]     = a.x + dX;
+		vecCenter[2 * t + 1] = a.y + dY;
+	}
+
+	GDouble dMinX = rect.x, dMinY = rect.y;
+	GDouble dMaxX = GDouble(rect.x) + rect.width, dMaxY = GDouble(rect.y) + rect.height;
+
+	std::vector<GDouble> vecPoly, vecWork;
+	VecPoint2D           vecRing;
+
+	GInt nCell = 0;
+
+	cells.reserve(mesh.point_count() * 6, mesh.point_count(), mesh.point_count());
+
+	for (uint32_t v = 0; v < mesh.point_count(); v++)
+	{
+		cells.begin_polygon();
+
+		if (mesh.vertex_of(v) != v || mesh.vertex_edge(v) == DelaunayMesh2D::DELAUNAY_NONE)
+			continue;
+
+		uint32_t nHull = mesh.hull_edge(v);
+		uint32_t start = (nHull != DelaunayMesh2D::DELAUNAY_NONE) ? nHull : mesh.vertex_edge(v);
+		uint32_t e     = start;
+
+		// 2. Circumcenters of triangles around v (counterclockwise)
+		vecPoly.clear();
+
+		do
+		{
+			uint32_t t = e / 3;
+
+			vecPoly.push_back(vecCenter[2 * t]);
+			vecPoly.push_back(vecCenter[2 * t + 1]);
+
+			e = vecHalf[DelaunayMesh2D::prev_edge(e)];
+
+		} while (e != DelaunayMesh2D::DELAUNAY_NONE && e != start);
+
+		// 3. Hull point : close the cell by rays (outer normal of hull edges)
+		if (nHull != DelaunayMesh2D::DELAUNAY_NONE)
+		{
+			const Point2D& pt  = mesh.point(v);
+			const Point2D& ptN = mesh.point(vecTri[DelaunayMesh2D::next_edge(nHull)]);
+
+			// Last triangle : edge u -> v without opposite
+			uint32_t h = start;
+
+			while (vecHalf[DelaunayMesh2D::prev_edge(h)] != DelaunayMesh2D::DELAUNAY_NONE)
+			{
+				h = vecHalf[DelaunayMesh2D::prev_edge(h)];
+			}
+
+			const Point2D& ptU = mesh.point(vecTri[DelaunayMesh2D::prev_edge(h)]);
+
+			GDouble r1x = GDouble(ptN.y) - pt.y, r1y = GDouble(pt.x) - ptN.x;
+			GDouble r2x = GDouble(pt.y) - ptU.y, r2y = GDouble(ptU.x) - pt.x;
+
+			GDouble dLen1 = std::sqrt(r1x * r1x + r1y * r1y);
+			GDouble dLen2 = std::sqrt(r2x * r2x + r2y * r2y);
+
+			r1x /= dLen1; r1y /= dLen1;
+			r2x /= dLen2; r2y /= dLen2;
+
+			GDouble mx = r1x + r2x, my = r1y + r2y;
+			GDouble dLenM = std::sqrt(mx * mx + my * my);
+
+			if (dLenM > 1e-12) { mx /= dLenM; my /= dLenM; }
+			else			   { mx = r1x; my = r1y; }
+
+			// Far enough : closing edges stay outside rect
+			GDouble dFar = 0.0;
+
+			for (size_t i = 0; i < vecPoly.size(); i += 2)
+			{
+				dFar = std::max(dFar, std::sqrt(cdt_dist2(vecPoly[i], vecPoly[i + 1], pt.x, pt.y)));
+			}
+
+			dFar = std::max(dFar, std::sqrt(cdt_dist2(dMinX, dMinY, pt.x, pt.y)));
+			dFar = std::max(dFar, std::sqrt(cdt_dist2(dMaxX, dMinY, pt.x, pt.y)));
+			dFar = std::max(dFar, std::sqrt(cdt_dist2(dMinX, dMaxY, pt.x, pt.y)));
+			dFar = std::max(dFar, std::sqrt(cdt_dist2(dMaxX, dMaxY, pt.x, pt.y)));
+			dFar = 4.0 * dFar + 1.0;
+
+			size_t nLastPt = vecPoly.size() - 2;
+
+			GDouble dFirstX = vecPoly[0], dFirstY = vecPoly[1];
+			GDouble dLastX  = vecPoly[nLastPt], dLastY = vecPoly[nLastPt + 1];
+
+			vecPoly.push_back(dLastX + dFar * r2x);
+			vecPoly.push_back(dLastY + dFar * r2y);
+			vecPoly.push_back(pt.x + dFar * mx);
+			vecPoly.push_back(pt.y + dFar * my);
+			vecPoly.push_back(dFirstX + dFar * r1x);
+			vecPoly.push_back(dFirstY + dFar * r1y);
+		}
+
+		voronoi_clip_rect(vecPoly, vecWork, dMinX, dMinY, dMaxX, dMaxY);
+
+		if (vecPoly.size() < 6)
+			continue;
+
+		vecRing.resize(vecPoly.size() / 2);
+
+		for (size_t i = 0; i < vecRing.size(); i++)
+		{
+			vecRing[i].x = static_cast<GFloat>(vecPoly[2 * i]);
+			vecRing[i].y = static_cast<GFloat>(vecPoly[2 * i + 1]);
+		}
+
+		cells.add_ring(vecRing);
+		nCell++;
+	}
+
+	return nCell;
+}
+
+}}
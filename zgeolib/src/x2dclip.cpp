@@ -0,0 +1,468 @@
+#include "x2dclip.h"
+
+#include <algorithm>
+
+#if defined(GEO_SIMD_AVX) || defined(GEO_SIMD_SSE)
+#include <immintrin.h>
+#endif
+
+namespace geo { namespace v2 {
+
+static_assert(sizeof(Point2D) == 2 * sizeof(GFloat), "Point2D must be packed (x, y) for SIMD outcode");
+
+#define GEO_OUT_ALL		(GEO_OUT_LEFT | GEO_OUT_RIGHT | GEO_OUT_BOTTOM | GEO_OUT_TOP)
+
+/***********************************************************************************
+*! @brief  : Outcode of point
+***********************************************************************************/
+static inline GInt rect_outcode(const Point2D& pt, GFloat fMinX, GFloat fMinY, GFloat fMaxX, GFloat fMaxY)
+{
+	return ((pt.x < fMinX) ? GEO_OUT_LEFT   : 0) | ((pt.x > fMaxX) ? GEO_OUT_RIGHT : 0) |
+		   ((pt.y < fMinY) ? GEO_OUT_BOTTOM : 0) | ((pt.y > fMaxY) ? GEO_OUT_TOP   : 0);
+}
+
+#if defined(GEO_SIMD_AVX) || defined(GEO_SIMD_SSE)
+/***********************************************************************************
+*! @brief  : Outcode of compare masks of interleaved (x, y) lanes
+*! @param  : [in] nLt   : lane < min mask (even bit : x | odd bit : y)
+*! @param  : [in] nGt   : lane > max mask
+*! @param  : [in] nEven : mask of all even bits
+*! @param  : [in] bAll  : TRUE : bit set if all lanes are set (AND) | FALSE : any (OR)
+***********************************************************************************/
+static inline GInt rect_outcode_mask(int nLt, int nGt, int nEven, GBool bAll)
+{
+	const int nOdd = nEven << 1;
+
+	auto funTest = [bAll](int nMask, int nBit) { return bAll ? ((nMask & nBit) == nBit) : ((nMask & nBit) != 0); };
+
+	return (funTest(nLt, nEven) ? GEO_OUT_LEFT   : 0) | (funTest(nGt, nEven) ? GEO_OUT_RIGHT : 0) |
+		   (funTest(nLt, nOdd)  ? GEO_OUT_BOTTOM : 0) | (funTest(nGt, nOdd)  ? GEO_OUT_TOP   : 0);
+}
+#endif
+
+/***********************************************************************************
+*! @brief  : Outcode of all points of ring
+*! @param  : [in ] poly     : ring points
+*! @param  : [in ] rect     : rectangle
+*! @param  : [out] pAndCode : AND of outcodes (!= 0 : all outside on one side)
+*! @return : OR of outcodes (0 : all inside)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Points are compared as interleaved (x, y) lanes with (min x, min y)
+*!           and (max x, max y) : no shuffle
+***********************************************************************************/
+Dllexport GInt get_outcode_rect(const RingView2D& poly, const Rect2D& rect, GInt* pAndCode /*= NULL*/)
+{
+	const GFloat fMinX = rect.x, fMaxX = rect.x + rect.width;
+	const GFloat fMinY = rect.y, fMaxY = rect.y + rect.height;
+
+	const size_t n = poly.size();
+	const Point2D* pts = poly.data();
+
+	GInt nOr = 0, nAnd = (n > 0) ? GEO_OUT_ALL : 0;
+	size_t i = 0;
+
+#if defined(GEO_SIMD_AVX)
+	if (n >= 4)
+	{
+		const GFloat* pData = reinterpret_cast<const GFloat*>(pts);
+
+		const __m256 vMin = _mm256_setr_ps(fMinX, fMinY, fMinX, fMinY, fMinX, fMinY, fMinX, fMinY);
+		const __m256 vMax = _mm256_setr_ps(fMaxX, fMaxY, fMaxX, fMaxY, fMaxX, fMaxY, fMaxX, fMaxY);
+
+		__m256 vLtOr  = _mm256_setzero_ps(), vGtOr = _mm256_setzero_ps();
+		__m256 vLtAnd = _mm256_castsi256_ps(_mm256_set1_epi32(-1)), vGtAnd = vLtAnd;
+
+		const size_t nBlock = n - (n % 4);
+
+		for (; i < nBlock; i += 4)
+		{
+			const __m256 v = _mm256_loadu_ps(pData + 2 * i);
+
+			const __m256 vLt = _mm256_cmp_ps(v, vMin, _CMP_LT_OQ);
+			const __m256 vGt = _mm256_cmp_ps(v, vMax, _CMP_GT_OQ);
+
+			vLtOr  = _mm256_or_ps(vLtOr, vLt);
+			vGtOr  = _mm256_or_ps(vGtOr, vGt);
+			vLtAnd = _mm256_and_ps(vLtAnd, vLt);
+			vGtAnd = _mm256_and_ps(vGtAnd, vGt);
+		}
+
+		nOr  |= rect_outcode_mask(_mm256_movemask_ps(vLtOr), _mm256_movemask_ps(vGtOr), 0x55, GFalse);
+		nAnd &= rect_outcode_mask(_mm256_movemask_ps(vLtAnd), _mm256_movemask_ps(vGtAnd), 0x55, GTrue);
+	}
+
+#elif defined(GEO_SIMD_SSE)
+	if (n >= 2)
+	{
+		const GFloat* pData = reinterpret_cast<const GFloat*>(pts);
+
+		const __m128 vMin = _mm_setr_ps(fMinX, fMinY, fMinX, fMinY);
+		const __m128 vMax = _mm_setr_ps(fMaxX, fMaxY, fMaxX, fMaxY);
+
+		__m128 vLtOr  = _mm_setzero_ps(), vGtOr = _mm_setzero_ps();
+		__m128 vLtAnd = _mm_castsi128_ps(_mm_set1_epi32(-1)), vGtAnd = vLtAnd;
+
+		const size_t nBlock = n - (n % 2);
+
+		for (; i < nBlock; i += 2)
+		{
+			const __m128 v = _mm_loadu_ps(pData + 2 * i);
+
+			const __m128 vLt = _mm_cmplt_ps(v, vMin);
+			const __m128 vGt = _mm_cmpgt_ps(v, vMax);
+
+			vLtOr  = _mm_or_ps(vLtOr, vLt);
+			vGtOr  = _mm_or_ps(vGtOr, vGt);
+			vLtAnd = _mm_and_ps(vLtAnd, vLt);
+			vGtAnd = _mm_and_ps(vGtAnd, vGt);
+		}
+
+		nOr  |= rect_outcode_mask(_mm_movemask_ps(vLtOr), _mm_movemask_ps(vGtOr), 0x5, GFalse);
+		nAnd &= rect_outcode_mask(_mm_movemask_ps(vLtAnd), _mm_movemask_ps(vGtAnd), 0x5, GTrue);
+	}
+#endif
+
+	for (; i < n; i++)
+	{
+		GInt nCode = rect_outcode(pts[i], fMinX, fMinY, fMaxX, fMaxY);
+
+		nOr  |= nCode;
+		nAnd &= nCode;
+	}
+
+	if (pAndCode) *pAndCode = nAnd;
+
+	return nOr;
+}
+
+/***********************************************************************************
+*! @brief  : Classify ring with rectangle (trivial accept / reject)
+*! @param  : [in] poly : ring points
+*! @param  : [in] rect : rectangle
+*! @return : EnumRectClip
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+Dllexport EnumRectClip classify_polygon_rect(const RingView2D& poly, const Rect2D& rect)
+{
+	GInt nAnd = 0;
+	GInt nOr  = get_outcode_rect(poly, rect, &nAnd);
+
+	if (nAnd != 0 || poly.empty())
+		return RECT_OUTSIDE;
+
+	return (nOr == 0) ? RECT_INSIDE : RECT_CROSS;
+}
+
+/***********************************************************************************
+*! @brief  : Intersection of edge and line (axis = fBound), from the lower point
+***********************************************************************************/
+template<GInt AXIS>
+static inline Point2D rect_intersect(const Point2D& pt1, const Point2D& pt2, GFloat fBound)
+{
+	const GBool bSwap = (pt2.x < pt1.x || (pt2.x == pt1.x && pt2.y < pt1.y));
+
+	const Point2D& ptLo = bSwap ? pt2 : pt1;
+	const Point2D& ptHi = bSwap ? pt1 : pt2;
+
+	if (AXIS == 0)
+	{
+		GFloat t = (fBound - ptLo.x) / (ptHi.x - ptLo.x);
+		return Point2D(fBound, ptLo.y + t * (ptHi.y - ptLo.y));
+	}
+	else
+	{
+		GFloat t = (fBound - ptLo.y) / (ptHi.y - ptLo.y);
+		return Point2D(ptLo.x + t * (ptHi.x - ptLo.x), fBound);
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Sutherland-Hodgman clipping of ring by one side of rectangle
+*! @param  : [in ] pIn    : ring points
+*! @param  : [in ] nIn    : number of point
+*! @param  : [in ] fBound : side (x if AXIS = 0 | y if AXIS = 1)
+*! @param  : [out] vecOut : clip ring (replaced)
+*! @note   : Point on side is inside. Intersection only for edges strictly crossing
+*!           the side (no duplicate point at a vertex on side)
+***********************************************************************************/
+template<GInt AXIS, GBool MAXSIDE>
+static void rect_clip_side(const Point2D* pIn, size_t nIn, GFloat fBound, VecPoint2D& vecOut)
+{
+	vecOut.clear();
+
+	// 1 : inside | 0 : on side | -1 : outside
+	auto funSide = [fBound](const Point2D& pt)
+	{
+		const GFloat v = (AXIS == 0) ? pt.x : pt.y;
+		return MAXSIDE ? ((v < fBound) ? 1 : (v > fBound) ? -1 : 0)
+					   : ((v > fBound) ? 1 : (v < fBound) ? -1 : 0);
+	};
+
+	const Point2D* pPrev = &pIn[nIn - 1];
+	int nPrev = funSide(*pPrev);
+
+	for (size_t i = 0; i < nIn; i++)
+	{
+		const Point2D& ptCur = pIn[i];
+		const int nCur = funSide(ptCur);
+
+		if (nPrev * nCur < 0)
+		{
+			vecOut.push_back(rect_intersect<AXIS>(*pPrev, ptCur, fBound));
+		}
+
+		if (nCur >= 0)
+		{
+			vecOut.push_back(ptCur);
+		}
+
+		pPrev = &ptCur;
+		nPrev = nCur;
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Clipping ring by the rectangle sides in outcode
+*! @param  : [in ] pts      : ring points
+*! @param  : [in ] nCnt     : number of point
+*! @param  : [in ] nOrCode  : OR outcode of ring (sides to clip)
+*! @param  : [out] vecOut   : clip ring (replaced, empty if less than 3 points)
+*! @param  : [in ] vecWork  : work buffer
+***********************************************************************************/
+static void rect_clip_ring(const Point2D* pts, size_t nCnt, const Rect2D& rect, GInt nOrCode, VecPoint2D& vecOut, VecPoint2D& vecWork)
+{
+	vecOut.assign(pts, pts + nCnt);
+
+	auto funSide = [&](GInt nCode, void (*funClip)(const Point2D*, size_t, GFloat, VecPoint2D&), GFloat fBound)
+	{
+		if ((nOrCode & nCode) == 0 || vecOut.size() < 3)
+			return;
+
+		funClip(vecOut.data(), vecOut.size(), fBound, vecWork);
+		vecOut.swap(vecWork);
+	};
+
+	funSide(GEO_OUT_LEFT,   rect_clip_side<0, GFalse>, rect.x);
+	funSide(GEO_OUT_RIGHT,  rect_clip_side<0, GTrue >, rect.x + rect.width);
+	funSide(GEO_OUT_BOTTOM, rect_clip_side<1, GFalse>, rect.y);
+	funSide(GEO_OUT_TOP,    rect_clip_side<1, GTrue >, rect.y + rect.height);
+
+	if (vecOut.size() < 3)
+	{
+		vecOut.clear();
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Clipping polygon by rectangle (caller buffers)
+*! @param  : [in ] poly    : polygon (any orientation, orientation is kept)
+*! @param  : [in ] rect    : clip rectangle
+*! @param  : [out] vecOut  : clip polygon (replaced, empty if outside)
+*! @param  : [in ] vecWork : work buffer
+*! @return : number of point of clip polygon
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Sutherland-Hodgman only on the rectangle sides crossed by the
+*!           polygon (outcode). Concave polygon may get zero width bridges along
+*!           the sides (same as clip_polygon_hodgman)
+***********************************************************************************/
+Dllexport GInt clip_polygon_rect(const RingView2D& poly, const Rect2D& rect, VecPoint2D& vecOut, VecPoint2D& vecWork)
+{
+	vecOut.clear();
+
+	if (poly.size() < 3 || rect.width < 0 || rect.height < 0)
+	{
+		_ASSERT(0);
+		return 0;
+	}
+
+	GInt nAnd = 0;
+	GInt nOr  = get_outcode_rect(poly, rect, &nAnd);
+
+	// Trivial reject
+	if (nAnd != 0)
+		return 0;
+
+	// Trivial accept
+	if (nOr == 0)
+	{
+		vecOut.assign(poly.begin(), poly.end());
+		return static_cast<GInt>(vecOut.size());
+	}
+
+	rect_clip_ring(poly.data(), poly.size(), rect, nOr, vecOut, vecWork);
+
+	return static_cast<GInt>(vecOut.size());
+}
+
+/***********************************************************************************
+*! @brief  : Clipping polygon by rectangle
+*! @param  : [in] poly : polygon
+*! @param  : [in] rect : clip rectangle
+*! @return : clip polygon (empty if outside)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+Dllexport VecPoint2D clip_polygon_rect(const VecPoint2D& poly, const Rect2D& rect)
+{
+	VecPoint2D vecOut, vecWork;
+
+	clip_polygon_rect(RingView2D(poly), rect, vecOut, vecWork);
+
+	return vecOut;
+}
+
+/***********************************************************************************
+*! @brief  : Clipping all polygons of multipolygon by rectangle (batch)
+*! @param  : [in ] mpoly     : multipolygon
+*! @param  : [in ] rect      : clip rectangle
+*! @param  : [out] result    : clip multipolygon (appended)
+*! @param  : [out] pVecIndex : index of source polygon for each result polygon
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Outer ring decides for the whole polygon : outside -> skipped,
+*!           inside -> copied (holes are inside outer ring)
+***********************************************************************************/
+Dllexport void clip_polygon_rect(const MultiPolygon2D& mpoly, const Rect2D& rect, MultiPolygon2D& result,
+								 std::vector<uint32_t>* pVecIndex /*= NULL*/)
+{
+	if (rect.width < 0 || rect.height < 0)
+	{
+		_ASSERT(0);
+		return;
+	}
+
+	size_t nMaxRing = 0;
+
+	for (size_t r = 0; r < mpoly.ring_count(); r++)
+	{
+		nMaxRing = std::max(nMaxRing, mpoly.ring_size(r));
+	}
+
+	// Reserve heuristic : a few extra points for rect corners (a concave ring can
+	// gain more, the vectors then grow as usual)
+	VecPoint2D vecOut, vecWork;
+	vecOut.reserve(nMaxRing + 8);
+	vecWork.reserve(nMaxRing + 8);
+
+	for (size_t p = 0; p < mpoly.poly_count(); p++)
+	{
+		const size_t nRingBegin = mpoly.poly_ring_begin(p);
+		const size_t nRingEnd   = mpoly.poly_ring_end(p);
+
+		if (nRingBegin == nRingEnd || mpoly.ring_size(nRingBegin) < 3)
+			continue;
+
+		GInt nAnd = 0;
+		GInt nOr  = get_outcode_rect(mpoly.ring(nRingBegin), rect, &nAnd);
+
+		if (nAnd != 0)
+			continue;
+
+		if (nOr == 0)
+		{
+			result.begin_polygon();
+
+			if (pVecIndex) pVecIndex->push_back(static_cast<uint32_t>(p));
+
+			for (size_t r = nRingBegin; r < nRingEnd; r++)
+			{
+				result.add_ring(mpoly.ring(r));
+			}
+
+			continue;
+		}
+
+		for (size_t r = nRingBegin; r < nRingEnd; r++)
+		{
+			const GBool bOuter = (r == nRingBegin);
+			const RingView2D ring = mpoly.ring(r);
+
+			if (ring.size() < 3)
+				continue;
+
+			GInt nRingAnd = nAnd;
+			GInt nRingOr  = bOuter ? nOr : get_outcode_rect(ring, rect, &nRingAnd);
+
+			if (nRingAnd != 0)
+				continue;
+
+			rect_clip_ring(ring.data(), ring.size(), rect, nRingOr, vecOut, vecWork);
+
+			if (vecOut.empty())
+			{
+				if (bOuter) break;
+				continue;
+			}
+
+			if (bOuter)
+			{
+				result.begin_polygon();
+
+				if (pVecIndex) pVecIndex->push_back(static_cast<uint32_t>(p));
+			}
+
+			result.add_ring(vecOut.data(), vecOut.size());
+		}
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Clipping polygon list by rectangle (batch, one polygon per ring)
+*! @param  : [in ] polys     : polygon list
+*! @param  : [in ] rect      : clip rectangle
+*! @param  : [out] result    : clip multipolygon (appended)
+*! @param  : [out] pVecIndex : index of source polygon for each result polygon
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+Dllexport void clip_polygon_rect(const VecPolyList& polys, const Rect2D& rect, MultiPolygon2D& result,
+								 std::vector<uint32_t>* pVecIndex /*= NULL*/)
+{
+	if (rect.width < 0 || rect.height < 0)
+	{
+		_ASSERT(0);
+		return;
+	}
+
+	size_t nMaxRing = 0;
+
+	for (const VecPoint2D& poly : polys)
+	{
+		nMaxRing = std::max(nMaxRing, poly.size());
+	}
+
+	VecPoint2D vecOut, vecWork;
+	vecOut.reserve(nMaxRing + 8);
+	vecWork.reserve(nMaxRing + 8);
+
+	for (size_t p = 0; p < polys.size(); p++)
+	{
+		const VecPoint2D& poly = polys[p];
+
+		if (poly.size() < 3)
+			continue;
+
+		GInt nAnd = 0;
+		GInt nOr  = get_outcode_rect(RingView2D(poly), rect, &nAnd);
+
+		if (nAnd != 0)
+			continue;
+
+		if (nOr == 0)
+		{
+			result.begin_polygon();
+			result.add_ring(poly);
+		}
+		else
+		{
+			rect_clip_ring(poly.data(), poly.size(), rect, nOr, vecOut, vecWork);
+
+			if (vecOut.empty())
+				continue;
+
+			result.begin_polygon();
+			result.add_ring(vecOut.data(), vecOut.size());
+		}
+
+		if (pVecIndex) pVecIndex->push_back(static_cast<uint32_t>(p));
+	}
+}
+
+}}
@@ -0,0 +1,456 @@
+#include "x2dgrid.h"
+#include "x2dpred.h"
+
+#include <cassert>
+#include <cmath>
+#include <algorithm>
+
+namespace geo { namespace v2 {
+
+static const uint32_t	GRID_MAX_CELL  = 4096;	// max number of column (row)
+static const GDouble	GRID_CELL_RATE = 2.0;	// auto resolution : cells per vertex
+static const GDouble	GRID_MARGIN    = 1e-6;	// edge bucketing margin (cell size rate)
+
+GridPolygon::GridPolygon() :
+	m_dMinX(0.0), m_dMinY(0.0), m_dMaxX(0.0), m_dMaxY(0.0),
+	m_dCellW(1.0), m_dCellH(1.0), m_nCellX(0), m_nCellY(0)
+{
+
+}
+
+GridPolygon::GridPolygon(const VecPoint2D& poly, uint32_t nCellX, uint32_t nCellY) :
+	m_dMinX(0.0), m_dMinY(0.0), m_dMaxX(0.0), m_dMaxY(0.0),
+	m_dCellW(1.0), m_dCellH(1.0), m_nCellX(0), m_nCellY(0)
+{
+	build(poly, nCellX, nCellY);
+}
+
+GridPolygon::GridPolygon(const RingView2D& poly, uint32_t nCellX, uint32_t nCellY) :
+	m_dMinX(0.0), m_dMinY(0.0), m_dMaxX(0.0), m_dMaxY(0.0),
+	m_dCellW(1.0), m_dCellH(1.0), m_nCellX(0), m_nCellY(0)
+{
+	build(poly, nCellX, nCellY);
+}
+
+/***********************************************************************************
+*! @brief  : Build grid from polygon (can be called again to rebuild)
+*! @param  : [in] poly   : polygon (CW or CCW)
+*! @param  : [in] nCellX : number of column (0 : auto from vertex count)
+*! @param  : [in] nCellY : number of row    (0 : auto from vertex count)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Auto resolution : about 2 cells per vertex, square cells
+***********************************************************************************/
+void GridPolygon::build(const VecPoint2D& poly, uint32_t nCellX, uint32_t nCellY)
+{
+	build(RingView2D(poly), nCellX, nCellY);
+}
+
+/***********************************************************************************
+*! @brief  : Build grid from polygon view (can be called again to rebuild)
+*! @param  : [in] poly   : polygon (CW or CCW)
+*! @param  : [in] nCellX : number of column (0 : auto from vertex count)
+*! @param  : [in] nCellY : number of row    (0 : auto from vertex count)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Points are copied (edges of cells refer to the copy)
+***********************************************************************************/
+void GridPolygon::build(const RingView2D& poly, uint32_t nCellX, uint32_t nCellY)
+{
+	clear();
+
+	if (poly.size() < 3)
+	{
+		assert(0);
+		return;
+	}
+
+	m_vecPoly.assign(poly.begin(), poly.end());
+
+	// 1. Bounding box
+	m_dMinX = m_dMaxX = poly[0].x;
+	m_dMinY = m_dMaxY = poly[0].y;
+
+	for (size_t i = 1; i < poly.size(); i++)
+	{
+		m_dMinX = std::min<GDouble>(m_dMinX, poly[i].x);
+		m_dMinY = std::min<GDouble>(m_dMinY, poly[i].y);
+		m_dMaxX = std::max<GDouble>(m_dMaxX, poly[i].x);
+		m_dMaxY = std::max<GDouble>(m_dMaxY, poly[i].y);
+	}
+
+	GDouble dWidth  = m_dMaxX - m_dMinX;
+	GDouble dHeight = m_dMaxY - m_dMinY;
+
+	// 2. Resolution
+	if (nCellX == 0 || nCellY == 0)
+	{
+		GDouble dCellCnt = GRID_CELL_RATE * static_cast<GDouble>(poly.size());
+		GDouble dAspect  = (dWidth > 0.0 && dHeight > 0.0) ? dWidth / dHeight : 1.0;
+
+		if (nCellX == 0)
+			nCellX = static_cast<uint32_t>(std::min<GDouble>(std::ceil(std::sqrt(dCellCnt * dAspect)), GRID_MAX_CELL));
+		if (nCellY == 0)
+			nCellY = static_cast<uint32_t>(std::min<GDouble>(std::ceil(dCellCnt / nCellX), GRID_MAX_CELL));
+	}
+
+	m_nCellX = (dWidth  > 0.0) ? std::max<uint32_t>(1, std::min(nCellX, GRID_MAX_CELL)) : 1;
+	m_nCellY = (dHeight > 0.0) ? std::max<uint32_t>(1, std::min(nCellY, GRID_MAX_CELL)) : 1;
+	m_dCellW = (dWidth  > 0.0) ? dWidth  / m_nCellX : 1.0;
+	m_dCellH = (dHeight > 0.0) ? dHeight / m_nCellY : 1.0;
+
+	// 3. Edges of each cell + state of each cell center
+	bucket_edges();
+	compute_cell_state();
+}
+
+/***********************************************************************************
+*! @brief  : Release grid data
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+void GridPolygon::clear()
+{
+	m_vecPoly.clear();
+	m_vecCellStart.clear();
+	m_vecCellEdge.clear();
+	m_vecCellState.clear();
+
+	m_nCellX = m_nCellY = 0;
+}
+
+/***********************************************************************************
+*! @brief  : Put each edge into all cells it passes through (CSR, 2 passes)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Edge is clipped to each row band, then columns of the clipped part
+*!           are taken. A small margin keeps edges on cell borders in both cells
+***********************************************************************************/
+void GridPolygon::bucket_edges()
+{
+	const uint32_t nEdgeCnt = static_cast<uint32_t>(m_vecPoly.size());
+	const uint32_t nCellCnt = m_nCellX * m_nCellY;
+
+	const GDouble dMarginX = m_dCellW * GRID_MARGIN;
+	const GDouble dMarginY = m_dCellH * GRID_MARGIN;
+
+	auto col_of = [&](GDouble x) -> uint32_t
+	{
+		GDouble c = std::floor((x - m_dMinX) / m_dCellW);
+		return static_cast<uint32_t>(std::min<GDouble>(std::max<GDouble>(c, 0.0), m_nCellX - 1));
+	};
+
+	auto row_of = [&](GDouble y) -> uint32_t
+	{
+		GDouble r = std::floor((y - m_dMinY) / m_dCellH);
+		return static_cast<uint32_t>(std::min<GDouble>(std::max<GDouble>(r, 0.0), m_nCellY - 1));
+	};
+
+	// Cells of edge e : count (arEdge = NULL) or fill edge index
+	auto for_each_cell = [&](uint32_t e, uint32_t* arCount, uint32_t* arEdge)
+	{
+		const Point2D& pa = m_vecPoly[e];
+		const Point2D& pb = m_vecPoly[(e + 1 < nEdgeCnt) ? e + 1 : 0];
+
+		GDouble ax = pa.x, ay = pa.y, bx = pb.x, by = pb.y;
+
+		if (ay > by)
+		{
+			std::swap(ax, bx);
+			std::swap(ay, by);
+		}
+
+		uint32_t r0 = row_of(ay - dMarginY);
+		uint32_t r1 = row_of(by + dMarginY);
+
+		for (uint32_t r = r0; r <= r1; r++)
+		{
+			// Band is widened by the margin : edge touching the row border is also
+			// taken in the columns of the neighbour row
+			GDouble dBandY0 = std::max<GDouble>(m_dMinY + r * m_dCellH - dMarginY, ay);
+			GDouble dBandY1 = std::min<GDouble>(m_dMinY + (r + 1) * m_dCellH + dMarginY, by);
+
+			GDouble x0 = ax, x1 = bx;
+
+			if (by > ay)
+			{
+				GDouble dSlope = (bx - ax) / (by - ay);
+				x0 = ax + (std::max<GDouble>(dBandY0, ay) - ay) * dSlope;
+				x1 = ax + (std::min<GDouble>(dBandY1, by) - ay) * dSlope;
+			}
+
+			if (x0 > x1)
+				std::swap(x0, x1);
+
+			uint32_t c0 = col_of(x0 - dMarginX);
+			uint32_t c1 = col_of(x1 + dMarginX);
+
+			for (uint32_t c = c0; c <= c1; c++)
+			{
+				uint32_t nCell = r * m_nCellX + c;
+
+				if (arEdge)
+					arEdge[arCount[nCell]++] = e;
+				else
+					arCount[nCell]++;
+			}
+		}
+	};
+
+	m_vecCellStart.assign(nCellCnt + 1, 0);
+
+	for (uint32_t e = 0; e < nEdgeCnt; e++)
+	{
+		for_each_cell(e, m_vecCellStart.data() + 1, NULL);
+	}
+
+	for (uint32_t i = 0; i < nCellCnt; i++)
+	{
+		m_vecCellStart[i + 1] += m_vecCellStart[i];
+	}
+
+	m_vecCellEdge.resize(m_vecCellStart.back());
+
+	std::vector<uint32_t> vecFill(m_vecCellStart.begin(), m_vecCellStart.end() - 1);
+
+	for (uint32_t e = 0; e < nEdgeCnt; e++)
+	{
+		for_each_cell(e, vecFill.data(), m_vecCellEdge.data());
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Inside state of all cell centers (one scanline per row)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Crossing rule of is_point_in_polygon. Side of each center is decided
+*!           by orient2d, the crossing x is only used to find the nearest center
+***********************************************************************************/
+void GridPolygon::compute_cell_state()
+{
+	const uint32_t nEdgeCnt = static_cast<uint32_t>(m_vecPoly.size());
+
+	m_vecCellState.assign(static_cast<size_t>(m_nCellX) * m_nCellY, 0);
+
+	// diff[row * (nCellX + 1) + m] : parity flip for centers [0, m) of the row
+	std::vector<uint8_t> vecFlip(static_cast<size_t>(m_nCellX + 1) * m_nCellY, 0);
+
+	for (uint32_t e = 0; e < nEdgeCnt; e++)
+	{
+		const Point2D& pa = m_vecPoly[e];
+		const Point2D& pb = m_vecPoly[(e + 1 < nEdgeCnt) ? e + 1 : 0];
+
+		// Lower point (y <= cy) -> upper point (y > cy)
+		GDouble lx = pa.x, ly = pa.y, ux = pb.x, uy = pb.y;
+
+		if (ly > uy)
+		{
+			std::swap(lx, ux);
+			std::swap(ly, uy);
+		}
+
+		if (ly == uy)
+			continue;
+
+		// Rows whose center y is in [ly, uy)
+		GDouble dRow0 = std::ceil((ly - m_dMinY) / m_dCellH - 0.5) - 1.0;
+		GDouble dRow1 = std::floor((uy - m_dMinY) / m_dCellH - 0.5) + 1.0;
+
+		int32_t r0 = static_cast<int32_t>(std::max<GDouble>(dRow0, 0.0));
+		int32_t r1 = static_cast<int32_t>(std::min<GDouble>(dRow1, m_nCellY - 1.0));
+
+		for (int32_t r = r0; r <= r1; r++)
+		{
+			GDouble cy = m_dMinY + (r + 0.5) * m_dCellH;
+
+			if (!(ly <= cy && cy < uy))
+				continue;
+
+			// m : number of center on the left of the crossing
+			GDouble dX  = lx + (cy - ly) * (ux - lx) / (uy - ly);
+			GDouble dM  = std::floor((dX - m_dMinX) / m_dCellW + 0.5);
+			int32_t m   = static_cast<int32_t>(std::min<GDouble>(std::max<GDouble>(dM, 0.0), m_nCellX));
+
+			auto is_left = [&](int32_t c)
+			{
+				GDouble cx = m_dMinX + (c + 0.5) * m_dCellW;
+				return orient2d(lx, ly, ux, uy, cx, cy) > 0.0;
+			};
+
+			while (m > 0 && !is_left(m - 1)) m--;
+			while (m < static_cast<int32_t>(m_nCellX) && is_left(m)) m++;
+
+			size_t nBase = static_cast<size_t>(r) * (m_nCellX + 1);
+			vecFlip[nBase] ^= 1;
+			vecFlip[nBase + m] ^= 1;
+		}
+	}
+
+	for (uint32_t r = 0; r < m_nCellY; r++)
+	{
+		uint8_t nState = 0;
+
+		for (uint32_t c = 0; c < m_nCellX; c++)
+		{
+			nState ^= vecFlip[static_cast<size_t>(r) * (m_nCellX + 1) + c];
+			m_vecCellState[static_cast<size_t>(r) * m_nCellX + c] = nState;
+		}
+	}
+
+	// Center on an edge : side of center is not defined for the segment test
+	for (uint32_t r = 0; r < m_nCellY; r++)
+	{
+		const GDouble cy = m_dMinY + (r + 0.5) * m_dCellH;
+
+		for (uint32_t c = 0; c < m_nCellX; c++)
+		{
+			const GDouble cx = m_dMinX + (c + 0.5) * m_dCellW;
+			const uint32_t nCell = r * m_nCellX + c;
+
+			for (uint32_t i = m_vecCellStart[nCell]; i < m_vecCellStart[nCell + 1]; i++)
+			{
+				uint32_t e = m_vecCellEdge[i];
+
+				const Point2D& pa = m_vecPoly[e];
+				const Point2D& pb = m_vecPoly[(e + 1 < nEdgeCnt) ? e + 1 : 0];
+
+				if (orient2d(pa.x, pa.y, pb.x, pb.y, cx, cy) == 0.0 &&
+					cx >= std::min(pa.x, pb.x) && cx <= std::max(pa.x, pb.x) &&
+					cy >= std::min(pa.y, pb.y) && cy <= std::max(pa.y, pb.y))
+				{
+					m_vecCellState[nCell] |= 2;
+					break;
+				}
+			}
+		}
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Check point inside polygon with all edges (crossing rule, exact sign)
+*! @note   : Used for cells whose center is on an edge
+***********************************************************************************/
+GBool GridPolygon::contains_full(GDouble px, GDouble py) const
+{
+	const size_t nEdgeCnt = m_vecPoly.size();
+
+	GBool bInside = GFalse;
+
+	for (size_t i = 0, j = nEdgeCnt - 1; i < nEdgeCnt; j = i++)
+	{
+		const Point2D& pa = m_vecPoly[j];
+		const Point2D& pb = m_vecPoly[i];
+
+		GDouble dSideP = orient2d(pa.x, pa.y, pb.x, pb.y, px, py);
+
+		if (dSideP == 0.0 &&
+			px >= std::min(pa.x, pb.x) && px <= std::max(pa.x, pb.x) &&
+			py >= std::min(pa.y, pb.y) && py <= std::max(pa.y, pb.y))
+			return GTrue;
+
+		if ((pa.y > py) != (pb.y > py))
+		{
+			// Crossing of ray to +x : pt on the left of the upward edge
+			if ((pb.y > pa.y) ? (dSideP > 0.0) : (dSideP < 0.0))
+				bInside = !bInside;
+		}
+	}
+
+	return bInside;
+}
+
+/***********************************************************************************
+*! @brief  : Check point inside polygon
+*! @param  : [in] pt : point check
+*! @return : TRUE : inside | FALSE : outside
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Crossing rule of is_point_in_polygon with exact sign (orient2d).
+*!           Points on the boundary are inside
+***********************************************************************************/
+GBool GridPolygon::contains(const Point2D& pt) const
+{
+	if (m_vecCellState.empty())
+		return GFalse;
+
+	GDouble px = pt.x, py = pt.y;
+
+	if (px < m_dMinX || px > m_dMaxX || py < m_dMinY || py > m_dMaxY)
+		return GFalse;
+
+	uint32_t col = std::min(static_cast<uint32_t>((px - m_dMinX) / m_dCellW), m_nCellX - 1);
+	uint32_t row = std::min(static_cast<uint32_t>((py - m_dMinY) / m_dCellH), m_nCellY - 1);
+	uint32_t nCell = row * m_nCellX + col;
+
+	if (m_vecCellState[nCell] & 2)
+		return contains_full(px, py);
+
+	GBool bInside = (m_vecCellState[nCell] & 1) != 0;
+
+	uint32_t nBegin = m_vecCellStart[nCell];
+	uint32_t nEnd   = m_vecCellStart[nCell + 1];
+
+	if (nBegin == nEnd)
+		return bInside;
+
+	// Count crossings of segment [pt, center] with the edges of the cell
+	const GDouble cx = m_dMinX + (col + 0.5) * m_dCellW;
+	const GDouble cy = m_dMinY + (row + 0.5) * m_dCellH;
+	const uint32_t nEdgeCnt = static_cast<uint32_t>(m_vecPoly.size());
+
+	for (uint32_t i = nBegin; i < nEnd; i++)
+	{
+		uint32_t e = m_vecCellEdge[i];
+
+		const Point2D& pa = m_vecPoly[e];
+		const Point2D& pb = m_vecPoly[(e + 1 < nEdgeCnt) ? e + 1 : 0];
+
+		GDouble dSideP = orient2d(pa.x, pa.y, pb.x, pb.y, px, py);
+
+		// Point on the edge (vertex included) : before the half open test, which
+		// skips the edge when pt is an end point and the other one is on the right
+		if (dSideP == 0.0 &&
+			px >= std::min(pa.x, pb.x) && px <= std::max(pa.x, pb.x) &&
+			py >= std::min(pa.y, pb.y) && py <= std::max(pa.y, pb.y))
+			return GTrue;
+
+		// Half open : point on line [pt, center] is on the right side
+		if ((orient2d(px, py, cx, cy, pa.x, pa.y) > 0.0) == (orient2d(px, py, cx, cy, pb.x, pb.y) > 0.0))
+			continue;
+
+		if ((dSideP > 0.0) != (orient2d(pa.x, pa.y, pb.x, pb.y, cx, cy) > 0.0))
+			bInside = !bInside;
+	}
+
+	return bInside;
+}
+
+/***********************************************************************************
+*! @brief  : Check list point inside polygon
+*! @param  : [in ] pts : point list
+*! @param  : [in ] n   : number of point
+*! @param  : [out] out : 1 : inside | 0 : outside (size >= n)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+void GridPolygon::contains(const Point2D* pts, size_t n, uint8_t* out) const
+{
+	for (size_t i = 0; i < n; i++)
+	{
+		out[i] = contains(pts[i]) ? 1 : 0;
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Number of edge stored in cell (col, row)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+size_t GridPolygon::cell_edge_count(uint32_t col, uint32_t row) const
+{
+	if (col >= m_nCellX || row >= m_nCellY)
+		return 0;
+
+	uint32_t nCell = row * m_nCellX + col;
+	return m_vecCellStart[nCell + 1] - m_vecCellStart[nCell];
+}
+
+void GridPolygon::get_bounding_box(Point2D& ptMin, Point2D& ptMax) const
+{
+	ptMin = Point2D(static_cast<GFloat>(m_dMinX), static_cast<GFloat>(m_dMinY));
+	ptMax = Point2D(static_cast<GFloat>(m_dMaxX), static_cast<GFloat>(m_dMaxY));
+}
+
+}}
@@ -0,0 +1,656 @@
+#include "x2dkdtree.h"
+
+#include <cmath>
+#include <algorithm>
+
+namespace geo { namespace v2 {
+
+const uint32_t KdTree2D::KDTREE_NONE;
+const uint32_t KdTree2D::KDTREE_LEAF;
+
+#define KDTREE_PARALLEL_MIN		16384	// build : min number of point to use pool
+#define KDTREE_TASK_MIN			4096	// build : min number of point of subtree task
+#define KDTREE_QUERY_CHUNK		256		// batch query : number of query per task
+#define KDTREE_STACK			64		// depth of tree < 64 for any 32 bit size
+
+typedef struct tagKdItem
+{
+	Point2D		m_pt;
+	uint32_t	m_nIndex;
+
+} KdItem;
+
+typedef struct tagKdRange
+{
+	size_t		m_nBegin;
+	size_t		m_nEnd;
+	GDouble		m_dBound;	// squared distance from query point to split line
+
+} KdRange;
+
+static inline GFloat kdtree_coord(const Point2D& pt, size_t nAxis)
+{
+	return nAxis ? pt.y : pt.x;
+}
+
+static inline GDouble kdtree_dist2(const Point2D& pt1, const Point2D& pt2)
+{
+	GDouble dx = GDouble(pt1.x) - pt2.x;
+	GDouble dy = GDouble(pt1.y) - pt2.y;
+
+	return dx * dx + dy * dy;
+}
+
+static inline GDouble kdtree_max_dist2(GFloat fMaxDist)
+{
+	return (fMaxDist < FLT_MAX) ? GDouble(fMaxDist) * fMaxDist : DBL_MAX;
+}
+
+/***********************************************************************************
+*! @brief  : Put median of range [nBegin, nEnd) at middle, split on longer side
+***********************************************************************************/
+static size_t kdtree_split(KdItem* pItem, uint8_t* pAxis, size_t nBegin, size_t nEnd)
+{
+	GFloat fMinX = FLT_MAX, fMinY = FLT_MAX, fMaxX = -FLT_MAX, fMaxY = -FLT_MAX;
+
+	for (size_t i = nBegin; i < nEnd; i++)
+	{
+		const Point2D& pt = pItem[i].m_pt;
+
+		fMinX = std::min<GFloat>(fMinX, pt.x); fMaxX = std::max<GFloat>(fMaxX, pt.x);
+		fMinY = std::min<GFloat>(fMinY, pt.y); fMaxY = std::max<GFloat>(fMaxY, pt.y);
+	}
+
+	size_t nAxis = (fMaxX - fMinX >= fMaxY - fMinY) ? 0 : 1;
+	size_t nMid  = nBegin + (nEnd - nBegin) / 2;
+
+	std::nth_element(pItem + nBegin, pItem + nMid, pItem + nEnd, [nAxis](const KdItem& a, const KdItem& b)
+	{
+		return kdtree_coord(a.m_pt, nAxis) < kdtree_coord(b.m_pt, nAxis);
+	});
+
+	pAxis[nMid] = static_cast<uint8_t>(nAxis);
+
+	return nMid;
+}
+
+/***********************************************************************************
+*! @brief  : Build subtree of range [nBegin, nEnd) (explicit stack)
+***********************************************************************************/
+static void kdtree_build_range(KdItem* pItem, uint8_t* pAxis, size_t nBegin, size_t nEnd)
+{
+	std::vector<std::pair<size_t, size_t>> stack(1, std::make_pair(nBegin, nEnd));
+
+	while (!stack.empty())
+	{
+		size_t b = stack.back().first;
+		size_t e = stack.back().second;
+
+		stack.pop_back();
+
+		if (e - b <= KdTree2D::KDTREE_LEAF)
+			continue;
+
+		size_t m = kdtree_split(pItem, pAxis, b, e);
+
+		stack.push_back(std::make_pair(m + 1, e));
+		stack.push_back(std::make_pair(b, m));
+	}
+}
+
+KdTree2D::KdTree2D()
+{
+
+}
+
+/***********************************************************************************
+*! @brief  : Build tree (can be called again to rebuild)
+*! @param  : [in] pts     : points (copied)
+*! @param  : [in] nCnt    : number of point
+*! @param  : [in] pool    : thread pool, subtrees below the top levels are built
+*!                          in parallel
+*! @param  : [in] nThread : max number of worker (<= 0 : all)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : O(n log n), median by nth_element. Same tree for any thread count
+***********************************************************************************/
+void KdTree2D::build(const Point2D* pts, size_t nCnt)
+{
+	clear();
+
+	std::vector<KdItem> vecItem(nCnt);
+
+	for (size_t i = 0; i < nCnt; i++)
+	{
+		vecItem[i].m_pt     = pts[i];
+		vecItem[i].m_nIndex = static_cast<uint32_t>(i);
+	}
+
+	m_vecAxis.assign(nCnt, 0);
+
+	kdtree_build_range(vecItem.data(), m_vecAxis.data(), 0, nCnt);
+
+	m_vecPoint.resize(nCnt);
+	m_vecIndex.resize(nCnt);
+
+	for (size_t i = 0; i < nCnt; i++)
+	{
+		m_vecPoint[i] = vecItem[i].m_pt;
+		m_vecIndex[i] = vecItem[i].m_nIndex;
+	}
+}
+
+void KdTree2D::build(const VecPoint2D& vecPoints)
+{
+	build(vecPoints.data(), vecPoints.size());
+}
+
+void KdTree2D::build(const VecPoint2D& vecPoints, GeoThreadPool& pool, GInt nThread /*= 0*/)
+{
+	size_t nCnt    = vecPoints.size();
+	GInt   nWorker = (nThread > 0) ? std::min(nThread, pool.thread_count()) : pool.thread_count();
+
+	if (nCnt < KDTREE_PARALLEL_MIN || nWorker <= 1)
+	{
+		build(vecPoints);
+		return;
+	}
+
+	clear();
+
+	std::vector<KdItem> vecItem(nCnt);
+
+	for (size_t i = 0; i < nCnt; i++)
+	{
+		vecItem[i].m_pt     = vecPoints[i];
+		vecItem[i].m_nIndex = static_cast<uint32_t>(i);
+	}
+
+	m_vecAxis.assign(nCnt, 0);
+
+	// 1. Top levels (serial) until there are enough subtrees for the workers
+	std::vector<std::pair<size_t, size_t>> vecRange(1, std::make_pair(size_t(0), nCnt));
+	std::vector<std::pair<size_t, size_t>> vecNext;
+
+	size_t nTarget = 4 * static_cast<size_t>(nWorker);
+	GBool  bSplit  = GTrue;
+
+	while (vecRange.size() < nTarget && bSplit)
+	{
+		bSplit = GFalse;
+		vecNext.clear();
+
+		for (size_t r = 0; r < vecRange.size(); r++)
+		{
+			size_t b = vecRange[r].first;
+			size_t e = vecRange[r].second;
+
+			if (e - b < KDTREE_TASK_MIN)
+			{
+				vecNext.push_back(vecRange[r]);
+				continue;
+			}
+
+			size_t m = kdtree_split(vecItem.data(), m_vecAxis.data(), b, e);
+
+			vecNext.push_back(std::make_pair(b, m));
+			vecNext.push_back(std::make_pair(m + 1, e));
+			bSplit = GTrue;
+		}
+
+		vecRange.swap(vecNext);
+	}
+
+	// 2. Subtrees (parallel) : ranges are disjoint, same splits as serial build
+	pool.parallel_for(vecRange.size(), [&](size_t nTask, GInt)
+	{
+		kdtree_build_range(vecItem.data(), m_vecAxis.data(), vecRange[nTask].first, vecRange[nTask].second);
+	}, nWorker);
+
+	m_vecPoint.resize(nCnt);
+	m_vecIndex.resize(nCnt);
+
+	for (size_t i = 0; i < nCnt; i++)
+	{
+		m_vecPoint[i] = vecItem[i].m_pt;
+		m_vecIndex[i] = vecItem[i].m_nIndex;
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Remove all points
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+void KdTree2D::clear()
+{
+	m_vecPoint.clear();
+	m_vecIndex.clear();
+	m_vecAxis.clear();
+}
+
+/***********************************************************************************
+*! @brief  : Nearest point
+*! @param  : [in ] pt       : query point
+*! @param  : [in ] fMaxDist : search radius (points farther are ignored)
+*! @param  : [out] result   : nearest point (not changed if not found)
+*! @return : TRUE : found | FALSE : no point within fMaxDist
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+GBool KdTree2D::query_nearest(const Point2D& pt, GFloat fMaxDist, KdHit& result) const
+{
+	if (m_vecPoint.empty())
+		return GFalse;
+
+	GDouble  dBest2 = kdtree_max_dist2(fMaxDist);
+	uint32_t nBest  = KDTREE_NONE;
+
+	auto check_slot = [&](size_t i)
+	{
+		GDouble d2 = kdtree_dist2(pt, m_vecPoint[i]);
+
+		if (d2 < dBest2 || (d2 == dBest2 && m_vecIndex[i] < nBest))
+		{
+			dBest2 = d2;
+			nBest  = m_vecIndex[i];
+		}
+	};
+
+	KdRange arStack[KDTREE_STACK];
+	size_t  nTop = 0;
+
+	arStack[nTop++] = { 0, m_vecPoint.size(), 0.0 };
+
+	while (nTop > 0)
+	{
+		KdRange range = arStack[--nTop];
+
+		if (range.m_dBound > dBest2)
+			continue;
+
+		size_t b = range.m_nBegin, e = range.m_nEnd;
+
+		// Go down to the leaf on the side of pt, push other sides
+		while (e - b > KDTREE_LEAF)
+		{
+			size_t m = b + (e - b) / 2;
+
+			check_slot(m);
+
+			GDouble dDiff = GDouble(kdtree_coord(pt, m_vecAxis[m])) - kdtree_coord(m_vecPoint[m], m_vecAxis[m]);
+			GDouble dDiff2 = dDiff * dDiff;
+
+			if (dDiff < 0.0)
+			{
+				if (dDiff2 <= dBest2) arStack[nTop++] = { m + 1, e, dDiff2 };
+				e = m;
+			}
+			else
+			{
+				if (dDiff2 <= dBest2) arStack[nTop++] = { b, m, dDiff2 };
+				b = m + 1;
+			}
+		}
+
+		for (size_t i = b; i < e; i++)
+		{
+			check_slot(i);
+		}
+	}
+
+	if (nBest == KDTREE_NONE)
+		return GFalse;
+
+	result.m_nIndex = nBest;
+	result.m_fDist  = static_cast<GFloat>(std::sqrt(dBest2));
+
+	return GTrue;
+}
+
+/***********************************************************************************
+*! @brief  : All points within radius
+*! @param  : [in ] pt        : query point
+*! @param  : [in ] fRadius   : radius (point at distance == fRadius is included)
+*! @param  : [out] vecResult : points (appended, order not defined)
+*! @return : number of point found
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+size_t KdTree2D::query_radius(const Point2D& pt, GFloat fRadius, VecKdHit& vecResult) const
+{
+	if (m_vecPoint.empty() || fRadius < 0.f)
+		return 0;
+
+	GDouble dRadius2 = kdtree_max_dist2(fRadius);
+	size_t  nStart   = vecResult.size();
+
+	auto check_slot = [&](size_t i)
+	{
+		GDouble d2 = kdtree_dist2(pt, m_vecPoint[i]);
+
+		if (d2 <= dRadius2)
+		{
+			KdHit hit;
+			hit.m_nIndex = m_vecIndex[i];
+			hit.m_fDist  = static_cast<GFloat>(std::sqrt(d2));
+
+			vecResult.push_back(hit);
+		}
+	};
+
+	KdRange arStack[KDTREE_STACK];
+	size_t  nTop = 0;
+
+	arStack[nTop++] = { 0, m_vecPoint.size(), 0.0 };
+
+	while (nTop > 0)
+	{
+		KdRange range = arStack[--nTop];
+
+		size_t b = range.m_nBegin, e = range.m_nEnd;
+
+		while (e - b > KDTREE_LEAF)
+		{
+			size_t m = b + (e - b) / 2;
+
+			check_slot(m);
+
+			GDouble dDiff = GDouble(kdtree_coord(pt, m_vecAxis[m])) - kdtree_coord(m_vecPoint[m], m_vecAxis[m]);
+
+			if (dDiff * dDiff > dRadius2)
+			{
+				// Only one side can have points within radius
+				if (dDiff < 0.0) e = m;
+				else			 b = m + 1;
+
+				continue;
+			}
+
+			arStack[nTop++] = { m + 1, e, 0.0 };
+			e = m;
+		}
+
+		for (size_t i = b; i < e; i++)
+		{
+			check_slot(i);
+		}
+	}
+
+	return vecResult.size() - nStart;
+}
+
+/***********************************************************************************
+*! @brief  : k nearest in max heap (farthest on top), sorted nearest first on return
+***********************************************************************************/
+size_t KdTree2D::knn_search(const Point2D& pt, size_t nK, GFloat fMaxDist, std::vector<KnnItem>& vecHeap) const
+{
+	vecHeap.clear();
+
+	if (m_vecPoint.empty() || nK == 0)
+		return 0;
+
+	GDouble dMax2 = kdtree_max_dist2(fMaxDist);
+
+	auto worst2 = [&]() -> GDouble
+	{
+		return (vecHeap.size() < nK) ? dMax2 : vecHeap.front().first;
+	};
+
+	auto check_slot = [&](size_t i)
+	{
+		KnnItem item(kdtree_dist2(pt, m_vecPoint[i]), m_vecIndex[i]);
+
+		if (vecHeap.size() < nK)
+		{
+			if (item.first > dMax2)
+				return;
+		}
+		else if (item < vecHeap.front())
+		{
+			std::pop_heap(vecHeap.begin(), vecHeap.end());
+			vecHeap.pop_back();
+		}
+		else
+		{
+			return;
+		}
+
+		vecHeap.push_back(item);
+		std::push_heap(vecHeap.begin(), vecHeap.end());
+	};
+
+	KdRange arStack[KDTREE_STACK];
+	size_t  nTop = 0;
+
+	arStack[nTop++] = { 0, m_vecPoint.size(), 0.0 };
+
+	while (nTop > 0)
+	{
+		KdRange range = arStack[--nTop];
+
+		if (range.m_dBound > worst2())
+			continue;
+
+		size_t b = range.m_nBegin, e = range.m_nEnd;
+
+		while (e - b > KDTREE_LEAF)
+		{
+			size_t m = b + (e - b) / 2;
+
+			check_slot(m);
+
+			GDouble dDiff = GDouble(kdtree_coord(pt, m_vecAxis[m])) - kdtree_coord(m_vecPoint[m], m_vecAxis[m]);
+			GDouble dDiff2 = dDiff * dDiff;
+
+			if (dDiff < 0.0)
+			{
+				if (dDiff2 <= worst2()) arStack[nTop++] = { m + 1, e, dDiff2 };
+				e = m;
+			}
+			else
+			{
+				if (dDiff2 <= worst2()) arStack[nTop++] = { b, m, dDiff2 };
+				b = m + 1;
+			}
+		}
+
+		for (size_t i = b; i < e; i++)
+		{
+			check_slot(i);
+		}
+	}
+
+	std::sort_heap(vecHeap.begin(), vecHeap.end());
+
+	return vecHeap.size();
+}
+
+/***********************************************************************************
+*! @brief  : k nearest points
+*! @param  : [in ] pt        : query point
+*! @param  : [in ] nK        : number of point
+*! @param  : [out] vecResult : min(nK, size()) points (replaced, nearest first)
+*! @param  : [in ] fMaxDist  : search radius (points farther are ignored)
+*! @return : number of point found
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+size_t KdTree2D::query_knn(const Point2D& pt, size_t nK, VecKdHit& vecResult, GFloat fMaxDist /*= FLT_MAX*/) const
+{
+	std::vector<KnnItem> vecHeap;
+	vecHeap.reserve(nK + 1);
+
+	size_t nFound = knn_search(pt, nK, fMaxDist, vecHeap);
+
+	vecResult.resize(nFound);
+
+	for (size_t i = 0; i < nFound; i++)
+	{
+		vecResult[i].m_nIndex = vecHeap[i].second;
+		vecResult[i].m_fDist  = static_cast<GFloat>(std::sqrt(vecHeap[i].first));
+	}
+
+	return nFound;
+}
+
+/***********************************************************************************
+*! @brief  : Nearest point of each query point
+*! @param  : [in ] vecQuery  : query points
+*! @param  : [in ] fMaxDist  : search radius
+*! @param  : [out] vecResult : result of query i in slot i (replaced,
+*!                             m_nIndex = KDTREE_NONE : not found)
+*! @param  : [in ] pool      : thread pool
+*! @param  : [in ] nThread   : max number of worker (<= 0 : all)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+void KdTree2D::query_nearest(const VecPoint2D& vecQuery, GFloat fMaxDist, VecKdHit& vecResult) const
+{
+	KdHit none = { KDTREE_NONE, FLT_MAX };
+
+	vecResult.assign(vecQuery.size(), none);
+
+	for (size_t i = 0; i < vecQuery.size(); i++)
+	{
+		query_nearest(vecQuery[i], fMaxDist, vecResult[i]);
+	}
+}
+
+void KdTree2D::query_nearest(const VecPoint2D& vecQuery, GFloat fMaxDist, VecKdHit& vecResult,
+							 GeoThreadPool& pool, GInt nThread /*= 0*/) const
+{
+	KdHit none = { KDTREE_NONE, FLT_MAX };
+
+	size_t nCnt      = vecQuery.size();
+	size_t nChunkCnt = (nCnt + KDTREE_QUERY_CHUNK - 1) / KDTREE_QUERY_CHUNK;
+
+	vecResult.assign(nCnt, none);
+
+	pool.parallel_for(nChunkCnt, [&](size_t nTask, GInt)
+	{
+		size_t nEnd = std::min(nCnt, (nTask + 1) * KDTREE_QUERY_CHUNK);
+
+		for (size_t i = nTask * KDTREE_QUERY_CHUNK; i < nEnd; i++)
+		{
+			query_nearest(vecQuery[i], fMaxDist, vecResult[i]);
+		}
+	}, nThread);
+}
+
+/***********************************************************************************
+*! @brief  : k nearest points of each query point
+*! @param  : [in ] vecQuery  : query points
+*! @param  : [in ] nK        : number of point
+*! @param  : [out] vecResult : results of query i in [i * nK, (i + 1) * nK) (replaced,
+*!                             nearest first, m_nIndex = KDTREE_NONE : not found)
+*! @param  : [in ] pool      : thread pool
+*! @param  : [in ] nThread   : max number of worker (<= 0 : all)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+void KdTree2D::query_knn(const VecPoint2D& vecQuery, size_t nK, VecKdHit& vecResult) const
+{
+	KdHit none = { KDTREE_NONE, FLT_MAX };
+
+	vecResult.assign(vecQuery.size() * nK, none);
+
+	std::vector<KnnItem> vecHeap;
+	vecHeap.reserve(nK + 1);
+
+	for (size_t q = 0; q < vecQuery.size(); q++)
+	{
+		size_t nFound = knn_search(vecQuery[q], nK, FLT_MAX, vecHeap);
+
+		for (size_t i = 0; i < nFound; i++)
+		{
+			vecResult[q * nK + i].m_nIndex = vecHeap[i].second;
+			vecResult[q * nK + i].m_fDist  = static_cast<GFloat>(std::sqrt(vecHeap[i].first));
+		}
+	}
+}
+
+void KdTree2D::query_knn(const VecPoint2D& vecQuery, size_t nK, VecKdHit& vecResult,
+						 GeoThreadPool& pool, GInt nThread /*= 0*/) const
+{
+	KdHit none = { KDTREE_NONE, FLT_MAX };
+
+	size_t nCnt      = vecQuery.size();
+	size_t nChunkCnt = (nCnt + KDTREE_QUERY_CHUNK - 1) / KDTREE_QUERY_CHUNK;
+
+	vecResult.assign(nCnt * nK, none);
+
+	// One heap per worker (kept for all tasks of worker)
+	std::vector<std::vector<KnnItem>> vecHeap(pool.thread_count());
+
+	pool.parallel_for(nChunkCnt, [&](size_t nTask, GInt nWorker)
+	{
+		std::vector<KnnItem>& heap = vecHeap[nWorker];
+
+		size_t nEnd = std::min(nCnt, (nTask + 1) * KDTREE_QUERY_CHUNK);
+
+		for (size_t q = nTask * KDTREE_QUERY_CHUNK; q < nEnd; q++)
+		{
+			size_t nFound = knn_search(vecQuery[q], nK, FLT_MAX, heap);
+
+			for (size_t i = 0; i < nFound; i++)
+			{
+				vecResult[q * nK + i].m_nIndex = heap[i].second;
+				vecResult[q * nK + i].m_fDist  = static_cast<GFloat>(std::sqrt(heap[i].first));
+			}
+		}
+	}, nThread);
+}
+
+/***********************************************************************************
+*! @brief  : Merge points closer than tolerance (weld vertices)
+*! @param  : [in ] vecPoints : points
+*! @param  : [in ] fTol      : points within fTol of a kept point are merged to it
+*! @param  : [out] vecOut    : kept points (replaced, input order)
+*! @param  : [out] pMap      : index in vecOut of each input point (NULL : not used)
+*! @return : number of removed point
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Greedy in input order, O(n log n) with KdTree2D (not O(n^2))
+***********************************************************************************/
+size_t remove_duplicate_points(const VecPoint2D& vecPoints, GFloat fTol, VecPoint2D& vecOut,
+							   std::vector<uint32_t>* pMap /*= NULL*/)
+{
+	return remove_duplicate_points(RingView2D(vecPoints), fTol, vecOut, pMap);
+}
+
+size_t remove_duplicate_points(const RingView2D& vecPoints, GFloat fTol, VecPoint2D& vecOut,
+							   std::vector<uint32_t>* pMap /*= NULL*/)
+{
+	vecOut.clear();
+
+	std::vector<uint32_t> vecMap(vecPoints.size(), KdTree2D::KDTREE_NONE);
+
+	KdTree2D tree;
+	tree.build(vecPoints.data(), vecPoints.size());
+
+	VecKdHit vecHit;
+
+	for (size_t i = 0; i < vecPoints.size(); i++)
+	{
+		if (vecMap[i] != KdTree2D::KDTREE_NONE)
+			continue;
+
+		uint32_t nKeep = static_cast<uint32_t>(vecOut.size());
+
+		vecOut.push_back(vecPoints[i]);
+		vecMap[i] = nKeep;
+
+		vecHit.clear();
+		tree.query_radius(vecPoints[i], fTol, vecHit);
+
+		for (size_t h = 0; h < vecHit.size(); h++)
+		{
+			if (vecMap[vecHit[h].m_nIndex] == KdTree2D::KDTREE_NONE)
+			{
+				vecMap[vecHit[h].m_nIndex] = nKeep;
+			}
+		}
+	}
+
+	if (pMap != NULL)
+	{
+		pMap->swap(vecMap);
+	}
+
+	return vecPoints.size() - vecOut.size();
+}
+
+}}
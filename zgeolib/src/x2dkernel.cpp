@@ -0,0 +1,1251 @@
+#include "x2dkernel.h"
+#include "x2dscratch.h"
+#include <cassert>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <algorithm>
+
+namespace geo { namespace v2 {
+
+/***********************************************************************************
+*! @brief  : Convert point list to fixed point
+*! @param  : [in ] pts    : point list
+*! @param  : [in ] nCnt   : number of point
+*! @param  : [in ] dScale : fixed unit per world unit (ex : 1000 -> 0.001)
+*! @param  : [out] out    : fixed point list (size >= nCnt)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Round to nearest (snap rounding to grid 1 / dScale)
+***********************************************************************************/
+Dllexport void to_fixed(const Point2D* pts, size_t nCnt, GDouble dScale, Point2Dx* out)
+{
+	for (size_t i = 0; i < nCnt; i++)
+	{
+		out[i].x = static_cast<GFixed>(std::llround(pts[i].x * dScale));
+		out[i].y = static_cast<GFixed>(std::llround(pts[i].y * dScale));
+
+		assert(std::abs(out[i].x) <= GFIXED_COORD_MAX && std::abs(out[i].y) <= GFIXED_COORD_MAX);
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Convert fixed point list to point
+*! @param  : [in ] pts    : fixed point list
+*! @param  : [in ] nCnt   : number of point
+*! @param  : [in ] dScale : fixed unit per world unit (same as to_fixed)
+*! @param  : [out] out    : point list (size >= nCnt)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+Dllexport void from_fixed(const Point2Dx* pts, size_t nCnt, GDouble dScale, Point2D* out)
+{
+	const GDouble dInv = 1.0 / dScale;
+
+	for (size_t i = 0; i < nCnt; i++)
+	{
+		out[i].x = static_cast<GFloat>(pts[i].x * dInv);
+		out[i].y = static_cast<GFloat>(pts[i].y * dInv);
+	}
+}
+
+namespace kernel {
+
+/***********************************************************************************
+*! @brief  : Convert double to scalar (fixed point : round to nearest)
+***********************************************************************************/
+template<typename T>
+static inline T from_double(GDouble dVal)
+{
+	return ScalarTraits<T>::exact ? static_cast<T>(std::llround(dVal)) : static_cast<T>(dVal);
+}
+
+/***********************************************************************************
+*! @brief  : Sign of value with tolerance of ScalarTraits (-1, 0, 1)
+***********************************************************************************/
+template<typename T, typename C>
+static inline int sign_eps(C cVal)
+{
+	const C cEps = ScalarTraits<T>::epsilon();
+
+	if ((cVal < 0 ? -cVal : cVal) <= cEps) return 0;
+	return (cVal < 0) ? -1 : 1;
+}
+
+/***********************************************************************************
+*! @brief  : Sum of ring terms in calc_type (area, orientation)
+*! @note   : Fixed point : two's complement 128 bits (hi, lo). Each term < 2^62
+*!           but a sum of n terms overflows int64
+***********************************************************************************/
+template<typename C>
+struct RingSum
+{
+	C	m_sum;
+
+	RingSum() : m_sum(0) {}
+
+	void	add(C cVal)		{ m_sum += cVal; }
+	int		sign() const	{ return (m_sum > 0) ? 1 : (m_sum < 0) ? -1 : 0; }
+	C		value() const	{ return m_sum; }
+};
+
+template<>
+struct RingSum<GFixed>
+{
+	int64_t		m_hi;
+	uint64_t	m_lo;
+
+	RingSum() : m_hi(0), m_lo(0) {}
+
+	void add(GFixed cVal)
+	{
+		const uint64_t lo = m_lo + static_cast<uint64_t>(cVal);
+
+		m_hi += ((cVal < 0) ? -1 : 0) + ((lo < m_lo) ? 1 : 0);
+		m_lo  = lo;
+	}
+
+	int sign() const
+	{
+		return (m_hi < 0) ? -1 : (m_hi > 0 || m_lo != 0) ? 1 : 0;
+	}
+
+	GFixed value() const
+	{
+		// Fits int64 : hi is the sign extension of lo
+		const GBool bFit = (m_hi == ((m_lo >> 63) ? -1 : 0)) ? GTrue : GFalse;
+
+		assert(bFit);
+
+		if (bFit == GFalse)
+			return (m_hi < 0) ? -INT64_MAX : INT64_MAX;
+
+		return static_cast<GFixed>(m_lo);
+	}
+};
+
+/***********************************************************************************
+*! @brief  : Turn of b to vector oa in wide_type (> 0 : left | < 0 : right)
+*! @note   : Float, double : exact sign when predicate is PRED_EXACT
+***********************************************************************************/
+template<typename P>
+static inline typename ScalarTraits<typename P::value_type>::wide_type turn_wide(const P& o, const P& a, const P& b)
+{
+	typedef typename P::value_type T;
+	typedef typename ScalarTraits<T>::wide_type W;
+
+	if (!ScalarTraits<T>::exact && get_predicate() == PRED_EXACT)
+		return W(orient2d(GDouble(o.x), GDouble(o.y), GDouble(a.x), GDouble(a.y), GDouble(b.x), GDouble(b.y)));
+
+	return cross_wide(o, a, b);
+}
+
+/***********************************************************************************
+*! @brief  : Use exact sign (fixed point or predicate is PRED_EXACT)
+***********************************************************************************/
+template<typename T>
+static inline GBool is_exact_mode()
+{
+	return (ScalarTraits<T>::exact || get_predicate() == PRED_EXACT) ? GTrue : GFalse;
+}
+
+/***********************************************************************************
+*! @brief  : Exact orientation of c to vector ab (fixed point is exact in double)
+***********************************************************************************/
+template<typename P>
+static inline GDouble orient_exact(const P& a, const P& b, const P& c)
+{
+	return orient2d(GDouble(a.x), GDouble(a.y), GDouble(b.x), GDouble(b.y), GDouble(c.x), GDouble(c.y));
+}
+
+/***********************************************************************************
+*! @brief  : Magnitude of vector (x, y) in real_type
+***********************************************************************************/
+template<typename R>
+static inline R mag_real(R rx, R ry)
+{
+	return std::sqrt(rx * rx + ry * ry);
+}
+
+/***********************************************************************************
+*! @brief  : Unit vector of (x, y) in real_type (zero vector -> zero vector)
+***********************************************************************************/
+template<typename R>
+static inline void normalize_real(R& rx, R& ry)
+{
+	R rMag = mag_real(rx, ry);
+
+	if (rMag <= 0)
+	{
+		rx = 0; ry = 0;
+		return;
+	}
+
+	rx = rx / rMag;
+	ry = ry / rMag;
+}
+
+/***********************************************************************************
+*! @brief  : Perpendicular projection of point onto line in real_type (not rounded)
+***********************************************************************************/
+template<typename P, typename R>
+static inline void project_line_real(const P& ptLine1, const P& ptLine2, const P& pt, R& rx, R& ry)
+{
+	const R rDx = R(ptLine2.x) - R(ptLine1.x);
+	const R rDy = R(ptLine2.y) - R(ptLine1.y);
+
+	R rDis = rDx * rDx + rDy * rDy;
+
+	if ((std::abs(rDis) <= R(ScalarTraits<typename P::value_type>::epsilon())) == false)
+	{
+		R rDet = (R(pt.x) - R(ptLine1.x)) * rDx + (R(pt.y) - R(ptLine1.y)) * rDy;
+
+		R t = rDet / rDis;
+		rx = R(ptLine1.x) + t * (R(ptLine2.x) - R(ptLine1.x));
+		ry = R(ptLine1.y) + t * (R(ptLine2.y) - R(ptLine1.y));
+	}
+	else
+	{
+		rx = R(pt.x); ry = R(pt.y); // case 3 points coincide
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Projection of point onto line segment in real_type (not rounded)
+*! @return : 1 : projection | 2 : nearly ptSeg1 | 3 : nearly ptSeg2 | 0 : none
+*!           (rx, ry : projection or the nearest end point)
+***********************************************************************************/
+template<typename P, typename R>
+static GInt project_lsegment_real(const P& ptSeg1, const P& ptSeg2, const P& pt, GBool bCheckNearest, R& rx, R& ry)
+{
+	const R rEps = R(ScalarTraits<typename P::value_type>::epsilon());
+
+	GInt iRet = 0;
+
+	project_line_real(ptSeg1, ptSeg2, pt, rx, ry);
+
+	// Point in side line Segment
+	R rDot1 = (R(ptSeg2.x) - R(ptSeg1.x)) * (rx - R(ptSeg1.x)) + (R(ptSeg2.y) - R(ptSeg1.y)) * (ry - R(ptSeg1.y));
+	R rDot2 = (R(ptSeg1.x) - R(ptSeg2.x)) * (rx - R(ptSeg2.x)) + (R(ptSeg1.y) - R(ptSeg2.y)) * (ry - R(ptSeg2.y));
+
+	if (rDot1 >= rEps && rDot2 >= rEps)
+	{
+		iRet = 1;
+	}
+	else if (bCheckNearest == GTrue)
+	{
+		R rDis1 = mag_real(R(ptSeg1.x) - rx, R(ptSeg1.y) - ry);
+		R rDis2 = mag_real(R(ptSeg2.x) - rx, R(ptSeg2.y) - ry);
+
+		iRet = (rDis1 <= rDis2) ? 2 : 3;
+	}
+
+	if (iRet == 2)
+	{
+		rx = R(ptSeg1.x); ry = R(ptSeg1.y);
+	}
+	else if (iRet == 3)
+	{
+		rx = R(ptSeg2.x); ry = R(ptSeg2.y);
+	}
+
+	return iRet;
+}
+
+/***********************************************************************************
+*! @brief  : Intersection of two lines or line segments (exact predicate)
+*! @param  : [in]  bSeg1  : pt1 pt2 is line segment
+*! @param  : [in]  bSeg2  : pt3 pt4 is line segment
+*! @param  : [out] pInter : intersection (double, rounded to T, not changed if not intersect)
+*! @return : TRUE : Intersect | FALSE : not intersect or parallel
+***********************************************************************************/
+template<typename P>
+static GBool intersect_2line_exact(const P& pt1, const P& pt2, const P& pt3, const P& pt4,
+								   GBool bSeg1, GBool bSeg2, P* pInter)
+{
+	typedef typename P::value_type T;
+
+	GDouble dx1 = GDouble(pt2.x) - GDouble(pt1.x), dy1 = GDouble(pt2.y) - GDouble(pt1.y);
+	GDouble dx2 = GDouble(pt4.x) - GDouble(pt3.x), dy2 = GDouble(pt4.y) - GDouble(pt3.y);
+
+	// Parallel test with the exact sign (fixed point coordinates are exact in double)
+	GDouble dDet = cross2d(GDouble(pt1.x), GDouble(pt1.y), GDouble(pt2.x), GDouble(pt2.y),
+						   GDouble(pt3.x), GDouble(pt3.y), GDouble(pt4.x), GDouble(pt4.y));
+
+	if (dDet == 0.0)
+		return GFalse;
+
+	// End points of segment are on the same side of the other line
+	if (bSeg1)
+	{
+		GDouble d1 = orient_exact(pt3, pt4, pt1);
+		GDouble d2 = orient_exact(pt3, pt4, pt2);
+
+		if ((d1 > 0.0 && d2 > 0.0) || (d1 < 0.0 && d2 < 0.0))
+			return GFalse;
+	}
+
+	if (bSeg2)
+	{
+		GDouble d3 = orient_exact(pt1, pt2, pt3);
+		GDouble d4 = orient_exact(pt1, pt2, pt4);
+
+		if ((d3 > 0.0 && d4 > 0.0) || (d3 < 0.0 && d4 < 0.0))
+			return GFalse;
+	}
+
+	if (pInter)
+	{
+		GDouble t = ((GDouble(pt3.x) - GDouble(pt1.x)) * dy2 - (GDouble(pt3.y) - GDouble(pt1.y)) * dx2) / dDet;
+
+		if (bSeg1)
+		{
+			t = std::min(std::max(t, 0.0), 1.0);
+		}
+
+		pInter->x = from_double<T>(GDouble(pt1.x) + t * dx1);
+		pInter->y = from_double<T>(GDouble(pt1.y) + t * dy1);
+	}
+
+	return GTrue;
+}
+
+/***********************************************************************************
+*! @brief  : Check polygon is counterclockwise
+*! @param  : [in] poly : ring points
+*! @param  : [in] nCnt : number of point
+*! @return : TRUE : is CCW | FALSE : CW
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+template<typename P>
+Dllexport GBool is_ccw(const P* poly, size_t nCnt)
+{
+	typedef typename ScalarTraits<typename P::value_type>::calc_type C;
+
+	int nPolyCnt = static_cast<int>(nCnt);
+
+	int nNext; RingSum<C> sum;
+
+	for (int i = 0; i < nPolyCnt; i++)
+	{
+		nNext = (i + 1) % nPolyCnt;
+		sum.add((C(poly[nNext].x) - C(poly[i].x)) * (C(poly[nNext].y) + C(poly[i].y)));
+	}
+
+	return (sum.sign() <= 0) ? GTrue : GFalse;
+}
+
+/***********************************************************************************
+*! @brief  : Check polygon is convex
+*! @param  : [in] poly : ring points
+*! @param  : [in] nCnt : number of point
+*! @return : TRUE : is convex | FALSE : no convex
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+template<typename P>
+Dllexport GBool is_convex_polygon(const P* poly, size_t nCnt)
+{
+	int nPolyCnt = static_cast<int>(nCnt);
+
+	if (nPolyCnt < 3)
+		return GFalse;
+
+	EnumOrien ePreOrien = EnumOrien::COLLINEAR;
+
+	for (int i = 0; i < nPolyCnt - 2; i++)
+	{
+		EnumOrien eCurOrien = orientation(poly[i], poly[i + 1], poly[i + 2]);
+
+		if (eCurOrien  != EnumOrien::COLLINEAR &&
+			(ePreOrien != EnumOrien::COLLINEAR && eCurOrien != ePreOrien))
+		{
+			return GFalse;
+		}
+
+		ePreOrien = eCurOrien;
+	}
+
+	return GTrue;
+}
+
+/***********************************************************************************
+*! @brief  : Check two point is the same
+*! @param  : [in] p1, p2 : point
+*! @param  : [in] tTol   : tolerance of each coordinate
+*! @return : TRUE : same | FALSE : not same
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+template<typename P>
+Dllexport GBool is_same(const P& p1, const P& p2, typename ScalarTraits<typename P::value_type>::real_type tTol)
+{
+	typedef typename ScalarTraits<typename P::value_type>::real_type R;
+
+	return (std::abs(R(p2.x) - R(p1.x)) <= tTol &&
+			std::abs(R(p2.y) - R(p1.y)) <= tTol) ? GTrue : GFalse;
+}
+
+/***********************************************************************************
+*! @brief  : Check two vector is the same direction (parallel, same sign)
+*! @param  : [in] v1, v2 : vector (not normal)
+*! @param  : [in] tTol   : tolerance of cross product of unit vectors
+*! @return : TRUE : same | FALSE : not same
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+template<typename P>
+Dllexport GBool is_same_direction(const P& v1, const P& v2, typename ScalarTraits<typename P::value_type>::real_type tTol)
+{
+	typedef typename ScalarTraits<typename P::value_type>::real_type R;
+
+	R rx1 = R(v1.x), ry1 = R(v1.y);
+	R rx2 = R(v2.x), ry2 = R(v2.y);
+
+	normalize_real(rx1, ry1);
+	normalize_real(rx2, ry2);
+
+	R rCrs = rx1 * ry2 - ry1 * rx2;
+
+	// Point in straight line
+	if (std::abs(rCrs) <= tTol)
+	{
+		return ((rx1 * rx2) >= 0 && (ry1 * ry2) >= 0) ? GTrue : GFalse;
+	}
+
+	return GFalse;
+}
+
+/***********************************************************************************
+*! @brief  : Check two vector have the same sign on x and y
+*! @param  : [in] v1, v2 : vector
+*! @return : TRUE : same sign | FALSE : not same
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+template<typename P>
+Dllexport GBool is_same_sign(const P& v1, const P& v2)
+{
+	typedef typename ScalarTraits<typename P::value_type>::calc_type C;
+
+	return ((C(v1.x) * C(v2.x)) >= 0 && (C(v1.y) * C(v2.y)) >= 0) ? GTrue : GFalse;
+}
+
+/***********************************************************************************
+*! @brief  : Relation of point and line segment
+*! @param  : [in] pt1, pt2 : line segment
+*! @param  : [in] pt       : point check
+*! @return : 0 : not in line segment | 1 : in line segment | 2 : same pt1 or pt2
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+template<typename P>
+Dllexport GInt rel_point_lsegment(const P& pt1, const P& pt2, const P& pt)
+{
+	typedef typename P::value_type T;
+	typedef typename ScalarTraits<T>::real_type R;
+
+	if (is_exact_mode<T>())
+	{
+		if (orient_exact(pt1, pt2, pt) != 0.0)
+			return 0;
+
+		if ((pt.x == pt1.x && pt.y == pt1.y) || (pt.x == pt2.x && pt.y == pt2.y))
+			return 2;
+
+		// Collinear : inside bounding box of line segment
+		if (pt.x < std::min(pt1.x, pt2.x) || pt.x > std::max(pt1.x, pt2.x) ||
+			pt.y < std::min(pt1.y, pt2.y) || pt.y > std::max(pt1.y, pt2.y))
+			return 0;
+
+		return 1;
+	}
+
+	const R rEps = R(ScalarTraits<T>::epsilon());
+
+	const R rx1 = R(pt.x) - R(pt1.x), ry1 = R(pt.y) - R(pt1.y);		// vector p1p
+	const R rx2 = R(pt2.x) - R(pt1.x), ry2 = R(pt2.y) - R(pt1.y);	// vector p1p2
+
+	R rCrs = rx1 * ry2 - ry1 * rx2;
+
+	// Is not in line segment
+	if ((std::abs(rCrs) <= rEps) == false)
+		return 0;
+
+	R rDot_p1p_p1p2 = rx2 * rx1 + ry2 * ry1;
+
+	// Same p1
+	if (rDot_p1p_p1p2 < 0)
+		return 0;
+	if (std::abs(rDot_p1p_p1p2) <= rEps)
+		return 2;
+
+	// Same p2
+	R rDot_p1p2_p1p2 = rx2 * rx2 + ry2 * ry2;
+
+	if (rDot_p1p_p1p2 > rDot_p1p2_p1p2)
+		return 0;
+	if (std::abs(rDot_p1p2_p1p2 - rDot_p1p_p1p2) <= rEps)
+		return 2;
+
+	return 1;
+}
+
+/***********************************************************************************
+*! @brief  : Check point on line segment (line segment = 2 point)
+*! @param  : [in] pt1, pt2 : line segment
+*! @param  : [in] pt       : point check
+*! @return : TRUE : inside | FALSE : outside
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+template<typename P>
+Dllexport GBool is_point_in_lsegment(const P& pt1, const P& pt2, const P& pt)
+{
+	typedef typename P::value_type T;
+	typedef typename ScalarTraits<T>::real_type R;
+
+	if (is_exact_mode<T>())
+	{
+		if (orient_exact(pt1, pt2, pt) != 0.0)
+			return GFalse;
+
+		return (pt.x >= std::min(pt1.x, pt2.x) && pt.x <= std::max(pt1.x, pt2.x) &&
+				pt.y >= std::min(pt1.y, pt2.y) && pt.y <= std::max(pt1.y, pt2.y)) ? GTrue : GFalse;
+	}
+
+	const R rx1 = R(pt.x) - R(pt1.x), ry1 = R(pt.y) - R(pt1.y);	// vector p1p
+	const R rx2 = R(pt.x) - R(pt2.x), ry2 = R(pt.y) - R(pt2.y);	// vector p2p
+
+	R rCrs = rx1 * ry2 - ry1 * rx2;
+
+	// Point in straight line
+	if (std::abs(rCrs) <= R(ScalarTraits<T>::epsilon()))
+	{
+		// Point in side line Segment
+		R rp1pDistance  = mag_real(rx1, ry1);
+		R rp2pDistance  = mag_real(rx2, ry2);
+		R rp1p2Distance = mag_real(R(pt1.x) - R(pt2.x), R(pt1.y) - R(pt2.y));
+
+		if (rp1pDistance <= rp1p2Distance &&
+			rp2pDistance <= rp1p2Distance)
+		{
+			return GTrue;
+		}
+	}
+
+	return GFalse;
+}
+
+/***********************************************************************************
+*! @brief  : Check point on line (line = 2 point)
+*! @param  : [in] pt1, pt2 : line
+*! @param  : [in] pt       : point check
+*! @return : TRUE : inside | FALSE : outside
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+template<typename P>
+Dllexport GBool is_point_in_line(const P& pt1, const P& pt2, const P& pt)
+{
+	typedef typename P::value_type T;
+	typedef typename ScalarTraits<T>::real_type R;
+
+	if (is_exact_mode<T>())
+	{
+		return (orient_exact(pt1, pt2, pt) == 0.0) ? GTrue : GFalse;
+	}
+
+	const R rx1 = R(pt.x) - R(pt1.x), ry1 = R(pt.y) - R(pt1.y);	// vector p1p
+	const R rx2 = R(pt.x) - R(pt2.x), ry2 = R(pt.y) - R(pt2.y);	// vector p2p
+
+	R rCrs = rx1 * ry2 - ry1 * rx2;
+
+	return (std::abs(rCrs) <= R(ScalarTraits<T>::epsilon())) ? GTrue : GFalse;
+}
+
+/***********************************************************************************
+*! @brief  : Check distance of point to line segment is not over snap
+*! @param  : [in] pt1, pt2 : line segment
+*! @param  : [in] pt       : point check
+*! @param  : [in] tSnap    : snap distance
+*! @return : TRUE : snap | FALSE : not snap
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+template<typename P>
+Dllexport GBool is_snap_point_to_lsegment(const P& pt1, const P& pt2, const P& pt,
+										  typename ScalarTraits<typename P::value_type>::real_type tSnap)
+{
+	typedef typename ScalarTraits<typename P::value_type>::real_type R;
+
+	R rx, ry;
+
+	if (project_lsegment_real(pt1, pt2, pt, GTrue, rx, ry) >= 1)
+	{
+		R rDisProj = mag_real(rx - R(pt.x), ry - R(pt.y));
+
+		return (rDisProj <= std::abs(tSnap)) ? GTrue : GFalse;
+	}
+
+	return GFalse;
+}
+
+/***********************************************************************************
+*! @brief  : Check distance of point to line is not over snap
+*! @param  : [in] pt1, pt2 : line
+*! @param  : [in] pt       : point check
+*! @param  : [in] tSnap    : snap distance
+*! @return : TRUE : snap | FALSE : not snap
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+template<typename P>
+Dllexport GBool is_snap_point_to_line(const P& pt1, const P& pt2, const P& pt,
+									  typename ScalarTraits<typename P::value_type>::real_type tSnap)
+{
+	typedef typename ScalarTraits<typename P::value_type>::real_type R;
+
+	R rx, ry;
+
+	project_line_real(pt1, pt2, pt, rx, ry);
+
+	R rDisProj = mag_real(rx - R(pt.x), ry - R(pt.y));
+
+	return (rDisProj <= std::abs(tSnap)) ? GTrue : GFalse;
+}
+
+/***********************************************************************************
+*! @brief  : Check point is in ray (ray : start point and direction)
+*! @param  : [in] pt  : start point of ray
+*! @param  : [in] vn  : direction of ray
+*! @param  : [in] ptc : point check
+*! @return : TRUE : in ray | FALSE : out ray
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+template<typename P>
+Dllexport GBool is_point_in_ray(const P& pt, const P& vn, const P& ptc)
+{
+	typedef typename ScalarTraits<typename P::value_type>::real_type R;
+
+	P pt2(pt.x + vn.x, pt.y + vn.y);
+
+	if (is_point_in_line(pt, pt2, ptc))
+	{
+		// unit vector ptpc
+		R rx = R(ptc.x) - R(pt.x), ry = R(ptc.y) - R(pt.y);
+
+		normalize_real(rx, ry);
+
+		return ((rx * R(vn.x)) >= 0 &&
+				(ry * R(vn.y)) >= 0) ? GTrue : GFalse;
+	}
+
+	return GFalse;
+}
+
+/***********************************************************************************
+*! @brief  : Perpendicular projection of point onto line (line = 2 point)
+*! @param  : [in] ptLine1, ptLine2 : line
+*! @param  : [in] pt               : point
+*! @return : projection (fixed point : rounded to the nearest grid point)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+template<typename P>
+Dllexport P get_projection_point_to_line(const P& ptLine1, const P& ptLine2, const P& pt)
+{
+	typedef typename P::value_type T;
+	typedef typename ScalarTraits<T>::real_type R;
+
+	R rx, ry;
+
+	project_line_real(ptLine1, ptLine2, pt, rx, ry);
+
+	return P(from_double<T>(rx), from_double<T>(ry));
+}
+
+/***********************************************************************************
+*! @brief  : Perpendicular projection of point onto line segment
+*! @param  : [in ] ptSeg1, ptSeg2 : line segment
+*! @param  : [in ] pt             : point
+*! @param  : [out] pptPerp        : projection, or nearest end point (can be NULL)
+*! @param  : [in ] bCheckNearest  : get nearest end point if no projection
+*! @return : 1 : projection | 2 : nearly ptSeg1 | 3 : nearly ptSeg2 | 0 : none
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+template<typename P>
+Dllexport GInt get_projection_point_to_lsegment(const P& ptSeg1, const P& ptSeg2, const P& pt,
+												P* pptPerp, GBool bCheckNearest)
+{
+	typedef typename P::value_type T;
+	typedef typename ScalarTraits<T>::real_type R;
+
+	R rx, ry;
+
+	GInt iRet = project_lsegment_real(ptSeg1, ptSeg2, pt, bCheckNearest, rx, ry);
+
+	if (pptPerp && iRet != 0)
+	{
+		*pptPerp = P(from_double<T>(rx), from_double<T>(ry));
+	}
+
+	return iRet;
+}
+
+/***********************************************************************************
+*! @brief  : Intersection of two lines (line = 2 point)
+*! @param  : [in ] pt1, pt2 : line 1
+*! @param  : [in ] pt3, pt4 : line 2
+*! @param  : [out] pInter   : intersection (max value of scalar if not intersect)
+*! @return : TRUE : Intersect | FALSE : parallel
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+template<typename P>
+Dllexport GBool intersect_2line(const P& pt1, const P& pt2, const P& pt3, const P& pt4, P* pInter)
+{
+	typedef typename P::value_type T;
+	typedef typename ScalarTraits<T>::real_type R;
+
+	P ptIntersect(std::numeric_limits<T>::max(), std::numeric_limits<T>::max());
+	GBool bInter = GFalse;
+
+	if (is_exact_mode<T>())
+	{
+		bInter = intersect_2line_exact(pt1, pt2, pt3, pt4, GFalse, GFalse, &ptIntersect);
+	}
+	else
+	{
+		// Equation of the first straight line  : ax + by = c
+		R ra = R(pt2.y) - R(pt1.y);
+		R rb = R(pt1.x) - R(pt2.x);
+		R rc = ra * R(pt1.x) + rb * R(pt1.y);
+
+		// Equation of the second straight line : a1x + b1y = c1
+		R ra1 = R(pt4.y) - R(pt3.y);
+		R rb1 = R(pt3.x) - R(pt4.x);
+		R rc1 = ra1 * R(pt3.x) + rb1 * R(pt3.y);
+
+		R rDet = ra * rb1 - rb * ra1;
+
+		// Check not parallel line
+		if ((std::abs(rDet) <= R(ScalarTraits<T>::epsilon())) == false)
+		{
+			ptIntersect.x = from_double<T>((rb1 * rc - rb * rc1) / rDet);
+			ptIntersect.y = from_double<T>((ra * rc1 - ra1 * rc) / rDet);
+
+			bInter = GTrue;
+		}
+	}
+
+	if (pInter)
+	{
+		*pInter = ptIntersect;
+	}
+
+	return bInter;
+}
+
+/***********************************************************************************
+*! @brief  : Checks if two line segments intersect and get intersection point
+*! @param  : [in ] pt1, pt2 : line segment 1
+*! @param  : [in ] pt3, pt4 : line segment 2
+*! @param  : [out] pInter   : intersection (not changed if not intersect)
+*! @return : TRUE : Intersect | FALSE : not intersect or parallel
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+template<typename P>
+Dllexport GBool intersect_2lsegment(const P& pt1, const P& pt2, const P& pt3, const P& pt4, P* pInter)
+{
+	typedef typename P::value_type T;
+
+	if (is_exact_mode<T>())
+	{
+		return intersect_2line_exact(pt1, pt2, pt3, pt4, GTrue, GTrue, pInter);
+	}
+
+	P ptIntersect;
+
+	GBool bInter = intersect_2line(pt1, pt2, pt3, pt4, &ptIntersect);
+
+	// Intersection of the lines is inside both line segments
+	if (bInter == GTrue)
+	{
+		bInter = (is_point_in_lsegment(pt1, pt2, ptIntersect) &&
+				  is_point_in_lsegment(pt3, pt4, ptIntersect)) ? GTrue : GFalse;
+	}
+
+	if (pInter && bInter)
+	{
+		*pInter = ptIntersect;
+	}
+
+	return bInter;
+}
+
+/***********************************************************************************
+*! @brief  : Intersection of line (2 point) and line segment
+*! @param  : [in ] ptLine1, ptLine2 : line
+*! @param  : [in ] ptSeg1, ptSeg2   : line segment
+*! @param  : [out] pInter           : intersection (not changed if not intersect)
+*! @return : TRUE : Intersect | FALSE : not intersect
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+template<typename P>
+Dllexport GBool intersect_line_lsegment(const P& ptLine1, const P& ptLine2, const P& ptSeg1, const P& ptSeg2, P* pInter)
+{
+	typedef typename P::value_type T;
+	typedef typename ScalarTraits<T>::real_type R;
+
+	if (is_exact_mode<T>())
+	{
+		return intersect_2line_exact(ptSeg1, ptSeg2, ptLine1, ptLine2, GTrue, GFalse, pInter);
+	}
+
+	P ptInter;
+
+	if (GTrue == intersect_2line(ptLine1, ptLine2, ptSeg1, ptSeg2, &ptInter))
+	{
+		// Check point inside line segment
+		R rp1pDistance  = mag_real(R(ptSeg1.x) - R(ptInter.x), R(ptSeg1.y) - R(ptInter.y));
+		R rp2pDistance  = mag_real(R(ptSeg2.x) - R(ptInter.x), R(ptSeg2.y) - R(ptInter.y));
+		R rp1p2Distance = mag_real(R(ptSeg1.x) - R(ptSeg2.x), R(ptSeg1.y) - R(ptSeg2.y));
+
+		if (rp1pDistance <= rp1p2Distance &&
+			rp2pDistance <= rp1p2Distance)
+		{
+			if (pInter)
+			{
+				*pInter = ptInter;
+			}
+			return GTrue;
+		}
+	}
+
+	return GFalse;
+}
+
+/***********************************************************************************
+*! @brief  : Intersection points of line (2 point) and polygon
+*! @param  : [in ] pt1, pt2   : line
+*! @param  : [in ] poly       : ring points
+*! @param  : [in ] nCnt       : number of point
+*! @param  : [out] vecInter   : intersection points (appended, can be NULL)
+*! @param  : [in ] bOnlyCheck : stop at the first intersection
+*! @return : number of intersection
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+template<typename P>
+Dllexport GInt intersect_line_polygon(const P& pt1, const P& pt2, const P* poly, size_t nCnt,
+									  std::vector<P>* vecInter, GBool bOnlyCheck)
+{
+	if (nCnt < 3)
+	{
+		assert(0);
+		return 0;
+	}
+
+	int nInter = 0;
+	int nPolyCount = static_cast<int>(nCnt);
+
+	P ptInter;
+	for (int j = 0, i = nPolyCount - 1; j < nPolyCount; i = j++)
+	{
+		if (intersect_line_lsegment(pt1, pt2, poly[i], poly[j], &ptInter) == GTrue)
+		{
+			nInter++;
+
+			if (vecInter)
+			{
+				vecInter->push_back(ptInter);
+			}
+
+			// Just intersect will return always.
+			if (GTrue == bOnlyCheck)
+			{
+				break;
+			}
+		}
+	}
+
+	return nInter;
+}
+
+/***********************************************************************************
+*! @brief  : Intersection points of line segment and polygon
+*! @param  : [in ] pt1, pt2   : line segment
+*! @param  : [in ] poly       : ring points
+*! @param  : [in ] nCnt       : number of point
+*! @param  : [out] vecInter   : intersection points (appended, can be NULL)
+*! @param  : [in ] bOnlyCheck : stop at the first intersection
+*! @return : number of intersection
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+template<typename P>
+Dllexport GInt intersect_lsegment_polygon(const P& pt1, const P& pt2, const P* poly, size_t nCnt,
+										  std::vector<P>* vecInter, GBool bOnlyCheck)
+{
+	typedef typename P::value_type T;
+
+	if (nCnt < 3)
+	{
+		assert(0);
+		return 0;
+	}
+
+	int nInter = 0;
+	int nPolyCount = static_cast<int>(nCnt);
+
+	// Bounding box of line segment (expand tolerance)
+	const T tEps  = ScalarTraits<T>::epsilon();
+	const T tMinX = std::min(pt1.x, pt2.x) - tEps;
+	const T tMaxX = std::max(pt1.x, pt2.x) + tEps;
+	const T tMinY = std::min(pt1.y, pt2.y) - tEps;
+	const T tMaxY = std::max(pt1.y, pt2.y) + tEps;
+
+	P ptInter;
+	for (int j = 0, i = nPolyCount - 1; j < nPolyCount; i = j++)
+	{
+		// Edge is outside the bounding box of line segment
+		if ((poly[i].x < tMinX && poly[j].x < tMinX) || (poly[i].x > tMaxX && poly[j].x > tMaxX) ||
+			(poly[i].y < tMinY && poly[j].y < tMinY) || (poly[i].y > tMaxY && poly[j].y > tMaxY))
+		{
+			continue;
+		}
+
+		if (intersect_2lsegment(pt1, pt2, poly[i], poly[j], &ptInter) == GTrue)
+		{
+			nInter++;
+
+			if (vecInter)
+			{
+				vecInter->push_back(ptInter);
+			}
+
+			// Just intersect will return always.
+			if (GTrue == bOnlyCheck)
+			{
+				break;
+			}
+		}
+	}
+
+	return nInter;
+}
+
+/***********************************************************************************
+*! @brief  : Signed area * 2 of polygon (> 0 : CCW)
+*! @param  : [in] poly : ring points
+*! @param  : [in] nCnt : number of point
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+template<typename P>
+Dllexport typename ScalarTraits<typename P::value_type>::calc_type get_area2_polygon(const P* poly, size_t nCnt)
+{
+	typedef typename ScalarTraits<typename P::value_type>::calc_type C;
+
+	RingSum<C> area;
+
+	int nPointCnts = static_cast<int>(nCnt);
+
+	if (nPointCnts <= 2)
+		return 0;
+
+	int j = nPointCnts - 1;
+
+	// (y[i] - y[j]) : positive for CCW ring, no negation of the sum
+	for (int i = 0; i < nPointCnts; i++)
+	{
+		area.add((C(poly[j].x) + C(poly[i].x)) * (C(poly[i].y) - C(poly[j].y)));
+		j = i;
+	}
+
+	return area.value();
+}
+
+/***********************************************************************************
+*! @brief  : Get bounding box of point list
+*! @param  : [in ] poly  : point list
+*! @param  : [in ] nCnt  : number of point
+*! @param  : [out] ptMin : min point
+*! @param  : [out] ptMax : max point
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+template<typename P>
+Dllexport void get_bounding_box(const P* poly, size_t nCnt, P& ptMin, P& ptMax)
+{
+	typedef typename P::value_type T;
+
+	T tMinX = std::numeric_limits<T>::max();
+	T tMinY = std::numeric_limits<T>::max();
+
+	T tMaxX = std::numeric_limits<T>::lowest();
+	T tMaxY = std::numeric_limits<T>::lowest();
+
+	int nPointCnt = static_cast<int>(nCnt);
+	for (int i = 0; i < nPointCnt; i++)
+	{
+		tMinX = std::min<T>(tMinX, poly[i].x);
+		tMinY = std::min<T>(tMinY, poly[i].y);
+		tMaxX = std::max<T>(tMaxX, poly[i].x);
+		tMaxY = std::max<T>(tMaxY, poly[i].y);
+	}
+
+	ptMin = P(tMinX, tMinY);
+	ptMax = P(tMaxX, tMaxY);
+}
+
+/***********************************************************************************
+*! @brief  : Check point inside polygon (crossing number)
+*! @param  : [in] pt   : point check
+*! @param  : [in] poly : ring points
+*! @param  : [in] nCnt : number of point
+*! @return : TRUE : inside | FALSE : outside
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+template<typename P>
+Dllexport GBool is_point_in_polygon(const P& pt, const P* poly, size_t nCnt)
+{
+	typedef typename P::value_type T;
+	typedef typename ScalarTraits<T>::wide_type W;
+
+	if (nCnt < 3)
+	{
+		assert(0);
+		return GFalse;
+	}
+
+	T tMinX = poly[0].x;
+	T tMaxX = poly[0].x;
+	T tMinY = poly[0].y;
+	T tMaxY = poly[0].y;
+
+	int nPolyCount = static_cast<int>(nCnt);
+
+	for (int i = 1; i < nPolyCount; i++)
+	{
+		tMinX = std::min<T>(poly[i].x, tMinX);
+		tMaxX = std::max<T>(poly[i].x, tMaxX);
+		tMinY = std::min<T>(poly[i].y, tMinY);
+		tMaxY = std::max<T>(poly[i].y, tMaxY);
+	}
+
+	if (pt.x < tMinX || pt.x > tMaxX || pt.y < tMinY || pt.y > tMaxY)
+		return GFalse;
+
+	const T tEps = ScalarTraits<T>::epsilon();
+
+	GBool bInside = GFalse;
+	for (int i = 0, j = nPolyCount - 1; i < nPolyCount; j = i++)
+	{
+		GBool bCross = GFalse;
+
+		if ((poly[i].y > pt.y) != (poly[j].y > pt.y))
+		{
+			if (ScalarTraits<T>::exact)
+			{
+				// pt.x < x at pt.y of edge : compare products, sign of dy is kept
+				W wDy  = W(poly[j].y) - W(poly[i].y);
+				W wLhs = (W(pt.x) - W(poly[i].x)) * wDy;
+				W wRhs = (W(poly[j].x) - W(poly[i].x)) * (W(pt.y) - W(poly[i].y));
+
+				bCross = (wDy > 0) ? (wLhs < wRhs) : (wLhs > wRhs);
+			}
+			else
+			{
+				bCross = pt.x < (poly[j].x - poly[i].x) * (pt.y - poly[i].y) / (poly[j].y - poly[i].y) + poly[i].x;
+			}
+		}
+
+		if (bCross)
+		{
+			bInside = !bInside;
+		}
+		// case inside edge and collinear
+		else if (std::abs(pt.y - poly[i].y) <= tEps &&
+				 std::abs(pt.y - poly[j].y) <= tEps)
+		{
+			if ((poly[i].x > pt.x) != (poly[j].x > pt.x))
+			{
+				return GTrue;
+			}
+		}
+	}
+
+	return bInside;
+}
+
+/***********************************************************************************
+*! @brief  : Clipping polygon use Sutherland-Hodgman algorithm
+*! @param  : [in ] poly    : polygon
+*! @param  : [in ] nCnt    : number of point
+*! @param  : [in ] clip    : convex clip polygon (CCW)
+*! @param  : [in ] nClip   : number of point of clip
+*! @param  : [out] vecOut  : clip polygon (replaced, CCW)
+*! @param  : [in ] vecWork : work buffer
+*! @return : number of point of clip polygon
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+template<typename P>
+Dllexport size_t clip_polygon_hodgman(const P* poly, size_t nCnt, const P* clip, size_t nClip,
+									  std::vector<P>& vecOut, std::vector<P>& vecWork)
+{
+	vecOut.assign(poly, poly + nCnt);
+
+	if (nCnt < 3 || nClip < 3)
+	{
+		assert(0);
+		vecOut.clear();
+		return 0;
+	}
+
+	// If polygon is not counterclockwise will recalculate
+	if (is_ccw(vecOut.data(), vecOut.size()) == GFalse)
+	{
+		std::reverse(vecOut.begin() + 1, vecOut.end());
+	}
+
+	return clip_ring_hodgman(clip, nClip, vecOut, vecWork);
+}
+
+/***********************************************************************************
+*! @brief  : Sutherland-Hodgman clipping of ring by all edges of convex polygon
+*! @param  : [in    ] clip    : convex clip polygon (CCW)
+*! @param  : [in    ] nClip   : number of point of clip
+*! @param  : [in,out] vecRing : ring (CCW) -> clip ring
+*! @param  : [in    ] vecWork : work buffer
+*! @return : number of point of clip ring
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+template<typename P, typename TVec>
+Dllexport size_t clip_ring_hodgman(const P* clip, size_t nClip, TVec& vecRing, TVec& vecWork)
+{
+	P ptInter;
+
+	for (size_t nEdge = 0; nEdge < nClip; nEdge++)
+	{
+		const P& ptSEdge = clip[nEdge];
+		const P& ptEEdge = clip[(nEdge + 1) % nClip];
+
+		std::swap(vecWork, vecRing);
+		vecRing.clear();
+
+		size_t nVertexCnt = vecWork.size();
+
+		for (size_t nVertex = 0; nVertex < nVertexCnt; nVertex++)
+		{
+			const P& ptCur  = vecWork[nVertex];
+			const P& ptNext = vecWork[(nVertex + 1) % nVertexCnt];
+
+			EnumOrien eRetOriCur  = orientation(ptSEdge, ptEEdge, ptCur);
+			EnumOrien eRetOriNext = orientation(ptSEdge, ptEEdge, ptNext);
+
+			if (eRetOriCur == EnumOrien::LEFT)
+			{
+				vecRing.push_back(ptCur);
+
+				if (eRetOriNext != EnumOrien::LEFT && intersect_2line_exact(ptCur, ptNext, ptSEdge, ptEEdge, GFalse, GFalse, &ptInter))
+				{
+					vecRing.push_back(ptInter);
+				}
+			}
+			else if (eRetOriNext == EnumOrien::LEFT)
+			{
+				if (intersect_2line_exact(ptCur, ptNext, ptSEdge, ptEEdge, GFalse, GFalse, &ptInter))
+				{
+					vecRing.push_back(ptInter);
+				}
+			}
+		}
+	}
+
+	return vecRing.size();
+}
+
+/***********************************************************************************
+*! @brief  : Convex hull use Andrew monotone chain algorithm
+*! @param  : [in ] pts     : point list
+*! @param  : [in ] nCnt    : number of point
+*! @param  : [out] vecHull : convex hull (replaced, CCW, start at leftmost point)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Turn test in wide_type (float, double : exact sign when predicate
+*!           is PRED_EXACT)
+***********************************************************************************/
+template<typename P>
+Dllexport void convex_hull_monotone(const P* pts, size_t nCnt, std::vector<P>& vecHull)
+{
+	vecHull.clear();
+
+	if (nCnt < 3)
+	{
+		vecHull.assign(pts, pts + nCnt);
+		return;
+	}
+
+	std::vector<P> vecPoints(pts, pts + nCnt);
+
+	std::sort(vecPoints.begin(), vecPoints.end(), [](const P& a, const P& b)
+	{
+		return (a.x < b.x) || (a.x == b.x && a.y < b.y);
+	});
+
+	int nPointCnt = static_cast<int>(nCnt);
+
+	vecHull.resize(nCnt * 2);
+
+	int k = 0;
+
+	// Lower hull
+	for (int i = 0; i < nPointCnt; i++)
+	{
+		while (k >= 2 && turn_wide(vecHull[k - 2], vecHull[k - 1], vecPoints[i]) <= 0) k--;
+		vecHull[k++] = vecPoints[i];
+	}
+
+	// Upper hull
+	for (int i = nPointCnt - 2, t = k + 1; i >= 0; i--)
+	{
+		while (k >= t && turn_wide(vecHull[k - 2], vecHull[k - 1], vecPoints[i]) <= 0) k--;
+		vecHull[k++] = vecPoints[i];
+	}
+
+	vecHull.resize(std::max(k - 1, 1));
+
+	// All points are the same
+	if (vecHull.size() == 2 && vecHull[0].x == vecHull[1].x && vecHull[0].y == vecHull[1].y)
+	{
+		vecHull.pop_back();
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+// Explicit instantiation : float (Point2D), double, fixed point int64
+
+#define X2D_KERNEL_INSTANTIATE(P)																			\
+	template Dllexport GBool is_ccw<P>(const P*, size_t);													\
+	template Dllexport GBool is_convex_polygon<P>(const P*, size_t);										\
+	template Dllexport GBool is_same<P>(const P&, const P&, ScalarTraits<P::value_type>::real_type);		\
+	template Dllexport GBool is_same_direction<P>(const P&, const P&, ScalarTraits<P::value_type>::real_type);\
+	template Dllexport GBool is_same_sign<P>(const P&, const P&);											\
+	template Dllexport GInt  rel_point_lsegment<P>(const P&, const P&, const P&);							\
+	template Dllexport GBool is_point_in_lsegment<P>(const P&, const P&, const P&);						\
+	template Dllexport GBool is_point_in_line<P>(const P&, const P&, const P&);							\
+	template Dllexport GBool is_snap_point_to_lsegment<P>(const P&, const P&, const P&,					\
+														  ScalarTraits<P::value_type>::real_type);			\
+	template Dllexport GBool is_snap_point_to_line<P>(const P&, const P&, const P&,						\
+													  ScalarTraits<P::value_type>::real_type);				\
+	template Dllexport GBool is_point_in_ray<P>(const P&, const P&, const P&);								\
+	template Dllexport P     get_projection_point_to_line<P>(const P&, const P&, const P&);					\
+	template Dllexport GInt  get_projection_point_to_lsegment<P>(const P&, const P&, const P&, P*, GBool);	\
+	template Dllexport GBool intersect_2line<P>(const P&, const P&, const P&, const P&, P*);				\
+	template Dllexport GBool intersect_2lsegment<P>(const P&, const P&, const P&, const P&, P*);			\
+	template Dllexport GBool intersect_line_lsegment<P>(const P&, const P&, const P&, const P&, P*);		\
+	template Dllexport GInt  intersect_line_polygon<P>(const P&, const P&, const P*, size_t,				\
+													   std::vector<P>*, GBool);								\
+	template Dllexport GInt  intersect_lsegment_polygon<P>(const P&, const P&, const P*, size_t,			\
+														   std::vector<P>*, GBool);							\
+	template Dllexport ScalarTraits<P::value_type>::calc_type get_area2_polygon<P>(const P*, size_t);		\
+	template Dllexport void get_bounding_box<P>(const P*, size_t, P&, P&);									\
+	template Dllexport GBool is_point_in_polygon<P>(const P&, const P*, size_t);							\
+	template Dllexport size_t clip_polygon_hodgman<P>(const P*, size_t, const P*, size_t,					\
+													  std::vector<P>&, std::vector<P>&);					\
+	template Dllexport size_t clip_ring_hodgman<P>(const P*, size_t, std::vector<P>&, std::vector<P>&);		\
+	template Dllexport void convex_hull_monotone<P>(const P*, size_t, std::vector<P>&);
+
+X2D_KERNEL_INSTANTIATE(Point2D)
+X2D_KERNEL_INSTANTIATE(Point2Dd)
+X2D_KERNEL_INSTANTIATE(Point2Dx)
+
+// Ring buffers of batch clipping (scratch memory)
+template Dllexport size_t clip_ring_hodgman<Point2D>(const Point2D*, size_t, ScratchVecPoint2D&, ScratchVecPoint2D&);
+
+}
+}}
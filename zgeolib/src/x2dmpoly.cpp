@@ -0,0 +1,153 @@
+#include "x2dmpoly.h"
+
+namespace geo { namespace v2 {
+
+MultiPolygon2D::MultiPolygon2D()
+{
+	m_vecRing.push_back(0);
+	m_vecPoly.push_back(0);
+}
+
+/***********************************************************************************
+*! @brief  : Remove all polygons (keep memory)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+void MultiPolygon2D::clear()
+{
+	m_vecPoint.clear();
+	m_vecRing.resize(1);
+	m_vecPoly.resize(1);
+}
+
+/***********************************************************************************
+*! @brief  : Reserve memory
+*! @param  : [in] nPoint : number of point
+*! @param  : [in] nRing  : number of ring
+*! @param  : [in] nPoly  : number of polygon
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+void MultiPolygon2D::reserve(size_t nPoint, size_t nRing, size_t nPoly)
+{
+	m_vecPoint.reserve(nPoint);
+	m_vecRing.reserve(nRing + 1);
+	m_vecPoly.reserve(nPoly + 1);
+}
+
+/***********************************************************************************
+*! @brief  : Start new polygon (next ring is outer ring)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+void MultiPolygon2D::begin_polygon()
+{
+	m_vecPoly.push_back(static_cast<uint32_t>(ring_count()));
+}
+
+/***********************************************************************************
+*! @brief  : Add ring to the current polygon (first ring : outer | other : hole)
+*! @param  : [in] pts  : ring points
+*! @param  : [in] nCnt : number of point
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+void MultiPolygon2D::add_ring(const Point2D* pts, size_t nCnt)
+{
+	if (poly_count() == 0)
+	{
+		begin_polygon();
+	}
+
+	m_vecPoint.insert(m_vecPoint.end(), pts, pts + nCnt);
+	m_vecRing.push_back(static_cast<uint32_t>(m_vecPoint.size()));
+	m_vecPoly.back() = static_cast<uint32_t>(ring_count());
+}
+
+void MultiPolygon2D::add_ring(const VecPoint2D& ring)
+{
+	add_ring(ring.data(), ring.size());
+}
+
+void MultiPolygon2D::add_ring(const RingView2D& ring)
+{
+	add_ring(ring.data(), ring.size());
+}
+
+/***********************************************************************************
+*! @brief  : Add polygon without hole
+*! @param  : [in] poly : outer ring
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+void MultiPolygon2D::add_polygon(const VecPoint2D& poly)
+{
+	begin_polygon();
+	add_ring(poly);
+}
+
+/***********************************************************************************
+*! @brief  : Add polygon with holes
+*! @param  : [in] rings : rings[0] : outer ring | other : holes
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+void MultiPolygon2D::add_polygon(const VecPolyList& rings)
+{
+	begin_polygon();
+
+	for (size_t i = 0; i < rings.size(); i++)
+	{
+		add_ring(rings[i]);
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Add each ring of list as polygon without hole
+*! @param  : [in] polys : polygon list
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+void MultiPolygon2D::add_polygons(const VecPolyList& polys)
+{
+	size_t nPointCnt = m_vecPoint.size();
+
+	for (size_t i = 0; i < polys.size(); i++)
+	{
+		nPointCnt += polys[i].size();
+	}
+
+	reserve(nPointCnt, ring_count() + polys.size(), poly_count() + polys.size());
+
+	for (size_t i = 0; i < polys.size(); i++)
+	{
+		add_polygon(polys[i]);
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Add all polygons of other multipolygon (same order)
+*! @param  : [in] mpoly : multipolygon
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+void MultiPolygon2D::append(const MultiPolygon2D& mpoly)
+{
+	if (&mpoly == this || mpoly.empty())
+	{
+		_ASSERT(&mpoly != this);
+		return;
+	}
+
+	uint32_t nPointBase = static_cast<uint32_t>(m_vecPoint.size());
+	uint32_t nRingBase  = static_cast<uint32_t>(ring_count());
+
+	m_vecPoint.insert(m_vecPoint.end(), mpoly.m_vecPoint.begin(), mpoly.m_vecPoint.end());
+
+	m_vecRing.reserve(m_vecRing.size() + mpoly.ring_count());
+	m_vecPoly.reserve(m_vecPoly.size() + mpoly.poly_count());
+
+	for (size_t r = 1; r < mpoly.m_vecRing.size(); r++)
+	{
+		m_vecRing.push_back(nPointBase + mpoly.m_vecRing[r]);
+	}
+
+	for (size_t p = 1; p < mpoly.m_vecPoly.size(); p++)
+	{
+		m_vecPoly.push_back(nRingBase + mpoly.m_vecPoly[p]);
+	}
+}
+
+}}
@@ -0,0 +1,479 @@
+#include "x2doffset.h"
+#include "x2dbool.h"
+
+#include <cmath>
+#include <algorithm>
+
+namespace geo { namespace v2 {
+
+static const GDouble OFFSET_PI = 3.14159265358979323846;
+
+PolygonOffset2D::PolygonOffset2D(GFloat fMiterLimit, GFloat fArcTol, GeoScratch* pScratch) :
+	m_vecPath(ScratchAllocator<OffsetPath>(pScratch)), m_vecInput(ScratchAllocator<Point2D>(pScratch)),
+	m_vecClean(ScratchAllocator<Point2D>(pScratch)), m_vecNormal(ScratchAllocator<GDouble>(pScratch)),
+	m_vecRing(ScratchAllocator<Point2D>(pScratch)),
+	m_fMiterLimit(fMiterLimit), m_fArcTol(fArcTol), m_dArcTol(0.0), m_dStepPerRad(0.0), m_dMiterLim(0.5)
+{
+
+}
+
+/***********************************************************************************
+*! @brief  : Add path
+*! @param  : [in] pts   : points (copied, closing point not repeated)
+*! @param  : [in] nCnt  : number of point
+*! @param  : [in] eJoin : join type
+*! @param  : [in] eEnd  : end type (END_POLYGON : ring is oriented CCW)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+void PolygonOffset2D::add_path(const Point2D* pts, size_t nCnt, EnumJoinType eJoin, EnumEndType eEnd)
+{
+	if (nCnt == 0)
+		return;
+
+	m_vecPath.push_back(OffsetPath{ uint32_t(m_vecInput.size()), uint32_t(nCnt), eJoin, eEnd, GFalse });
+	m_vecInput.insert(m_vecInput.end(), pts, pts + nCnt);
+}
+
+void PolygonOffset2D::add_path(const VecPoint2D& path, EnumJoinType eJoin, EnumEndType eEnd)
+{
+	add_path(path.data(), path.size(), eJoin, eEnd);
+}
+
+/***********************************************************************************
+*! @brief  : Add all rings of multipolygon
+*! @param  : [in] mpoly : polygons (outer ring + holes) or paths
+*! @param  : [in] eJoin : join type
+*! @param  : [in] eEnd  : end type
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : END_POLYGON : first ring of polygon is oriented CCW, other rings
+*!           CW (input orientation is not used)
+***********************************************************************************/
+void PolygonOffset2D::add_paths(const MultiPolygon2D& mpoly, EnumJoinType eJoin, EnumEndType eEnd)
+{
+	m_vecPath.reserve(m_vecPath.size() + mpoly.ring_count());
+	m_vecInput.reserve(m_vecInput.size() + mpoly.point_count());
+
+	for (size_t p = 0; p < mpoly.poly_count(); p++)
+	{
+		for (size_t r = mpoly.poly_ring_begin(p); r < mpoly.poly_ring_end(p); r++)
+		{
+			const size_t nCnt = mpoly.ring_size(r);
+
+			if (nCnt == 0)
+				continue;
+
+			GBool bHole = (eEnd == END_POLYGON && r != mpoly.poly_ring_begin(p)) ? GTrue : GFalse;
+
+			m_vecPath.push_back(OffsetPath{ uint32_t(m_vecInput.size()), uint32_t(nCnt), eJoin, eEnd, bHole });
+			m_vecInput.insert(m_vecInput.end(), mpoly.ring_data(r), mpoly.ring_data(r) + nCnt);
+		}
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Offset all paths
+*! @param  : [in ] fDelta : offset (polygon : > 0 grow | < 0 shrink, open and
+*!                          joined path : |fDelta| is used)
+*! @param  : [out] result : result polygons (outer ring CCW, hole CW)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Paths are kept (execute can be called again with other delta).
+*!           fDelta == 0 : polygons are only cleaned (union)
+***********************************************************************************/
+void PolygonOffset2D::execute(GFloat fDelta, MultiPolygon2D& result)
+{
+	m_mpolyRaw.clear();
+
+	const GDouble dDelta = GDouble(fDelta);
+	const GDouble dAbs   = std::fabs(dDelta);
+
+	// Round : chord of step angle a is at most m_dArcTol from arc -> |d| * (1 - cos(a / 2)) = tol
+	m_dArcTol = (m_fArcTol > 0.f) ? GDouble(m_fArcTol) : dAbs / 200.0;
+
+	if (dAbs > 0.0)
+	{
+		GDouble dRatio = std::min(m_dArcTol / dAbs, 1.0);
+		GDouble dStep  = std::max(2.0 * std::acos(1.0 - dRatio), 2.0 * OFFSET_PI / 4096.0);
+
+		m_dStepPerRad = 1.0 / dStep;
+	}
+
+	// Miter length = |d| / cos(a / 2) <= limit * |d|  <=>  1 + cos(a) >= 2 / limit^2
+	GDouble dLimit = std::max(GDouble(m_fMiterLimit), 1.0);
+	m_dMiterLim = 2.0 / (dLimit * dLimit);
+
+	for (const OffsetPath& path : m_vecPath)
+	{
+		size_t nCnt = clean_path(path);
+
+		switch (path.m_eEnd)
+		{
+		case END_POLYGON:
+			if (nCnt < 3)
+				break;
+
+			if (dAbs == 0.0)
+			{
+				m_vecRing.assign(m_vecClean.begin(), m_vecClean.begin() + nCnt);
+				add_raw_ring();
+			}
+			else
+			{
+				offset_closed(nCnt, path.m_eJoin, dDelta);
+			}
+			break;
+		case END_JOINED:
+			if (dAbs == 0.0)
+				break;
+
+			if (nCnt < 3)
+			{
+				offset_open(nCnt, path.m_eJoin, END_BUTT, dAbs);
+				break;
+			}
+
+			// Outer side (+1) and inner side (-1) of the band, whatever the orientation
+			offset_closed(nCnt, path.m_eJoin, dAbs);
+			std::reverse(m_vecClean.begin(), m_vecClean.begin() + nCnt);
+			offset_closed(nCnt, path.m_eJoin, dAbs);
+			break;
+		default:
+			if (dAbs == 0.0)
+				break;
+
+			offset_open(nCnt, path.m_eJoin, path.m_eEnd, dAbs);
+			break;
+		}
+	}
+
+	union_polygon(m_mpolyRaw, FILL_POSITIVE, result);
+}
+
+/***********************************************************************************
+*! @brief  : Remove all paths
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+void PolygonOffset2D::clear()
+{
+	m_vecPath.clear();
+	m_vecInput.clear();
+	m_mpolyRaw.clear();
+}
+
+/***********************************************************************************
+*! @brief  : Copy path to m_vecClean without consecutive duplicate point
+*! @return : number of point (polygon : oriented, closing duplicate removed)
+***********************************************************************************/
+size_t PolygonOffset2D::clean_path(const OffsetPath& path)
+{
+	const Point2D* pts = m_vecInput.data() + path.m_nBegin;
+
+	m_vecClean.clear();
+	m_vecClean.reserve(path.m_nCnt);
+
+	for (uint32_t i = 0; i < path.m_nCnt; i++)
+	{
+		if (m_vecClean.empty() || m_vecClean.back().x != pts[i].x || m_vecClean.back().y != pts[i].y)
+			m_vecClean.push_back(pts[i]);
+	}
+
+	const GBool bClosed = (path.m_eEnd == END_POLYGON || path.m_eEnd == END_JOINED) ? GTrue : GFalse;
+
+	while (bClosed && m_vecClean.size() > 1 && m_vecClean.back().x == m_vecClean.front().x &&
+											   m_vecClean.back().y == m_vecClean.front().y)
+	{
+		m_vecClean.pop_back();
+	}
+
+	const size_t nCnt = m_vecClean.size();
+
+	if (path.m_eEnd == END_POLYGON && nCnt >= 3)
+	{
+		GDouble dArea = 0.0;
+
+		for (size_t i = 0, j = nCnt - 1; i < nCnt; j = i++)
+		{
+			dArea += (GDouble(m_vecClean[j].x) - m_vecClean[i].x) * (GDouble(m_vecClean[j].y) + m_vecClean[i].y);
+		}
+
+		// dArea > 0 : CCW
+		if (dArea != 0.0 && (dArea < 0.0) != (path.m_bHole == GTrue))
+			std::reverse(m_vecClean.begin(), m_vecClean.end());
+	}
+
+	return nCnt;
+}
+
+/***********************************************************************************
+*! @brief  : Unit normal of edges of m_vecClean (right side : (dy, -dx))
+*! @note   : Right side of CCW ring is outside
+***********************************************************************************/
+void PolygonOffset2D::build_normals(size_t nCnt, GBool bClosed)
+{
+	const size_t nEdge = bClosed ? nCnt : nCnt - 1;
+
+	m_vecNormal.resize(nEdge * 2);
+
+	for (size_t i = 0; i < nEdge; i++)
+	{
+		const Point2D& pt1 = m_vecClean[i];
+		const Point2D& pt2 = m_vecClean[(i + 1) % nCnt];
+
+		GDouble dx = GDouble(pt2.x) - pt1.x, dy = GDouble(pt2.y) - pt1.y;
+		GDouble dLen = std::sqrt(dx * dx + dy * dy);
+
+		m_vecNormal[i * 2    ] =  dy / dLen;
+		m_vecNormal[i * 2 + 1] = -dx / dLen;
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Raw ring of closed path m_vecClean (offset on right side by dDelta)
+***********************************************************************************/
+void PolygonOffset2D::offset_closed(size_t nCnt, EnumJoinType eJoin, GDouble dDelta)
+{
+	build_normals(nCnt, GTrue);
+
+	m_vecRing.clear();
+
+	for (size_t i = 0; i < nCnt; i++)
+	{
+		add_join(m_vecClean[i], (i + nCnt - 1) % nCnt, i, 1.0, eJoin, dDelta);
+	}
+
+	add_raw_ring();
+}
+
+/***********************************************************************************
+*! @brief  : Raw ring of open path m_vecClean (right side forward, cap, left side
+*!           backward, cap : CCW)
+***********************************************************************************/
+void PolygonOffset2D::offset_open(size_t nCnt, EnumJoinType eJoin, EnumEndType eEnd, GDouble dDelta)
+{
+	if (nCnt == 0)
+		return;
+
+	if (nCnt == 1)
+	{
+		offset_point(m_vecClean[0], eEnd, dDelta);
+		return;
+	}
+
+	build_normals(nCnt, GFalse);
+
+	m_vecRing.clear();
+
+	add_cap(m_vecClean[0], 0, -1.0, eEnd, dDelta);
+
+	for (size_t i = 1; i + 1 < nCnt; i++)
+	{
+		add_join(m_vecClean[i], i - 1, i, 1.0, eJoin, dDelta);
+	}
+
+	add_cap(m_vecClean[nCnt - 1], nCnt - 2, 1.0, eEnd, dDelta);
+
+	for (size_t i = nCnt - 2; i >= 1; i--)
+	{
+		add_join(m_vecClean[i], i, i - 1, -1.0, eJoin, dDelta);
+	}
+
+	add_raw_ring();
+}
+
+/***********************************************************************************
+*! @brief  : Raw ring of single point path (END_ROUND : circle | END_SQUARE : square)
+***********************************************************************************/
+void PolygonOffset2D::offset_point(const Point2D& pt, EnumEndType eEnd, GDouble dDelta)
+{
+	m_vecRing.clear();
+
+	if (eEnd == END_ROUND)
+	{
+		add_arc(pt, 1.0, 0.0, 2.0 * OFFSET_PI, dDelta);
+		m_vecRing.pop_back();	// same as first point
+	}
+	else if (eEnd == END_SQUARE)
+	{
+		m_vecRing.push_back(Point2D(GFloat(pt.x - dDelta), GFloat(pt.y - dDelta)));
+		m_vecRing.push_back(Point2D(GFloat(pt.x + dDelta), GFloat(pt.y - dDelta)));
+		m_vecRing.push_back(Point2D(GFloat(pt.x + dDelta), GFloat(pt.y + dDelta)));
+		m_vecRing.push_back(Point2D(GFloat(pt.x - dDelta), GFloat(pt.y + dDelta)));
+	}
+
+	add_raw_ring();
+}
+
+/***********************************************************************************
+*! @brief  : Offset points at vertex pt between edge nPrev and edge nCur
+*! @param  : [in] dSign : -1 : path is walked backward (normals are reversed)
+*! @note   : Concave corner : pt itself is added, the small reversed loop is removed
+*!           by the positive fill rule of union
+***********************************************************************************/
+void PolygonOffset2D::add_join(const Point2D& pt, size_t nPrev, size_t nCur, GDouble dSign, EnumJoinType eJoin, GDouble dDelta)
+{
+	const GDouble n1x = dSign * m_vecNormal[nPrev * 2], n1y = dSign * m_vecNormal[nPrev * 2 + 1];
+	const GDouble n2x = dSign * m_vecNormal[nCur  * 2], n2y = dSign * m_vecNormal[nCur  * 2 + 1];
+
+	GDouble dSin = std::max(-1.0, std::min(1.0, n1x * n2y - n2x * n1y));
+	GDouble dCos = n1x * n2x + n1y * n2y;
+
+	// Edge turns back (spike) : convex on the offset side
+	if (dCos < 0.0 && std::fabs(dSin) < 1e-12)
+		dSin = (dDelta > 0.0) ? 0.0 : -0.0;
+
+	auto funAdd = [&](GDouble x, GDouble y)
+	{
+		m_vecRing.push_back(Point2D(GFloat(pt.x + x * dDelta), GFloat(pt.y + y * dDelta)));
+	};
+
+	// Nearly collinear : offset points of both edges are within tolerance
+	if (dCos > 0.0 && std::fabs(dSin * dDelta) < m_dArcTol)
+	{
+		funAdd(n2x, n2y);
+		return;
+	}
+
+	if (dSin * dDelta < 0.0)
+	{
+		funAdd(n1x, n1y);
+		m_vecRing.push_back(pt);
+		funAdd(n2x, n2y);
+		return;
+	}
+
+	if (eJoin == JOIN_MITER && 1.0 + dCos >= m_dMiterLim)
+	{
+		GDouble q = 1.0 / (1.0 + dCos);
+		funAdd((n1x + n2x) * q, (n1y + n2y) * q);
+	}
+	else if (eJoin == JOIN_ROUND)
+	{
+		add_arc(pt, n1x, n1y, std::atan2(dSin, dCos), dDelta);
+	}
+	else
+	{
+		// Square : cut line at distance |dDelta| from pt, perpendicular to bisector
+		GDouble t = std::tan(std::atan2(dSin, dCos) / 4.0);
+
+		funAdd(n1x - n1y * t, n1y + n1x * t);
+		funAdd(n2x + n2y * t, n2y - n2x * t);
+	}
+}
+
+/***********************************************************************************
+*! @brief  : End of open path at pt (normal of edge nEdge times dSign : from this
+*!           side to the other side)
+***********************************************************************************/
+void PolygonOffset2D::add_cap(const Point2D& pt, size_t nEdge, GDouble dSign, EnumEndType eEnd, GDouble dDelta)
+{
+	const GDouble nx = dSign * m_vecNormal[nEdge * 2], ny = dSign * m_vecNormal[nEdge * 2 + 1];
+	const GDouble tx = -ny, ty = nx;	// walk direction
+
+	switch (eEnd)
+	{
+	case END_ROUND:
+		add_arc(pt, nx, ny, OFFSET_PI, dDelta);
+		break;
+	case END_SQUARE:
+		m_vecRing.push_back(Point2D(GFloat(pt.x + (nx + tx) * dDelta), GFloat(pt.y + (ny + ty) * dDelta)));
+		m_vecRing.push_back(Point2D(GFloat(pt.x + (tx - nx) * dDelta), GFloat(pt.y + (ty - ny) * dDelta)));
+		break;
+	default:
+		m_vecRing.push_back(Point2D(GFloat(pt.x + nx * dDelta), GFloat(pt.y + ny * dDelta)));
+		m_vecRing.push_back(Point2D(GFloat(pt.x - nx * dDelta), GFloat(pt.y - ny * dDelta)));
+		break;
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Arc around pt from direction (nx, ny) turning dAngle (first and last
+*!           point included)
+***********************************************************************************/
+void PolygonOffset2D::add_arc(const Point2D& pt, GDouble nx, GDouble ny, GDouble dAngle, GDouble dDelta)
+{
+	const GInt nStep = std::max(1, GInt(std::ceil(std::fabs(dAngle) * m_dStepPerRad)));
+
+	const GDouble dStep = dAngle / nStep;
+	const GDouble c = std::cos(dStep), s = std::sin(dStep);
+
+	GDouble x = nx, y = ny;
+
+	for (GInt k = 0; k <= nStep; k++)
+	{
+		m_vecRing.push_back(Point2D(GFloat(pt.x + x * dDelta), GFloat(pt.y + y * dDelta)));
+
+		GDouble xr = x * c - y * s;
+		y = x * s + y * c;
+		x = xr;
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Move m_vecRing to raw rings (one polygon per ring)
+***********************************************************************************/
+void PolygonOffset2D::add_raw_ring()
+{
+	if (m_vecRing.size() < 3)
+		return;
+
+	m_mpolyRaw.begin_polygon();
+	m_mpolyRaw.add_ring(m_vecRing.data(), m_vecRing.size());
+}
+
+/***********************************************************************************
+*! @brief  : Offset of multipolygon
+*! @param  : [in ] mpoly       : polygons (outer ring + holes)
+*! @param  : [in ] fDelta      : offset (> 0 grow | < 0 shrink)
+*! @param  : [in ] eJoin       : join type
+*! @param  : [out] result      : result polygons (outer ring CCW, hole CW)
+*! @param  : [in ] fMiterLimit : max miter length / |fDelta| (JOIN_MITER)
+*! @param  : [in ] fArcTol     : max distance of round join to true arc
+*!                               (<= 0 : |fDelta| / 200)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Unlike infact_polygon, result has no self-intersection (concave
+*!           corners, near parallel edges, parts that vanish or merge)
+***********************************************************************************/
+Dllexport void offset_polygon(const MultiPolygon2D& mpoly, GFloat fDelta, EnumJoinType eJoin, MultiPolygon2D& result,
+							  GFloat fMiterLimit, GFloat fArcTol)
+{
+	PolygonOffset2D offset(fMiterLimit, fArcTol);
+	offset.add_paths(mpoly, eJoin, END_POLYGON);
+	offset.execute(fDelta, result);
+}
+
+Dllexport void offset_polygon(const MultiPolygon2D& mpoly, GFloat fDelta, EnumJoinType eJoin, MultiPolygon2D& result,
+							  GeoScratch& scratch, GFloat fMiterLimit, GFloat fArcTol)
+{
+	GeoScratchFrame frame(scratch);
+
+	PolygonOffset2D offset(fMiterLimit, fArcTol, &scratch);
+	offset.add_paths(mpoly, eJoin, END_POLYGON);
+	offset.execute(fDelta, result);
+}
+
+/***********************************************************************************
+*! @brief  : Buffer of open polylines
+*! @param  : [in ] vecLines    : polylines
+*! @param  : [in ] fDelta      : half width of buffer (> 0)
+*! @param  : [in ] eJoin       : join type
+*! @param  : [in ] eEnd        : end type (END_BUTT | END_SQUARE | END_ROUND)
+*! @param  : [out] result      : result polygons (outer ring CCW, hole CW)
+*! @param  : [in ] fMiterLimit : max miter length / fDelta (JOIN_MITER)
+*! @param  : [in ] fArcTol     : max distance of round join to true arc
+*!                               (<= 0 : fDelta / 200)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : All lines are merged (crossing lines give one polygon)
+***********************************************************************************/
+Dllexport void offset_polyline(const VecPolyList& vecLines, GFloat fDelta, EnumJoinType eJoin, EnumEndType eEnd,
+							   MultiPolygon2D& result, GFloat fMiterLimit, GFloat fArcTol)
+{
+	PolygonOffset2D offset(fMiterLimit, fArcTol);
+
+	for (const VecPoint2D& line : vecLines)
+	{
+		offset.add_path(line, eJoin, eEnd);
+	}
+
+	offset.execute(fDelta, result);
+}
+
+}}
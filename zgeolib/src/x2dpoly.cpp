@@ -3,22 +3,54 @@
 #include <cassert>
 #include "x2drel.h"
 #include "xgeosp.h"
+#include "x2dsweep.h"
+#include "x2dkernel.h"
 
 namespace geo {	namespace v2 {
 
+/***********************************************************************************
+*! @brief  : Reverse ring in place (first point is kept)
+***********************************************************************************/
+static void reverse_ring(Point2D* poly, int nPolyCnt)
+{
+	int nHalf = (nPolyCnt - 1) / 2;
+
+	for (int i = 1; i <= nHalf; i++)
+	{
+		std::swap(poly[i], poly[nPolyCnt - i]);
+	}
+}
+
 /***********************************************************************************
 @brief		Reverse polygon cw -> ccw | ccw -> cw
 @param		[in] poly : polygon
 ***********************************************************************************/
 Dllexport void reverse_polygon(VecPoint2D& poly)
 {
-	int nPolyCnt = static_cast<int>(poly.size());
+	reverse_ring(poly.data(), static_cast<int>(poly.size()));
+}
 
-	int nHalf = (nPolyCnt - 1) / 2;
+/***********************************************************************************
+*! @brief  : Reverse ring in place (first point is kept)
+*! @param  : [in] poly : ring points
+*! @param  : [in] nCnt : number of point
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+Dllexport void reverse_polygon(Point2D* poly, size_t nCnt)
+{
+	reverse_ring(poly, static_cast<int>(nCnt));
+}
 
-	for (int i = 1; i <= nHalf; i++)
+/***********************************************************************************
+*! @brief  : Reverse all rings of multipolygon (in place)
+*! @param  : [in] mpoly : multipolygon
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+Dllexport void reverse_polygon(MultiPolygon2D& mpoly)
+{
+	for (size_t r = 0; r < mpoly.ring_count(); r++)
 	{
-		std::swap(poly[i], poly[nPolyCnt - i]);
+		reverse_ring(mpoly.ring_data(r), static_cast<int>(mpoly.ring_size(r)));
 	}
 }
 
@@ -72,15 +104,10 @@ Dllexport VecPoint2D infact_polygon(const VecPoint2D& poly, const GFloat& fOffse
 }
 
 /***********************************************************************************
-*! @brief  : Inflat polygon certain distance (no copy)
-*! @param  : [in ] poly    : poly inflat (CCW)
-*! @param  : [out] fOffset : distance away from center
-*! @return : VecPoint2D polygon after inflating
-*! @author : thuong.nv			- [Date] : 08/28/2023
+*! @brief  : Inflat ring certain distance (in place)
 ***********************************************************************************/
-Dllexport void infact_polygonx(VecPoint2D& poly, const GFloat& fOffset)
+static void infact_ring(Point2D* poly, int nPolyCnt, const GFloat& fOffset)
 {
-	int nPolyCnt = static_cast<int>(poly.size());
 	int nPre = 0;
 
 	Line2D lnTemp;
@@ -98,7 +125,6 @@ Dllexport void infact_polygonx(VecPoint2D& poly, const GFloat& fOffset)
 		vecLineInflat.push_back(lnTemp);
 	}
 
-	VecPoint2D vecInflatPoly; vecInflatPoly.reserve(nPolyCnt);
 	Point2D ptInter;
 	int nLineCnt = static_cast<int>(vecLineInflat.size());
 
@@ -118,6 +144,32 @@ Dllexport void infact_polygonx(VecPoint2D& poly, const GFloat& fOffset)
 	}
 }
 
+/***********************************************************************************
+*! @brief  : Inflat polygon certain distance (no copy)
+*! @param  : [in ] poly    : poly inflat (CCW)
+*! @param  : [out] fOffset : distance away from center
+*! @return : VecPoint2D polygon after inflating
+*! @author : thuong.nv			- [Date] : 08/28/2023
+***********************************************************************************/
+Dllexport void infact_polygonx(VecPoint2D& poly, const GFloat& fOffset)
+{
+	infact_ring(poly.data(), static_cast<int>(poly.size()), fOffset);
+}
+
+/***********************************************************************************
+*! @brief  : Inflat all rings of multipolygon certain distance (no copy)
+*! @param  : [in] mpoly   : multipolygon (outer ring CCW, holes CW)
+*! @param  : [in] fOffset : distance away from center
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+Dllexport void infact_polygonx(MultiPolygon2D& mpoly, const GFloat& fOffset)
+{
+	for (size_t r = 0; r < mpoly.ring_count(); r++)
+	{
+		infact_ring(mpoly.ring_data(r), static_cast<int>(mpoly.ring_size(r)), fOffset);
+	}
+}
+
 /***********************************************************************************
 *! @brief  : Area of a polygon with given n ordered vertices
 *! @param  : [in] points : list point polygon
@@ -127,26 +179,44 @@ Dllexport void infact_polygonx(VecPoint2D& poly, const GFloat& fOffset)
 ***********************************************************************************/
 Dllexport GFloat get_area_polygon(const VecPoint2D& points)
 {
-	GFloat fArea = 0.f;
-
-	int nPointCnts = static_cast<int>(points.size());
+	return get_area_polygon(RingView2D(points));
+}
 
-	if (nPointCnts <= 2)
+Dllexport GFloat get_area_polygon(const RingView2D& points)
+{
+	if (points.size() <= 2)
 	{
 		assert(0);
 		return 0.f;
 	}
 
-	int j = nPointCnts - 1;
+	// Return absolute value
+	return fabsf(kernel::get_area2_polygon(points.data(), points.size()) / 2.f);
+}
 
-	for (int i = 0; i < nPointCnts; i++)
+/***********************************************************************************
+*! @brief  : Area of multipolygon (outer rings minus holes)
+*! @param  : [in] mpoly : multipolygon
+*! @return : float : area
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+Dllexport GFloat get_area_polygon(const MultiPolygon2D& mpoly)
+{
+	GFloat fArea = 0.f;
+
+	for (size_t p = 0; p < mpoly.poly_count(); p++)
 	{
-		fArea += (points[j].x + points[i].x) * (points[j].y - points[i].y);
-		j = i;
+		for (size_t r = mpoly.poly_ring_begin(p); r < mpoly.poly_ring_end(p); r++)
+		{
+			if (mpoly.ring_size(r) <= 2)
+				continue;
+
+			GFloat fRingArea = get_area_polygon(mpoly.ring(r));
+			fArea += (r == mpoly.poly_ring_begin(p)) ? fRingArea : -fRingArea;
+		}
 	}
 
-	// Return absolute value
-	return fabsf(fArea / 2.f);
+	return fArea;
 }
 
 /***********************************************************************************
@@ -158,23 +228,17 @@ Dllexport GFloat get_area_polygon(const VecPoint2D& points)
 ***********************************************************************************/
 Dllexport void get_bounding_box(const VecPoint2D& points, Point2D& ptMin, Point2D& ptMax)
 {
-	GFloat fMinX = std::numeric_limits<GFloat>::max();
-	GFloat fMinY = std::numeric_limits<GFloat>::max();
-
-	GFloat fMaxX = std::numeric_limits<GFloat>::min();
-	GFloat fMaxY = std::numeric_limits<GFloat>::min();
+	get_bounding_box(RingView2D(points), ptMin, ptMax);
+}
 
-	int nPointCnt = static_cast<int>(points.size());
-	for (int i = 0; i < nPointCnt; i++)
-	{
-		fMinX = std::min<GFloat>(fMinX, points[i].x);
-		fMinY = std::min<GFloat>(fMinY, points[i].y);
-		fMaxX = std::max<GFloat>(fMaxX, points[i].x);
-		fMaxY = std::max<GFloat>(fMaxY, points[i].y);
-	}
+Dllexport void get_bounding_box(const MultiPolygon2D& mpoly, Point2D& ptMin, Point2D& ptMax)
+{
+	get_bounding_box(RingView2D(mpoly.points()), ptMin, ptMax);
+}
 
-	ptMin = Point2D(fMinX, fMinY);
-	ptMax = Point2D(fMaxX, fMaxY);
+Dllexport void get_bounding_box(const RingView2D& points, Point2D& ptMin, Point2D& ptMax)
+{
+	kernel::get_bounding_box(points.data(), points.size(), ptMin, ptMax);
 }
 
 /***********************************************************************************
@@ -186,50 +250,46 @@ Dllexport void get_bounding_box(const VecPoint2D& points, Point2D& ptMin, Point2
 ***********************************************************************************/
 Dllexport GBool is_point_in_polygon(const Point2D& pt, const VecPoint2D& poly)
 {
-	if (poly.size() < 3)
-	{
-		assert(0);
-		return GFalse;
-	}
-
-	GFloat fMinX = poly[0].x;
-	GFloat fMaxX = poly[0].x;
-	GFloat fMinY = poly[0].y;
-	GFloat fMaxY = poly[0].y;
+	return is_point_in_polygon(pt, RingView2D(poly));
+}
 
-	int nPolyCount = static_cast<int>(poly.size());
+Dllexport GBool is_point_in_polygon(const Point2D& pt, const RingView2D& poly)
+{
+	return kernel::is_point_in_polygon(pt, poly.data(), poly.size());
+}
 
-	for (int i = 1; i < nPolyCount; i++)
+/***********************************************************************************
+*! @brief  : Check point inside multipolygon
+*! @param  : [in] pt    : point check
+*! @param  : [in] mpoly : multipolygon
+*! @return : TRUE : inside outer ring and outside holes of one polygon | FALSE
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+Dllexport GBool is_point_in_polygon(const Point2D& pt, const MultiPolygon2D& mpoly)
+{
+	for (size_t p = 0; p < mpoly.poly_count(); p++)
 	{
-		fMinX = std::min<GFloat>(poly[i].x, fMinX);
-		fMaxX = std::max<GFloat>(poly[i].x, fMaxX);
-		fMinY = std::min<GFloat>(poly[i].y, fMinY);
-		fMaxY = std::max<GFloat>(poly[i].y, fMaxY);
-	}
+		size_t nRing = mpoly.poly_ring_begin(p);
 
-	if (pt.x < fMinX || pt.x > fMaxX || pt.y < fMinY || pt.y > fMaxY)
-		return GFalse;
+		if (nRing == mpoly.poly_ring_end(p) || mpoly.ring_size(nRing) < 3)
+			continue;
 
-	GBool bInside = GFalse;
-	for (int i = 0, j = nPolyCount - 1; i < nPolyCount; j = i++)
-	{
-		if ((poly[i].y > pt.y) != (poly[j].y > pt.y) &&
-			pt.x < (poly[j].x - poly[i].x) * (pt.y - poly[i].y) / (poly[j].y - poly[i].y) + poly[i].x)
-		{
-			bInside = !bInside;
-		}
-		// case inside edge and collinear
-		else if (is_equal(poly[i].y, pt.y, MATH_EPSILON) &&
-				 is_equal(poly[j].y, pt.y, MATH_EPSILON))
+		if (is_point_in_polygon(pt, mpoly.ring(nRing)) == GFalse)
+			continue;
+
+		GBool bInHole = GFalse;
+
+		for (size_t r = nRing + 1; r < mpoly.poly_ring_end(p) && !bInHole; r++)
 		{
-			if ((poly[i].x > pt.x) != (poly[j].x > pt.x))
-			{
-				return GTrue;
-			}
+			if (mpoly.ring_size(r) >= 3 && is_point_in_polygon(pt, mpoly.ring(r)) == GTrue)
+				bInHole = GTrue;
 		}
+
+		if (!bInHole)
+			return GTrue;
 	}
 
-	return bInside;
+	return GFalse;
 }
 
 /***********************************************************************************
@@ -251,20 +311,49 @@ Dllexport GInt rel_2polygon(const VecPoint2D& poly1, const VecPoint2D& poly2)
 		return -1;
 	}
 
-	int nPolyCount = static_cast<int>(poly1.size());
+	// Case 1 : intersect - check 2 intersecting polygons (sweep line)
+	if (intersect_2polygon(poly1, poly2, NULL, GTrue) >= 1)
+		return 1;
+
+	// Case 2 : inside - check poly1 inside poly2 
+	if (GTrue == is_point_in_polygon(poly1[0], poly2))
+		return 2;
+
+	// Case 3 : inside - check poly2 inside poly1 
+	if (GTrue == is_point_in_polygon(poly2[0], poly1))
+		return 3;
 
-	// Case 1 : intersect - check 2 intersecting polygons
-	for (int j = 0, i = nPolyCount - 1; j < nPolyCount; i = j++)
+	// Case 4 (default): outside
+	return 0;
+}
+
+/***********************************************************************************
+*! @brief  : Get the relationship between 2 polygons (scratch memory)
+*! @param  : [in] poly1   : first polygon
+*! @param  : [in] poly2   : second polygon
+*! @param  : [in] scratch : temporary memory of sweep line
+*! @return : same as rel_2polygon
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+Dllexport GInt rel_2polygon(const RingView2D& poly1, const RingView2D& poly2, GeoScratch& scratch)
+{
+	if (poly1.size() < 3 || poly2.size() < 3)
 	{
-		if (intersect_lsegment_polygon(poly1[i], poly1[j], poly2, NULL, GTrue) >= 1)
-			return 1;
+		assert(0);
+		return -1;
 	}
 
-	// Case 2 : inside - check poly1 inside poly2 
+	GeoScratchFrame frame(scratch);
+
+	// Case 1 : intersect - check 2 intersecting polygons (sweep line)
+	if (intersect_2polygon(poly1, poly2, scratch, NULL, GTrue) >= 1)
+		return 1;
+
+	// Case 2 : inside - check poly1 inside poly2
 	if (GTrue == is_point_in_polygon(poly1[0], poly2))
 		return 2;
 
-	// Case 3 : inside - check poly2 inside poly1 
+	// Case 3 : inside - check poly2 inside poly1
 	if (GTrue == is_point_in_polygon(poly2[0], poly1))
 		return 3;
 
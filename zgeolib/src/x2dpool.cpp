@@ -0,0 +1,240 @@
+#include "x2dpool.h"
+#include <algorithm>
+
+namespace geo { namespace v2 {
+
+/***********************************************************************************
+*! @brief  : Create pool
+*! @param  : [in] nThread : number of worker (caller included)
+*!                          <= 0 : std::thread::hardware_concurrency()
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+GeoThreadPool::GeoThreadPool(GInt nThread /*= 0*/) :
+	m_pTask(NULL), m_nJob(0), m_nActive(0), m_nBusy(0), m_bStop(GFalse), m_bCancel(false)
+{
+	if (nThread <= 0)
+	{
+		nThread = std::max<GInt>(1, static_cast<GInt>(std::thread::hardware_concurrency()));
+	}
+
+	for (GInt i = 0; i < nThread; i++)
+	{
+		m_vecRange.push_back(new WorkRange());
+		m_vecRange.back()->m_nBegin = m_vecRange.back()->m_nEnd = 0;
+		m_vecScratch.push_back(new GeoScratch());
+	}
+
+	m_vecThread.reserve(nThread - 1);
+
+	for (GInt i = 1; i < nThread; i++)
+	{
+		m_vecThread.push_back(std::thread(&GeoThreadPool::thread_main, this, i));
+	}
+}
+
+GeoThreadPool::~GeoThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mtx);
+		m_bStop = GTrue;
+	}
+
+	m_cvStart.notify_all();
+
+	for (auto& thread : m_vecThread) thread.join();
+
+	for (auto pRange : m_vecRange) delete pRange;
+	for (auto pScratch : m_vecScratch) delete pScratch;
+}
+
+/***********************************************************************************
+*! @brief  : Run func(nTask, nWorker) for all task in [0, nTaskCnt), return when done
+*! @param  : [in] nTaskCnt : number of task
+*! @param  : [in] func     : task function (called concurrently)
+*! @param  : [in] nThread  : max number of worker (<= 0 : all)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Order of execution is not defined, write result of task i in slot i
+*!           to get deterministic output. Concurrent calls are serialized
+*!           A task which throws (any worker) : tasks not started are skipped,
+*!           all workers finish, then the first exception is rethrown
+***********************************************************************************/
+void GeoThreadPool::parallel_for(size_t nTaskCnt, const TaskFunc& func, GInt nThread /*= 0*/)
+{
+	if (nTaskCnt == 0)
+		return;
+
+	std::lock_guard<std::mutex> lockRun(m_mtxRun);
+
+	GInt nActive = thread_count();
+
+	if (nThread > 0) nActive = std::min(nActive, nThread);
+
+	nActive = static_cast<GInt>(std::min<size_t>(static_cast<size_t>(nActive), nTaskCnt));
+
+	if (nActive <= 1)
+	{
+		for (size_t i = 0; i < nTaskCnt; i++) func(i, 0);
+		return;
+	}
+
+	// Contiguous range per worker : neighbour tasks stay on the same core
+	for (GInt w = 0; w < thread_count(); w++)
+	{
+		WorkRange& range = *m_vecRange[w];
+
+		range.m_nBegin = (w < nActive) ? nTaskCnt * w / nActive : 0;
+		range.m_nEnd   = (w < nActive) ? nTaskCnt * (w + 1) / nActive : 0;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_mtx);
+
+		m_pTask   = &func;
+		m_nActive = nActive;
+		m_nBusy   = static_cast<GInt>(m_vecThread.size());
+		m_pError  = std::exception_ptr();
+		m_bCancel.store(false, std::memory_order_relaxed);
+		m_nJob++;
+	}
+
+	m_cvStart.notify_all();
+
+	// Exception of task is caught inside run_worker : workers still use m_pTask
+	// (func of this frame) until m_nBusy == 0
+	run_worker(0);
+
+	std::exception_ptr pError;
+
+	{
+		std::unique_lock<std::mutex> lock(m_mtx);
+		m_cvDone.wait(lock, [this] { return m_nBusy == 0; });
+
+		m_pTask = NULL;
+		std::swap(pError, m_pError);
+	}
+
+	if (pError)
+	{
+		std::rethrow_exception(pError);
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Loop of pool thread : wait job -> run -> report done
+*! @param  : [in] nWorker : worker index
+***********************************************************************************/
+void GeoThreadPool::thread_main(GInt nWorker)
+{
+	size_t nJob = 0;
+
+	for (;;)
+	{
+		GBool bActive = GFalse;
+
+		{
+			std::unique_lock<std::mutex> lock(m_mtx);
+			m_cvStart.wait(lock, [this, nJob] { return m_bStop || m_nJob != nJob; });
+
+			if (m_bStop) return;
+
+			nJob    = m_nJob;
+			bActive = (nWorker < m_nActive);
+		}
+
+		if (bActive) run_worker(nWorker);
+
+		std::lock_guard<std::mutex> lock(m_mtx);
+
+		if (--m_nBusy == 0) m_cvDone.notify_one();
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Run tasks of own range, then steal until all ranges are empty
+*! @param  : [in] nWorker : worker index
+*! @note   : Exception of task is kept in m_pError (first one) and cancels the job
+***********************************************************************************/
+void GeoThreadPool::run_worker(GInt nWorker)
+{
+	WorkRange& range = *m_vecRange[nWorker];
+
+	while (m_bCancel.load(std::memory_order_relaxed) == false)
+	{
+		size_t nTask = 0;
+		GBool  bTask = GFalse;
+
+		{
+			std::lock_guard<std::mutex> lock(range.m_mtx);
+
+			if (range.m_nBegin < range.m_nEnd)
+			{
+				nTask = range.m_nBegin++;
+				bTask = GTrue;
+			}
+		}
+
+		if (bTask)
+		{
+			try
+			{
+				(*m_pTask)(nTask, nWorker);
+			}
+			catch (...)
+			{
+				std::lock_guard<std::mutex> lock(m_mtx);
+
+				if (!m_pError) m_pError = std::current_exception();
+
+				m_bCancel.store(true, std::memory_order_relaxed);
+				break;
+			}
+		}
+		else if (steal_range(nWorker) == GFalse)
+		{
+			// A stolen range is always owned by the thief, no task is lost
+			break;
+		}
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Move upper half of range of other worker to own range
+*! @param  : [in] nWorker : worker index (thief)
+*! @return : TRUE : stolen | FALSE : all ranges are empty
+***********************************************************************************/
+GBool GeoThreadPool::steal_range(GInt nWorker)
+{
+	for (GInt k = 1; k < m_nActive; k++)
+	{
+		WorkRange& victim = *m_vecRange[(nWorker + k) % m_nActive];
+
+		size_t nBegin = 0, nEnd = 0;
+
+		{
+			std::lock_guard<std::mutex> lock(victim.m_mtx);
+
+			if (victim.m_nBegin >= victim.m_nEnd)
+				continue;
+
+			size_t nRemain = victim.m_nEnd - victim.m_nBegin;
+
+			nEnd   = victim.m_nEnd;
+			nBegin = victim.m_nEnd - (nRemain + 1) / 2;
+
+			victim.m_nEnd = nBegin;
+		}
+
+		WorkRange& range = *m_vecRange[nWorker];
+
+		std::lock_guard<std::mutex> lock(range.m_mtx);
+
+		range.m_nBegin = nBegin;
+		range.m_nEnd   = nEnd;
+
+		return GTrue;
+	}
+
+	return GFalse;
+}
+
+}}
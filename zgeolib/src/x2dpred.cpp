@@ -0,0 +1,381 @@
+#include "x2dpred.h"
+
+#include <cmath>
+#include <atomic>
+
+namespace geo { namespace v2 {
+
+/***********************************************************************************
+* Expansion arithmetic (J. R. Shewchuk, Adaptive Precision Floating-Point
+* Arithmetic and Fast Robust Geometric Predicates, 1997)
+* An expansion is a sum of non-overlapping doubles sorted by increasing magnitude.
+* Products use fma so that the result doesn't depend on floating-point contraction
+***********************************************************************************/
+
+static const GDouble PRED_EPS			= 1.1102230246251565e-16;	// 2^-53
+static const GDouble PRED_RESULT_ERR	= (3.0 + 8.0 * PRED_EPS) * PRED_EPS;
+static const GDouble PRED_CCW_ERR_B		= (2.0 + 12.0 * PRED_EPS) * PRED_EPS;
+static const GDouble PRED_CCW_ERR_C		= (9.0 + 64.0 * PRED_EPS) * PRED_EPS * PRED_EPS;
+
+static std::atomic<EnumPredicate> g_ePredicate(PRED_EPSILON);	// read by pool workers
+
+static inline void fast_two_sum(GDouble a, GDouble b, GDouble& x, GDouble& y)
+{
+	x = a + b;
+	GDouble bvirt = x - a;
+	y = b - bvirt;
+}
+
+static inline void two_sum(GDouble a, GDouble b, GDouble& x, GDouble& y)
+{
+	x = a + b;
+	GDouble bvirt  = x - a;
+	GDouble avirt  = x - bvirt;
+	GDouble bround = b - bvirt;
+	GDouble around = a - avirt;
+	y = around + bround;
+}
+
+static inline void two_diff_tail(GDouble a, GDouble b, GDouble x, GDouble& y)
+{
+	GDouble bvirt  = a - x;
+	GDouble avirt  = x + bvirt;
+	GDouble bround = bvirt - b;
+	GDouble around = a - avirt;
+	y = around + bround;
+}
+
+static inline void two_diff(GDouble a, GDouble b, GDouble& x, GDouble& y)
+{
+	x = a - b;
+	two_diff_tail(a, b, x, y);
+}
+
+static inline void two_product(GDouble a, GDouble b, GDouble& x, GDouble& y)
+{
+	x = a * b;
+	y = std::fma(a, b, -x);
+}
+
+// (a1 + a0) - (b1 + b0) = x3 + x2 + x1 + x0
+static inline void two_two_diff(GDouble a1, GDouble a0, GDouble b1, GDouble b0, GDouble* x)
+{
+	GDouble i, j, k;
+
+	two_diff(a0, b0, i, x[0]);
+	two_sum(a1, i, j, k);
+	two_diff(k, b1, i, x[1]);
+	two_sum(j, i, x[3], x[2]);
+}
+
+/***********************************************************************************
+*! @brief  : h = e + f (zero components are removed)
+*! @return : length of h (h can't be e or f)
+***********************************************************************************/
+static int fast_expansion_sum_zeroelim(int elen, const GDouble* e, int flen, const GDouble* f, GDouble* h)
+{
+	GDouble Q, Qnew, hh;
+	int eindex = 0, findex = 0, hindex = 0;
+
+	GDouble enow = e[0];
+	GDouble fnow = f[0];
+
+	if ((fnow > enow) == (fnow > -enow))
+	{
+		Q = enow;
+		enow = (++eindex < elen) ? e[eindex] : 0.0;
+	}
+	else
+	{
+		Q = fnow;
+		fnow = (++findex < flen) ? f[findex] : 0.0;
+	}
+
+	if (eindex < elen && findex < flen)
+	{
+		if ((fnow > enow) == (fnow > -enow))
+		{
+			fast_two_sum(enow, Q, Qnew, hh);
+			enow = (++eindex < elen) ? e[eindex] : 0.0;
+		}
+		else
+		{
+			fast_two_sum(fnow, Q, Qnew, hh);
+			fnow = (++findex < flen) ? f[findex] : 0.0;
+		}
+
+		Q = Qnew;
+		if (hh != 0.0) h[hindex++] = hh;
+
+		while (eindex < elen && findex < flen)
+		{
+			if ((fnow > enow) == (fnow > -enow))
+			{
+				two_sum(Q, enow, Qnew, hh);
+				enow = (++eindex < elen) ? e[eindex] : 0.0;
+			}
+			else
+			{
+				two_sum(Q, fnow, Qnew, hh);
+				fnow = (++findex < flen) ? f[findex] : 0.0;
+			}
+
+			Q = Qnew;
+			if (hh != 0.0) h[hindex++] = hh;
+		}
+	}
+
+	while (eindex < elen)
+	{
+		two_sum(Q, enow, Qnew, hh);
+		enow = (++eindex < elen) ? e[eindex] : 0.0;
+
+		Q = Qnew;
+		if (hh != 0.0) h[hindex++] = hh;
+	}
+
+	while (findex < flen)
+	{
+		two_sum(Q, fnow, Qnew, hh);
+		fnow = (++findex < flen) ? f[findex] : 0.0;
+
+		Q = Qnew;
+		if (hh != 0.0) h[hindex++] = hh;
+	}
+
+	if (Q != 0.0 || hindex == 0)
+		h[hindex++] = Q;
+
+	return hindex;
+}
+
+/***********************************************************************************
+*! @brief  : h = e * b (zero components are removed)
+*! @return : length of h (max 2 * elen)
+***********************************************************************************/
+static int scale_expansion_zeroelim(int elen, const GDouble* e, GDouble b, GDouble* h)
+{
+	GDouble Q, sum, hh, product1, product0;
+	int hindex = 0;
+
+	two_product(e[0], b, Q, hh);
+	if (hh != 0.0) h[hindex++] = hh;
+
+	for (int eindex = 1; eindex < elen; eindex++)
+	{
+		two_product(e[eindex], b, product1, product0);
+		two_sum(Q, product0, sum, hh);
+		if (hh != 0.0) h[hindex++] = hh;
+
+		fast_two_sum(product1, sum, Q, hh);
+		if (hh != 0.0) h[hindex++] = hh;
+	}
+
+	if (Q != 0.0 || hindex == 0)
+		h[hindex++] = Q;
+
+	return hindex;
+}
+
+/***********************************************************************************
+*! @brief  : h = e * f
+*! @return : length of h (max 2 * elen * flen)
+***********************************************************************************/
+static int expansion_product(int elen, const GDouble* e, int flen, const GDouble* f, GDouble* h)
+{
+	GDouble arScale[32], arSum[2][512];
+
+	int nLen = scale_expansion_zeroelim(elen, e, f[0], arSum[0]);
+	int nCur = 0;
+
+	for (int i = 1; i < flen; i++)
+	{
+		int nScale = scale_expansion_zeroelim(elen, e, f[i], arScale);
+		nLen = fast_expansion_sum_zeroelim(nLen, arSum[nCur], nScale, arScale, arSum[1 - nCur]);
+		nCur = 1 - nCur;
+	}
+
+	for (int i = 0; i < nLen; i++)
+	{
+		h[i] = arSum[nCur][i];
+	}
+
+	return nLen;
+}
+
+/***********************************************************************************
+*! @brief  : Select predicate used by x2drel / x2dint / x2dalgo
+*! @param  : [in] ePred : predicate
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Atomic (relaxed) : workers read it while running. Change it only
+*!           between calls, a call in progress can see both values
+***********************************************************************************/
+Dllexport void set_predicate(EnumPredicate ePred)
+{
+	g_ePredicate.store(ePred, std::memory_order_relaxed);
+}
+
+/***********************************************************************************
+*! @brief  : Get predicate used by x2drel / x2dint / x2dalgo
+*! @return : EnumPredicate
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+Dllexport EnumPredicate get_predicate()
+{
+	return g_ePredicate.load(std::memory_order_relaxed);
+}
+
+/***********************************************************************************
+*! @brief  : Exact orientation when the fast filter fails (don't call directly)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : orient2dadapt of Shewchuk : more precise stages are evaluated only
+*!           when the error bound of the previous stage is not enough
+***********************************************************************************/
+Dllexport GDouble orient2d_adapt(GDouble ax, GDouble ay, GDouble bx, GDouble by,
+								 GDouble cx, GDouble cy, GDouble dDetSum)
+{
+	GDouble B[4], u[4], C1[8], C2[12], D[16];
+	GDouble acxtail, acytail, bcxtail, bcytail;
+	GDouble s1, s0, t1, t0;
+
+	GDouble acx = ax - cx;
+	GDouble bcx = bx - cx;
+	GDouble acy = ay - cy;
+	GDouble bcy = by - cy;
+
+	// Stage B : exact products of rounded differences
+	two_product(acx, bcy, s1, s0);
+	two_product(acy, bcx, t1, t0);
+	two_two_diff(s1, s0, t1, t0, B);
+
+	GDouble dDet = B[0] + B[1] + B[2] + B[3];
+	GDouble dErrBound = PRED_CCW_ERR_B * dDetSum;
+
+	if (dDet >= dErrBound || -dDet >= dErrBound)
+		return dDet;
+
+	two_diff_tail(ax, cx, acx, acxtail);
+	two_diff_tail(bx, cx, bcx, bcxtail);
+	two_diff_tail(ay, cy, acy, acytail);
+	two_diff_tail(by, cy, bcy, bcytail);
+
+	if (acxtail == 0.0 && acytail == 0.0 && bcxtail == 0.0 && bcytail == 0.0)
+		return dDet;
+
+	// Stage C : first order correction of the tails
+	dErrBound = PRED_CCW_ERR_C * dDetSum + PRED_RESULT_ERR * std::fabs(dDet);
+	dDet += (acx * bcytail + bcy * acxtail) - (acy * bcxtail + bcx * acytail);
+
+	if (dDet >= dErrBound || -dDet >= dErrBound)
+		return dDet;
+
+	// Stage D : exact
+	two_product(acxtail, bcy, s1, s0);
+	two_product(acytail, bcx, t1, t0);
+	two_two_diff(s1, s0, t1, t0, u);
+	int nC1 = fast_expansion_sum_zeroelim(4, B, 4, u, C1);
+
+	two_product(acx, bcytail, s1, s0);
+	two_product(acy, bcxtail, t1, t0);
+	two_two_diff(s1, s0, t1, t0, u);
+	int nC2 = fast_expansion_sum_zeroelim(nC1, C1, 4, u, C2);
+
+	two_product(acxtail, bcytail, s1, s0);
+	two_product(acytail, bcxtail, t1, t0);
+	two_two_diff(s1, s0, t1, t0, u);
+	int nD = fast_expansion_sum_zeroelim(nC2, C2, 4, u, D);
+
+	return D[nD - 1];
+}
+
+/***********************************************************************************
+*! @brief  : Exact cross product when the fast filter fails (don't call directly)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Differences are two-term expansions, whole product is exact
+***********************************************************************************/
+Dllexport GDouble cross2d_exact(GDouble ax, GDouble ay, GDouble bx, GDouble by,
+								GDouble cx, GDouble cy, GDouble dx, GDouble dy)
+{
+	GDouble abx[2], aby[2], cdx[2], cdy[2];
+	GDouble arP[8], arQ[8], arDet[16];
+
+	two_diff(bx, ax, abx[1], abx[0]);
+	two_diff(by, ay, aby[1], aby[0]);
+	two_diff(dx, cx, cdx[1], cdx[0]);
+	two_diff(dy, cy, cdy[1], cdy[0]);
+
+	int nP = expansion_product(2, abx, 2, cdy, arP);
+	int nQ = expansion_product(2, aby, 2, cdx, arQ);
+
+	for (int i = 0; i < nQ; i++) arQ[i] = -arQ[i];
+
+	int nDet = fast_expansion_sum_zeroelim(nP, arP, nQ, arQ, arDet);
+
+	return arDet[nDet - 1];
+}
+
+/***********************************************************************************
+*! @brief  : Exact in-circle when the fast filter fails (don't call directly)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Whole determinant is evaluated with expansions (slow, rare)
+***********************************************************************************/
+Dllexport GDouble incircle_exact(GDouble ax, GDouble ay, GDouble bx, GDouble by,
+								 GDouble cx, GDouble cy, GDouble dx, GDouble dy)
+{
+	GDouble adx[2], ady[2], bdx[2], bdy[2], cdx[2], cdy[2];
+
+	two_diff(ax, dx, adx[1], adx[0]);
+	two_diff(ay, dy, ady[1], ady[0]);
+	two_diff(bx, dx, bdx[1], bdx[0]);
+	two_diff(by, dy, bdy[1], bdy[0]);
+	two_diff(cx, dx, cdx[1], cdx[0]);
+	two_diff(cy, dy, cdy[1], cdy[0]);
+
+	// det = alift * (bdx * cdy - cdx * bdy) + blift * (cdx * ady - adx * cdy)
+	//     + clift * (adx * bdy - bdx * ady)
+	auto funCross = [](const GDouble* ux, const GDouble* vy, const GDouble* vx, const GDouble* uy, GDouble* h)
+	{
+		GDouble arP[8], arQ[8];
+
+		int nP = expansion_product(2, ux, 2, vy, arP);
+		int nQ = expansion_product(2, vx, 2, uy, arQ);
+
+		for (int i = 0; i < nQ; i++) arQ[i] = -arQ[i];
+
+		return fast_expansion_sum_zeroelim(nP, arP, nQ, arQ, h);
+	};
+
+	auto funLift = [](const GDouble* x, const GDouble* y, GDouble* h)
+	{
+		GDouble arP[8], arQ[8];
+
+		int nP = expansion_product(2, x, 2, x, arP);
+		int nQ = expansion_product(2, y, 2, y, arQ);
+
+		return fast_expansion_sum_zeroelim(nP, arP, nQ, arQ, h);
+	};
+
+	GDouble arCross[16], arLift[16];
+	GDouble arTerm[3][512];
+	int nTerm[3];
+
+	const GDouble* arU[3][4] = { { bdx, cdy, cdx, bdy }, { cdx, ady, adx, cdy }, { adx, bdy, bdx, ady } };
+	const GDouble* arL[3][2] = { { adx, ady }, { bdx, bdy }, { cdx, cdy } };
+
+	for (int k = 0; k < 3; k++)
+	{
+		int nCross = funCross(arU[k][0], arU[k][1], arU[k][2], arU[k][3], arCross);
+		int nLift  = funLift(arL[k][0], arL[k][1], arLift);
+
+		nTerm[k] = expansion_product(nLift, arLift, nCross, arCross, arTerm[k]);
+	}
+
+	GDouble arSum1[1024], arSum2[1536];
+
+	int nSum1 = fast_expansion_sum_zeroelim(nTerm[0], arTerm[0], nTerm[1], arTerm[1], arSum1);
+	int nSum2 = fast_expansion_sum_zeroelim(nSum1, arSum1, nTerm[2], arTerm[2], arSum2);
+
+	return arSum2[nSum2 - 1];
+}
+
+}}
@@ -0,0 +1,540 @@
+#include "x2dprep.h"
+#include "x2drel.h"
+#include "x2dpoly.h"
+#include <cassert>
+#include <cstring>
+#include <cmath>
+#include <algorithm>
+
+#if defined(GEO_SIMD_AVX) || defined(GEO_SIMD_SSE)
+#include <immintrin.h>
+#endif
+
+namespace geo { namespace v2 {
+
+PreparedPolygon::PreparedPolygon() : m_bCCW(GTrue), m_bConvex(GFalse)
+{
+
+}
+
+PreparedPolygon::PreparedPolygon(const VecPoint2D& poly) : m_bCCW(GTrue), m_bConvex(GFalse)
+{
+	build(poly);
+}
+
+PreparedPolygon::PreparedPolygon(GeoScratch* pScratch) :
+	m_vecPoly(ScratchAllocator<Point2D>(pScratch)), m_vecEdge(ScratchAllocator<EdgeCoef>(pScratch)),
+	m_bCCW(GTrue), m_bConvex(GFalse)
+{
+
+}
+
+PreparedPolygon::PreparedPolygon(const RingView2D& poly, GeoScratch* pScratch) :
+	m_vecPoly(ScratchAllocator<Point2D>(pScratch)), m_vecEdge(ScratchAllocator<EdgeCoef>(pScratch)),
+	m_bCCW(GTrue), m_bConvex(GFalse)
+{
+	build(poly);
+}
+
+/***********************************************************************************
+*! @brief  : Build cached data from polygon (can be called again to rebuild)
+*! @param  : [in] poly : polygon (CW or CCW)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+void PreparedPolygon::build(const VecPoint2D& poly)
+{
+	build(RingView2D(poly));
+}
+
+/***********************************************************************************
+*! @brief  : Build cached data from polygon view (can be called again to rebuild)
+*! @param  : [in] poly : polygon (CW or CCW)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Memory comes from the scratch given at construction (if any)
+***********************************************************************************/
+void PreparedPolygon::build(const RingView2D& poly)
+{
+	clear();
+
+	int nPolyCnt = static_cast<int>(poly.size());
+
+	if (nPolyCnt < 3)
+	{
+		assert(0);
+		return;
+	}
+
+	// 1. Bounding box + edge table (same edge order as is_point_in_polygon)
+	GFloat fMinX = poly[0].x, fMaxX = poly[0].x;
+	GFloat fMinY = poly[0].y, fMaxY = poly[0].y;
+
+	m_vecEdge.reserve(nPolyCnt);
+
+	for (int i = 0, j = nPolyCnt - 1; i < nPolyCnt; j = i++)
+	{
+		fMinX = std::min<GFloat>(poly[i].x, fMinX);
+		fMaxX = std::max<GFloat>(poly[i].x, fMaxX);
+		fMinY = std::min<GFloat>(poly[i].y, fMinY);
+		fMaxY = std::max<GFloat>(poly[i].y, fMaxY);
+
+		EdgeCoef edge;
+		edge.m_x0 = poly[i].x; edge.m_y0 = poly[i].y;
+		edge.m_x1 = poly[j].x; edge.m_y1 = poly[j].y;
+
+		GFloat fDy = edge.m_y1 - edge.m_y0;
+		edge.m_fSlope = (fDy != 0.f) ? (edge.m_x1 - edge.m_x0) / fDy : 0.f;
+
+		m_vecEdge.push_back(edge);
+	}
+
+	m_ptMin = Point2D(fMinX, fMinY);
+	m_ptMax = Point2D(fMaxX, fMaxY);
+
+	// 2. Orientation
+	m_bCCW = geo::v2::is_ccw(poly);
+
+	// 3. Convex : remove consecutive duplicate point, all turns have the same sign
+	//    and the boundary winds only once (direction x change sign twice)
+	m_vecPoly.reserve(nPolyCnt);
+
+	for (int i = 0; i < nPolyCnt; i++)
+	{
+		if (m_vecPoly.empty() || m_vecPoly.back().x != poly[i].x || m_vecPoly.back().y != poly[i].y)
+			m_vecPoly.push_back(poly[i]);
+	}
+
+	while (m_vecPoly.size() > 1 && m_vecPoly.back().x == m_vecPoly.front().x &&
+								   m_vecPoly.back().y == m_vecPoly.front().y)
+	{
+		m_vecPoly.pop_back();
+	}
+
+	if (m_bCCW == GFalse)
+	{
+		reverse_polygon(m_vecPoly.data(), m_vecPoly.size());
+	}
+
+	int nCnt = static_cast<int>(m_vecPoly.size());
+	int nSign = 0, nFlipX = 0; GBool bConvex = (nCnt >= 3) ? GTrue : GFalse;
+	GFloat fPreDx = 0.f;
+
+	for (int i = 0; i < nCnt && bConvex; i++)
+	{
+		const Point2D& p0 = m_vecPoly[i];
+		const Point2D& p1 = m_vecPoly[(i + 1) % nCnt];
+		const Point2D& p2 = m_vecPoly[(i + 2) % nCnt];
+
+		GFloat fCrs = (p1.x - p0.x) * (p2.y - p1.y) - (p1.y - p0.y) * (p2.x - p1.x);
+
+		if (fCrs != 0.f)
+		{
+			int nCurSign = (fCrs > 0.f) ? 1 : -1;
+
+			if (nSign != 0 && nCurSign != nSign)
+				bConvex = GFalse;
+
+			nSign = nCurSign;
+		}
+
+		GFloat fDx = p1.x - p0.x;
+
+		if (fDx != 0.f)
+		{
+			if (fPreDx != 0.f && ((fDx > 0.f) != (fPreDx > 0.f)))
+				nFlipX++;
+			fPreDx = fDx;
+		}
+	}
+
+	// Sign change between the last and the first edge is counted by wrapping
+	if (bConvex)
+	{
+		for (int i = 0; i < nCnt; i++)
+		{
+			GFloat fDx = m_vecPoly[(i + 1) % nCnt].x - m_vecPoly[i].x;
+
+			if (fDx != 0.f)
+			{
+				if ((fDx > 0.f) != (fPreDx > 0.f))
+					nFlipX++;
+				break;
+			}
+		}
+	}
+
+	m_bConvex = (bConvex && nSign != 0 && nFlipX <= 2) ? GTrue : GFalse;
+
+	if (m_bConvex == GFalse)
+	{
+		ScratchVecPoint2D(m_vecPoly.get_allocator()).swap(m_vecPoly);
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Release cached data
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+void PreparedPolygon::clear()
+{
+	ScratchVecPoint2D(m_vecPoly.get_allocator()).swap(m_vecPoly);
+	VecEdgeCoef(m_vecEdge.get_allocator()).swap(m_vecEdge);
+
+	m_ptMin = Point2D(0.f, 0.f);
+	m_ptMax = Point2D(0.f, 0.f);
+	m_bCCW  = GTrue;
+	m_bConvex = GFalse;
+}
+
+/***********************************************************************************
+*! @brief  : Check point inside polygon
+*! @param  : [in] pt : point check
+*! @return : TRUE : inside | FALSE : outside
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Same result as is_point_in_polygon for points not on the boundary.
+*!           Boundary point can differ : convex polygon -> always inside (fan
+*!           test, >= 0) | other polygon -> same crossing rule, but the cached
+*!           slope rounds differently (see bench/bench_prep.cpp)
+***********************************************************************************/
+GBool PreparedPolygon::contains(const Point2D& pt) const
+{
+	if (m_vecEdge.empty())
+		return GFalse;
+
+	if (pt.x < m_ptMin.x || pt.x > m_ptMax.x || pt.y < m_ptMin.y || pt.y > m_ptMax.y)
+		return GFalse;
+
+	return (m_bConvex == GTrue) ? contains_convex(pt) : contains_crossing(pt);
+}
+
+/***********************************************************************************
+*! @brief  : Check point inside polygon with the rule of is_point_in_polygon
+*! @param  : [in] pt : point check
+*! @return : TRUE : inside | FALSE : outside
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Same result as is_point_in_polygon, boundary point included (no
+*!           fan test, x of edge at pt.y is divided as is_point_in_polygon does)
+***********************************************************************************/
+GBool PreparedPolygon::contains_legacy(const Point2D& pt) const
+{
+	if (m_vecEdge.empty())
+		return GFalse;
+
+	if (pt.x < m_ptMin.x || pt.x > m_ptMax.x || pt.y < m_ptMin.y || pt.y > m_ptMax.y)
+		return GFalse;
+
+	const GFloat fx = pt.x, fy = pt.y;
+	const EdgeCoef* pEdge = m_vecEdge.data();
+	const size_t nEdgeCnt = m_vecEdge.size();
+
+	GBool bInside = GFalse;
+
+	for (size_t i = 0; i < nEdgeCnt; i++)
+	{
+		const EdgeCoef& e = pEdge[i];
+
+		if ((e.m_y0 > fy) != (e.m_y1 > fy) &&
+			fx < (e.m_x1 - e.m_x0) * (fy - e.m_y0) / (e.m_y1 - e.m_y0) + e.m_x0)
+		{
+			bInside = !bInside;
+		}
+		// case inside edge and collinear
+		else if (std::fabs(fy - e.m_y0) <= MATH_EPSILON &&
+				 std::fabs(fy - e.m_y1) <= MATH_EPSILON)
+		{
+			if ((e.m_x0 > fx) != (e.m_x1 > fx))
+			{
+				return GTrue;
+			}
+		}
+	}
+
+	return bInside;
+}
+
+/***********************************************************************************
+*! @brief  : Check list point inside polygon
+*! @param  : [in ] pts : point list
+*! @param  : [in ] n   : number of point
+*! @param  : [out] out : 1 : inside | 0 : outside (size >= n)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+void PreparedPolygon::contains(const Point2D* pts, size_t n, uint8_t* out) const
+{
+	if (m_vecEdge.empty())
+	{
+		std::memset(out, 0, n);
+		return;
+	}
+
+	const GFloat fMinX = m_ptMin.x, fMaxX = m_ptMax.x;
+	const GFloat fMinY = m_ptMin.y, fMaxY = m_ptMax.y;
+
+	for (size_t i = 0; i < n; i++)
+	{
+		const Point2D& pt = pts[i];
+
+		if (pt.x < fMinX || pt.x > fMaxX || pt.y < fMinY || pt.y > fMaxY)
+		{
+			out[i] = 0;
+			continue;
+		}
+
+		out[i] = (m_bConvex == GTrue) ? contains_convex(pt) : contains_crossing(pt);
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Check point buffer (SoA) inside polygon
+*! @param  : [in ] pts : point buffer
+*! @param  : [out] out : 1 : inside | 0 : outside (size >= pts.size())
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Test GEO_SIMD_WIDTH points per edge iteration (AVX : 8 | SSE : 4)
+***********************************************************************************/
+void PreparedPolygon::contains(const PointSoA2D& pts, uint8_t* out) const
+{
+	const size_t n = pts.size();
+
+	if (m_vecEdge.empty())
+	{
+		std::memset(out, 0, n);
+		return;
+	}
+
+	const GFloat* px = pts.x.data();
+	const GFloat* py = pts.y.data();
+	size_t i = 0;
+
+	// Convex polygon : O(log n) per point is faster than any edge loop
+	if (m_bConvex == GFalse)
+	{
+		const size_t nBlock = n - (n % GEO_SIMD_WIDTH);
+
+		for (; i < nBlock; i += GEO_SIMD_WIDTH)
+		{
+			contains_crossing_block(px + i, py + i, out + i);
+		}
+	}
+
+	for (; i < n; i++)
+	{
+		out[i] = contains(Point2D(px[i], py[i]));
+	}
+}
+
+/***********************************************************************************
+*! @brief  : bounding box of polygon
+*! @param  : [out] ptMin  : min point bounding
+*! @param  : [out] ptMax  : max point bounding
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+void PreparedPolygon::get_bounding_box(Point2D& ptMin, Point2D& ptMax) const
+{
+	ptMin = m_ptMin;
+	ptMax = m_ptMax;
+}
+
+/***********************************************************************************
+*! @brief  : Crossing number test use cached edge table
+*! @param  : [in] pt : point check (inside bounding box)
+*! @return : TRUE : inside | FALSE : outside
+*! @note   : ref : https://wrf.ecse.rpi.edu/Research/Short_Notes/pnpoly.html
+***********************************************************************************/
+GBool PreparedPolygon::contains_crossing(const Point2D& pt) const
+{
+	const GFloat fx = pt.x, fy = pt.y;
+	const EdgeCoef* pEdge = m_vecEdge.data();
+	const size_t nEdgeCnt = m_vecEdge.size();
+
+	GBool bInside = GFalse;
+
+	for (size_t i = 0; i < nEdgeCnt; i++)
+	{
+		const EdgeCoef& e = pEdge[i];
+
+		if ((e.m_y0 > fy) != (e.m_y1 > fy) &&
+			fx < (fy - e.m_y0) * e.m_fSlope + e.m_x0)
+		{
+			bInside = !bInside;
+		}
+		// case inside edge and collinear
+		else if (std::fabs(e.m_y0 - fy) <= MATH_EPSILON &&
+				 std::fabs(e.m_y1 - fy) <= MATH_EPSILON)
+		{
+			if ((e.m_x0 > fx) != (e.m_x1 > fx))
+			{
+				return GTrue;
+			}
+		}
+	}
+
+	return bInside;
+}
+
+/***********************************************************************************
+*! @brief  : Point in convex polygon use binary search on the fan of vertex 0
+*! @param  : [in] pt : point check (inside bounding box)
+*! @return : TRUE : inside or on boundary | FALSE : outside
+***********************************************************************************/
+GBool PreparedPolygon::contains_convex(const Point2D& pt) const
+{
+	const Point2D* p = m_vecPoly.data();
+	const int nCnt = static_cast<int>(m_vecPoly.size());
+
+	auto funOrient = [](const Point2D& a, const Point2D& b, const Point2D& c) -> GFloat
+	{
+		return (b.x - a.x) * (c.y - a.y) - (c.x - a.x) * (b.y - a.y);
+	};
+
+	// Outside the wedge p[1] - p[0] - p[n-1]
+	if (funOrient(p[0], p[1], pt) < 0.f || funOrient(p[0], p[nCnt - 1], pt) > 0.f)
+		return GFalse;
+
+	int nLow = 1, nHigh = nCnt - 1;
+
+	while (nHigh - nLow > 1)
+	{
+		int nMid = (nLow + nHigh) / 2;
+
+		if (funOrient(p[0], p[nMid], pt) >= 0.f)
+			nLow = nMid;
+		else
+			nHigh = nMid;
+	}
+
+	return (funOrient(p[nLow], p[nLow + 1], pt) >= 0.f) ? GTrue : GFalse;
+}
+
+/***********************************************************************************
+*! @brief  : Crossing number test for GEO_SIMD_WIDTH points (one edge per iteration)
+*! @param  : [in ] px  : x of points
+*! @param  : [in ] py  : y of points
+*! @param  : [out] out : 1 : inside | 0 : outside
+*! @note   : Same rule as contains_crossing (horizontal collinear edge is inside)
+***********************************************************************************/
+void PreparedPolygon::contains_crossing_block(const GFloat* px, const GFloat* py, uint8_t* out) const
+{
+	const EdgeCoef* pEdge = m_vecEdge.data();
+	const size_t nEdgeCnt = m_vecEdge.size();
+
+#if defined(GEO_SIMD_AVX)
+	const __m256 vx = _mm256_loadu_ps(px);
+	const __m256 vy = _mm256_loadu_ps(py);
+
+	// Reject whole block outside bounding box
+	__m256 vBox = _mm256_and_ps(
+		_mm256_and_ps(_mm256_cmp_ps(vx, _mm256_set1_ps(m_ptMin.x), _CMP_GE_OQ),
+					  _mm256_cmp_ps(vx, _mm256_set1_ps(m_ptMax.x), _CMP_LE_OQ)),
+		_mm256_and_ps(_mm256_cmp_ps(vy, _mm256_set1_ps(m_ptMin.y), _CMP_GE_OQ),
+					  _mm256_cmp_ps(vy, _mm256_set1_ps(m_ptMax.y), _CMP_LE_OQ)));
+
+	int nBoxMask = _mm256_movemask_ps(vBox);
+
+	if (nBoxMask == 0)
+	{
+		std::memset(out, 0, 8);
+		return;
+	}
+
+	const __m256 vEps = _mm256_set1_ps(MATH_EPSILON);
+	const __m256 vAbs = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+
+	__m256 vInside = _mm256_setzero_ps();
+	__m256 vOnEdge = _mm256_setzero_ps();
+
+	for (size_t i = 0; i < nEdgeCnt; i++)
+	{
+		const EdgeCoef& e = pEdge[i];
+
+		const __m256 vx0 = _mm256_set1_ps(e.m_x0);
+		const __m256 vy0 = _mm256_set1_ps(e.m_y0);
+		const __m256 vx1 = _mm256_set1_ps(e.m_x1);
+		const __m256 vy1 = _mm256_set1_ps(e.m_y1);
+
+		__m256 vStraddle = _mm256_xor_ps(_mm256_cmp_ps(vy0, vy, _CMP_GT_OQ),
+										 _mm256_cmp_ps(vy1, vy, _CMP_GT_OQ));
+		__m256 vXCross   = _mm256_add_ps(_mm256_mul_ps(_mm256_sub_ps(vy, vy0), _mm256_set1_ps(e.m_fSlope)), vx0);
+		__m256 vCross    = _mm256_and_ps(vStraddle, _mm256_cmp_ps(vx, vXCross, _CMP_LT_OQ));
+
+		vInside = _mm256_xor_ps(vInside, vCross);
+
+		// case inside edge and collinear
+		__m256 vHorz = _mm256_and_ps(
+			_mm256_cmp_ps(_mm256_and_ps(_mm256_sub_ps(vy, vy0), vAbs), vEps, _CMP_LE_OQ),
+			_mm256_cmp_ps(_mm256_and_ps(_mm256_sub_ps(vy, vy1), vAbs), vEps, _CMP_LE_OQ));
+		__m256 vSpan = _mm256_xor_ps(_mm256_cmp_ps(vx0, vx, _CMP_GT_OQ),
+									 _mm256_cmp_ps(vx1, vx, _CMP_GT_OQ));
+
+		vOnEdge = _mm256_or_ps(vOnEdge, _mm256_andnot_ps(vCross, _mm256_and_ps(vHorz, vSpan)));
+	}
+
+	int nMask = _mm256_movemask_ps(_mm256_or_ps(vInside, vOnEdge)) & nBoxMask;
+
+	for (int k = 0; k < 8; k++)
+	{
+		out[k] = static_cast<uint8_t>((nMask >> k) & 1);
+	}
+
+#elif defined(GEO_SIMD_SSE)
+	const __m128 vx = _mm_loadu_ps(px);
+	const __m128 vy = _mm_loadu_ps(py);
+
+	// Reject whole block outside bounding box
+	__m128 vBox = _mm_and_ps(
+		_mm_and_ps(_mm_cmpge_ps(vx, _mm_set1_ps(m_ptMin.x)), _mm_cmple_ps(vx, _mm_set1_ps(m_ptMax.x))),
+		_mm_and_ps(_mm_cmpge_ps(vy, _mm_set1_ps(m_ptMin.y)), _mm_cmple_ps(vy, _mm_set1_ps(m_ptMax.y))));
+
+	int nBoxMask = _mm_movemask_ps(vBox);
+
+	if (nBoxMask == 0)
+	{
+		std::memset(out, 0, 4);
+		return;
+	}
+
+	const __m128 vEps = _mm_set1_ps(MATH_EPSILON);
+	const __m128 vAbs = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+
+	__m128 vInside = _mm_setzero_ps();
+	__m128 vOnEdge = _mm_setzero_ps();
+
+	for (size_t i = 0; i < nEdgeCnt; i++)
+	{
+		const EdgeCoef& e = pEdge[i];
+
+		const __m128 vx0 = _mm_set1_ps(e.m_x0);
+		const __m128 vy0 = _mm_set1_ps(e.m_y0);
+		const __m128 vx1 = _mm_set1_ps(e.m_x1);
+		const __m128 vy1 = _mm_set1_ps(e.m_y1);
+
+		__m128 vStraddle = _mm_xor_ps(_mm_cmpgt_ps(vy0, vy), _mm_cmpgt_ps(vy1, vy));
+		__m128 vXCross   = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(vy, vy0), _mm_set1_ps(e.m_fSlope)), vx0);
+		__m128 vCross    = _mm_and_ps(vStraddle, _mm_cmplt_ps(vx, vXCross));
+
+		vInside = _mm_xor_ps(vInside, vCross);
+
+		// case inside edge and collinear
+		__m128 vHorz = _mm_and_ps(_mm_cmple_ps(_mm_and_ps(_mm_sub_ps(vy, vy0), vAbs), vEps),
+								  _mm_cmple_ps(_mm_and_ps(_mm_sub_ps(vy, vy1), vAbs), vEps));
+		__m128 vSpan = _mm_xor_ps(_mm_cmpgt_ps(vx0, vx), _mm_cmpgt_ps(vx1, vx));
+
+		vOnEdge = _mm_or_ps(vOnEdge, _mm_andnot_ps(vCross, _mm_and_ps(vHorz, vSpan)));
+	}
+
+	int nMask = _mm_movemask_ps(_mm_or_ps(vInside, vOnEdge)) & nBoxMask;
+
+	for (int k = 0; k < 4; k++)
+	{
+		out[k] = static_cast<uint8_t>((nMask >> k) & 1);
+	}
+
+#else
+	(void)pEdge; (void)nEdgeCnt;
+
+	for (int k = 0; k < GEO_SIMD_WIDTH; k++)
+	{
+		out[k] = contains(Point2D(px[k], py[k]));
+	}
+#endif
+}
+
+}}
@@ -0,0 +1,524 @@
+#include "x2draster.h"
+#include "x2dscratch.h"
+
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+
+namespace geo { namespace v2 {
+
+typedef std::vector<uint32_t, ScratchAllocator<uint32_t>> ScratchVecIndex;
+
+/***********************************************************************************
+*! @brief  : Coverage of accumulated winding by fill rule
+***********************************************************************************/
+static inline GFloat raster_alpha(GFloat fWind, EnumFillRule eFill)
+{
+	switch (eFill)
+	{
+	case FILL_EVENODD:
+	{
+		GFloat a = std::fabs(fWind);
+		a -= 2.f * std::floor(a * 0.5f);
+		return (a > 1.f) ? 2.f - a : a;
+	}
+	case FILL_POSITIVE:
+		return std::min(std::max(fWind, 0.f), 1.f);
+	default:
+		break;
+	}
+
+	return std::min(std::fabs(fWind), 1.f);
+}
+
+static inline void raster_store(uint8_t& nOut, GFloat fAlpha)
+{
+	nOut = static_cast<uint8_t>(fAlpha * 255.f + 0.5f);
+}
+
+static inline void raster_store(GFloat& fOut, GFloat fAlpha)
+{
+	fOut = fAlpha;
+}
+
+/***********************************************************************************
+*! @brief  : Add line piece inside cell column c (x in [c, c + 1], y in row)
+***********************************************************************************/
+static inline void raster_cell(GFloat* pCov, GFloat* pArea, GInt c, GDouble xa, GDouble ya, GDouble xb, GDouble yb,
+							   GDouble dDir, GInt& nMin, GInt& nMax)
+{
+	const GDouble d = dDir * (yb - ya);
+	const GDouble fMid = (xa + xb) * 0.5 - c;
+
+	pArea[c] += GFloat(d * (1.0 - fMid));	// part of cell c right of line
+	pCov[c]  += GFloat(d);					// cells right of c
+
+	nMin = std::min(nMin, c);
+	nMax = std::max(nMax, c);
+}
+
+/***********************************************************************************
+*! @brief  : Add line piece of a row (ya <= yb, relative to row top) to cells
+*! @note   : Part left of canvas is moved to x = 0 (covers the whole row), part
+*!           right of canvas is dropped
+***********************************************************************************/
+static void raster_line(GFloat* pCov, GFloat* pArea, GInt nWidth, GDouble xa, GDouble ya, GDouble xb, GDouble yb,
+						GDouble dDir, GInt& nMin, GInt& nMax)
+{
+	const GDouble dW = GDouble(nWidth);
+
+	if (xa < 0.0 || xb < 0.0)
+	{
+		if (xa <= 0.0 && xb <= 0.0)
+		{
+			raster_cell(pCov, pArea, 0, 0.0, ya, 0.0, yb, dDir, nMin, nMax);
+			return;
+		}
+
+		const GDouble ym = ya + (0.0 - xa) * (yb - ya) / (xb - xa);
+
+		if (xa < 0.0)
+		{
+			raster_cell(pCov, pArea, 0, 0.0, ya, 0.0, ym, dDir, nMin, nMax);
+			xa = 0.0; ya = ym;
+		}
+		else
+		{
+			raster_cell(pCov, pArea, 0, 0.0, ym, 0.0, yb, dDir, nMin, nMax);
+			xb = 0.0; yb = ym;
+		}
+	}
+
+	if (xa > dW || xb > dW)
+	{
+		if (xa >= dW && xb >= dW)
+			return;
+
+		const GDouble ym = ya + (dW - xa) * (yb - ya) / (xb - xa);
+
+		if (xa > dW)
+		{
+			xa = dW; ya = ym;
+		}
+		else
+		{
+			xb = dW; yb = ym;
+		}
+	}
+
+	const GInt c0 = std::min(GInt(std::floor(xa)), nWidth - 1);
+	const GInt c1 = std::min(GInt(std::floor(xb)), nWidth - 1);
+
+	if (c0 == c1)
+	{
+		raster_cell(pCov, pArea, c0, xa, ya, xb, yb, dDir, nMin, nMax);
+		return;
+	}
+
+	// Split at pixel borders
+	const GInt	  nStep  = (c1 > c0) ? 1 : -1;
+	const GDouble dSlope = (yb - ya) / (xb - xa);
+
+	GDouble x = xa, y = ya;
+
+	for (GInt c = c0; c != c1; c += nStep)
+	{
+		const GDouble xBorder = (nStep > 0) ? GDouble(c + 1) : GDouble(c);
+		const GDouble yBorder = ya + (xBorder - xa) * dSlope;
+
+		raster_cell(pCov, pArea, c, x, y, xBorder, yBorder, dDir, nMin, nMax);
+		x = xBorder; y = yBorder;
+	}
+
+	raster_cell(pCov, pArea, c1, x, y, xb, yb, dDir, nMin, nMax);
+}
+
+/***********************************************************************************
+*! @brief  : Rasterize rows [nRow0, nRow1) with active edge table
+*! @param  : [in] pEdge  : edges sorted by top
+*! @param  : [in] pIndex : edges of band (sorted, NULL : all edges)
+*! @param  : [in] pCov   : zeroed cell buffer (nWidth + 1), zeroed on return
+*! @param  : [in] pArea  : zeroed cell buffer (nWidth + 1), zeroed on return
+***********************************************************************************/
+template<typename T>
+static void raster_rows(const RasterEdge* pEdge, const uint32_t* pIndex, size_t nEdge, GInt nWidth, GInt nRow0, GInt nRow1,
+						T* pBuffer, GInt nStride, EnumFillRule eFill, GFloat* pCov, GFloat* pArea, ScratchVecIndex& vecActive)
+{
+	size_t nNext = 0;
+	vecActive.clear();
+
+	for (GInt r = nRow0; r < nRow1; r++)
+	{
+		const GFloat fTop = GFloat(r), fBottom = GFloat(r + 1);
+
+		// 1. Active edge table : insert edges starting above row bottom
+		while (nNext < nEdge)
+		{
+			const uint32_t e = pIndex ? pIndex[nNext] : uint32_t(nNext);
+
+			if (pEdge[e].m_y0 >= fBottom)
+				break;
+
+			vecActive.push_back(e);
+			nNext++;
+		}
+
+		// 2. Remove finished edges, add row piece of other edges
+		GInt nMin = nWidth, nMax = -1;
+		size_t nKeep = 0;
+
+		for (size_t k = 0; k < vecActive.size(); k++)
+		{
+			const RasterEdge& edge = pEdge[vecActive[k]];
+
+			if (edge.m_y1 <= fTop)
+				continue;
+
+			vecActive[nKeep++] = vecActive[k];
+
+			const GDouble yt = std::max(GDouble(edge.m_y0), GDouble(fTop));
+			const GDouble yb = std::min(GDouble(edge.m_y1), GDouble(fBottom));
+
+			if (yb <= yt)
+				continue;
+
+			const GDouble xt = edge.m_x0 + (yt - edge.m_y0) * edge.m_fDxDy;
+			const GDouble xb = edge.m_x0 + (yb - edge.m_y0) * edge.m_fDxDy;
+
+			raster_line(pCov, pArea, nWidth, xt, yt - r, xb, yb - r, edge.m_fDir, nMin, nMax);
+		}
+
+		vecActive.resize(nKeep);
+
+		// 3. Scan row : winding = cover of cells on the left + area of cell
+		T* pRow = pBuffer + size_t(r) * size_t(nStride);
+
+		if (nMax < 0)
+		{
+			std::fill(pRow, pRow + nWidth, T(0));
+			continue;
+		}
+
+		std::fill(pRow, pRow + nMin, T(0));
+
+		GFloat fAcc = 0.f;
+
+		for (GInt x = nMin; x <= nMax; x++)
+		{
+			raster_store(pRow[x], raster_alpha(fAcc + pArea[x], eFill));
+			fAcc += pCov[x];
+
+			pArea[x] = 0.f;
+			pCov[x]  = 0.f;
+		}
+
+		T tRest;
+		raster_store(tRest, raster_alpha(fAcc, eFill));
+		std::fill(pRow + nMax + 1, pRow + nWidth, tRest);
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Rasterize all rows (serial)
+***********************************************************************************/
+template<typename T>
+static void raster_render(const std::vector<RasterEdge>& vecEdge, GInt nWidth, GInt nHeight,
+						  T* pBuffer, GInt nStride, EnumFillRule eFill)
+{
+	std::vector<GFloat> vecCov(nWidth + 1, 0.f), vecArea(nWidth + 1, 0.f);
+	ScratchVecIndex vecActive;
+
+	raster_rows(vecEdge.data(), (const uint32_t*)NULL, vecEdge.size(), nWidth, 0, nHeight,
+				pBuffer, nStride, eFill, vecCov.data(), vecArea.data(), vecActive);
+}
+
+/***********************************************************************************
+*! @brief  : Rasterize bands of nTileRows rows on pool
+*! @note   : Edges are binned to the bands they cross (sorted order is kept), the
+*!           active edges of a band are in the same order as the serial render
+***********************************************************************************/
+template<typename T>
+static void raster_render(const std::vector<RasterEdge>& vecEdge, GInt nWidth, GInt nHeight,
+						  T* pBuffer, GInt nStride, EnumFillRule eFill, GeoThreadPool& pool, GInt nThread, GInt nTileRows)
+{
+	nTileRows = std::max(nTileRows, 1);
+
+	const GInt nBand = (nHeight + nTileRows - 1) / nTileRows;
+
+	auto funBandRange = [&](const RasterEdge& edge, GInt& b0, GInt& b1)
+	{
+		const GInt r0 = std::max(GInt(std::floor(edge.m_y0)), 0);
+		const GInt r1 = std::min(GInt(std::ceil(edge.m_y1)) - 1, nHeight - 1);
+
+		b0 = r0 / nTileRows;
+		b1 = (r1 < r0) ? b0 - 1 : r1 / nTileRows;
+	};
+
+	std::vector<uint32_t> vecBandBegin(nBand + 1, 0), vecBandEdge;
+
+	for (const RasterEdge& edge : vecEdge)
+	{
+		GInt b0, b1;
+		funBandRange(edge, b0, b1);
+
+		for (GInt b = b0; b <= b1; b++)
+		{
+			vecBandBegin[b + 1]++;
+		}
+	}
+
+	for (GInt b = 0; b < nBand; b++)
+	{
+		vecBandBegin[b + 1] += vecBandBegin[b];
+	}
+
+	vecBandEdge.resize(vecBandBegin[nBand]);
+	std::vector<uint32_t> vecBandPos(vecBandBegin.begin(), vecBandBegin.end() - 1);
+
+	for (size_t e = 0; e < vecEdge.size(); e++)
+	{
+		GInt b0, b1;
+		funBandRange(vecEdge[e], b0, b1);
+
+		for (GInt b = b0; b <= b1; b++)
+		{
+			vecBandEdge[vecBandPos[b]++] = uint32_t(e);
+		}
+	}
+
+	pool.parallel_for(size_t(nBand), [&](size_t nTask, GInt nWorker)
+	{
+		GeoScratch& scratch = pool.scratch(nWorker);
+		GeoScratchFrame frame(scratch);
+
+		GFloat* pCov  = scratch.alloc_array<GFloat>(size_t(nWidth) + 1);
+		GFloat* pArea = scratch.alloc_array<GFloat>(size_t(nWidth) + 1);
+
+		std::fill(pCov, pCov + nWidth + 1, 0.f);
+		std::fill(pArea, pArea + nWidth + 1, 0.f);
+
+		ScratchVecIndex vecActive{ ScratchAllocator<uint32_t>(&scratch) };
+
+		const GInt nRow0 = GInt(nTask) * nTileRows;
+		const GInt nRow1 = std::min(nRow0 + nTileRows, nHeight);
+
+		raster_rows(vecEdge.data(), vecBandEdge.data() + vecBandBegin[nTask], vecBandBegin[nTask + 1] - vecBandBegin[nTask],
+					nWidth, nRow0, nRow1, pBuffer, nStride, eFill, pCov, pArea, vecActive);
+	}, nThread);
+}
+
+ScanlineRasterizer2D::ScanlineRasterizer2D(GInt nWidth, GInt nHeight) :
+	m_nWidth(std::max(nWidth, 0)), m_nHeight(std::max(nHeight, 0)), m_ptOrigin(0.f, 0.f), m_fScale(1.f), m_bSorted(GTrue)
+{
+
+}
+
+/***********************************************************************************
+*! @brief  : Remove edges and set canvas size
+*! @param  : [in] nWidth  : width (pixel)
+*! @param  : [in] nHeight : height (pixel)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+void ScanlineRasterizer2D::reset(GInt nWidth, GInt nHeight)
+{
+	m_nWidth  = std::max(nWidth, 0);
+	m_nHeight = std::max(nHeight, 0);
+
+	clear();
+}
+
+/***********************************************************************************
+*! @brief  : World to pixel transform of next added rings
+*! @param  : [in] ptOrigin : world point at pixel (0, 0) corner
+*! @param  : [in] fScale   : pixel per world unit
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Default : origin (0, 0), scale 1 (input is in pixel space)
+***********************************************************************************/
+void ScanlineRasterizer2D::set_transform(const Point2D& ptOrigin, GFloat fScale)
+{
+	m_ptOrigin = ptOrigin;
+	m_fScale   = fScale;
+}
+
+/***********************************************************************************
+*! @brief  : Add ring (closed, closing point not repeated)
+*! @param  : [in] pts  : points
+*! @param  : [in] nCnt : number of point
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Horizontal edges and edges out of canvas rows are skipped
+***********************************************************************************/
+void ScanlineRasterizer2D::add_ring(const Point2D* pts, size_t nCnt)
+{
+	if (nCnt < 3)
+		return;
+
+	const GDouble dScale = m_fScale;
+
+	auto funPixel = [&](const Point2D& pt, GDouble& x, GDouble& y)
+	{
+		x = (GDouble(pt.x) - m_ptOrigin.x) * dScale;
+		y = (GDouble(pt.y) - m_ptOrigin.y) * dScale;
+	};
+
+	GDouble x1, y1;
+	funPixel(pts[nCnt - 1], x1, y1);
+
+	for (size_t i = 0; i < nCnt; i++)
+	{
+		const GDouble x0 = x1, y0 = y1;
+		funPixel(pts[i], x1, y1);
+
+		if (y0 == y1)
+			continue;
+
+		const GBool bUp = (y1 < y0) ? GTrue : GFalse;
+
+		const GDouble xt = bUp ? x1 : x0, yt = bUp ? y1 : y0;
+		const GDouble xb = bUp ? x0 : x1, yb = bUp ? y0 : y1;
+
+		if (yb <= 0.0 || yt >= GDouble(m_nHeight) || std::min(xt, xb) >= GDouble(m_nWidth))
+			continue;
+
+		m_vecEdge.push_back(RasterEdge{ GFloat(xt), GFloat(yt), GFloat(yb), GFloat((xb - xt) / (yb - yt)), bUp ? 1.f : -1.f });
+	}
+
+	m_bSorted = GFalse;
+}
+
+void ScanlineRasterizer2D::add_ring(const VecPoint2D& ring)
+{
+	add_ring(ring.data(), ring.size());
+}
+
+/***********************************************************************************
+*! @brief  : Add all rings
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+void ScanlineRasterizer2D::add_polygons(const VecPolyList& vecPoly)
+{
+	for (const VecPoint2D& ring : vecPoly)
+	{
+		add_ring(ring);
+	}
+}
+
+void ScanlineRasterizer2D::add_polygons(const MultiPolygon2D& mpoly)
+{
+	m_vecEdge.reserve(m_vecEdge.size() + mpoly.point_count());
+
+	for (size_t r = 0; r < mpoly.ring_count(); r++)
+	{
+		add_ring(mpoly.ring_data(r), mpoly.ring_size(r));
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Remove all edges (canvas size and transform are kept)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+void ScanlineRasterizer2D::clear()
+{
+	m_vecEdge.clear();
+	m_bSorted = GTrue;
+}
+
+/***********************************************************************************
+*! @brief  : Sort edges by top (stable : same order for same input)
+***********************************************************************************/
+void ScanlineRasterizer2D::sort_edges()
+{
+	if (m_bSorted)
+		return;
+
+	std::stable_sort(m_vecEdge.begin(), m_vecEdge.end(), [](const RasterEdge& e1, const RasterEdge& e2)
+	{
+		return e1.m_y0 < e2.m_y0;
+	});
+
+	m_bSorted = GTrue;
+}
+
+/***********************************************************************************
+*! @brief  : Coverage mask of added rings
+*! @param  : [out] pBuffer : canvas (all pixels written, 0 : empty)
+*! @param  : [in ] nStride : element count between rows (>= width)
+*! @param  : [in ] eFill   : fill rule (FILL_POSITIVE : ring with positive
+*!                           area, CCW in world, is filled)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : uint8_t : 0 - 255 | GFloat : 0 - 1
+***********************************************************************************/
+void ScanlineRasterizer2D::render(uint8_t* pBuffer, GInt nStride, EnumFillRule eFill)
+{
+	if (m_nWidth == 0 || m_nHeight == 0)
+		return;
+
+	sort_edges();
+	raster_render(m_vecEdge, m_nWidth, m_nHeight, pBuffer, nStride, eFill);
+}
+
+void ScanlineRasterizer2D::render(GFloat* pBuffer, GInt nStride, EnumFillRule eFill)
+{
+	if (m_nWidth == 0 || m_nHeight == 0)
+		return;
+
+	sort_edges();
+	raster_render(m_vecEdge, m_nWidth, m_nHeight, pBuffer, nStride, eFill);
+}
+
+/***********************************************************************************
+*! @brief  : Coverage mask of added rings (tiled, multithread)
+*! @param  : [out] pBuffer   : canvas (all pixels written, 0 : empty)
+*! @param  : [in ] nStride   : element count between rows (>= width)
+*! @param  : [in ] eFill     : fill rule
+*! @param  : [in ] pool      : thread pool
+*! @param  : [in ] nThread   : max number of worker (<= 0 : all)
+*! @param  : [in ] nTileRows : number of row of a tile (band)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Same output as serial render
+***********************************************************************************/
+void ScanlineRasterizer2D::render(uint8_t* pBuffer, GInt nStride, EnumFillRule eFill, GeoThreadPool& pool,
+								  GInt nThread, GInt nTileRows)
+{
+	if (m_nWidth == 0 || m_nHeight == 0)
+		return;
+
+	sort_edges();
+	raster_render(m_vecEdge, m_nWidth, m_nHeight, pBuffer, nStride, eFill, pool, nThread, nTileRows);
+}
+
+void ScanlineRasterizer2D::render(GFloat* pBuffer, GInt nStride, EnumFillRule eFill, GeoThreadPool& pool,
+								  GInt nThread, GInt nTileRows)
+{
+	if (m_nWidth == 0 || m_nHeight == 0)
+		return;
+
+	sort_edges();
+	raster_render(m_vecEdge, m_nWidth, m_nHeight, pBuffer, nStride, eFill, pool, nThread, nTileRows);
+}
+
+/***********************************************************************************
+*! @brief  : Coverage mask of polygons (8 bit)
+*! @param  : [in ] vecPoly  : rings (world)
+*! @param  : [in ] rect     : world window of canvas (x, y : pixel (0, 0) corner)
+*! @param  : [in ] nWidth   : width (pixel)
+*! @param  : [in ] nHeight  : height (pixel)
+*! @param  : [out] vecMask  : nWidth * nHeight values (replaced, row 0 at rect.y)
+*! @param  : [in ] eFill    : fill rule
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Scale is nWidth / rect.width (rect.height is not used)
+***********************************************************************************/
+Dllexport void rasterize_polygon(const VecPolyList& vecPoly, const Rect2D& rect, GInt nWidth, GInt nHeight,
+								 std::vector<uint8_t>& vecMask, EnumFillRule eFill)
+{
+	vecMask.assign(size_t(std::max(nWidth, 0)) * size_t(std::max(nHeight, 0)), 0);
+
+	if (nWidth <= 0 || nHeight <= 0 || !(rect.width > 0.f))
+		return;
+
+	ScanlineRasterizer2D raster(nWidth, nHeight);
+	raster.set_transform(Point2D(rect.x, rect.y), GFloat(nWidth) / rect.width);
+	raster.add_polygons(vecPoly);
+	raster.render(vecMask.data(), nWidth, eFill);
+}
+
+}}
@@ -1,8 +1,9 @@
 #include "x2drel.h"
 #include "x2dbase.h"
 #include "xgeosp.h"
-#include "x2dint.h"
+#include "x2dkernel.h"
 #include <cassert>
+#include <algorithm>
 
 namespace geo {namespace v2 {
 
@@ -15,8 +16,7 @@ namespace geo {namespace v2 {
 ************************************************************************************/
 Dllexport GBool is_same(const Point2D& p1, const Point2D& p2, const GFloat& ftolerance)
 {
-	return is_equal(p1.x, p2.x, ftolerance) &&
-		is_equal(p1.y, p2.y, ftolerance);
+	return kernel::is_same(p1, p2, ftolerance);
 }
 
 /***********************************************************************************
@@ -26,19 +26,9 @@ Dllexport GBool is_same(const Point2D& p1, const Point2D& p2, const GFloat& ftol
 @param		[in] ftolerance : > math_epsilon
 @return		true : same | false : not same
 ***********************************************************************************/
-Dllexport bool is_same_direction(const Vec2D& v1, const Point2D& v2, const GFloat& ftolerance /* = MATH_EPSILON*/)
+Dllexport GBool is_same_direction(const Vec2D& v1, const Point2D& v2, const GFloat& ftolerance /* = MATH_EPSILON*/)
 {
-	Vec2D vn1 = normalize(v1);
-	Vec2D vn2 = normalize(v2);
-
-	float fCrs = cross(vn1, vn2);
-
-	// Point in straight line
-	if (geo::is_equal(fCrs, 0.f, ftolerance))
-	{
-		return is_same_sign(vn1, vn2);
-	}
-	return GFalse;
+	return kernel::is_same_direction(v1, v2, ftolerance);
 }
 
 /***********************************************************************************
@@ -50,7 +40,7 @@ Dllexport bool is_same_direction(const Vec2D& v1, const Point2D& v2, const GFloa
 ***********************************************************************************/
 Dllexport GBool is_same_sign(const Vec2D& v1, const Point2D& v2)
 {
-	return ((v1.x * v2.x) >= 0 && (v1.y * v2.y) >= 0) ? GTrue : GFalse;
+	return kernel::is_same_sign(v1, v2);
 }
 
 /***********************************************************************************
@@ -60,17 +50,12 @@ Dllexport GBool is_same_sign(const Vec2D& v1, const Point2D& v2)
 ***********************************************************************************/
 Dllexport GBool is_ccw(const VecPoint2D& poly)
 {
-	int nPolyCnt = static_cast<int>(poly.size());
-
-	int nNext; float fSum = 0.f;
-
-	for (int i = 0; i < nPolyCnt; i++)
-	{
-		nNext = (i + 1) % nPolyCnt;
-		fSum += (poly[nNext].x - poly[i].x) * (poly[nNext].y + poly[i].y);
-	}
+	return is_ccw(RingView2D(poly));
+}
 
-	return (fSum <= 0.f) ? GTrue : GFalse;
+Dllexport GBool is_ccw(const RingView2D& poly)
+{
+	return kernel::is_ccw(poly.data(), poly.size());
 }
 
 /***********************************************************************************
@@ -82,14 +67,11 @@ Dllexport GBool is_ccw(const VecPoint2D& poly)
 *!					   | RIGHT     : ptc on the right p1p2
 *!					   | LEFT      : ptc on the left  p1p2
 *! @author : thuong.nv			- [Date] : 08/07/2023
+*! @note   : Use exact sign when predicate is PRED_EXACT (set_predicate)
 ***********************************************************************************/
 Dllexport EnumOrien get_orientation_point_vector(const Point2D& pt1, const Point2D& pt2, const Point2D& ptC)
 {
-	const float fOrin = (pt2.x - pt1.x) * (ptC.y - pt1.y) - (ptC.x - pt1.x) * (pt2.y - pt1.y);
-
-	if (geo::is_equal(fOrin, 0.f, MATH_EPSILON)) return EnumOrien::COLLINEAR; /* ptc and p1p2 collinear */
-	else if (fOrin < 0.f)	return EnumOrien::RIGHT; /* ptc on the right p1p2 */
-	else	return EnumOrien::LEFT;	/* ptc on the left p1p2 */
+	return kernel::orientation(pt1, pt2, ptC);
 }
 
 /***********************************************************************************
@@ -105,32 +87,7 @@ Dllexport EnumOrien get_orientation_point_vector(const Point2D& pt1, const Point
 ***********************************************************************************/
 Dllexport GInt rel_point_lsegment(const Point2D& pt1, const Point2D& pt2, const Point2D& pt)
 {
-	Vec2D vp1p  = pt - pt1; // Vector vp1p ;
-	Vec2D vp1p2 = pt2 - pt1; // Vector vp2p ;
-
-	float fCrs =  cross(vp1p, vp1p2);
-
-	// Is not in line segment
-	if (!is_equal(fCrs, 0.f, MATH_EPSILON))
-		return 0;
-
-	float fDot_p1p_p1p2 = dot(vp1p2, vp1p);
-
-	// Same p1
-	if (fDot_p1p_p1p2 < 0)
-		return 0;
-	if (is_equal(fDot_p1p_p1p2, 0, MATH_EPSILON) == GTrue)
-		return 2;
-
-	// Same p2
-	float fDot_p1p2_p1p2 = dot(vp1p2, vp1p2);
-
-	if (fDot_p1p_p1p2 > fDot_p1p2_p1p2)
-		return 0;
-	if (is_equal(fDot_p1p_p1p2, fDot_p1p2_p1p2, MATH_EPSILON) == true)
-		return 2;
-
-	return 1;
+	return kernel::rel_point_lsegment(pt1, pt2, pt);
 }
 
 /***********************************************************************************
@@ -140,27 +97,12 @@ Dllexport GInt rel_point_lsegment(const Point2D& pt1, const Point2D& pt2, const
 ***********************************************************************************/
 Dllexport GBool is_convex_polygon(const VecPoint2D& poly)
 {
-	int nPolyCnt = static_cast<int>(poly.size());
-
-	if (nPolyCnt < 3)
-		return GFalse;
-
-	EnumOrien ePreOrien = EnumOrien::COLLINEAR;
-
-	for (int i = 0; i < nPolyCnt - 2; i++)
-	{
-		EnumOrien eCurOrien = get_orientation_point_vector(poly[i], poly[i + 1], poly[i + 2]);
-
-		if (eCurOrien  != EnumOrien::COLLINEAR &&
-			(ePreOrien != EnumOrien::COLLINEAR && eCurOrien != ePreOrien))
-		{
-			return GFalse;
-		}
-
-		ePreOrien = eCurOrien;
-	}
+	return is_convex_polygon(RingView2D(poly));
+}
 
-	return GTrue;
+Dllexport GBool is_convex_polygon(const RingView2D& poly)
+{
+	return kernel::is_convex_polygon(poly.data(), poly.size());
 }
 
 /***********************************************************************************
@@ -172,27 +114,7 @@ Dllexport GBool is_convex_polygon(const VecPoint2D& poly)
 ***********************************************************************************/
 Dllexport GBool is_point_in_lsegment(const Point2D& pt1, const Point2D& pt2, const Point2D& pt)
 {
-	Vec2D vp1p = pt - pt1; // Vector vp1p ;
-	Vec2D vp2p = pt - pt2; // Vector vp2p ;
-
-	GFloat fCrs = cross(vp1p, vp2p);
-
-	// Point in straight line
-	if (geo::is_equal(fCrs, 0.f, MATH_EPSILON))
-	{
-		// TODO : improve
-		// Point in side line Segment 
-		GFloat fp1pDistance  = mag(vp1p);
-		GFloat fp2pDistance  = mag(vp2p);
-		GFloat fp1p2Distance = mag(pt1 - pt2);
-
-		if (fp1pDistance <= fp1p2Distance &&
-			fp2pDistance <= fp1p2Distance)
-		{
-			return GTrue;
-		}
-	}
-	return GFalse;
+	return kernel::is_point_in_lsegment(pt1, pt2, pt);
 }
 
 /***********************************************************************************
@@ -204,16 +126,7 @@ Dllexport GBool is_point_in_lsegment(const Point2D& pt1, const Point2D& pt2, con
 ***********************************************************************************/
 Dllexport GBool is_snap_point_to_lsegment(const Point2D& pt1, const Point2D& pt2, const Point2D& pt, const GFloat& fSnap)
 {
-	Point2D ptProj;
-
-	if (get_projection_point_to_lsegment(pt1, pt2, pt, &ptProj, true) >= 1)
-	{
-		float fDisProj = mag(ptProj - pt);
-
-		return fDisProj <= std::abs(fSnap);
-	}
-
-	return false;
+	return kernel::is_snap_point_to_lsegment(pt1, pt2, pt, fSnap);
 }
 
 /***********************************************************************************
@@ -225,17 +138,7 @@ Dllexport GBool is_snap_point_to_lsegment(const Point2D& pt1, const Point2D& pt2
 ***********************************************************************************/
 Dllexport GBool is_point_in_line(const Point2D& pt1, const Point2D& pt2, const Point2D& pt)
 {
-	Vec2D vp1p = pt - pt1; // Vector vp1p ;
-	Vec2D vp2p = pt - pt2; // Vector vp2p ;
-
-	GFloat fCrs = cross(vp1p, vp2p);
-
-	// Point in straight line
-	if (is_equal(fCrs, 0.f, MATH_EPSILON))
-	{
-		return GTrue;
-	}
-	return GFalse;
+	return kernel::is_point_in_line(pt1, pt2, pt);
 }
 
 /***********************************************************************************
@@ -247,11 +150,7 @@ Dllexport GBool is_point_in_line(const Point2D& pt1, const Point2D& pt2, const P
 ***********************************************************************************/
 Dllexport GBool is_snap_point_to_line(const Point2D& pt1, const Point2D& pt2, const Point2D& pt, const GFloat& fSnap)
 {
-	Point2D ptProj = get_projection_point_to_line(pt1, pt2, pt);
-
-	GFloat fDisProj = mag(ptProj - pt);
-
-	return (fDisProj <= std::abs(fSnap))? GTrue : GFalse;
+	return kernel::is_snap_point_to_line(pt1, pt2, pt, fSnap);
 }
 
 /***********************************************************************************
@@ -264,18 +163,7 @@ Dllexport GBool is_snap_point_to_line(const Point2D& pt1, const Point2D& pt2, co
 ***********************************************************************************/
 Dllexport GBool is_point_in_ray(const Point2D& pt, const Vec2D& vn, const Point2D& ptc)
 {
-	Point2D pt2 = move(pt, vn, 1.f);
-
-	if (is_point_in_line(pt, pt2, ptc))
-	{
-		// unit vector ptpc
-		Vec2D vptpc = normalize(ptc - pt);
-
-		return  (vptpc.x * vn.x) >= 0 &&
-				(vptpc.y * vn.y) >= 0;
-	}
-
-	return GFalse;
+	return kernel::is_point_in_ray(pt, vn, ptc);
 }
 
 }}
\ No newline at end of file
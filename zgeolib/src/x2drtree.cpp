@@ -0,0 +1,485 @@
+#include "x2drtree.h"
+
+#include <cmath>
+#include <cstring>
+#include <queue>
+#include <algorithm>
+
+namespace geo { namespace v2 {
+
+/***********************************************************************************
+*! @brief  : Header of serialized tree
+***********************************************************************************/
+typedef struct tagRTreeHeader
+{
+	char		m_szMagic[4];	// "ZGRT"
+	uint32_t	m_nVersion;
+	uint32_t	m_nNodeSize;
+	uint32_t	m_nLevel;		// number of level
+	uint32_t	m_nNode;		// number of node
+
+} RTreeHeader;
+
+static const char		RTREE_MAGIC[4]  = { 'Z', 'G', 'R', 'T' };
+static const uint32_t	RTREE_VERSION   = 1;
+
+/***********************************************************************************
+*! @brief  : Box of empty item (never overlaps anything)
+***********************************************************************************/
+static void rtree_empty_node(PackedRTree::Node& node)
+{
+	node.m_fMinX = FLT_MAX;  node.m_fMinY = FLT_MAX;
+	node.m_fMaxX = -FLT_MAX; node.m_fMaxY = -FLT_MAX;
+}
+
+static void rtree_ring_node(const Point2D* pts, size_t nCnt, PackedRTree::Node& node)
+{
+	rtree_empty_node(node);
+
+	for (size_t i = 0; i < nCnt; i++)
+	{
+		node.m_fMinX = std::min<GFloat>(node.m_fMinX, pts[i].x);
+		node.m_fMinY = std::min<GFloat>(node.m_fMinY, pts[i].y);
+		node.m_fMaxX = std::max<GFloat>(node.m_fMaxX, pts[i].x);
+		node.m_fMaxY = std::max<GFloat>(node.m_fMaxY, pts[i].y);
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Sort-Tile-Recursive order of one level : sort by center x, cut into
+*!           vertical slabs of (slab count * node size) nodes, sort slab by center y
+*! @param  : [in] arNode    : level nodes
+*! @param  : [in] nCnt      : number of node
+*! @param  : [in] nNodeSize : max children per node
+***********************************************************************************/
+static void rtree_str_sort(PackedRTree::Node* arNode, uint32_t nCnt, uint32_t nNodeSize)
+{
+	if (nCnt <= nNodeSize)
+		return;
+
+	auto less_x = [](const PackedRTree::Node& a, const PackedRTree::Node& b)
+	{
+		return a.m_fMinX + a.m_fMaxX < b.m_fMinX + b.m_fMaxX;
+	};
+
+	auto less_y = [](const PackedRTree::Node& a, const PackedRTree::Node& b)
+	{
+		return a.m_fMinY + a.m_fMaxY < b.m_fMinY + b.m_fMaxY;
+	};
+
+	uint32_t nParent   = (nCnt + nNodeSize - 1) / nNodeSize;
+	uint32_t nSlab     = static_cast<uint32_t>(std::ceil(std::sqrt(static_cast<GDouble>(nParent))));
+	uint32_t nSlabSize = ((nParent + nSlab - 1) / nSlab) * nNodeSize;
+
+	std::sort(arNode, arNode + nCnt, less_x);
+
+	for (uint32_t i = 0; i < nCnt; i += nSlabSize)
+	{
+		uint32_t nEnd = std::min(i + nSlabSize, nCnt);
+		std::sort(arNode + i, arNode + nEnd, less_y);
+	}
+}
+
+static inline GBool rtree_overlap(const PackedRTree::Node& node, GFloat fMinX, GFloat fMinY, GFloat fMaxX, GFloat fMaxY)
+{
+	return node.m_fMinX <= fMaxX && node.m_fMaxX >= fMinX &&
+		   node.m_fMinY <= fMaxY && node.m_fMaxY >= fMinY;
+}
+
+static inline GFloat rtree_dist2(const PackedRTree::Node& node, GFloat x, GFloat y)
+{
+	GFloat dx = std::max<GFloat>(std::max<GFloat>(node.m_fMinX - x, x - node.m_fMaxX), 0.f);
+	GFloat dy = std::max<GFloat>(std::max<GFloat>(node.m_fMinY - y, y - node.m_fMaxY), 0.f);
+	return dx * dx + dy * dy;
+}
+
+PackedRTree::PackedRTree() : m_nNodeSize(16)
+{
+
+}
+
+/***********************************************************************************
+*! @brief  : Build tree from polygon list (item i : polys[i])
+*! @param  : [in] polys     : polygon list
+*! @param  : [in] nNodeSize : max children per node [2 ~ 65535]
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Empty polygon is kept as item but never returned by query
+***********************************************************************************/
+void PackedRTree::build(const VecPolyList& polys, uint32_t nNodeSize)
+{
+	m_vecNode.resize(polys.size());
+
+	for (size_t i = 0; i < polys.size(); i++)
+	{
+		rtree_ring_node(polys[i].data(), polys[i].size(), m_vecNode[i]);
+		m_vecNode[i].m_nIndex = static_cast<uint32_t>(i);
+	}
+
+	build_levels(nNodeSize);
+}
+
+/***********************************************************************************
+*! @brief  : Build tree from multipolygon (item i : polygon i, use outer ring)
+*! @param  : [in] mpoly     : multipolygon
+*! @param  : [in] nNodeSize : max children per node [2 ~ 65535]
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+void PackedRTree::build(const MultiPolygon2D& mpoly, uint32_t nNodeSize)
+{
+	m_vecNode.resize(mpoly.poly_count());
+
+	for (size_t i = 0; i < mpoly.poly_count(); i++)
+	{
+		if (mpoly.poly_ring_begin(i) < mpoly.poly_ring_end(i))
+		{
+			size_t r = mpoly.poly_ring_begin(i);
+			rtree_ring_node(mpoly.ring_data(r), mpoly.ring_size(r), m_vecNode[i]);
+		}
+		else
+		{
+			rtree_empty_node(m_vecNode[i]);
+		}
+
+		m_vecNode[i].m_nIndex = static_cast<uint32_t>(i);
+	}
+
+	build_levels(nNodeSize);
+}
+
+/***********************************************************************************
+*! @brief  : Build tree from bounding box list (item i : [arMin[i], arMax[i]])
+*! @param  : [in] arMin     : box min list
+*! @param  : [in] arMax     : box max list
+*! @param  : [in] nCnt      : number of box
+*! @param  : [in] nNodeSize : max children per node [2 ~ 65535]
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+void PackedRTree::build(const Point2D* arMin, const Point2D* arMax, size_t nCnt, uint32_t nNodeSize)
+{
+	m_vecNode.resize(nCnt);
+
+	for (size_t i = 0; i < nCnt; i++)
+	{
+		Node& node   = m_vecNode[i];
+		node.m_fMinX = arMin[i].x; node.m_fMinY = arMin[i].y;
+		node.m_fMaxX = arMax[i].x; node.m_fMaxY = arMax[i].y;
+		node.m_nIndex = static_cast<uint32_t>(i);
+	}
+
+	build_levels(nNodeSize);
+}
+
+/***********************************************************************************
+*! @brief  : Build upper levels from leaves (m_vecNode contains only leaves)
+*! @param  : [in] nNodeSize : max children per node
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+void PackedRTree::build_levels(uint32_t nNodeSize)
+{
+	m_nNodeSize = std::min<uint32_t>(std::max<uint32_t>(nNodeSize, 2), 65535);
+	m_vecLevel.clear();
+
+	if (m_vecNode.empty())
+		return;
+
+	uint32_t nItem  = static_cast<uint32_t>(m_vecNode.size());
+	uint32_t nTotal = nItem;
+
+	for (uint32_t n = nItem; n > 1; )
+	{
+		n = (n + m_nNodeSize - 1) / m_nNodeSize;
+		nTotal += n;
+	}
+
+	m_vecNode.reserve(nTotal);
+	m_vecLevel.reserve(32);
+
+	uint32_t nBegin = 0, nEnd = nItem;
+
+	rtree_str_sort(m_vecNode.data(), nItem, m_nNodeSize);
+	m_vecLevel.push_back(0);
+	m_vecLevel.push_back(nEnd);
+
+	while (nEnd - nBegin > 1)
+	{
+		for (uint32_t i = nBegin; i < nEnd; i += m_nNodeSize)
+		{
+			uint32_t nLast = std::min(i + m_nNodeSize, nEnd);
+
+			Node parent;
+			rtree_empty_node(parent);
+			parent.m_nIndex = i;
+
+			for (uint32_t j = i; j < nLast; j++)
+			{
+				const Node& child = m_vecNode[j];
+				parent.m_fMinX = std::min<GFloat>(parent.m_fMinX, child.m_fMinX);
+				parent.m_fMinY = std::min<GFloat>(parent.m_fMinY, child.m_fMinY);
+				parent.m_fMaxX = std::max<GFloat>(parent.m_fMaxX, child.m_fMaxX);
+				parent.m_fMaxY = std::max<GFloat>(parent.m_fMaxY, child.m_fMaxY);
+			}
+
+			m_vecNode.push_back(parent);
+		}
+
+		nBegin = nEnd;
+		nEnd   = static_cast<uint32_t>(m_vecNode.size());
+
+		rtree_str_sort(m_vecNode.data() + nBegin, nEnd - nBegin, m_nNodeSize);
+		m_vecLevel.push_back(nEnd);
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Remove all nodes
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+void PackedRTree::clear()
+{
+	m_vecNode.clear();
+	m_vecLevel.clear();
+}
+
+/***********************************************************************************
+*! @brief  : End of children range (children are cut at the end of their level)
+*! @param  : [in] nFirst : first child node
+*! @return : last child node + 1
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+uint32_t PackedRTree::child_end(uint32_t nFirst) const
+{
+	uint32_t nLevelEnd = *std::upper_bound(m_vecLevel.begin(), m_vecLevel.end(), nFirst);
+	return std::min(nFirst + m_nNodeSize, nLevelEnd);
+}
+
+/***********************************************************************************
+*! @brief  : Find items whose bounding box overlaps window
+*! @param  : [in ] ptMin     : window min
+*! @param  : [in ] ptMax     : window max
+*! @param  : [out] vecResult : item index list (appended)
+*! @return : number of item found
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+size_t PackedRTree::query_window(const Point2D& ptMin, const Point2D& ptMax, std::vector<uint32_t>& vecResult) const
+{
+	if (m_vecNode.empty())
+		return 0;
+
+	GFloat fMinX = ptMin.x, fMinY = ptMin.y;
+	GFloat fMaxX = ptMax.x, fMaxY = ptMax.y;
+
+	uint32_t nItem = m_vecLevel[1];
+	uint32_t nRoot = static_cast<uint32_t>(m_vecNode.size() - 1);
+	size_t   nOld  = vecResult.size();
+
+	if (!rtree_overlap(m_vecNode[nRoot], fMinX, fMinY, fMaxX, fMaxY))
+		return 0;
+
+	std::vector<uint32_t> vecStack;
+	vecStack.reserve(m_nNodeSize * level_count());
+	vecStack.push_back(nRoot);
+
+	while (!vecStack.empty())
+	{
+		uint32_t i = vecStack.back();
+		vecStack.pop_back();
+
+		if (i < nItem)
+		{
+			vecResult.push_back(m_vecNode[i].m_nIndex);
+			continue;
+		}
+
+		uint32_t nFirst = m_vecNode[i].m_nIndex;
+		uint32_t nLast  = child_end(nFirst);
+
+		for (uint32_t j = nFirst; j < nLast; j++)
+		{
+			if (rtree_overlap(m_vecNode[j], fMinX, fMinY, fMaxX, fMaxY))
+				vecStack.push_back(j);
+		}
+	}
+
+	return vecResult.size() - nOld;
+}
+
+/***********************************************************************************
+*! @brief  : Find items whose bounding box contains point
+*! @param  : [in ] pt        : point
+*! @param  : [out] vecResult : item index list (appended)
+*! @return : number of item found
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Candidates only. Check is_point_in_polygon on results for exact test
+***********************************************************************************/
+size_t PackedRTree::query_point(const Point2D& pt, std::vector<uint32_t>& vecResult) const
+{
+	return query_window(pt, pt, vecResult);
+}
+
+/***********************************************************************************
+*! @brief  : Find k items nearest to point (distance to bounding box)
+*! @param  : [in ] pt        : point
+*! @param  : [in ] nK        : number of item
+*! @param  : [out] vecResult : item index list, nearest first (appended)
+*! @param  : [in ] fMaxDist  : max distance
+*! @return : number of item found
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Best first search. Items containing pt have distance 0
+***********************************************************************************/
+size_t PackedRTree::query_nearest(const Point2D& pt, size_t nK, std::vector<uint32_t>& vecResult, GFloat fMaxDist) const
+{
+	if (m_vecNode.empty() || nK == 0)
+		return 0;
+
+	typedef std::pair<GFloat, uint32_t> DistNode;	// squared distance, node
+
+	std::priority_queue<DistNode, std::vector<DistNode>, std::greater<DistNode>> queNode;
+
+	GFloat   fMaxDist2 = (fMaxDist < std::sqrt(FLT_MAX)) ? fMaxDist * fMaxDist : FLT_MAX;
+	uint32_t nItem     = m_vecLevel[1];
+	uint32_t nRoot     = static_cast<uint32_t>(m_vecNode.size() - 1);
+	size_t   nFound    = 0;
+
+	auto push_node = [&](uint32_t i)
+	{
+		const Node& node = m_vecNode[i];
+
+		// Skip empty box
+		if (node.m_fMinX > node.m_fMaxX)
+			return;
+
+		GFloat fDist2 = rtree_dist2(node, pt.x, pt.y);
+
+		if (fDist2 <= fMaxDist2)
+			queNode.push(DistNode(fDist2, i));
+	};
+
+	push_node(nRoot);
+
+	while (!queNode.empty() && nFound < nK)
+	{
+		uint32_t i = queNode.top().second;
+		queNode.pop();
+
+		if (i < nItem)
+		{
+			vecResult.push_back(m_vecNode[i].m_nIndex);
+			nFound++;
+			continue;
+		}
+
+		uint32_t nFirst = m_vecNode[i].m_nIndex;
+		uint32_t nLast  = child_end(nFirst);
+
+		for (uint32_t j = nFirst; j < nLast; j++)
+		{
+			push_node(j);
+		}
+	}
+
+	return nFound;
+}
+
+/***********************************************************************************
+*! @brief  : Write tree to flat binary blob
+*! @param  : [out] vecBlob : blob data (replaced)
+*! @return : blob size (byte)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Host byte order. Layout : header | level offsets | nodes
+***********************************************************************************/
+size_t PackedRTree::serialize(std::vector<uint8_t>& vecBlob) const
+{
+	RTreeHeader header;
+	memcpy(header.m_szMagic, RTREE_MAGIC, sizeof(RTREE_MAGIC));
+	header.m_nVersion  = RTREE_VERSION;
+	header.m_nNodeSize = m_nNodeSize;
+	header.m_nLevel    = static_cast<uint32_t>(level_count());
+	header.m_nNode     = static_cast<uint32_t>(m_vecNode.size());
+
+	size_t nLevelByte = m_vecLevel.size() * sizeof(uint32_t);
+	size_t nNodeByte  = m_vecNode.size() * sizeof(Node);
+
+	vecBlob.resize(sizeof(RTreeHeader) + nLevelByte + nNodeByte);
+
+	uint8_t* pData = vecBlob.data();
+	memcpy(pData, &header, sizeof(RTreeHeader));
+
+	if (nLevelByte > 0)
+		memcpy(pData + sizeof(RTreeHeader), m_vecLevel.data(), nLevelByte);
+
+	if (nNodeByte > 0)
+		memcpy(pData + sizeof(RTreeHeader) + nLevelByte, m_vecNode.data(), nNodeByte);
+
+	return vecBlob.size();
+}
+
+/***********************************************************************************
+*! @brief  : Read tree from flat binary blob (written by serialize)
+*! @param  : [in] pData : blob data
+*! @param  : [in] nSize : blob size (byte)
+*! @return : TRUE : success | FALSE : invalid blob (tree is cleared)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+GBool PackedRTree::deserialize(const uint8_t* pData, size_t nSize)
+{
+	clear();
+
+	RTreeHeader header;
+
+	if (!pData || nSize < sizeof(RTreeHeader))
+		return GFalse;
+
+	memcpy(&header, pData, sizeof(RTreeHeader));
+
+	if (memcmp(header.m_szMagic, RTREE_MAGIC, sizeof(RTREE_MAGIC)) != 0 ||
+		header.m_nVersion != RTREE_VERSION || header.m_nNodeSize < 2 || header.m_nNodeSize > 65535)
+		return GFalse;
+
+	size_t nLevelCnt  = (header.m_nNode > 0) ? static_cast<size_t>(header.m_nLevel) + 1 : 0;
+	size_t nLevelByte = nLevelCnt * sizeof(uint32_t);
+	size_t nNodeByte  = static_cast<size_t>(header.m_nNode) * sizeof(Node);
+
+	if (nSize != sizeof(RTreeHeader) + nLevelByte + nNodeByte || (header.m_nNode > 0 && header.m_nLevel == 0))
+		return GFalse;
+
+	m_vecLevel.resize(nLevelCnt);
+	m_vecNode.resize(header.m_nNode);
+
+	if (nLevelByte > 0)
+		memcpy(m_vecLevel.data(), pData + sizeof(RTreeHeader), nLevelByte);
+
+	if (nNodeByte > 0)
+		memcpy(m_vecNode.data(), pData + sizeof(RTreeHeader) + nLevelByte, nNodeByte);
+
+	m_nNodeSize = header.m_nNodeSize;
+
+	// Validate structure so queries never read out of range
+	GBool bValid = (nLevelCnt == 0) ||
+				   (m_vecLevel.front() == 0 && m_vecLevel.back() == header.m_nNode &&
+					m_vecLevel[nLevelCnt - 1] - m_vecLevel[nLevelCnt - 2] == 1);
+
+	for (size_t l = 1; bValid && l < nLevelCnt; l++)
+	{
+		if (m_vecLevel[l] <= m_vecLevel[l - 1])
+			bValid = GFalse;
+	}
+
+	for (size_t l = 1; bValid && l + 1 < nLevelCnt; l++)
+	{
+		for (uint32_t i = m_vecLevel[l]; i < m_vecLevel[l + 1]; i++)
+		{
+			if (m_vecNode[i].m_nIndex < m_vecLevel[l - 1] || m_vecNode[i].m_nIndex >= m_vecLevel[l])
+			{
+				bValid = GFalse;
+				break;
+			}
+		}
+	}
+
+	if (!bValid)
+		clear();
+
+	return bValid;
+}
+
+}}
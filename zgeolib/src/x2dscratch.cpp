@@ -0,0 +1,188 @@
+#include "x2dscratch.h"
+#include <algorithm>
+
+namespace geo { namespace v2 {
+
+GeoScratch::GeoScratch(size_t nBlockSize /*= 64 * 1024*/) :
+	m_nBlock(0), m_nOffset(0), m_nBlockSize(std::max<size_t>(nBlockSize, 256)),
+	m_nUsed(0), m_nPeak(0), m_nAllocCnt(0), m_nHeapCnt(0)
+{
+
+}
+
+GeoScratch::~GeoScratch()
+{
+	release();
+}
+
+/***********************************************************************************
+*! @brief  : Allocate memory from arena
+*! @param  : [in] nSize  : byte count
+*! @param  : [in] nAlign : alignment (power of 2)
+*! @return : memory (valid until reset or rewind)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : New block (heap) only when all blocks are full
+***********************************************************************************/
+void* GeoScratch::alloc(size_t nSize, size_t nAlign /*= alignof(std::max_align_t)*/)
+{
+	m_nAllocCnt++;
+
+	if (nSize == 0) nSize = 1;
+
+	while (m_nBlock < m_vecBlock.size())
+	{
+		const Block& block = m_vecBlock[m_nBlock];
+
+		uintptr_t nBase  = reinterpret_cast<uintptr_t>(block.m_pData);
+		size_t	  nStart = static_cast<size_t>(((nBase + m_nOffset + nAlign - 1) & ~(uintptr_t)(nAlign - 1)) - nBase);
+
+		if (nStart + nSize <= block.m_nSize)
+		{
+			m_nUsed  += nStart + nSize - m_nOffset;
+			m_nOffset = nStart + nSize;
+			m_nPeak   = std::max(m_nPeak, m_nUsed);
+
+			return block.m_pData + nStart;
+		}
+
+		// Rest of block is skipped until rewind
+		m_nUsed  += block.m_nSize - m_nOffset;
+		m_nOffset = 0;
+		m_nBlock++;
+	}
+
+	return alloc_block(nSize, nAlign);
+}
+
+/***********************************************************************************
+*! @brief  : Add new block (size is doubled from total capacity) and allocate on it
+***********************************************************************************/
+void* GeoScratch::alloc_block(size_t nSize, size_t nAlign)
+{
+	size_t nBlockSize = std::max(std::max(m_nBlockSize, nSize + nAlign), capacity());
+
+	Block block;
+	block.m_pData = static_cast<uint8_t*>(::operator new(nBlockSize));
+	block.m_nSize = nBlockSize;
+
+	m_vecBlock.push_back(block);
+	m_nHeapCnt++;
+
+	m_nBlock  = m_vecBlock.size() - 1;
+	m_nOffset = 0;
+
+	// Block is large enough for size + alignment padding
+	m_nAllocCnt--;
+	return alloc(nSize, nAlign);
+}
+
+/***********************************************************************************
+*! @brief  : Give back memory (only the last allocation is reclaimed)
+*! @param  : [in] pData : memory return by alloc
+*! @param  : [in] nSize : byte count
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+void GeoScratch::free(void* pData, size_t nSize)
+{
+	if (pData == NULL || m_nBlock >= m_vecBlock.size())
+		return;
+
+	if (nSize == 0) nSize = 1;
+
+	uint8_t* pTop = m_vecBlock[m_nBlock].m_pData + m_nOffset;
+
+	if (static_cast<uint8_t*>(pData) + nSize == pTop)
+	{
+		m_nOffset -= nSize;
+		m_nUsed   -= nSize;
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Give back all memory (blocks are kept)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Many blocks are merged into one block of the total size
+***********************************************************************************/
+void GeoScratch::reset()
+{
+	if (m_vecBlock.size() > 1)
+	{
+		size_t nTotal = capacity();
+
+		for (const Block& block : m_vecBlock)
+		{
+			::operator delete(block.m_pData);
+		}
+
+		m_vecBlock.resize(1);
+		m_vecBlock[0].m_pData = static_cast<uint8_t*>(::operator new(nTotal));
+		m_vecBlock[0].m_nSize = nTotal;
+
+		m_nHeapCnt++;
+	}
+
+	m_nBlock  = 0;
+	m_nOffset = 0;
+	m_nUsed   = 0;
+}
+
+/***********************************************************************************
+*! @brief  : Free all blocks
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+void GeoScratch::release()
+{
+	for (const Block& block : m_vecBlock)
+	{
+		::operator delete(block.m_pData);
+	}
+
+	std::vector<Block>().swap(m_vecBlock);
+
+	m_nBlock  = 0;
+	m_nOffset = 0;
+	m_nUsed   = 0;
+}
+
+/***********************************************************************************
+*! @brief  : Get allocation state
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+GeoScratch::Mark GeoScratch::mark() const
+{
+	Mark mark;
+	mark.m_nBlock  = m_nBlock;
+	mark.m_nOffset = m_nOffset;
+	mark.m_nUsed   = m_nUsed;
+
+	return mark;
+}
+
+/***********************************************************************************
+*! @brief  : Restore allocation state (memory allocated after mark is given back)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+void GeoScratch::rewind(const Mark& mark)
+{
+	m_nBlock  = mark.m_nBlock;
+	m_nOffset = mark.m_nOffset;
+	m_nUsed   = mark.m_nUsed;
+}
+
+/***********************************************************************************
+*! @brief  : Total size of all blocks (byte)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+size_t GeoScratch::capacity() const
+{
+	size_t nTotal = 0;
+
+	for (const Block& block : m_vecBlock)
+	{
+		nTotal += block.m_nSize;
+	}
+
+	return nTotal;
+}
+
+}}
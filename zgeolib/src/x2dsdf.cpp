@@ -0,0 +1,732 @@
+#include "x2dsdf.h"
+#include "x2dscratch.h"
+
+#include <cmath>
+#include <cfloat>
+#include <algorithm>
+
+namespace geo { namespace v2 {
+
+/***********************************************************************************
+*! @brief  : Run tasks on pool (NULL : serial, worker 0)
+***********************************************************************************/
+static void sdf_parallel(GeoThreadPool* pPool, GInt nThread, size_t nTask, const GeoThreadPool::TaskFunc& func)
+{
+	if (pPool)
+	{
+		pPool->parallel_for(nTask, func, nThread);
+		return;
+	}
+
+	for (size_t i = 0; i < nTask; i++)
+	{
+		func(i, 0);
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Squared distance from (px, py) to segment ab, nearest point (qx, qy)
+***********************************************************************************/
+static inline GDouble sdf_seg_dist2(GDouble px, GDouble py, GDouble ax, GDouble ay, GDouble bx, GDouble by,
+									GDouble& qx, GDouble& qy)
+{
+	const GDouble dx = bx - ax, dy = by - ay;
+	const GDouble dLen2 = dx * dx + dy * dy;
+
+	GDouble t = (dLen2 > 0.0) ? ((px - ax) * dx + (py - ay) * dy) / dLen2 : 0.0;
+	t = std::min(std::max(t, 0.0), 1.0);
+
+	qx = ax + t * dx;
+	qy = ay + t * dy;
+
+	return (px - qx) * (px - qx) + (py - qy) * (py - qy);
+}
+
+/***********************************************************************************
+*! @brief  : 1D distance transform : pD[i] = min_q (pF[q] + (i - q)^2), pArg[i] = q
+*! @note   : Lower envelope of parabolas (Felzenszwalb - Huttenlocher), O(n).
+*!           pF[q] = DBL_MAX : no value (pArg = -1 when no value at all)
+***********************************************************************************/
+static void sdf_edt_1d(const GDouble* pF, GInt n, GInt* pV, GDouble* pZ, GDouble* pD, GInt* pArg)
+{
+	GInt k = -1;
+
+	for (GInt q = 0; q < n; q++)
+	{
+		if (pF[q] == DBL_MAX)
+			continue;
+
+		if (k < 0)
+		{
+			k = 0; pV[0] = q; pZ[0] = -DBL_MAX; pZ[1] = DBL_MAX;
+			continue;
+		}
+
+		GDouble s = 0.0;
+
+		while (GTrue)	// pZ[0] = -DBL_MAX : stops at k = 0
+		{
+			const GInt v = pV[k];
+			s = ((pF[q] + GDouble(q) * q) - (pF[v] + GDouble(v) * v)) / (2.0 * (q - v));
+
+			if (s > pZ[k])
+				break;
+
+			k--;
+		}
+
+		k++;
+		pV[k] = q; pZ[k] = s; pZ[k + 1] = DBL_MAX;
+	}
+
+	for (GInt i = 0, j = 0; i < n; i++)
+	{
+		if (k < 0)
+		{
+			pD[i]	  = DBL_MAX;
+			pArg[i] = -1;
+			continue;
+		}
+
+		while (pZ[j + 1] < i)
+		{
+			j++;
+		}
+
+		const GInt q = pV[j];
+
+		pD[i]	  = pF[q] + GDouble(i - q) * GDouble(i - q);
+		pArg[i] = q;
+	}
+}
+
+SdfBaker2D::SdfBaker2D() :
+	m_bClosed(GTrue), m_eFill(FILL_EVENODD), m_ptOrigin(0.f, 0.f), m_fScale(1.f),
+	m_nWidth(0), m_nHeight(0), m_fMaxDist(0.f)
+{
+
+}
+
+/***********************************************************************************
+*! @brief  : Set shape (copied, edge tree is built)
+*! @param  : [in] mpoly   : polygons or polylines
+*! @param  : [in] bClosed : TRUE : rings are closed, signed distance
+*!                          FALSE : rings are polylines, unsigned distance
+*! @param  : [in] eFill   : fill rule of inside test (bClosed)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+void SdfBaker2D::set_shape(const MultiPolygon2D& mpoly, GBool bClosed, EnumFillRule eFill)
+{
+	m_shape   = mpoly;
+	m_bClosed = bClosed;
+	m_eFill   = eFill;
+
+	m_tree.build(m_shape, bClosed);
+}
+
+/***********************************************************************************
+*! @brief  : Set grid
+*! @param  : [in] rect    : world window (x, y : pixel (0, 0) corner)
+*! @param  : [in] nWidth  : width (pixel)
+*! @param  : [in] nHeight : height (pixel)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Scale is nWidth / rect.width (same as rasterize_polygon)
+***********************************************************************************/
+void SdfBaker2D::set_grid(const Rect2D& rect, GInt nWidth, GInt nHeight)
+{
+	m_nWidth   = std::max(nWidth, 0);
+	m_nHeight  = std::max(nHeight, 0);
+	m_ptOrigin = Point2D(rect.x, rect.y);
+	m_fScale   = (rect.width > 0.f) ? GFloat(m_nWidth) / rect.width : 1.f;
+}
+
+/***********************************************************************************
+*! @brief  : Distance clamp (world unit)
+*! @param  : [in] fMaxDist : |distance| <= fMaxDist (<= 0 : no clamp)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+void SdfBaker2D::set_max_distance(GFloat fMaxDist)
+{
+	m_fMaxDist = fMaxDist;
+}
+
+/***********************************************************************************
+*! @brief  : Edges of closed shape in pixel space sorted by top, binned to bands
+***********************************************************************************/
+void SdfBaker2D::build_edges()
+{
+	m_vecEdge.clear();
+	m_vecBandEdge.clear();
+	m_vecBandBegin.assign((m_nHeight + SDF_BAND_ROWS - 1) / SDF_BAND_ROWS + 1, 0);
+
+	if (!m_bClosed)
+		return;
+
+	const GDouble dScale = m_fScale;
+
+	for (size_t r = 0; r < m_shape.ring_count(); r++)
+	{
+		const Point2D* pts  = m_shape.ring_data(r);
+		const size_t   nCnt = m_shape.ring_size(r);
+
+		if (nCnt < 3)
+			continue;
+
+		GDouble x1 = (GDouble(pts[nCnt - 1].x) - m_ptOrigin.x) * dScale;
+		GDouble y1 = (GDouble(pts[nCnt - 1].y) - m_ptOrigin.y) * dScale;
+
+		for (size_t i = 0; i < nCnt; i++)
+		{
+			const GDouble x0 = x1, y0 = y1;
+
+			x1 = (GDouble(pts[i].x) - m_ptOrigin.x) * dScale;
+			y1 = (GDouble(pts[i].y) - m_ptOrigin.y) * dScale;
+
+			if (y0 == y1)
+				continue;
+
+			const GBool bUp = (y1 < y0) ? GTrue : GFalse;
+
+			const GDouble xt = bUp ? x1 : x0, yt = bUp ? y1 : y0;
+			const GDouble xb = bUp ? x0 : x1, yb = bUp ? y0 : y1;
+
+			if (yb <= 0.0 || yt >= GDouble(m_nHeight) || std::min(xt, xb) >= GDouble(m_nWidth))
+				continue;
+
+			m_vecEdge.push_back(RasterEdge{ GFloat(xt), GFloat(yt), GFloat(yb), GFloat((xb - xt) / (yb - yt)), bUp ? 1.f : -1.f });
+		}
+	}
+
+	std::stable_sort(m_vecEdge.begin(), m_vecEdge.end(), [](const RasterEdge& e1, const RasterEdge& e2)
+	{
+		return e1.m_y0 < e2.m_y0;
+	});
+
+	// Rows whose center is in [y0, y1)
+	auto funBandRange = [&](const RasterEdge& edge, GInt& b0, GInt& b1)
+	{
+		const GInt r0 = std::max(GInt(std::ceil(edge.m_y0 - 0.5f)), 0);
+		const GInt r1 = std::min(GInt(std::ceil(edge.m_y1 - 0.5f)) - 1, m_nHeight - 1);
+
+		b0 = r0 / SDF_BAND_ROWS;
+		b1 = (r1 < r0) ? b0 - 1 : r1 / SDF_BAND_ROWS;
+	};
+
+	const size_t nBand = m_vecBandBegin.size() - 1;
+
+	for (const RasterEdge& edge : m_vecEdge)
+	{
+		GInt b0, b1;
+		funBandRange(edge, b0, b1);
+
+		for (GInt b = b0; b <= b1; b++)
+		{
+			m_vecBandBegin[b + 1]++;
+		}
+	}
+
+	for (size_t b = 0; b < nBand; b++)
+	{
+		m_vecBandBegin[b + 1] += m_vecBandBegin[b];
+	}
+
+	m_vecBandEdge.resize(m_vecBandBegin[nBand]);
+	std::vector<uint32_t> vecBandPos(m_vecBandBegin.begin(), m_vecBandBegin.end() - 1);
+
+	for (size_t e = 0; e < m_vecEdge.size(); e++)
+	{
+		GInt b0, b1;
+		funBandRange(m_vecEdge[e], b0, b1);
+
+		for (GInt b = b0; b <= b1; b++)
+		{
+			m_vecBandEdge[vecBandPos[b]++] = uint32_t(e);
+		}
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Inside flag of pixels of a row (crossings of the row center line)
+***********************************************************************************/
+void SdfBaker2D::row_inside(GInt nRow, const uint32_t* pEdge, size_t nEdge,
+							std::vector<SdfCross, ScratchAllocator<SdfCross>>& vecCross, uint8_t* pInside) const
+{
+	const GFloat yc = GFloat(nRow) + 0.5f;
+
+	vecCross.clear();
+
+	for (size_t k = 0; k < nEdge; k++)
+	{
+		const RasterEdge& edge = m_vecEdge[pEdge[k]];
+
+		if (edge.m_y0 <= yc && yc < edge.m_y1)
+		{
+			vecCross.push_back(SdfCross{ edge.m_x0 + (yc - edge.m_y0) * edge.m_fDxDy, edge.m_fDir > 0.f ? 1 : -1 });
+		}
+	}
+
+	std::sort(vecCross.begin(), vecCross.end(), [](const SdfCross& c1, const SdfCross& c2)
+	{
+		return (c1.m_x != c2.m_x) ? c1.m_x < c2.m_x : c1.m_nDir < c2.m_nDir;
+	});
+
+	GInt   nWind = 0;
+	size_t k     = 0;
+
+	for (GInt c = 0; c < m_nWidth; c++)
+	{
+		const GFloat xc = GFloat(c) + 0.5f;
+
+		while (k < vecCross.size() && vecCross[k].m_x < xc)
+		{
+			nWind += vecCross[k++].m_nDir;
+		}
+
+		GBool bInside = GFalse;
+
+		switch (m_eFill)
+		{
+		case FILL_NONZERO:	bInside = (nWind != 0) ? GTrue : GFalse; break;
+		case FILL_POSITIVE:	bInside = (nWind > 0) ? GTrue : GFalse;	 break;
+		default:			bInside = (nWind & 1) ? GTrue : GFalse;	 break;
+		}
+
+		pInside[c] = bInside ? 1 : 0;
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Exact unsigned distance of pixels of a row
+*! @note   : |d(p + step) - d(p)| <= step : search radius of a pixel is the distance
+*!           of the previous pixel + step (full radius when nothing is found)
+***********************************************************************************/
+void SdfBaker2D::row_exact(GInt nRow, GFloat* pDist) const
+{
+	const GFloat fCap  = (m_fMaxDist > 0.f) ? m_fMaxDist : FLT_MAX;
+	const GFloat fStep = 1.f / m_fScale;
+	const GFloat y     = m_ptOrigin.y + (GFloat(nRow) + 0.5f) * fStep;
+
+	GFloat fPrev = -1.f;
+
+	for (GInt c = 0; c < m_nWidth; c++)
+	{
+		const Point2D pt(m_ptOrigin.x + (GFloat(c) + 0.5f) * fStep, y);
+
+		GFloat fRadius = fCap;
+
+		if (fPrev >= 0.f)
+		{
+			fRadius = std::min(fCap, (fPrev + fStep) * 1.0001f + 1e-6f);
+		}
+
+		SegSnap snap;
+		GBool   bFound = m_tree.query_nearest(pt, fRadius, snap);
+
+		if (!bFound && fRadius < fCap)
+		{
+			bFound = m_tree.query_nearest(pt, fCap, snap);
+		}
+
+		pDist[c] = bFound ? std::min(snap.m_fDist, fCap) : fCap;
+		fPrev    = bFound ? snap.m_fDist : -1.f;
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Approximate unsigned distance of all pixels (EDT + jump flooding)
+*! @note   : Cells crossed by an edge keep their nearest edge (edges out of grid
+*!           seed the border cells). Each pixel takes the edge of its nearest seed
+*!           cell (Felzenszwalb-Huttenlocher EDT, rows then columns), then the
+*!           nearest of the edges of its 8 neighbours. Edge index is spread instead
+*!           of point : distance to the spread edge is exact
+***********************************************************************************/
+void SdfBaker2D::approx_field(std::vector<GFloat>& vecDist, GeoThreadPool* pPool, GInt nThread) const
+{
+	const uint32_t SDF_NONE = 0xFFFFFFFF;
+
+	const GInt    nWidth = m_nWidth, nHeight = m_nHeight;
+	const size_t  nCell  = size_t(nWidth) * size_t(nHeight);
+	const GFloat  fCap   = (m_fMaxDist > 0.f) ? m_fMaxDist : FLT_MAX;
+	const GDouble dScale = m_fScale;
+	const GDouble dFar   = 1e30;
+
+	// Edges in pixel space
+	VecLine2D vecSeg;
+	vecSeg.reserve(m_shape.point_count());
+
+	for (size_t r = 0; r < m_shape.ring_count(); r++)
+	{
+		const Point2D* pts  = m_shape.ring_data(r);
+		const size_t   nCnt = m_shape.ring_size(r);
+
+		if (nCnt == 0)
+			continue;
+
+		const size_t nSeg = (m_bClosed && nCnt > 2) ? nCnt : std::max(nCnt - 1, size_t(1));
+
+		for (size_t i = 0; i < nSeg; i++)
+		{
+			const Point2D& pt1 = pts[i];
+			const Point2D& pt2 = pts[(i + 1 < nCnt) ? i + 1 : (m_bClosed ? 0 : i)];
+
+			Line2D line;
+			line.ptStart = Point2D(GFloat((pt1.x - m_ptOrigin.x) * dScale), GFloat((pt1.y - m_ptOrigin.y) * dScale));
+			line.ptEnd   = Point2D(GFloat((pt2.x - m_ptOrigin.x) * dScale), GFloat((pt2.y - m_ptOrigin.y) * dScale));
+
+			vecSeg.push_back(line);
+		}
+	}
+
+	std::vector<uint32_t> vecNear(nCell, SDF_NONE), vecNext(nCell);
+
+	GeoScratch scratchSerial;
+
+	auto funDist2 = [&](uint32_t nSeg, GInt c, GInt r)
+	{
+		const Line2D& line = vecSeg[nSeg];
+
+		GDouble qx, qy;
+		return sdf_seg_dist2(c + 0.5, r + 0.5, line.ptStart.x, line.ptStart.y, line.ptEnd.x, line.ptEnd.y, qx, qy);
+	};
+
+	// 1. Seed cells crossed by edges (clamped to grid)
+	for (uint32_t s = 0; s < uint32_t(vecSeg.size()); s++)
+	{
+		const GDouble ax = vecSeg[s].ptStart.x, ay = vecSeg[s].ptStart.y;
+		const GDouble bx = vecSeg[s].ptEnd.x,   by = vecSeg[s].ptEnd.y;
+
+		const GInt ra = std::min(std::max(GInt(std::floor(std::min(ay, by))), 0), nHeight - 1);
+		const GInt rb = std::min(std::max(GInt(std::floor(std::max(ay, by))), 0), nHeight - 1);
+
+		for (GInt r = ra; r <= rb; r++)
+		{
+			const GDouble dLo = (r == 0) ? -dFar : GDouble(r);
+			const GDouble dHi = (r == nHeight - 1) ? dFar : GDouble(r + 1);
+
+			GDouble x0 = std::min(ax, bx), x1 = std::max(ax, bx);
+
+			if (ay != by)
+			{
+				GDouble t0 = (dLo - ay) / (by - ay), t1 = (dHi - ay) / (by - ay);
+
+				if (t0 > t1)
+					std::swap(t0, t1);
+
+				t0 = std::max(t0, 0.0);
+				t1 = std::min(t1, 1.0);
+
+				if (t0 > t1)
+					continue;
+
+				x0 = ax + t0 * (bx - ax);
+				x1 = ax + t1 * (bx - ax);
+
+				if (x0 > x1)
+					std::swap(x0, x1);
+			}
+
+			const GInt c0 = std::min(std::max(GInt(std::floor(x0)), 0), nWidth - 1);
+			const GInt c1 = std::min(std::max(GInt(std::floor(x1)), 0), nWidth - 1);
+
+			for (GInt c = c0; c <= c1; c++)
+			{
+				uint32_t& nNear = vecNear[size_t(r) * nWidth + c];
+
+				if (nNear == SDF_NONE || funDist2(s, c, r) < funDist2(nNear, c, r))
+				{
+					nNear = s;
+				}
+			}
+		}
+	}
+
+	// 2. Nearest seed cell of each pixel : EDT of seed cells (value : squared distance
+	// to their edge), rows then columns
+	std::vector<GDouble> vecRowDist(nCell);
+	std::vector<GInt>	 vecRowArg(nCell);
+
+	const size_t nRowBand = size_t((nHeight + SDF_BAND_ROWS - 1) / SDF_BAND_ROWS);
+	const size_t nColBand = size_t((nWidth + SDF_BAND_ROWS - 1) / SDF_BAND_ROWS);
+	const size_t nMaxLen  = size_t(std::max(nWidth, nHeight));
+
+	sdf_parallel(pPool, nThread, nRowBand, [&](size_t nTask, GInt nWorker)
+	{
+		GeoScratch& scratch = pPool ? pPool->scratch(nWorker) : scratchSerial;
+		GeoScratchFrame frame(scratch);
+
+		GDouble* pF = scratch.alloc_array<GDouble>(nMaxLen);
+		GInt*	 pV = scratch.alloc_array<GInt>(nMaxLen);
+		GDouble* pZ = scratch.alloc_array<GDouble>(nMaxLen + 1);
+
+		const GInt r0 = GInt(nTask) * SDF_BAND_ROWS;
+		const GInt r1 = std::min(r0 + SDF_BAND_ROWS, nHeight);
+
+		for (GInt r = r0; r < r1; r++)
+		{
+			const size_t nRow = size_t(r) * nWidth;
+
+			for (GInt c = 0; c < nWidth; c++)
+			{
+				const uint32_t nSeg = vecNear[nRow + c];
+				pF[c] = (nSeg == SDF_NONE) ? DBL_MAX : funDist2(nSeg, c, r);
+			}
+
+			sdf_edt_1d(pF, nWidth, pV, pZ, &vecRowDist[nRow], &vecRowArg[nRow]);
+		}
+	});
+
+	sdf_parallel(pPool, nThread, nColBand, [&](size_t nTask, GInt nWorker)
+	{
+		GeoScratch& scratch = pPool ? pPool->scratch(nWorker) : scratchSerial;
+		GeoScratchFrame frame(scratch);
+
+		GDouble* pF	   = scratch.alloc_array<GDouble>(nMaxLen);
+		GInt*	 pV	   = scratch.alloc_array<GInt>(nMaxLen);
+		GDouble* pZ	   = scratch.alloc_array<GDouble>(nMaxLen + 1);
+		GDouble* pD	   = scratch.alloc_array<GDouble>(nMaxLen);
+		GInt*	 pArg  = scratch.alloc_array<GInt>(nMaxLen);
+
+		const GInt c0 = GInt(nTask) * SDF_BAND_ROWS;
+		const GInt c1 = std::min(c0 + SDF_BAND_ROWS, nWidth);
+
+		for (GInt c = c0; c < c1; c++)
+		{
+			for (GInt r = 0; r < nHeight; r++)
+			{
+				pF[r] = vecRowDist[size_t(r) * nWidth + c];
+			}
+
+			sdf_edt_1d(pF, nHeight, pV, pZ, pD, pArg);
+
+			for (GInt r = 0; r < nHeight; r++)
+			{
+				uint32_t nSeg = SDF_NONE;
+
+				if (pArg[r] >= 0)
+				{
+					const GInt q = pArg[r];
+					nSeg = vecNear[size_t(q) * nWidth + vecRowArg[size_t(q) * nWidth + c]];
+				}
+
+				vecNext[size_t(r) * nWidth + c] = nSeg;
+			}
+		}
+	});
+
+	// 3. Jump flooding pass of step 1 : edge of nearest seed cell is not always the
+	// nearest edge
+	sdf_parallel(pPool, nThread, nRowBand, [&](size_t nTask, GInt)
+	{
+		const GInt r0 = GInt(nTask) * SDF_BAND_ROWS;
+		const GInt r1 = std::min(r0 + SDF_BAND_ROWS, nHeight);
+
+		for (GInt r = r0; r < r1; r++)
+		{
+			for (GInt c = 0; c < nWidth; c++)
+			{
+				uint32_t nBest  = vecNext[size_t(r) * nWidth + c];
+				GDouble  dBest2 = (nBest == SDF_NONE) ? DBL_MAX : funDist2(nBest, c, r);
+
+				for (GInt nr = std::max(r - 1, 0); nr <= std::min(r + 1, nHeight - 1); nr++)
+				{
+					for (GInt nc = std::max(c - 1, 0); nc <= std::min(c + 1, nWidth - 1); nc++)
+					{
+						const uint32_t nCand = vecNext[size_t(nr) * nWidth + nc];
+
+						if (nCand == SDF_NONE || nCand == nBest)
+							continue;
+
+						const GDouble d2 = funDist2(nCand, c, r);
+
+						if (d2 < dBest2)
+						{
+							dBest2 = d2;
+							nBest  = nCand;
+						}
+					}
+				}
+
+				vecNear[size_t(r) * nWidth + c] = nBest;
+			}
+		}
+	});
+
+	// 4. Distance in world unit
+	vecDist.resize(nCell);
+
+	for (GInt r = 0; r < nHeight; r++)
+	{
+		for (GInt c = 0; c < nWidth; c++)
+		{
+			const size_t   i     = size_t(r) * nWidth + c;
+			const uint32_t nNear = vecNear[i];
+
+			vecDist[i] = (nNear == SDF_NONE) ? fCap :
+						 std::min(GFloat(std::sqrt(funDist2(nNear, c, r)) / dScale), fCap);
+		}
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Bake rows by bands (sign + distance + store)
+***********************************************************************************/
+void SdfBaker2D::bake_field(void* pBuffer, GInt nStride, GBool bByte, EnumSdfMode eMode,
+							GeoThreadPool* pPool, GInt nThread)
+{
+	if (m_nWidth == 0 || m_nHeight == 0)
+		return;
+
+	build_edges();
+
+	const GFloat fRange = (m_fMaxDist > 0.f) ? m_fMaxDist : 4.f / m_fScale;
+
+	std::vector<GFloat> vecField;
+
+	if (eMode == SDF_APPROX)
+	{
+		approx_field(vecField, pPool, nThread);
+	}
+
+	GeoScratch scratchSerial;
+
+	const size_t nBand = m_vecBandBegin.size() - 1;
+
+	sdf_parallel(pPool, nThread, nBand, [&](size_t nTask, GInt nWorker)
+	{
+		GeoScratch& scratch = pPool ? pPool->scratch(nWorker) : scratchSerial;
+		GeoScratchFrame frame(scratch);
+
+		GFloat*  pDist   = scratch.alloc_array<GFloat>(size_t(m_nWidth));
+		uint8_t* pInside = scratch.alloc_array<uint8_t>(size_t(m_nWidth));
+
+		std::vector<SdfCross, ScratchAllocator<SdfCross>> vecCross{ ScratchAllocator<SdfCross>(&scratch) };
+
+		const GInt r0 = GInt(nTask) * SDF_BAND_ROWS;
+		const GInt r1 = std::min(r0 + SDF_BAND_ROWS, m_nHeight);
+
+		const uint32_t* pEdge = m_vecBandEdge.data() + m_vecBandBegin[nTask];
+		const size_t    nEdge = m_vecBandBegin[nTask + 1] - m_vecBandBegin[nTask];
+
+		for (GInt r = r0; r < r1; r++)
+		{
+			if (eMode == SDF_APPROX)
+			{
+				std::copy(vecField.begin() + size_t(r) * m_nWidth, vecField.begin() + size_t(r + 1) * m_nWidth, pDist);
+			}
+			else
+			{
+				row_exact(r, pDist);
+			}
+
+			if (m_bClosed)
+			{
+				row_inside(r, pEdge, nEdge, vecCross, pInside);
+
+				for (GInt c = 0; c < m_nWidth; c++)
+				{
+					if (pInside[c])
+						pDist[c] = -pDist[c];
+				}
+			}
+
+			if (bByte)
+			{
+				uint8_t* pRow = static_cast<uint8_t*>(pBuffer) + size_t(r) * size_t(nStride);
+
+				for (GInt c = 0; c < m_nWidth; c++)
+				{
+					const GFloat a = std::min(std::max(0.5f - 0.5f * pDist[c] / fRange, 0.f), 1.f);
+					pRow[c] = static_cast<uint8_t>(a * 255.f + 0.5f);
+				}
+			}
+			else
+			{
+				GFloat* pRow = static_cast<GFloat*>(pBuffer) + size_t(r) * size_t(nStride);
+				std::copy(pDist, pDist + m_nWidth, pRow);
+			}
+		}
+	});
+}
+
+/***********************************************************************************
+*! @brief  : Bake distance field
+*! @param  : [out] pBuffer : grid (all pixels written, row 0 at rect.y)
+*! @param  : [in ] nStride : element count between rows (>= width)
+*! @param  : [in ] eMode   : exact or approximate
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : GFloat  : distance (world unit)
+*!           uint8_t : 128 at edge, 255 - 0 for distance -range .. +range
+***********************************************************************************/
+void SdfBaker2D::bake(GFloat* pBuffer, GInt nStride, EnumSdfMode eMode)
+{
+	bake_field(pBuffer, nStride, GFalse, eMode, NULL, 0);
+}
+
+void SdfBaker2D::bake(uint8_t* pBuffer, GInt nStride, EnumSdfMode eMode)
+{
+	bake_field(pBuffer, nStride, GTrue, eMode, NULL, 0);
+}
+
+/***********************************************************************************
+*! @brief  : Bake distance field (multithread)
+*! @param  : [in] pool    : thread pool
+*! @param  : [in] nThread : max number of worker (<= 0 : all)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Same output as serial bake
+***********************************************************************************/
+void SdfBaker2D::bake(GFloat* pBuffer, GInt nStride, EnumSdfMode eMode, GeoThreadPool& pool, GInt nThread)
+{
+	bake_field(pBuffer, nStride, GFalse, eMode, &pool, nThread);
+}
+
+void SdfBaker2D::bake(uint8_t* pBuffer, GInt nStride, EnumSdfMode eMode, GeoThreadPool& pool, GInt nThread)
+{
+	bake_field(pBuffer, nStride, GTrue, eMode, &pool, nThread);
+}
+
+/***********************************************************************************
+*! @brief  : Distance field of polygons (or polylines)
+*! @param  : [in ] mpoly    : shape
+*! @param  : [in ] rect     : world window of grid
+*! @param  : [in ] nWidth   : width (pixel)
+*! @param  : [in ] nHeight  : height (pixel)
+*! @param  : [in ] fMaxDist : distance clamp / 8-bit range (<= 0 : none)
+*! @param  : [out] vecSdf   : nWidth * nHeight values (replaced)
+*! @param  : [in ] eMode    : exact or approximate
+*! @param  : [in ] bClosed  : TRUE : polygons (signed) | FALSE : polylines
+*! @param  : [in ] pPool    : thread pool (NULL : serial)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+Dllexport void bake_sdf(const MultiPolygon2D& mpoly, const Rect2D& rect, GInt nWidth, GInt nHeight, GFloat fMaxDist,
+						std::vector<GFloat>& vecSdf, EnumSdfMode eMode, GBool bClosed, GeoThreadPool* pPool)
+{
+	vecSdf.assign(size_t(std::max(nWidth, 0)) * size_t(std::max(nHeight, 0)), 0.f);
+
+	SdfBaker2D baker;
+	baker.set_shape(mpoly, bClosed);
+	baker.set_grid(rect, nWidth, nHeight);
+	baker.set_max_distance(fMaxDist);
+
+	if (pPool)
+		baker.bake(vecSdf.data(), nWidth, eMode, *pPool);
+	else
+		baker.bake(vecSdf.data(), nWidth, eMode);
+}
+
+Dllexport void bake_sdf(const MultiPolygon2D& mpoly, const Rect2D& rect, GInt nWidth, GInt nHeight, GFloat fMaxDist,
+						std::vector<uint8_t>& vecSdf, EnumSdfMode eMode, GBool bClosed, GeoThreadPool* pPool)
+{
+	vecSdf.assign(size_t(std::max(nWidth, 0)) * size_t(std::max(nHeight, 0)), 0);
+
+	SdfBaker2D baker;
+	baker.set_shape(mpoly, bClosed);
+	baker.set_grid(rect, nWidth, nHeight);
+	baker.set_max_distance(fMaxDist);
+
+	if (pPool)
+		baker.bake(vecSdf.data(), nWidth, eMode, *pPool);
+	else
+		baker.bake(vecSdf.data(), nWidth, eMode);
+}
+
+}}
@@ -0,0 +1,481 @@
+#include "x2dsegtree.h"
+
+#include <cmath>
+#include <cfloat>
+#include <algorithm>
+
+namespace geo { namespace v2 {
+
+const uint32_t SegmentTree2D::SEGTREE_NONE;
+const uint32_t SegmentTree2D::SEGTREE_LEAF_SIZE;
+
+/***********************************************************************************
+*! @brief  : Squared distance from point to box (0 : inside)
+***********************************************************************************/
+static inline GDouble segtree_dist2(const SegmentTree2D::Node& node, const Point2D& pt)
+{
+	GDouble dx = std::max<GDouble>(0.0, std::max<GDouble>(GDouble(node.m_fMinX) - pt.x, GDouble(pt.x) - node.m_fMaxX));
+	GDouble dy = std::max<GDouble>(0.0, std::max<GDouble>(GDouble(node.m_fMinY) - pt.y, GDouble(pt.y) - node.m_fMaxY));
+
+	return dx * dx + dy * dy;
+}
+
+static inline void segtree_empty_box(SegmentTree2D::Node& node)
+{
+	node.m_fMinX = FLT_MAX;  node.m_fMinY = FLT_MAX;
+	node.m_fMaxX = -FLT_MAX; node.m_fMaxY = -FLT_MAX;
+}
+
+static inline void segtree_add_point(SegmentTree2D::Node& node, const Point2D& pt)
+{
+	node.m_fMinX = std::min<GFloat>(node.m_fMinX, pt.x);
+	node.m_fMinY = std::min<GFloat>(node.m_fMinY, pt.y);
+	node.m_fMaxX = std::max<GFloat>(node.m_fMaxX, pt.x);
+	node.m_fMaxY = std::max<GFloat>(node.m_fMaxY, pt.y);
+}
+
+SegmentTree2D::SegmentTree2D()
+{
+
+}
+
+/***********************************************************************************
+*! @brief  : Build tree from all edges of multipolygon
+*! @param  : [in] mpoly   : multipolygon (points are copied)
+*! @param  : [in] bClosed : TRUE : edge last -> first point is added (polygon)
+*!                          FALSE : rings are polylines
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Top-down median split on the longer axis, O(n log n)
+***********************************************************************************/
+void SegmentTree2D::build(const MultiPolygon2D& mpoly, GBool bClosed /*= GTrue*/)
+{
+	clear();
+
+	m_vecPoint = mpoly.points();
+
+	size_t nPointCnt = m_vecPoint.size();
+
+	m_vecSegEnd.assign(nPointCnt, SEGTREE_NONE);
+	m_vecSegPrev.assign(nPointCnt, SEGTREE_NONE);
+	m_vecSegRing.assign(nPointCnt, SEGTREE_NONE);
+	m_vecSegLeaf.assign(nPointCnt, SEGTREE_NONE);
+
+	// 1. Segments of rings (segment s : point s -> next point of ring)
+	for (size_t r = 0; r < mpoly.ring_count(); r++)
+	{
+		uint32_t nBegin = static_cast<uint32_t>(mpoly.ring_begin(r));
+		uint32_t nEnd   = static_cast<uint32_t>(mpoly.ring_end(r));
+
+		if (nEnd - nBegin < 2)
+			continue;
+
+		for (uint32_t i = nBegin; i < nEnd; i++)
+		{
+			uint32_t nNext = (i + 1 < nEnd) ? i + 1 : (bClosed ? nBegin : SEGTREE_NONE);
+
+			if (nNext == SEGTREE_NONE)
+				continue;
+
+			// Closing point equal to first point : no zero length segment
+			if (nNext == nBegin && m_vecPoint[i].x == m_vecPoint[nBegin].x && m_vecPoint[i].y == m_vecPoint[nBegin].y)
+				continue;
+
+			m_vecSegEnd[i]      = nNext;
+			m_vecSegRing[i]     = static_cast<uint32_t>(r);
+			m_vecSegPrev[nNext] = i;
+
+			m_vecOrder.push_back(i);
+		}
+	}
+
+	if (m_vecOrder.empty())
+		return;
+
+	// 2. Top-down split (explicit stack)
+	typedef struct tagBuildItem
+	{
+		uint32_t	m_nNode;
+		uint32_t	m_nFirst;
+		uint32_t	m_nCount;
+
+	} BuildItem;
+
+	std::vector<BuildItem> stack;
+	std::vector<GFloat>    vecCenter(nPointCnt * 2);
+
+	for (uint32_t s : m_vecOrder)
+	{
+		const Point2D& pt1 = m_vecPoint[s];
+		const Point2D& pt2 = m_vecPoint[m_vecSegEnd[s]];
+
+		vecCenter[2 * s]     = pt1.x + pt2.x;
+		vecCenter[2 * s + 1] = pt1.y + pt2.y;
+	}
+
+	m_vecNode.reserve(2 * (m_vecOrder.size() / SEGTREE_LEAF_SIZE + 1));
+	m_vecNode.push_back(Node());
+	m_vecNode[0].m_nParent = SEGTREE_NONE;
+
+	stack.push_back({ 0, 0, static_cast<uint32_t>(m_vecOrder.size()) });
+
+	while (!stack.empty())
+	{
+		BuildItem item = stack.back(); stack.pop_back();
+
+		if (item.m_nCount <= SEGTREE_LEAF_SIZE)
+		{
+			Node& leaf = m_vecNode[item.m_nNode];
+
+			leaf.m_nFirst = item.m_nFirst;
+			leaf.m_nCount = item.m_nCount;
+
+			for (uint32_t i = item.m_nFirst; i < item.m_nFirst + item.m_nCount; i++)
+			{
+				m_vecSegLeaf[m_vecOrder[i]] = item.m_nNode;
+			}
+
+			continue;
+		}
+
+		// Split axis : longer side of centers box
+		GFloat fMinX = FLT_MAX, fMinY = FLT_MAX, fMaxX = -FLT_MAX, fMaxY = -FLT_MAX;
+
+		for (uint32_t i = item.m_nFirst; i < item.m_nFirst + item.m_nCount; i++)
+		{
+			uint32_t s = m_vecOrder[i];
+
+			fMinX = std::min(fMinX, vecCenter[2 * s]); fMaxX = std::max(fMaxX, vecCenter[2 * s]);
+			fMinY = std::min(fMinY, vecCenter[2 * s + 1]); fMaxY = std::max(fMaxY, vecCenter[2 * s + 1]);
+		}
+
+		size_t nAxis = (fMaxX - fMinX >= fMaxY - fMinY) ? 0 : 1;
+
+		uint32_t* pFirst = m_vecOrder.data() + item.m_nFirst;
+		uint32_t  nHalf  = item.m_nCount / 2;
+
+		std::nth_element(pFirst, pFirst + nHalf, pFirst + item.m_nCount, [&](uint32_t a, uint32_t b)
+		{
+			return vecCenter[2 * a + nAxis] < vecCenter[2 * b + nAxis];
+		});
+
+		uint32_t nLeft = static_cast<uint32_t>(m_vecNode.size());
+
+		m_vecNode.push_back(Node());
+		m_vecNode.push_back(Node());
+
+		m_vecNode[nLeft].m_nParent     = item.m_nNode;
+		m_vecNode[nLeft + 1].m_nParent = item.m_nNode;
+		m_vecNode[item.m_nNode].m_nFirst = nLeft;
+		m_vecNode[item.m_nNode].m_nCount = 0;
+
+		stack.push_back({ nLeft + 1, item.m_nFirst + nHalf, item.m_nCount - nHalf });
+		stack.push_back({ nLeft, item.m_nFirst, nHalf });
+	}
+
+	refit();
+}
+
+/***********************************************************************************
+*! @brief  : Remove all nodes
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+void SegmentTree2D::clear()
+{
+	m_vecNode.clear();
+	m_vecPoint.clear();
+	m_vecSegEnd.clear();
+	m_vecSegPrev.clear();
+	m_vecSegRing.clear();
+	m_vecSegLeaf.clear();
+	m_vecOrder.clear();
+}
+
+/***********************************************************************************
+*! @brief  : Nearest point of segment to pt, update snap if nearer than dDist2
+***********************************************************************************/
+void SegmentTree2D::segment_snap(uint32_t nSeg, const Point2D& pt, SegSnap& snap, GDouble& dDist2) const
+{
+	const Point2D& pt1 = m_vecPoint[nSeg];
+	const Point2D& pt2 = m_vecPoint[m_vecSegEnd[nSeg]];
+
+	GDouble dx = GDouble(pt2.x) - pt1.x, dy = GDouble(pt2.y) - pt1.y;
+	GDouble px = GDouble(pt.x) - pt1.x,  py = GDouble(pt.y) - pt1.y;
+
+	GDouble dLen2 = dx * dx + dy * dy;
+	GDouble t     = (dLen2 > 0.0) ? (px * dx + py * dy) / dLen2 : 0.0;
+
+	GInt nProj = 1;
+
+	if (t <= 0.0)		{ t = 0.0; nProj = 2; }
+	else if (t >= 1.0)	{ t = 1.0; nProj = 3; }
+
+	GDouble ex = px - t * dx, ey = py - t * dy;
+	GDouble d2 = ex * ex + ey * ey;
+
+	// Same distance : lower segment index (result does not depend on tree shape)
+	if (d2 < dDist2 || (d2 == dDist2 && snap.m_nSeg != SEGTREE_NONE && nSeg < snap.m_nSeg))
+	{
+		dDist2 = d2;
+
+		snap.m_nSeg  = nSeg;
+		snap.m_nRing = m_vecSegRing[nSeg];
+		snap.m_nProj = nProj;
+		snap.m_fDist = static_cast<GFloat>(std::sqrt(d2));
+
+		if (nProj == 2)		 snap.m_ptProj = pt1;
+		else if (nProj == 3) snap.m_ptProj = pt2;
+		else
+		{
+			snap.m_ptProj.x = static_cast<GFloat>(pt1.x + t * dx);
+			snap.m_ptProj.y = static_cast<GFloat>(pt1.y + t * dy);
+		}
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Nearest segment within snap radius
+*! @param  : [in ] pt     : point (cursor)
+*! @param  : [in ] fSnap  : snap radius
+*! @param  : [out] result : nearest segment (not changed if not found)
+*! @return : TRUE : found | FALSE : no segment within fSnap
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Same test as is_snap_point_to_lsegment on every segment. Nearer
+*!           child is visited first, nodes farther than the best are skipped
+***********************************************************************************/
+GBool SegmentTree2D::query_nearest(const Point2D& pt, GFloat fSnap, SegSnap& result) const
+{
+	if (m_vecNode.empty())
+		return GFalse;
+
+	GDouble dBest2 = GDouble(fSnap) * fSnap;
+
+	SegSnap snap;
+	snap.m_nSeg = SEGTREE_NONE;
+
+	uint32_t arStack[64];
+	size_t   nTop = 0;
+
+	if (segtree_dist2(m_vecNode[0], pt) <= dBest2)
+		arStack[nTop++] = 0;
+
+	while (nTop > 0)
+	{
+		const Node& node = m_vecNode[arStack[--nTop]];
+
+		if (segtree_dist2(node, pt) > dBest2)
+			continue;
+
+		if (node.m_nCount > 0)
+		{
+			for (uint32_t i = node.m_nFirst; i < node.m_nFirst + node.m_nCount; i++)
+			{
+				segment_snap(m_vecOrder[i], pt, snap, dBest2);
+			}
+
+			continue;
+		}
+
+		// Push farther child first : nearer child is popped first
+		uint32_t nNear = node.m_nFirst, nFar = node.m_nFirst + 1;
+		GDouble  dNear = segtree_dist2(m_vecNode[nNear], pt);
+		GDouble  dFar  = segtree_dist2(m_vecNode[nFar], pt);
+
+		if (dFar < dNear)
+		{
+			std::swap(nNear, nFar);
+			std::swap(dNear, dFar);
+		}
+
+		if (dFar <= dBest2 && nTop < 64)  arStack[nTop++] = nFar;
+		if (dNear <= dBest2 && nTop < 64) arStack[nTop++] = nNear;
+	}
+
+	if (snap.m_nSeg == SEGTREE_NONE)
+		return GFalse;
+
+	result = snap;
+
+	return GTrue;
+}
+
+/***********************************************************************************
+*! @brief  : All segments within snap radius
+*! @param  : [in ] pt        : point (cursor)
+*! @param  : [in ] fSnap     : snap radius
+*! @param  : [out] vecResult : segments (appended, nearest first)
+*! @return : number of segment found
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+size_t SegmentTree2D::query_radius(const Point2D& pt, GFloat fSnap, VecSegSnap& vecResult) const
+{
+	if (m_vecNode.empty())
+		return 0;
+
+	GDouble dSnap2 = GDouble(fSnap) * fSnap;
+	size_t  nStart = vecResult.size();
+
+	std::vector<uint32_t> stack(1, 0);
+
+	while (!stack.empty())
+	{
+		const Node& node = m_vecNode[stack.back()];
+		stack.pop_back();
+
+		if (segtree_dist2(node, pt) > dSnap2)
+			continue;
+
+		if (node.m_nCount == 0)
+		{
+			stack.push_back(node.m_nFirst);
+			stack.push_back(node.m_nFirst + 1);
+			continue;
+		}
+
+		for (uint32_t i = node.m_nFirst; i < node.m_nFirst + node.m_nCount; i++)
+		{
+			SegSnap snap;
+			snap.m_nSeg = SEGTREE_NONE;
+
+			GDouble dDist2 = dSnap2;
+
+			// Segment at distance == fSnap is kept (same as is_snap_point_to_lsegment)
+			segment_snap(m_vecOrder[i], pt, snap, dDist2);
+
+			if (snap.m_nSeg == SEGTREE_NONE && dSnap2 > 0.0)
+			{
+				dDist2 = std::nextafter(dSnap2, DBL_MAX);
+				segment_snap(m_vecOrder[i], pt, snap, dDist2);
+			}
+
+			if (snap.m_nSeg != SEGTREE_NONE)
+				vecResult.push_back(snap);
+		}
+	}
+
+	std::sort(vecResult.begin() + nStart, vecResult.end(), [](const SegSnap& a, const SegSnap& b)
+	{
+		return (a.m_fDist != b.m_fDist) ? (a.m_fDist < b.m_fDist) : (a.m_nSeg < b.m_nSeg);
+	});
+
+	return vecResult.size() - nStart;
+}
+
+/***********************************************************************************
+*! @brief  : Box of leaf from its segments
+***********************************************************************************/
+void SegmentTree2D::refit_leaf(uint32_t nNode)
+{
+	Node& node = m_vecNode[nNode];
+
+	segtree_empty_box(node);
+
+	for (uint32_t i = node.m_nFirst; i < node.m_nFirst + node.m_nCount; i++)
+	{
+		uint32_t s = m_vecOrder[i];
+
+		segtree_add_point(node, m_vecPoint[s]);
+		segtree_add_point(node, m_vecPoint[m_vecSegEnd[s]]);
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Box of inner node from its children
+*! @return : TRUE : box changed
+***********************************************************************************/
+GBool SegmentTree2D::refit_inner(uint32_t nNode)
+{
+	Node& node = m_vecNode[nNode];
+
+	const Node& left  = m_vecNode[node.m_nFirst];
+	const Node& right = m_vecNode[node.m_nFirst + 1];
+
+	GFloat fMinX = std::min(left.m_fMinX, right.m_fMinX);
+	GFloat fMinY = std::min(left.m_fMinY, right.m_fMinY);
+	GFloat fMaxX = std::max(left.m_fMaxX, right.m_fMaxX);
+	GFloat fMaxY = std::max(left.m_fMaxY, right.m_fMaxY);
+
+	if (fMinX == node.m_fMinX && fMinY == node.m_fMinY && fMaxX == node.m_fMaxX && fMaxY == node.m_fMaxY)
+		return GFalse;
+
+	node.m_fMinX = fMinX; node.m_fMinY = fMinY;
+	node.m_fMaxX = fMaxX; node.m_fMaxY = fMaxY;
+
+	return GTrue;
+}
+
+/***********************************************************************************
+*! @brief  : Move point and refit boxes of its segments up to the root
+*! @param  : [in] nPoint : point index (index in points of multipolygon)
+*! @param  : [in] pt     : new position
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : O(log n). Refit stops at the first node whose box is unchanged.
+*!           Tree is not rebalanced, build again after large edits
+***********************************************************************************/
+void SegmentTree2D::move_point(uint32_t nPoint, const Point2D& pt)
+{
+	if (nPoint >= m_vecPoint.size())
+	{
+		_ASSERT(0);
+		return;
+	}
+
+	m_vecPoint[nPoint] = pt;
+
+	uint32_t arSeg[2] = { m_vecSegEnd[nPoint] != SEGTREE_NONE ? nPoint : SEGTREE_NONE, m_vecSegPrev[nPoint] };
+
+	for (uint32_t s : arSeg)
+	{
+		if (s == SEGTREE_NONE)
+			continue;
+
+		uint32_t nNode = m_vecSegLeaf[s];
+
+		refit_leaf(nNode);
+
+		for (nNode = m_vecNode[nNode].m_nParent; nNode != SEGTREE_NONE; nNode = m_vecNode[nNode].m_nParent)
+		{
+			if (refit_inner(nNode) == GFalse)
+				break;
+		}
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Update all points (same topology) and refit all nodes
+*! @param  : [in] mpoly : multipolygon used by build (points moved)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : O(n), bottom-up
+***********************************************************************************/
+void SegmentTree2D::refit(const MultiPolygon2D& mpoly)
+{
+	if (mpoly.point_count() != m_vecPoint.size())
+	{
+		_ASSERT(0);
+		return;
+	}
+
+	m_vecPoint = mpoly.points();
+
+	refit();
+}
+
+void SegmentTree2D::refit()
+{
+	// Children are always after their parent : reverse order is bottom-up
+	for (size_t i = m_vecNode.size(); i > 0; i--)
+	{
+		uint32_t nNode = static_cast<uint32_t>(i - 1);
+
+		if (m_vecNode[nNode].m_nCount > 0)
+		{
+			refit_leaf(nNode);
+		}
+		else
+		{
+			segtree_empty_box(m_vecNode[nNode]);
+			refit_inner(nNode);
+		}
+	}
+}
+
+}}
@@ -0,0 +1,467 @@
+#include "x2dsimp.h"
+
+#include <cmath>
+#include <queue>
+#include <limits>
+#include <algorithm>
+#include <functional>
+
+namespace geo { namespace v2 {
+
+static const GDouble SIMPLIFY_KEEP = std::numeric_limits<GDouble>::max();
+
+/***********************************************************************************
+*! @brief  : Squared distance of point to segment (double precision)
+***********************************************************************************/
+static inline GDouble simplify_dist2(const Point2D& pt, const Point2D& pt1, const Point2D& pt2)
+{
+	GDouble dx = GDouble(pt2.x) - pt1.x, dy = GDouble(pt2.y) - pt1.y;
+	GDouble px = GDouble(pt.x) - pt1.x,  py = GDouble(pt.y) - pt1.y;
+
+	GDouble dLen2 = dx * dx + dy * dy;
+	GDouble t     = (dLen2 > 0.0) ? (px * dx + py * dy) / dLen2 : 0.0;
+
+	t = std::max(0.0, std::min(1.0, t));
+
+	px -= t * dx; py -= t * dy;
+
+	return px * px + py * py;
+}
+
+/***********************************************************************************
+*! @brief  : Area of triangle (double precision)
+***********************************************************************************/
+static inline GDouble simplify_area(const Point2D& pt1, const Point2D& pt2, const Point2D& pt3)
+{
+	return 0.5 * std::fabs((GDouble(pt2.x) - pt1.x) * (GDouble(pt3.y) - pt1.y) -
+						   (GDouble(pt2.y) - pt1.y) * (GDouble(pt3.x) - pt1.x));
+}
+
+/***********************************************************************************
+*! @brief  : Number of point without closing point (ring : last == first)
+***********************************************************************************/
+static inline size_t simplify_size(const RingView2D& line, GBool bClosed)
+{
+	size_t nCnt = line.size();
+
+	if (bClosed && nCnt > 1 && line[0].x == line[nCnt - 1].x && line[0].y == line[nCnt - 1].y)
+		nCnt--;
+
+	return nCnt;
+}
+
+/***********************************************************************************
+*! @brief  : Douglas-Peucker significance : squared distance to the split segment,
+*!           clamped by the value of the parent split (so the values are nested)
+*! @param  : [in ] pts    : points
+*! @param  : [in ] nCnt   : number of point
+*! @param  : [in ] bClosed: ring | polyline
+*! @param  : [out] sig    : value of each point (size >= nCnt)
+***********************************************************************************/
+static void significance_dp(const Point2D* pts, size_t nCnt, GBool bClosed, GDouble* sig)
+{
+	typedef struct tagSplit
+	{
+		size_t	i;
+		size_t	j;			// may be nCnt (ring : point 0)
+		GDouble	dParent;
+
+	} Split;
+
+	std::fill(sig, sig + nCnt, SIMPLIFY_KEEP);
+
+	if (nCnt <= (bClosed ? 3u : 2u))
+		return;
+
+	std::vector<Split> stack;
+
+	if (bClosed)
+	{
+		// Split ring at the farthest point of point 0
+		size_t nFar = 1; GDouble dFar = -1.0;
+
+		for (size_t i = 1; i < nCnt; i++)
+		{
+			GDouble dx = GDouble(pts[i].x) - pts[0].x, dy = GDouble(pts[i].y) - pts[0].y;
+
+			if (dx * dx + dy * dy > dFar)
+			{
+				dFar = dx * dx + dy * dy;
+				nFar = i;
+			}
+		}
+
+		stack.push_back({ 0, nFar, SIMPLIFY_KEEP });
+		stack.push_back({ nFar, nCnt, SIMPLIFY_KEEP });
+	}
+	else
+	{
+		stack.push_back({ 0, nCnt - 1, SIMPLIFY_KEEP });
+	}
+
+	while (!stack.empty())
+	{
+		Split split = stack.back(); stack.pop_back();
+
+		if (split.j - split.i < 2)
+			continue;
+
+		const Point2D& pt1 = pts[split.i];
+		const Point2D& pt2 = pts[split.j % nCnt];
+
+		size_t nMax = split.i + 1; GDouble dMax = -1.0;
+
+		for (size_t k = split.i + 1; k < split.j; k++)
+		{
+			GDouble d = simplify_dist2(pts[k], pt1, pt2);
+
+			if (d > dMax)
+			{
+				dMax = d;
+				nMax = k;
+			}
+		}
+
+		sig[nMax] = std::min(dMax, split.dParent);
+
+		stack.push_back({ split.i, nMax, sig[nMax] });
+		stack.push_back({ nMax, split.j, sig[nMax] });
+	}
+
+	// Ring keeps 3 points : the most significant point of the two halves
+	if (bClosed)
+	{
+		size_t nBest = nCnt; GDouble dBest = -1.0;
+
+		for (size_t i = 0; i < nCnt; i++)
+		{
+			if (sig[i] != SIMPLIFY_KEEP && sig[i] > dBest)
+			{
+				dBest = sig[i];
+				nBest = i;
+			}
+		}
+
+		if (nBest < nCnt) sig[nBest] = SIMPLIFY_KEEP;
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Visvalingam-Whyatt significance : effective area when the point is
+*!           removed (never smaller than the area of the previous removed point)
+*! @param  : [in ] pts    : points
+*! @param  : [in ] nCnt   : number of point
+*! @param  : [in ] bClosed: ring | polyline
+*! @param  : [out] sig    : value of each point (size >= nCnt)
+***********************************************************************************/
+static void significance_vw(const Point2D* pts, size_t nCnt, GBool bClosed, GDouble* sig)
+{
+	typedef std::pair<GDouble, size_t> AreaItem;
+
+	std::fill(sig, sig + nCnt, SIMPLIFY_KEEP);
+
+	size_t nMinCnt = bClosed ? 3u : 2u;
+
+	if (nCnt <= nMinCnt)
+		return;
+
+	std::vector<size_t>  vecPrev(nCnt), vecNext(nCnt);
+	std::vector<GDouble> vecArea(nCnt, SIMPLIFY_KEEP);
+
+	std::priority_queue<AreaItem, std::vector<AreaItem>, std::greater<AreaItem>> heap;
+
+	for (size_t i = 0; i < nCnt; i++)
+	{
+		vecPrev[i] = (i == 0) ? nCnt - 1 : i - 1;
+		vecNext[i] = (i + 1 == nCnt) ? 0 : i + 1;
+	}
+
+	for (size_t i = 0; i < nCnt; i++)
+	{
+		if (!bClosed && (i == 0 || i + 1 == nCnt))
+			continue;
+
+		vecArea[i] = simplify_area(pts[vecPrev[i]], pts[i], pts[vecNext[i]]);
+		heap.push(AreaItem(vecArea[i], i));
+	}
+
+	size_t  nRemain  = nCnt;
+	GDouble dLastEff = 0.0;
+
+	while (!heap.empty() && nRemain > nMinCnt)
+	{
+		AreaItem item = heap.top(); heap.pop();
+
+		size_t i = item.second;
+
+		// Removed point or old area (lazy update)
+		if (sig[i] != SIMPLIFY_KEEP || vecArea[i] != item.first)
+			continue;
+
+		dLastEff = std::max(dLastEff, item.first);
+		sig[i]   = dLastEff;
+		nRemain--;
+
+		size_t nPrev = vecPrev[i], nNext = vecNext[i];
+
+		vecNext[nPrev] = nNext;
+		vecPrev[nNext] = nPrev;
+
+		for (size_t n : { nPrev, nNext })
+		{
+			if (!bClosed && (n == 0 || n + 1 == nCnt))
+				continue;
+
+			vecArea[n] = simplify_area(pts[vecPrev[n]], pts[n], pts[vecNext[n]]);
+			heap.push(AreaItem(vecArea[n], n));
+		}
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Significance of each point (point is kept for threshold < value)
+*! @param  : [in ] line    : points
+*! @param  : [in ] bClosed : TRUE : ring (closing point is ignored) | FALSE : polyline
+*! @param  : [in ] eMethod : DP : squared distance | VW : effective area
+*! @param  : [out] vecSig  : value of each point (replaced, size of line)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Values are nested : the points kept by a larger threshold are also
+*!           kept by a smaller one. End points of polyline (and 3 points of ring)
+*!           are always kept
+***********************************************************************************/
+Dllexport void get_simplify_significance(const RingView2D& line, GBool bClosed, EnumSimplify eMethod,
+										 std::vector<GDouble>& vecSig)
+{
+	vecSig.assign(line.size(), SIMPLIFY_KEEP);
+
+	size_t nCnt = simplify_size(line, bClosed);
+
+	if (eMethod == SIMPLIFY_VW)
+		significance_vw(line.data(), nCnt, bClosed, vecSig.data());
+	else
+		significance_dp(line.data(), nCnt, bClosed, vecSig.data());
+}
+
+/***********************************************************************************
+*! @brief  : Keep points whose significance > threshold
+***********************************************************************************/
+static void simplify_filter(const RingView2D& line, const std::vector<GDouble>& vecSig, GDouble dThreshold,
+							VecPoint2D& vecOut)
+{
+	vecOut.clear();
+
+	for (size_t i = 0; i < line.size(); i++)
+	{
+		if (vecSig[i] > dThreshold) vecOut.push_back(line[i]);
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Simplify polyline / ring use Douglas-Peucker algorithm
+*! @param  : [in ] line       : points
+*! @param  : [in ] fTolerance : max distance of removed point to result
+*! @param  : [in ] bClosed    : TRUE : ring | FALSE : polyline
+*! @param  : [out] vecOut     : simplified points (replaced)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Ring keeps its closing point if input has it. Result may self-intersect
+*! @refer  : https://en.wikipedia.org/wiki/Ramer-Douglas-Peucker_algorithm
+***********************************************************************************/
+Dllexport void simplify_douglas_peucker(const RingView2D& line, GFloat fTolerance, GBool bClosed, VecPoint2D& vecOut)
+{
+	std::vector<GDouble> vecSig;
+	get_simplify_significance(line, bClosed, SIMPLIFY_DP, vecSig);
+
+	simplify_filter(line, vecSig, GDouble(fTolerance) * fTolerance, vecOut);
+}
+
+Dllexport VecPoint2D simplify_douglas_peucker(const VecPoint2D& line, GFloat fTolerance, GBool bClosed /*= GFalse*/)
+{
+	VecPoint2D vecOut;
+	simplify_douglas_peucker(RingView2D(line), fTolerance, bClosed, vecOut);
+	return vecOut;
+}
+
+/***********************************************************************************
+*! @brief  : Simplify polyline / ring use Visvalingam-Whyatt algorithm
+*! @param  : [in ] line   : points
+*! @param  : [in ] fArea  : points of effective area <= fArea are removed
+*! @param  : [in ] bClosed: TRUE : ring | FALSE : polyline
+*! @param  : [out] vecOut : simplified points (replaced)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Ring keeps its closing point if input has it. Result may self-intersect
+*! @refer  : https://en.wikipedia.org/wiki/Visvalingam-Whyatt_algorithm
+***********************************************************************************/
+Dllexport void simplify_visvalingam(const RingView2D& line, GFloat fArea, GBool bClosed, VecPoint2D& vecOut)
+{
+	std::vector<GDouble> vecSig;
+	get_simplify_significance(line, bClosed, SIMPLIFY_VW, vecSig);
+
+	simplify_filter(line, vecSig, GDouble(fArea), vecOut);
+}
+
+Dllexport VecPoint2D simplify_visvalingam(const VecPoint2D& line, GFloat fArea, GBool bClosed /*= GFalse*/)
+{
+	VecPoint2D vecOut;
+	simplify_visvalingam(RingView2D(line), fArea, bClosed, vecOut);
+	return vecOut;
+}
+
+///////////////////////////////////////////////////////////////////////////////////
+// PolygonLod2D
+
+PolygonLod2D::PolygonLod2D() : m_eMethod(SIMPLIFY_DP)
+{
+
+}
+
+/***********************************************************************************
+*! @brief  : Build levels (can be called again to rebuild)
+*! @param  : [in] mpoly     : source multipolygon
+*! @param  : [in] fMinTol   : tolerance of level 1 (unit of mpoly)
+*! @param  : [in] eMethod   : simplification method
+*! @param  : [in] nMaxLevel : max number of level (source included)
+*! @param  : [in] bClosed   : TRUE : rings | FALSE : rings are polylines
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Significance of points is computed once, each level only filters.
+*!           Building stops when no ring can be simplified anymore
+***********************************************************************************/
+void PolygonLod2D::build(const MultiPolygon2D& mpoly, GFloat fMinTol, EnumSimplify eMethod /*= SIMPLIFY_DP*/,
+						 GInt nMaxLevel /*= 16*/, GBool bClosed /*= GTrue*/)
+{
+	clear();
+
+	m_eMethod = eMethod;
+
+	m_vecLevel.push_back(mpoly);
+	m_vecTol.push_back(0.f);
+
+	if (fMinTol <= 0.f || nMaxLevel <= 1)
+		return;
+
+	// Significance of points of current level (same layout as level points)
+	std::vector<GDouble> vecSig(mpoly.point_count()), vecRingSig;
+	size_t nMinCnt = 0;
+
+	for (size_t r = 0; r < mpoly.ring_count(); r++)
+	{
+		get_simplify_significance(mpoly.ring(r), bClosed, eMethod, vecRingSig);
+
+		std::copy(vecRingSig.begin(), vecRingSig.end(), vecSig.begin() + mpoly.ring_begin(r));
+
+		nMinCnt += std::count(vecRingSig.begin(), vecRingSig.end(), SIMPLIFY_KEEP);
+	}
+
+	std::vector<GDouble> vecNextSig;
+	GDouble dTol = fMinTol;
+
+	// Tolerance is doubled until all rings are at their minimum (<= 64 doublings)
+	for (GInt nIter = 0; nIter < 64 && level_count() < nMaxLevel &&
+		 m_vecLevel.back().point_count() > nMinCnt; nIter++, dTol *= 2.0)
+	{
+		// DP : squared distance | VW : area
+		GDouble dThreshold = dTol * dTol;
+
+		const MultiPolygon2D& prev = m_vecLevel.back();
+
+		size_t nKeep = 0;
+
+		for (size_t i = 0; i < vecSig.size(); i++)
+		{
+			if (vecSig[i] > dThreshold) nKeep++;
+		}
+
+		if (nKeep == prev.point_count())
+			continue;
+
+		// Filter previous level : polygons and rings are kept (same index as source)
+		MultiPolygon2D level;
+		level.reserve(nKeep, prev.ring_count(), prev.poly_count());
+
+		vecNextSig.clear();
+		vecNextSig.reserve(nKeep);
+
+		VecPoint2D vecRing;
+
+		for (size_t p = 0; p < prev.poly_count(); p++)
+		{
+			level.begin_polygon();
+
+			for (size_t r = prev.poly_ring_begin(p); r < prev.poly_ring_end(p); r++)
+			{
+				vecRing.clear();
+
+				for (size_t i = prev.ring_begin(r); i < prev.ring_end(r); i++)
+				{
+					if (vecSig[i] > dThreshold)
+					{
+						vecRing.push_back(prev.points()[i]);
+						vecNextSig.push_back(vecSig[i]);
+					}
+				}
+
+				level.add_ring(vecRing);
+			}
+		}
+
+		m_vecLevel.push_back(std::move(level));
+		m_vecTol.push_back(static_cast<GFloat>(dTol));
+
+		vecSig.swap(vecNextSig);
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Release levels
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+void PolygonLod2D::clear()
+{
+	m_vecLevel.clear();
+	m_vecTol.clear();
+}
+
+/***********************************************************************************
+*! @brief  : Coarsest level whose tolerance <= fTolerance
+*! @param  : [in] fTolerance : allowed error (unit of mpoly)
+*! @return : level index (0 : source)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+GInt PolygonLod2D::get_level(GFloat fTolerance) const
+{
+	if (m_vecTol.empty())
+		return 0;
+
+	auto it = std::upper_bound(m_vecTol.begin(), m_vecTol.end(), fTolerance);
+
+	return std::max<GInt>(0, static_cast<GInt>(it - m_vecTol.begin()) - 1);
+}
+
+/***********************************************************************************
+*! @brief  : Level for camera zoom
+*! @param  : [in] fZoom     : pixel per unit (gp::Camera2D::GetZoom)
+*! @param  : [in] fPixelTol : allowed error on screen (pixel)
+*! @return : level index (0 : source)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+GInt PolygonLod2D::get_level_zoom(GFloat fZoom, GFloat fPixelTol /*= 0.5f*/) const
+{
+	if (fZoom <= 0.f)
+		return 0;
+
+	return get_level(fPixelTol / fZoom);
+}
+
+/***********************************************************************************
+*! @brief  : Multipolygon for camera zoom (render / hit test)
+*! @param  : [in] fZoom     : pixel per unit (gp::Camera2D::GetZoom)
+*! @param  : [in] fPixelTol : allowed error on screen (pixel)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+const MultiPolygon2D& PolygonLod2D::select(GFloat fZoom, GFloat fPixelTol /*= 0.5f*/) const
+{
+	_ASSERT(!m_vecLevel.empty());
+
+	return m_vecLevel[get_level_zoom(fZoom, fPixelTol)];
+}
+
+}}
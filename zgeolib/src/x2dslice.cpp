@@ -0,0 +1,837 @@
+#include "x2dslice.h"
+#include "x2dpoly.h"
+
+#include <cmath>
+#include <algorithm>
+
+namespace geo { namespace v2 {
+
+/***********************************************************************************
+*! @brief  : Crossing of a ring edge and a line
+***********************************************************************************/
+typedef struct tagSliceCross
+{
+	uint32_t	nLine;	// line slot (sorted offset)
+	uint32_t	nNode;	// node at crossing (ring vertex if on the line)
+	GDouble		u;		// position along line
+	GInt		nSide;	// bit 0 : counts for the side above line | bit 1 : below
+
+} SliceCross;
+
+/***********************************************************************************
+*! @brief  : Directed edge of a piece (interior on the left side)
+***********************************************************************************/
+typedef struct tagSliceEdge
+{
+	uint32_t	nStrip;	// strip s : between line s - 1 and line s
+	uint32_t	nFrom;
+	uint32_t	nTo;
+
+} SliceEdge;
+
+/***********************************************************************************
+*! @brief  : One direction of lines. Frame : u along line, v on left normal,
+*!           line s : v = m_vecOffset[s]
+***********************************************************************************/
+class SliceSweep
+{
+protected:
+	GDouble					m_dx, m_dy;		// unit direction
+	std::vector<GDouble>	m_vecOffset;	// sorted line offsets
+
+	VecPoint2D				m_vecNode;		// ring vertices then crossing points
+	std::vector<GDouble>	m_vecU, m_vecV;	// frame coordinates of nodes
+	std::vector<uint32_t>	m_vecRing;		// first node of ring r (+ end)
+
+	std::vector<SliceCross>	m_vecCross;		// crossings
+	std::vector<uint32_t>	m_vecSplit;		// nodes inside each edge (walk order)
+	std::vector<uint32_t>	m_vecSplitBegin;// first split of edge e (+ end)
+
+public:
+	SliceSweep() : m_dx(1.0), m_dy(0.0) {}
+
+	/*******************************************************************************
+	*! @brief  : Set line direction (unit) and offsets (sorted)
+	********************************************************************************/
+	void set_lines(GDouble dx, GDouble dy, const std::vector<GDouble>& vecOffset)
+	{
+		m_dx = dx; m_dy = dy;
+		m_vecOffset = vecOffset;
+	}
+
+	/*******************************************************************************
+	*! @brief  : Copy rings (bOrient : first ring of polygon CCW, other rings CW)
+	********************************************************************************/
+	void set_polygon(const MultiPolygon2D& mpoly, GBool bOrient)
+	{
+		m_vecNode.clear();
+		m_vecRing.clear();
+
+		m_vecNode.reserve(mpoly.point_count());
+
+		for (size_t p = 0; p < mpoly.poly_count(); p++)
+		{
+			for (size_t r = mpoly.poly_ring_begin(p); r < mpoly.poly_ring_end(p); r++)
+			{
+				const Point2D* pts = mpoly.ring_data(r);
+				const size_t nBegin = m_vecNode.size();
+
+				for (size_t i = 0; i < mpoly.ring_size(r); i++)
+				{
+					if (m_vecNode.size() == nBegin || m_vecNode.back().x != pts[i].x || m_vecNode.back().y != pts[i].y)
+						m_vecNode.push_back(pts[i]);
+				}
+
+				while (m_vecNode.size() > nBegin + 1 && m_vecNode.back().x == m_vecNode[nBegin].x &&
+														m_vecNode.back().y == m_vecNode[nBegin].y)
+				{
+					m_vecNode.pop_back();
+				}
+
+				if (m_vecNode.size() < nBegin + 3)
+				{
+					m_vecNode.resize(nBegin);
+					continue;
+				}
+
+				if (bOrient)
+				{
+					GDouble dArea = 0.0;
+
+					for (size_t i = nBegin, j = m_vecNode.size() - 1; i < m_vecNode.size(); j = i++)
+					{
+						dArea += (GDouble(m_vecNode[j].x) - m_vecNode[i].x) * (GDouble(m_vecNode[j].y) + m_vecNode[i].y);
+					}
+
+					const GBool bHole = (r != mpoly.poly_ring_begin(p)) ? GTrue : GFalse;
+
+					if (dArea != 0.0 && (dArea < 0.0) != (bHole == GTrue))
+						std::reverse(m_vecNode.begin() + nBegin, m_vecNode.end());
+				}
+
+				m_vecRing.push_back(uint32_t(nBegin));
+			}
+		}
+
+		m_vecRing.push_back(uint32_t(m_vecNode.size()));
+	}
+
+	/*******************************************************************************
+	*! @brief  : Crossings of all edges and lines. Side above line : edge (a, b)
+	*!           counts when min(va, vb) <= offset < max(va, vb), side below : when
+	*!           min(va, vb) < offset <= max(va, vb) (vertex on line : only once)
+	********************************************************************************/
+	void cross()
+	{
+		// Crossing points of previous lines are removed
+		const size_t nVert = m_vecRing.back();
+		m_vecNode.resize(nVert);
+
+		m_vecU.resize(nVert);
+		m_vecV.resize(nVert);
+
+		for (size_t i = 0; i < nVert; i++)
+		{
+			m_vecU[i] =  m_dx * m_vecNode[i].x + m_dy * m_vecNode[i].y;
+			m_vecV[i] = -m_dy * m_vecNode[i].x + m_dx * m_vecNode[i].y;
+		}
+
+		m_vecCross.clear();
+		m_vecSplit.clear();
+		m_vecSplitBegin.assign(1, 0);
+
+		for (size_t r = 0; r + 1 < m_vecRing.size(); r++)
+		{
+			const uint32_t nBegin = m_vecRing[r], nEnd = m_vecRing[r + 1];
+
+			for (uint32_t a = nBegin; a < nEnd; a++)
+			{
+				const uint32_t b = (a + 1 < nEnd) ? a + 1 : nBegin;
+				const GDouble  va = m_vecV[a], vb = m_vecV[b];
+
+				if (va != vb)
+				{
+					const GDouble vLo = std::min(va, vb), vHi = std::max(va, vb);
+
+					const size_t s0 = std::lower_bound(m_vecOffset.begin(), m_vecOffset.end(), vLo) - m_vecOffset.begin();
+					const size_t s1 = std::upper_bound(m_vecOffset.begin(), m_vecOffset.end(), vHi) - m_vecOffset.begin();
+
+					for (size_t k = 0; k < s1 - s0; k++)
+					{
+						const size_t  s = (va < vb) ? s0 + k : s1 - 1 - k;	// walk order a -> b
+						const GDouble c = m_vecOffset[s];
+						const GInt nSide = ((c < vHi) ? 1 : 0) | ((c > vLo) ? 2 : 0);
+
+						uint32_t nNode = a;
+						GDouble  u = m_vecU[a];
+
+						if (c == vb)
+						{
+							nNode = b;
+							u = m_vecU[b];
+						}
+						else if (c != va)
+						{
+							const GDouble t = (c - va) / (vb - va);
+							const Point2D& pa = m_vecNode[a];
+							const Point2D& pb = m_vecNode[b];
+
+							nNode = uint32_t(m_vecNode.size());
+							u = m_vecU[a] + t * (m_vecU[b] - m_vecU[a]);
+
+							m_vecNode.push_back(Point2D(GFloat(pa.x + t * (GDouble(pb.x) - pa.x)),
+														GFloat(pa.y + t * (GDouble(pb.y) - pa.y))));
+							m_vecU.push_back(u);
+							m_vecV.push_back(c);
+						}
+
+						m_vecCross.push_back(SliceCross{ uint32_t(s), nNode, u, nSide });
+
+						if (nNode != a && nNode != b)
+							m_vecSplit.push_back(nNode);
+					}
+				}
+
+				m_vecSplitBegin.push_back(uint32_t(m_vecSplit.size()));
+			}
+		}
+
+		std::sort(m_vecCross.begin(), m_vecCross.end(), [](const SliceCross& c1, const SliceCross& c2)
+		{
+			if (c1.nLine != c2.nLine) return c1.nLine < c2.nLine;
+			if (c1.u != c2.u) return c1.u < c2.u;
+			return c1.nNode < c2.nNode;
+		});
+	}
+
+	/*******************************************************************************
+	*! @brief  : Segments of lines inside on both sides (cuts)
+	*! @param  : [in] bSplit : TRUE : split at every crossing (nodes of pieces) |
+	*!                         FALSE : one segment per inside interval
+	*! @note   : Parts of line on a ring edge are inside on one side only : that
+	*!           edge bounds the piece (no cut segment)
+	********************************************************************************/
+	template<typename F>
+	void for_each_segment(GBool bSplit, F funSegment) const
+	{
+		GInt nAbove = 0, nBelow = 0;
+		size_t nStart = 0;
+
+		for (size_t i = 0; i < m_vecCross.size(); i++)
+		{
+			const SliceCross& cr = m_vecCross[i];
+
+			if (i == 0 || cr.nLine != m_vecCross[i - 1].nLine)
+			{
+				nAbove = nBelow = 0;
+			}
+
+			const GBool bWasIn = (nAbove && nBelow) ? GTrue : GFalse;
+
+			nAbove ^= (cr.nSide & 1);
+			nBelow ^= (cr.nSide >> 1) & 1;
+
+			const GBool bIn = (nAbove && nBelow) ? GTrue : GFalse;
+
+			if (bIn && !bWasIn)
+			{
+				nStart = i;
+			}
+			else if (!bIn && bWasIn && !bSplit && m_vecCross[nStart].nNode != cr.nNode)
+			{
+				funSegment(cr.nLine, m_vecCross[nStart].nNode, cr.nNode);
+			}
+
+			if (bIn && bSplit && i + 1 < m_vecCross.size() && m_vecCross[i + 1].nLine == cr.nLine &&
+				m_vecCross[i + 1].nNode != cr.nNode)
+			{
+				funSegment(cr.nLine, cr.nNode, m_vecCross[i + 1].nNode);
+			}
+		}
+	}
+
+	/*******************************************************************************
+	*! @brief  : Hatch segments
+	********************************************************************************/
+	void hatch(VecLine2D& vecSegment, std::vector<uint32_t>& vecLine) const
+	{
+		for_each_segment(GFalse, [&](uint32_t nLine, uint32_t n1, uint32_t n2)
+		{
+			vecSegment.push_back(Line2D(m_vecNode[n1], m_vecNode[n2]));
+			vecLine.push_back(nLine);
+		});
+	}
+
+	/*******************************************************************************
+	*! @brief  : Pieces of strips (outer ring CCW, hole CW)
+	********************************************************************************/
+	void slice(MultiPolygon2D& result, std::vector<uint32_t>& vecStrip) const;
+
+protected:
+	uint32_t strip_of(uint32_t n1, uint32_t n2) const
+	{
+		const GDouble v1 = m_vecV[n1], v2 = m_vecV[n2];
+
+		if (v1 == v2)
+		{
+			// Edge on a line : strip of the interior (left side)
+			auto it = std::lower_bound(m_vecOffset.begin(), m_vecOffset.end(), v1);
+
+			if (it != m_vecOffset.end() && *it == v1)
+				return uint32_t(it - m_vecOffset.begin()) + ((m_vecU[n2] > m_vecU[n1]) ? 1 : 0);
+		}
+
+		return uint32_t(std::upper_bound(m_vecOffset.begin(), m_vecOffset.end(), (v1 + v2) * 0.5) - m_vecOffset.begin());
+	}
+};
+
+/***********************************************************************************
+*! @brief  : Pieces of strips : split ring edges and both sides of hatch segments
+*!           are linked to rings strip by strip
+***********************************************************************************/
+void SliceSweep::slice(MultiPolygon2D& result, std::vector<uint32_t>& vecStrip) const
+{
+	// 1. Directed edges
+	std::vector<SliceEdge> vecEdge;
+	vecEdge.reserve(m_vecNode.size() + m_vecCross.size() * 2);
+
+	auto funAdd = [&](uint32_t n1, uint32_t n2)
+	{
+		if (n1 != n2)
+			vecEdge.push_back(SliceEdge{ strip_of(n1, n2), n1, n2 });
+	};
+
+	size_t nEdge = 0;
+
+	for (size_t r = 0; r + 1 < m_vecRing.size(); r++)
+	{
+		const uint32_t nBegin = m_vecRing[r], nEnd = m_vecRing[r + 1];
+
+		for (uint32_t a = nBegin; a < nEnd; a++, nEdge++)
+		{
+			uint32_t nPrev = a;
+
+			for (uint32_t k = m_vecSplitBegin[nEdge]; k < m_vecSplitBegin[nEdge + 1]; k++)
+			{
+				funAdd(nPrev, m_vecSplit[k]);
+				nPrev = m_vecSplit[k];
+			}
+
+			funAdd(nPrev, (a + 1 < nEnd) ? a + 1 : nBegin);
+		}
+	}
+
+	for_each_segment(GTrue, [&](uint32_t nLine, uint32_t n1, uint32_t n2)
+	{
+		vecEdge.push_back(SliceEdge{ nLine + 1, n1, n2 });	// bottom of strip above
+		vecEdge.push_back(SliceEdge{ nLine, n2, n1 });		// top of strip below
+	});
+
+	std::sort(vecEdge.begin(), vecEdge.end(), [](const SliceEdge& e1, const SliceEdge& e2)
+	{
+		if (e1.nStrip != e2.nStrip) return e1.nStrip < e2.nStrip;
+		if (e1.nFrom != e2.nFrom) return e1.nFrom < e2.nFrom;
+		return e1.nTo < e2.nTo;
+	});
+
+	// 2. Next edge at node (same strip) : first edge clockwise from the incoming edge
+	auto funNextEdge = [&](size_t e) -> GInt
+	{
+		const SliceEdge& edge = vecEdge[e];
+
+		SliceEdge key{ edge.nStrip, edge.nTo, 0 };
+
+		auto it = std::lower_bound(vecEdge.begin(), vecEdge.end(), key, [](const SliceEdge& e1, const SliceEdge& e2)
+		{
+			return (e1.nStrip != e2.nStrip) ? e1.nStrip < e2.nStrip : e1.nFrom < e2.nFrom;
+		});
+
+		GInt nBest = -1;
+		GDouble dBest = 0.0;
+
+		const Point2D& ptNode = m_vecNode[edge.nTo];
+		const Point2D& ptBack = m_vecNode[edge.nFrom];
+
+		const GDouble rx = GDouble(ptBack.x) - ptNode.x, ry = GDouble(ptBack.y) - ptNode.y;
+
+		for (; it != vecEdge.end() && it->nStrip == edge.nStrip && it->nFrom == edge.nTo; ++it)
+		{
+			const Point2D& ptNext = m_vecNode[it->nTo];
+
+			GDouble dx = GDouble(ptNext.x) - ptNode.x, dy = GDouble(ptNext.y) - ptNode.y;
+			GDouble dAngle = -std::atan2(rx * dy - ry * dx, rx * dx + ry * dy);
+
+			if (dAngle <= 0.0)
+				dAngle += 6.283185307179586;	// 2 * PI
+
+			if (nBest < 0 || dAngle < dBest)
+			{
+				nBest = GInt(it - vecEdge.begin());
+				dBest = dAngle;
+			}
+		}
+
+		return nBest;
+	};
+
+	// 3. Rings : walk until an edge of the walk comes again (open walks are dropped)
+	const GInt nEdgeCnt = GInt(vecEdge.size());
+
+	std::vector<GInt> vecWalk(nEdgeCnt, -1), vecPos(nEdgeCnt, 0);
+	std::vector<uint32_t> vecChain;
+
+	VecPoint2D vecRingPt;
+	std::vector<uint32_t> vecRingBegin(1, 0), vecRingStrip;
+	std::vector<GDouble> vecRingArea;
+
+	for (GInt e = 0; e < nEdgeCnt; e++)
+	{
+		if (vecWalk[e] >= 0)
+			continue;
+
+		vecChain.clear();
+
+		GInt nCur = e;
+
+		while (nCur >= 0 && vecWalk[nCur] < 0)
+		{
+			vecWalk[nCur] = e;
+			vecPos[nCur]  = GInt(vecChain.size());
+			vecChain.push_back(uint32_t(nCur));
+
+			nCur = funNextEdge(nCur);
+		}
+
+		if (nCur < 0 || vecWalk[nCur] != e)
+			continue;
+
+		GDouble dArea = 0.0;
+
+		for (size_t k = vecPos[nCur]; k < vecChain.size(); k++)
+		{
+			const Point2D& pt1 = m_vecNode[vecEdge[vecChain[k]].nFrom];
+			const Point2D& pt2 = m_vecNode[vecEdge[vecChain[k]].nTo];
+
+			dArea += (GDouble(pt1.x) - pt2.x) * (GDouble(pt1.y) + pt2.y);
+			vecRingPt.push_back(pt1);
+		}
+
+		if (dArea == 0.0)
+		{
+			vecRingPt.resize(vecRingBegin.back());
+			continue;
+		}
+
+		vecRingBegin.push_back(uint32_t(vecRingPt.size()));
+		vecRingStrip.push_back(vecEdge[e].nStrip);
+		vecRingArea.push_back(dArea * 0.5);
+	}
+
+	// 4. Holes (rings that touch no line) : smallest piece of the strip around them
+	const size_t nRing = vecRingArea.size();
+	std::vector<GInt> vecParent(nRing, -1);
+
+	auto funRing = [&](size_t r)
+	{
+		return RingView2D(vecRingPt.data() + vecRingBegin[r], vecRingBegin[r + 1] - vecRingBegin[r]);
+	};
+
+	for (size_t h = 0; h < nRing; h++)
+	{
+		if (vecRingArea[h] > 0.0)
+			continue;
+
+		// Test point strictly inside the strip (not on a hatch segment)
+		const uint32_t s = vecRingStrip[h];
+		const GDouble vLo = (s > 0) ? m_vecOffset[s - 1] : -HUGE_VAL;
+		const GDouble vHi = (s < m_vecOffset.size()) ? m_vecOffset[s] : HUGE_VAL;
+
+		Point2D ptTest = vecRingPt[vecRingBegin[h]];
+
+		for (uint32_t k = vecRingBegin[h]; k < vecRingBegin[h + 1]; k++)
+		{
+			const GDouble v = -m_dy * vecRingPt[k].x + m_dx * vecRingPt[k].y;
+
+			if (v > vLo && v < vHi)
+			{
+				ptTest = vecRingPt[k];
+				break;
+			}
+		}
+
+		GDouble dBest = 0.0;
+
+		for (size_t r = 0; r < nRing; r++)
+		{
+			if (vecRingArea[r] <= 0.0 || vecRingStrip[r] != s)
+				continue;
+
+			if ((vecParent[h] < 0 || vecRingArea[r] < dBest) && is_point_in_polygon(ptTest, funRing(r)))
+			{
+				vecParent[h] = GInt(r);
+				dBest = vecRingArea[r];
+			}
+		}
+	}
+
+	// 5. Output strip by strip (rings are found in strip order)
+	std::vector<GInt> vecHoleBegin(nRing + 1, 0), vecHole;
+
+	for (size_t h = 0; h < nRing; h++)
+	{
+		if (vecParent[h] >= 0)
+			vecHoleBegin[vecParent[h] + 1]++;
+	}
+
+	for (size_t r = 0; r < nRing; r++)
+	{
+		vecHoleBegin[r + 1] += vecHoleBegin[r];
+	}
+
+	vecHole.resize(vecHoleBegin[nRing]);
+	std::vector<GInt> vecHolePos(vecHoleBegin.begin(), vecHoleBegin.end() - 1);
+
+	for (size_t h = 0; h < nRing; h++)
+	{
+		if (vecParent[h] >= 0)
+			vecHole[vecHolePos[vecParent[h]]++] = GInt(h);
+	}
+
+	result.reserve(result.point_count() + vecRingPt.size(), result.ring_count() + nRing, result.poly_count() + nRing);
+
+	for (size_t r = 0; r < nRing; r++)
+	{
+		if (vecRingArea[r] <= 0.0)
+			continue;
+
+		result.begin_polygon();
+		result.add_ring(funRing(r));
+
+		for (GInt k = vecHoleBegin[r]; k < vecHoleBegin[r + 1]; k++)
+		{
+			result.add_ring(funRing(vecHole[k]));
+		}
+
+		vecStrip.push_back(vecRingStrip[r]);
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Offsets of lines ptOrigin + k * fSpacing * normal crossing mpoly
+*! @return : FALSE : no line (empty polygon, bad direction or spacing)
+***********************************************************************************/
+static GBool slice_regular_lines(const MultiPolygon2D& mpoly, const Point2D& ptOrigin, const Vec2D& vDir, GFloat fSpacing,
+								 SliceSweep& sweep, GInt& nFirst)
+{
+	const GDouble dLen = std::sqrt(GDouble(vDir.x) * vDir.x + GDouble(vDir.y) * vDir.y);
+
+	if (dLen == 0.0 || !(fSpacing > 0.f) || mpoly.point_count() == 0)
+		return GFalse;
+
+	const GDouble dx = vDir.x / dLen, dy = vDir.y / dLen;
+
+	GDouble vMin = HUGE_VAL, vMax = -HUGE_VAL;
+
+	for (const Point2D& pt : mpoly.points())
+	{
+		const GDouble v = -dy * pt.x + dx * pt.y;
+
+		vMin = std::min(vMin, v);
+		vMax = std::max(vMax, v);
+	}
+
+	const GDouble v0 = -dy * ptOrigin.x + dx * ptOrigin.y;
+	const GInt kMin = GInt(std::ceil((vMin - v0) / fSpacing));
+	const GInt kMax = GInt(std::floor((vMax - v0) / fSpacing));
+
+	std::vector<GDouble> vecOffset;
+	vecOffset.reserve(std::max(0, kMax - kMin + 1));
+
+	for (GInt k = kMin; k <= kMax; k++)
+	{
+		vecOffset.push_back(v0 + GDouble(k) * fSpacing);
+	}
+
+	sweep.set_lines(dx, dy, vecOffset);
+	nFirst = kMin;
+
+	return GTrue;
+}
+
+/***********************************************************************************
+*! @brief  : Group lines by direction
+*! @param  : [out] vecOrder : line index sorted by direction then offset
+*! @param  : [out] vecGroup : first position in vecOrder of each direction (+ end)
+*! @param  : [out] vecDir   : unit direction of each group (x, y)
+***********************************************************************************/
+static void slice_group_lines(const VecLine2D& vecLines, std::vector<uint32_t>& vecOrder,
+							  std::vector<uint32_t>& vecGroup, std::vector<GDouble>& vecDir)
+{
+	std::vector<GDouble> vecAngle(vecLines.size()), vecOffset(vecLines.size());
+
+	for (size_t i = 0; i < vecLines.size(); i++)
+	{
+		const Line2D& line = vecLines[i];
+
+		GDouble dx = GDouble(line.ptEnd.x) - line.ptStart.x, dy = GDouble(line.ptEnd.y) - line.ptStart.y;
+
+		if (dx == 0.0 && dy == 0.0)
+			continue;
+
+		// Same line for both directions : angle in [0, PI)
+		if (dy < 0.0 || (dy == 0.0 && dx < 0.0))
+		{
+			dx = -dx; dy = -dy;
+		}
+
+		vecAngle[i] = std::atan2(dy, dx);
+		vecOrder.push_back(uint32_t(i));
+	}
+
+	std::sort(vecOrder.begin(), vecOrder.end(), [&](uint32_t a, uint32_t b) { return vecAngle[a] < vecAngle[b]; });
+
+	for (size_t i = 0; i < vecOrder.size(); i++)
+	{
+		if (i == 0 || vecAngle[vecOrder[i]] - vecAngle[vecOrder[vecGroup.back()]] > 1e-12)
+		{
+			vecGroup.push_back(uint32_t(i));
+			vecDir.push_back(std::cos(vecAngle[vecOrder[i]]));
+			vecDir.push_back(std::sin(vecAngle[vecOrder[i]]));
+		}
+	}
+
+	vecGroup.push_back(uint32_t(vecOrder.size()));
+
+	for (size_t g = 0; g + 1 < vecGroup.size(); g++)
+	{
+		const GDouble dx = vecDir[g * 2], dy = vecDir[g * 2 + 1];
+
+		for (uint32_t k = vecGroup[g]; k < vecGroup[g + 1]; k++)
+		{
+			const Point2D& pt = vecLines[vecOrder[k]].ptStart;
+			vecOffset[vecOrder[k]] = -dy * pt.x + dx * pt.y;
+		}
+
+		std::sort(vecOrder.begin() + vecGroup[g], vecOrder.begin() + vecGroup[g + 1], [&](uint32_t a, uint32_t b)
+		{
+			return vecOffset[a] < vecOffset[b];
+		});
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Hatch segments of multipolygon by parallel lines
+*! @param  : [in ] mpoly      : multipolygon (even-odd rule over all rings)
+*! @param  : [in ] ptOrigin   : point on line 0
+*! @param  : [in ] vDir       : line direction
+*! @param  : [in ] fSpacing   : distance between lines (> 0)
+*! @param  : [out] vecSegment : segments inside mpoly (appended, line by line from
+*!                              the right side of vDir, along vDir on each line)
+*! @param  : [out] pLine      : line k of each segment (NULL : not used). Line k
+*!                              passes through ptOrigin + k * fSpacing * left normal
+*!                              (k < 0 : right side of ptOrigin)
+*! @return : number of segment
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Edges are bucketed to the lines they cross and all crossings are
+*!           sorted once : O((n + c) log(n + c)), n edges, c crossings (not one
+*!           cut per line). Parts of a line on a ring edge give no segment
+***********************************************************************************/
+Dllexport size_t hatch_polygon(const MultiPolygon2D& mpoly, const Point2D& ptOrigin, const Vec2D& vDir, GFloat fSpacing,
+							   VecLine2D& vecSegment, std::vector<GInt>* pLine)
+{
+	SliceSweep sweep;
+	GInt nFirst = 0;
+
+	if (slice_regular_lines(mpoly, ptOrigin, vDir, fSpacing, sweep, nFirst) == GFalse)
+		return 0;
+
+	sweep.set_polygon(mpoly, GFalse);
+	sweep.cross();
+
+	const size_t nStart = vecSegment.size();
+	std::vector<uint32_t> vecLine;
+
+	sweep.hatch(vecSegment, vecLine);
+
+	if (pLine)
+	{
+		for (uint32_t s : vecLine)
+		{
+			pLine->push_back(nFirst + GInt(s));
+		}
+	}
+
+	return vecSegment.size() - nStart;
+}
+
+/***********************************************************************************
+*! @brief  : Hatch segments of multipolygon by line set
+*! @param  : [in ] mpoly      : multipolygon (even-odd rule over all rings)
+*! @param  : [in ] vecLines   : lines (infinite line through ptStart, ptEnd)
+*! @param  : [out] vecSegment : segments inside mpoly (appended)
+*! @param  : [out] pLine      : index in vecLines of each segment (NULL : not used)
+*! @return : number of segment
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Parallel lines are grouped, one sweep per direction
+***********************************************************************************/
+Dllexport size_t hatch_polygon(const MultiPolygon2D& mpoly, const VecLine2D& vecLines,
+							   VecLine2D& vecSegment, std::vector<GInt>* pLine)
+{
+	std::vector<uint32_t> vecOrder, vecGroup, vecLine;
+	std::vector<GDouble> vecDir, vecOffset;
+
+	slice_group_lines(vecLines, vecOrder, vecGroup, vecDir);
+
+	SliceSweep sweep;
+	sweep.set_polygon(mpoly, GFalse);
+
+	const size_t nStart = vecSegment.size();
+
+	for (size_t g = 0; g + 1 < vecGroup.size(); g++)
+	{
+		const GDouble dx = vecDir[g * 2], dy = vecDir[g * 2 + 1];
+
+		// Same offset twice : one line (segments of the first index)
+		vecOffset.clear();
+		std::vector<uint32_t> vecSlot;
+
+		for (uint32_t k = vecGroup[g]; k < vecGroup[g + 1]; k++)
+		{
+			const Point2D& pt = vecLines[vecOrder[k]].ptStart;
+			const GDouble c = -dy * pt.x + dx * pt.y;
+
+			if (vecOffset.empty() || vecOffset.back() != c)
+			{
+				vecOffset.push_back(c);
+				vecSlot.push_back(vecOrder[k]);
+			}
+		}
+
+		sweep.set_lines(dx, dy, vecOffset);
+		sweep.cross();
+
+		vecLine.clear();
+		sweep.hatch(vecSegment, vecLine);
+
+		if (pLine)
+		{
+			for (uint32_t s : vecLine)
+			{
+				pLine->push_back(GInt(vecSlot[s]));
+			}
+		}
+	}
+
+	return vecSegment.size() - nStart;
+}
+
+/***********************************************************************************
+*! @brief  : Slice multipolygon into strips between parallel lines
+*! @param  : [in ] mpoly    : polygons (outer ring + holes, rings do not cross)
+*! @param  : [in ] ptOrigin : point on line 0
+*! @param  : [in ] vDir     : line direction
+*! @param  : [in ] fSpacing : distance between lines (> 0)
+*! @param  : [out] result   : pieces (appended, outer ring CCW, hole CW, strip by
+*!                            strip from the right side of vDir)
+*! @param  : [out] pStrip   : strip k of each piece (NULL : not used). Strip k is
+*!                            between line k and line k + 1 (see hatch_polygon)
+*! @return : number of piece
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Edges are split at the lines and linked with the hatch segments in
+*!           one pass (no repeated cut_line2poly). Pieces of neighbour strips
+*!           share their cut points exactly
+***********************************************************************************/
+Dllexport size_t slice_polygon(const MultiPolygon2D& mpoly, const Point2D& ptOrigin, const Vec2D& vDir, GFloat fSpacing,
+							   MultiPolygon2D& result, std::vector<GInt>* pStrip)
+{
+	SliceSweep sweep;
+	GInt nFirst = 0;
+
+	if (slice_regular_lines(mpoly, ptOrigin, vDir, fSpacing, sweep, nFirst) == GFalse)
+		return 0;
+
+	sweep.set_polygon(mpoly, GTrue);
+	sweep.cross();
+
+	std::vector<uint32_t> vecStrip;
+	sweep.slice(result, vecStrip);
+
+	if (pStrip)
+	{
+		for (uint32_t s : vecStrip)
+		{
+			pStrip->push_back(nFirst + GInt(s) - 1);
+		}
+	}
+
+	return vecStrip.size();
+}
+
+/***********************************************************************************
+*! @brief  : Slice multipolygon by line set
+*! @param  : [in ] mpoly    : polygons (outer ring + holes, rings do not cross)
+*! @param  : [in ] vecLines : lines (infinite line through ptStart, ptEnd)
+*! @param  : [out] result   : pieces (appended, outer ring CCW, hole CW)
+*! @return : number of piece
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Parallel lines are grouped, pieces of one direction are sliced by
+*!           the next direction
+***********************************************************************************/
+Dllexport size_t slice_polygon(const MultiPolygon2D& mpoly, const VecLine2D& vecLines, MultiPolygon2D& result)
+{
+	std::vector<uint32_t> vecOrder, vecGroup, vecStrip;
+	std::vector<GDouble> vecDir, vecOffset;
+
+	slice_group_lines(vecLines, vecOrder, vecGroup, vecDir);
+
+	SliceSweep sweep;
+	MultiPolygon2D mpolyCur, mpolyNext;
+
+	const MultiPolygon2D* pInput = &mpoly;
+
+	for (size_t g = 0; g + 1 < vecGroup.size(); g++)
+	{
+		const GDouble dx = vecDir[g * 2], dy = vecDir[g * 2 + 1];
+
+		vecOffset.clear();
+
+		for (uint32_t k = vecGroup[g]; k < vecGroup[g + 1]; k++)
+		{
+			const Point2D& pt = vecLines[vecOrder[k]].ptStart;
+			const GDouble c = -dy * pt.x + dx * pt.y;
+
+			if (vecOffset.empty() || vecOffset.back() != c)
+				vecOffset.push_back(c);
+		}
+
+		sweep.set_lines(dx, dy, vecOffset);
+		sweep.set_polygon(*pInput, GTrue);
+		sweep.cross();
+
+		mpolyNext.clear();
+		vecStrip.clear();
+		sweep.slice(mpolyNext, vecStrip);
+
+		std::swap(mpolyCur, mpolyNext);
+		pInput = &mpolyCur;
+	}
+
+	const size_t nStart = result.poly_count();
+
+	if (pInput == &mpoly)
+	{
+		// No line : pieces are the polygons
+		SliceSweep none;
+		none.set_polygon(mpoly, GTrue);
+		none.cross();
+		none.slice(result, vecStrip);
+	}
+	else
+	{
+		result.append(mpolyCur);
+	}
+
+	return result.poly_count() - nStart;
+}
+
+}}
@@ -0,0 +1,424 @@
+#include "x2dsnap.h"
+
+#include <cmath>
+#include <algorithm>
+
+namespace geo { namespace v2 {
+
+/***********************************************************************************
+*! @brief  : Uniform grid of cells over segments (candidate pairs and hot pixels)
+***********************************************************************************/
+typedef struct tagSnapGrid
+{
+	GFixed				nOrgX;
+	GFixed				nOrgY;
+	GFixed				nCell;		// cell size (grid unit)
+	GFixed				nCntX;
+	GFixed				nCntY;
+
+	std::vector<GInt>	vecBegin;	// item of cell k : [vecBegin[k], vecBegin[k + 1])
+	std::vector<GInt>	vecItem;
+
+} SnapGrid;
+
+/***********************************************************************************
+*! @brief  : Hot pixel on segment
+***********************************************************************************/
+typedef struct tagSnapHit
+{
+	GInt		nSeg;
+	GFixed		t;		// position on segment (projection)
+	Point2Dx	pt;
+
+} SnapHit;
+
+static inline GFixed snap_abs(GFixed v)
+{
+	return (v < 0) ? -v : v;
+}
+
+static inline GBool snap_opposite(GFixed v1, GFixed v2)
+{
+	return ((v1 > 0 && v2 < 0) || (v1 < 0 && v2 > 0)) ? GTrue : GFalse;
+}
+
+/***********************************************************************************
+*! @brief  : Segment touches hot pixel [c - 0.5, c + 0.5) x [c - 0.5, c + 0.5)
+*! @note   : Half open pixel : a segment through a pixel corner touches one pixel.
+*!           Endpoints are on grid and pixel borders are between grid points, so
+*!           a segment only touches a border alone at a corner :
+*!           |2 * cross(a, b, c)| = |dx| + |dy| (exact, no half unit)
+***********************************************************************************/
+static inline GBool snap_touch_pixel(const Point2Dx& a, const Point2Dx& b, const Point2Dx& c)
+{
+	if (c.x < std::min(a.x, b.x) || c.x > std::max(a.x, b.x) ||
+		c.y < std::min(a.y, b.y) || c.y > std::max(a.y, b.y))
+		return GFalse;
+
+	const GFixed dx = b.x - a.x, dy = b.y - a.y;
+	const GFixed nCrs2 = 2 * kernel::cross(a, b, c);
+	const GFixed nSpan = snap_abs(dx) + snap_abs(dy);
+
+	// Line through inside of pixel
+	if (snap_abs(nCrs2) < nSpan)
+		return GTrue;
+
+	if (snap_abs(nCrs2) > nSpan)
+		return GFalse;
+
+	// Line through one corner : only the lower left corner (c - 0.5) is in pixel
+	if (nCrs2 - dx + dy != 0)
+		return GFalse;
+
+	return (2 * std::min(a.x, b.x) < 2 * c.x - 1 && 2 * c.x - 1 < 2 * std::max(a.x, b.x) &&
+			2 * std::min(a.y, b.y) < 2 * c.y - 1 && 2 * c.y - 1 < 2 * std::max(a.y, b.y)) ? GTrue : GFalse;
+}
+
+/***********************************************************************************
+*! @brief  : Pixel of point (half open : round half up)
+***********************************************************************************/
+static inline GFixed snap_round(GDouble dVal)
+{
+	return static_cast<GFixed>(std::floor(dVal + 0.5));
+}
+
+static inline GFixed snap_cell(GFixed v, GFixed nOrg, GFixed nCell, GFixed nCnt)
+{
+	if (v <= nOrg) return 0;
+
+	return std::min((v - nOrg) / nCell, nCnt - 1);
+}
+
+static inline GFixed snap_cell_of(const SnapGrid& grid, const Point2Dx& pt)
+{
+	return snap_cell(pt.y, grid.nOrgY, grid.nCell, grid.nCntY) * grid.nCntX +
+		   snap_cell(pt.x, grid.nOrgX, grid.nCell, grid.nCntX);
+}
+
+/***********************************************************************************
+*! @brief  : Visit cells that may hold a hot pixel touched by segment ab
+*! @note   : Column by column : y range of the segment over the column widened by
+*!           one unit (a touched pixel center is less than 1 unit from the segment)
+***********************************************************************************/
+template<typename Fun>
+static void snap_visit_cells(const SnapGrid& grid, const Point2Dx& a, const Point2Dx& b, Fun funVisit)
+{
+	const GFixed nMinX = std::min(a.x, b.x), nMaxX = std::max(a.x, b.x);
+	const GFixed nMinY = std::min(a.y, b.y), nMaxY = std::max(a.y, b.y);
+
+	const GFixed nCol1 = snap_cell(nMinX - 1, grid.nOrgX, grid.nCell, grid.nCntX);
+	const GFixed nCol2 = snap_cell(nMaxX + 1, grid.nOrgX, grid.nCell, grid.nCntX);
+
+	const GDouble dSlope = (a.x != b.x) ? GDouble(b.y - a.y) / GDouble(b.x - a.x) : 0.0;
+
+	for (GFixed nCol = nCol1; nCol <= nCol2; nCol++)
+	{
+		GFixed nLowY = nMinY, nHighY = nMaxY;
+
+		if (a.x != b.x)
+		{
+			GFixed nX1 = grid.nOrgX + nCol * grid.nCell - 1;
+			GFixed nX2 = grid.nOrgX + (nCol + 1) * grid.nCell;
+
+			nX1 = std::min(std::max(nX1, nMinX), nMaxX);
+			nX2 = std::min(std::max(nX2, nMinX), nMaxX);
+
+			GDouble dY1 = GDouble(a.y) + GDouble(nX1 - a.x) * dSlope;
+			GDouble dY2 = GDouble(a.y) + GDouble(nX2 - a.x) * dSlope;
+
+			nLowY  = std::max(nMinY, static_cast<GFixed>(std::floor(std::min(dY1, dY2))));
+			nHighY = std::min(nMaxY, static_cast<GFixed>(std::ceil(std::max(dY1, dY2))));
+		}
+
+		const GFixed nRow1 = snap_cell(nLowY - 1, grid.nOrgY, grid.nCell, grid.nCntY);
+		const GFixed nRow2 = snap_cell(nHighY + 1, grid.nOrgY, grid.nCell, grid.nCntY);
+
+		for (GFixed nRow = nRow1; nRow <= nRow2; nRow++)
+		{
+			funVisit(nRow * grid.nCntX + nCol);
+		}
+	}
+}
+
+/***********************************************************************************
+*! @brief  : One round of snap rounding
+*! @param  : [in ] vecSeg : segments (no zero length)
+*! @param  : [out] vecOut : pieces
+*! @return : TRUE : a segment is rerouted or crossed | FALSE : output = input
+***********************************************************************************/
+static GBool snap_round_pass(const VecSnapSegment& vecSeg, VecSnapSegment& vecOut)
+{
+	const GInt nSegCnt = GInt(vecSeg.size());
+
+	vecOut.clear();
+
+	if (nSegCnt == 0)
+		return GFalse;
+
+	// 1. Grid : about one cell per segment
+	GFixed nMinX = vecSeg[0].pt1.x, nMaxX = nMinX;
+	GFixed nMinY = vecSeg[0].pt1.y, nMaxY = nMinY;
+
+	for (const SnapSegment& seg : vecSeg)
+	{
+		nMinX = std::min(nMinX, std::min(seg.pt1.x, seg.pt2.x));
+		nMaxX = std::max(nMaxX, std::max(seg.pt1.x, seg.pt2.x));
+		nMinY = std::min(nMinY, std::min(seg.pt1.y, seg.pt2.y));
+		nMaxY = std::max(nMaxY, std::max(seg.pt1.y, seg.pt2.y));
+	}
+
+	SnapGrid grid;
+	grid.nOrgX = nMinX - 2;
+	grid.nOrgY = nMinY - 2;
+
+	const GFixed nWidth  = nMaxX - nMinX + 4;
+	const GFixed nHeight = nMaxY - nMinY + 4;
+
+	GDouble dCell = std::ceil(std::sqrt(GDouble(nWidth) * GDouble(nHeight) / GDouble(nSegCnt)));
+	dCell = std::max(dCell, std::ceil(GDouble(std::max(nWidth, nHeight)) / GDouble(2 * nSegCnt + 1)));
+
+	grid.nCell = std::max<GFixed>(1, static_cast<GFixed>(dCell));
+	grid.nCntX = nWidth / grid.nCell + 1;
+	grid.nCntY = nHeight / grid.nCell + 1;
+
+	const size_t nCellCnt = size_t(grid.nCntX * grid.nCntY);
+
+	grid.vecBegin.assign(nCellCnt + 1, 0);
+
+	for (GInt i = 0; i < nSegCnt; i++)
+	{
+		snap_visit_cells(grid, vecSeg[i].pt1, vecSeg[i].pt2, [&](GFixed k) { grid.vecBegin[size_t(k) + 1]++; });
+	}
+
+	for (size_t k = 0; k < nCellCnt; k++)
+	{
+		grid.vecBegin[k + 1] += grid.vecBegin[k];
+	}
+
+	grid.vecItem.resize(grid.vecBegin[nCellCnt]);
+	std::vector<GInt> vecPos(grid.vecBegin.begin(), grid.vecBegin.end() - 1);
+
+	for (GInt i = 0; i < nSegCnt; i++)
+	{
+		snap_visit_cells(grid, vecSeg[i].pt1, vecSeg[i].pt2, [&](GFixed k) { grid.vecItem[vecPos[size_t(k)]++] = i; });
+	}
+
+	// 2. Hot pixels : endpoints and rounded crossings
+	GBool bChanged = GFalse;
+
+	VecPoint2Dx vecHot;
+	vecHot.reserve(size_t(nSegCnt) * 2);
+
+	std::vector<SnapHit> vecHit;
+	vecHit.reserve(size_t(nSegCnt) * 2);
+
+	for (const SnapSegment& seg : vecSeg)
+	{
+		vecHot.push_back(seg.pt1);
+		vecHot.push_back(seg.pt2);
+	}
+
+	for (size_t k = 0; k < nCellCnt; k++)
+	{
+		for (GInt i = grid.vecBegin[k]; i < grid.vecBegin[k + 1]; i++)
+		{
+			const GInt nSeg1 = grid.vecItem[i];
+			const SnapSegment& seg1 = vecSeg[nSeg1];
+
+			for (GInt j = i + 1; j < grid.vecBegin[k + 1]; j++)
+			{
+				const GInt nSeg2 = grid.vecItem[j];
+				const SnapSegment& seg2 = vecSeg[nSeg2];
+
+				// Proper crossing only : other contacts are at endpoints (hot already)
+				GFixed d1 = kernel::cross(seg2.pt1, seg2.pt2, seg1.pt1);
+				GFixed d2 = kernel::cross(seg2.pt1, seg2.pt2, seg1.pt2);
+
+				if (!snap_opposite(d1, d2))
+					continue;
+
+				GFixed d3 = kernel::cross(seg1.pt1, seg1.pt2, seg2.pt1);
+				GFixed d4 = kernel::cross(seg1.pt1, seg1.pt2, seg2.pt2);
+
+				if (!snap_opposite(d3, d4))
+					continue;
+
+				GDouble t = GDouble(d1) / (GDouble(d1) - GDouble(d2));
+
+				Point2Dx pt(snap_round(GDouble(seg1.pt1.x) + t * GDouble(seg1.pt2.x - seg1.pt1.x)),
+							snap_round(GDouble(seg1.pt1.y) + t * GDouble(seg1.pt2.y - seg1.pt1.y)));
+
+				// Pair is in many cells : keep the crossing of the cell of its pixel
+				if (size_t(snap_cell_of(grid, pt)) != k)
+					continue;
+
+				vecHot.push_back(pt);
+
+				// Both segments go through their crossing pixel (whatever the rounding)
+				vecHit.push_back(SnapHit{ nSeg1, 0, pt });
+				vecHit.push_back(SnapHit{ nSeg2, 0, pt });
+
+				bChanged = GTrue;
+			}
+		}
+	}
+
+	auto funLessPt = [](const Point2Dx& a, const Point2Dx& b)
+	{
+		return (a.x < b.x) || (a.x == b.x && a.y < b.y);
+	};
+
+	std::sort(vecHot.begin(), vecHot.end(), funLessPt);
+	vecHot.erase(std::unique(vecHot.begin(), vecHot.end(), [](const Point2Dx& a, const Point2Dx& b)
+	{
+		return a.x == b.x && a.y == b.y;
+	}), vecHot.end());
+
+	// 3. Hot pixels by cell
+	std::vector<GInt> vecHotBegin(nCellCnt + 1, 0), vecHotItem(vecHot.size());
+
+	for (const Point2Dx& pt : vecHot)
+	{
+		vecHotBegin[size_t(snap_cell_of(grid, pt)) + 1]++;
+	}
+
+	for (size_t k = 0; k < nCellCnt; k++)
+	{
+		vecHotBegin[k + 1] += vecHotBegin[k];
+	}
+
+	vecPos.assign(vecHotBegin.begin(), vecHotBegin.end() - 1);
+
+	for (size_t h = 0; h < vecHot.size(); h++)
+	{
+		vecHotItem[vecPos[size_t(snap_cell_of(grid, vecHot[h]))]++] = GInt(h);
+	}
+
+	// 4. Hot pixels touched by each segment
+	for (GInt i = 0; i < nSegCnt; i++)
+	{
+		const Point2Dx& a = vecSeg[i].pt1;
+		const Point2Dx& b = vecSeg[i].pt2;
+
+		snap_visit_cells(grid, a, b, [&](GFixed k)
+		{
+			for (GInt h = vecHotBegin[size_t(k)]; h < vecHotBegin[size_t(k) + 1]; h++)
+			{
+				const Point2Dx& pt = vecHot[vecHotItem[h]];
+
+				if (snap_touch_pixel(a, b, pt))
+				{
+					vecHit.push_back(SnapHit{ i, 0, pt });
+				}
+			}
+		});
+	}
+
+	// Order along segment : endpoints first and last, pixel beyond an end is clamped
+	for (SnapHit& hit : vecHit)
+	{
+		const Point2Dx& a = vecSeg[hit.nSeg].pt1;
+		const Point2Dx& b = vecSeg[hit.nSeg].pt2;
+
+		const GFixed dx = b.x - a.x, dy = b.y - a.y;
+		const GFixed nLen2 = dx * dx + dy * dy;
+
+		if (hit.pt.x == a.x && hit.pt.y == a.y)
+			hit.t = -1;
+		else if (hit.pt.x == b.x && hit.pt.y == b.y)
+			hit.t = nLen2 + 1;
+		else
+			hit.t = std::min(std::max((hit.pt.x - a.x) * dx + (hit.pt.y - a.y) * dy, GFixed(0)), nLen2);
+	}
+
+	std::sort(vecHit.begin(), vecHit.end(), [&](const SnapHit& h1, const SnapHit& h2)
+	{
+		if (h1.nSeg != h2.nSeg) return h1.nSeg < h2.nSeg;
+		if (h1.t != h2.t) return h1.t < h2.t;
+		return funLessPt(h1.pt, h2.pt);
+	});
+
+	// 5. Pieces between consecutive hot pixels
+	vecOut.reserve(vecHit.size());
+
+	for (size_t i = 0; i < vecHit.size(); )
+	{
+		const GInt nSeg = vecHit[i].nSeg;
+		const GInt nTag = vecSeg[nSeg].nTag;
+
+		Point2Dx ptPrev = vecSeg[nSeg].pt1;
+		size_t nPiece = vecOut.size();
+
+		for (; i < vecHit.size() && vecHit[i].nSeg == nSeg; i++)
+		{
+			const Point2Dx& pt = vecHit[i].pt;
+
+			if (pt.x == ptPrev.x && pt.y == ptPrev.y)
+				continue;
+
+			vecOut.push_back(SnapSegment{ ptPrev, pt, nTag });
+			ptPrev = pt;
+		}
+
+		const Point2Dx& ptEnd = vecSeg[nSeg].pt2;
+
+		if (ptPrev.x != ptEnd.x || ptPrev.y != ptEnd.y)
+		{
+			vecOut.push_back(SnapSegment{ ptPrev, ptEnd, nTag });
+		}
+
+		if (vecOut.size() - nPiece != 1)
+		{
+			bChanged = GTrue;
+		}
+	}
+
+	return bChanged;
+}
+
+/***********************************************************************************
+*! @brief  : Snap rounding of segments (iterated snap rounding)
+*! @param  : [in ] vecSeg   : segments (fixed point)
+*! @param  : [out] vecOut   : pieces (replaced) : endpoints on grid, pieces only
+*!                            meet at endpoints or overlap completely
+*! @param  : [in ] nMaxIter : max number of rounds
+*! @return : TRUE : OK | FALSE : coordinate out of GSNAP_COORD_MAX (vecOut empty)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : O((n + k) * m) per round : k crossings, m segments per grid cell
+***********************************************************************************/
+Dllexport GBool snap_round_segments(const VecSnapSegment& vecSeg, VecSnapSegment& vecOut, GInt nMaxIter /*= 4*/)
+{
+	vecOut.clear();
+
+	VecSnapSegment vecCur;
+	vecCur.reserve(vecSeg.size());
+
+	for (const SnapSegment& seg : vecSeg)
+	{
+		if (snap_abs(seg.pt1.x) > GSNAP_COORD_MAX || snap_abs(seg.pt1.y) > GSNAP_COORD_MAX ||
+			snap_abs(seg.pt2.x) > GSNAP_COORD_MAX || snap_abs(seg.pt2.y) > GSNAP_COORD_MAX)
+			return GFalse;
+
+		if (seg.pt1.x == seg.pt2.x && seg.pt1.y == seg.pt2.y)
+			continue;
+
+		vecCur.push_back(seg);
+	}
+
+	VecSnapSegment vecNext;
+
+	for (GInt i = 0; i < std::max(nMaxIter, 1); i++)
+	{
+		GBool bChanged = snap_round_pass(vecCur, vecNext);
+		vecCur.swap(vecNext);
+
+		if (bChanged == GFalse)
+			break;
+	}
+
+	vecOut.swap(vecCur);
+
+	return GTrue;
+}
+
+}}
@@ -0,0 +1,78 @@
+#include "x2dsoa.h"
+#include "x2dprep.h"
+#include <cstring>
+
+namespace geo { namespace v2 {
+
+/***********************************************************************************
+*! @brief  : Convert point list (AoS) to structure-of-arrays buffer
+*! @param  : [in ] points : point list
+*! @param  : [out] soa    : buffer (resized to points.size())
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+Dllexport void convert_points_to_soa(const VecPoint2D& points, PointSoA2D& soa)
+{
+	convert_points_to_soa(RingView2D(points), soa);
+}
+
+Dllexport void convert_points_to_soa(const RingView2D& points, PointSoA2D& soa)
+{
+	size_t nPointCnt = points.size();
+
+	soa.resize(nPointCnt);
+
+	GFloat* px = soa.x.data();
+	GFloat* py = soa.y.data();
+
+	for (size_t i = 0; i < nPointCnt; i++)
+	{
+		px[i] = points[i].x;
+		py[i] = points[i].y;
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Convert structure-of-arrays buffer to point list (AoS)
+*! @param  : [in ] soa    : buffer
+*! @param  : [out] points : point list (resized to soa.size())
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+Dllexport void convert_soa_to_points(const PointSoA2D& soa, VecPoint2D& points)
+{
+	size_t nPointCnt = soa.size();
+
+	points.resize(nPointCnt);
+
+	for (size_t i = 0; i < nPointCnt; i++)
+	{
+		points[i] = Point2D(soa.x[i], soa.y[i]);
+	}
+}
+
+/***********************************************************************************
+*! @brief	: check list point inside polygon (SIMD when available)
+*! @param	: [in ] pts  : point buffer
+*! @param	: [in ] poly : Polygon
+*! @param	: [out] out  : 1 : inside | 0 : outside (size >= pts.size())
+*! @author	: thuong.nv			- [Date] : 10/17/2026
+*! @note	: Build PreparedPolygon once and call contains() when the polygon is reused
+***********************************************************************************/
+Dllexport void is_point_in_polygon(const PointSoA2D& pts, const VecPoint2D& poly, uint8_t* out)
+{
+	is_point_in_polygon(pts, RingView2D(poly), out);
+}
+
+Dllexport void is_point_in_polygon(const PointSoA2D& pts, const RingView2D& poly, uint8_t* out)
+{
+	if (poly.size() < 3)
+	{
+		std::memset(out, 0, pts.size());
+		return;
+	}
+
+	PreparedPolygon prepPoly;
+	prepPoly.build(poly);
+	prepPoly.contains(pts, out);
+}
+
+}}
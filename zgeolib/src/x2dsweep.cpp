@@ -0,0 +1,558 @@
+#include "x2dsweep.h"
+#include <map>
+#include <set>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+namespace geo { namespace v2 {
+
+/***********************************************************************************
+*! @brief  : Event point (sorted by x then y)
+***********************************************************************************/
+typedef struct tagSweepEvent
+{
+	GDouble x;
+	GDouble y;
+
+	bool operator<(const tagSweepEvent& ev) const
+	{
+		return (x < ev.x) || (x == ev.x && y < ev.y);
+	}
+
+} SweepEvent;
+
+/***********************************************************************************
+*! @brief  : Probe value used to search segments passing through the event point
+***********************************************************************************/
+typedef struct tagSweepProbe
+{
+	GDouble y;
+
+} SweepProbe;
+
+/***********************************************************************************
+*! @brief  : Order of segments on the sweep line (bottom -> top)
+***********************************************************************************/
+struct SweepStatusLess
+{
+	typedef void is_transparent;
+
+	const SweepIntersector* m_pSweep;
+
+	bool operator()(GInt nSeg1, GInt nSeg2) const
+	{
+		return m_pSweep->less(nSeg1, nSeg2) == GTrue;
+	}
+
+	bool operator()(GInt nSeg, const SweepProbe& probe) const
+	{
+		return m_pSweep->y_at(m_pSweep->m_vecSeg[nSeg]) < probe.y - m_pSweep->m_dEps;
+	}
+
+	bool operator()(const SweepProbe& probe, GInt nSeg) const
+	{
+		return probe.y + m_pSweep->m_dEps < m_pSweep->y_at(m_pSweep->m_vecSeg[nSeg]);
+	}
+};
+
+SweepIntersector::SweepIntersector(GeoScratch* pScratch /*= NULL*/) :
+	m_vecSeg(ScratchAllocator<SweepSeg>(pScratch)), m_pScratch(pScratch),
+	m_dSweepX(0.0), m_dSweepY(0.0), m_dEps(0.0)
+{
+
+}
+
+/***********************************************************************************
+*! @brief  : Remove all segments
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+void SweepIntersector::clear()
+{
+	m_vecSeg.clear();
+}
+
+/***********************************************************************************
+*! @brief  : Reserve memory for segments
+*! @param  : [in] nCnt : number of segment
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+void SweepIntersector::reserve(size_t nCnt)
+{
+	m_vecSeg.reserve(nCnt);
+}
+
+/***********************************************************************************
+*! @brief  : Add segment
+*! @param  : [in] pt1    : first point
+*! @param  : [in] pt2    : second point
+*! @param  : [in] nGroup : group id
+*! @return : index of segment
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+GInt SweepIntersector::add_segment(const Point2D& pt1, const Point2D& pt2, GInt nGroup /*= 0*/)
+{
+	SweepSeg seg;
+
+	// Left (lower) point first
+	if (pt1.x < pt2.x || (pt1.x == pt2.x && pt1.y <= pt2.y))
+	{
+		seg.x1 = pt1.x; seg.y1 = pt1.y;
+		seg.x2 = pt2.x; seg.y2 = pt2.y;
+	}
+	else
+	{
+		seg.x1 = pt2.x; seg.y1 = pt2.y;
+		seg.x2 = pt1.x; seg.y2 = pt1.y;
+	}
+
+	seg.nGroup = nGroup;
+
+	m_vecSeg.push_back(seg);
+
+	return static_cast<GInt>(m_vecSeg.size()) - 1;
+}
+
+/***********************************************************************************
+*! @brief  : Add all edges of polygon (edge i : poly[i] -> poly[i + 1])
+*! @param  : [in] poly   : polygon
+*! @param  : [in] nGroup : group id
+*! @return : index of first edge
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+GInt SweepIntersector::add_polygon(const VecPoint2D& poly, GInt nGroup /*= 0*/)
+{
+	return add_polygon(RingView2D(poly), nGroup);
+}
+
+/***********************************************************************************
+*! @brief  : Add all edges of polygon view (edge i : poly[i] -> poly[i + 1])
+*! @param  : [in] poly   : polygon
+*! @param  : [in] nGroup : group id
+*! @return : index of first edge
+*! @author : thuong.nv			- [Date] : 10/17/2026
+***********************************************************************************/
+GInt SweepIntersector::add_polygon(const RingView2D& poly, GInt nGroup /*= 0*/)
+{
+	GInt nFirst = static_cast<GInt>(m_vecSeg.size());
+	GInt nPolyCnt = static_cast<GInt>(poly.size());
+
+	if (nPolyCnt == 2)
+	{
+		add_segment(poly[0], poly[1], nGroup);
+	}
+	else if (nPolyCnt >= 3)
+	{
+		m_vecSeg.reserve(m_vecSeg.size() + nPolyCnt);
+
+		for (GInt i = 0; i < nPolyCnt; i++)
+		{
+			add_segment(poly[i], poly[(i + 1) % nPolyCnt], nGroup);
+		}
+	}
+
+	return nFirst;
+}
+
+/***********************************************************************************
+*! @brief  : Y of segment at the sweep line (vertical segment : y of event point)
+***********************************************************************************/
+GDouble SweepIntersector::y_at(const SweepSeg& seg) const
+{
+	if (seg.x1 == seg.x2)
+	{
+		return std::min(std::max(m_dSweepY, seg.y1), seg.y2);
+	}
+
+	if (m_dSweepX <= seg.x1) return seg.y1;
+	if (m_dSweepX >= seg.x2) return seg.y2;
+
+	// Interpolate from the nearest end point
+	GDouble dSlope = (seg.y2 - seg.y1) / (seg.x2 - seg.x1);
+
+	if (m_dSweepX - seg.x1 <= seg.x2 - m_dSweepX)
+		return seg.y1 + (m_dSweepX - seg.x1) * dSlope;
+
+	return seg.y2 - (seg.x2 - m_dSweepX) * dSlope;
+}
+
+/***********************************************************************************
+*! @brief  : Order of two segments on the sweep line
+*! @note   : Segments meeting at the sweep line are ordered by slope (order just
+*!           after the event point). Vertical segment is the highest
+***********************************************************************************/
+GBool SweepIntersector::less(GInt nSeg1, GInt nSeg2) const
+{
+	if (nSeg1 == nSeg2)
+		return GFalse;
+
+	const SweepSeg& seg1 = m_vecSeg[nSeg1];
+	const SweepSeg& seg2 = m_vecSeg[nSeg2];
+
+	GDouble y1 = y_at(seg1);
+	GDouble y2 = y_at(seg2);
+
+	if (y1 < y2 - m_dEps) return GTrue;
+	if (y2 < y1 - m_dEps) return GFalse;
+
+	const GDouble dInf = std::numeric_limits<GDouble>::infinity();
+
+	GDouble dSlope1 = (seg1.x1 == seg1.x2) ? dInf : (seg1.y2 - seg1.y1) / (seg1.x2 - seg1.x1);
+	GDouble dSlope2 = (seg2.x1 == seg2.x2) ? dInf : (seg2.y2 - seg2.y1) / (seg2.x2 - seg2.x1);
+
+	if (dSlope1 != dSlope2)
+		return (dSlope1 < dSlope2) ? GTrue : GFalse;
+
+	return (nSeg1 < nSeg2) ? GTrue : GFalse;
+}
+
+/***********************************************************************************
+*! @brief  : Check two segments are parallel
+***********************************************************************************/
+GBool SweepIntersector::is_parallel(GInt nSeg1, GInt nSeg2) const
+{
+	const SweepSeg& a = m_vecSeg[nSeg1];
+	const SweepSeg& b = m_vecSeg[nSeg2];
+
+	GDouble rx = a.x2 - a.x1, ry = a.y2 - a.y1;
+	GDouble sx = b.x2 - b.x1, sy = b.y2 - b.y1;
+
+	GDouble dCrs = rx * sy - ry * sx;
+
+	return (std::fabs(dCrs) <= 1e-12 * std::sqrt((rx * rx + ry * ry) * (sx * sx + sy * sy))) ? GTrue : GFalse;
+}
+
+/***********************************************************************************
+*! @brief  : Intersection point of two segments (snap to end point)
+*! @return : TRUE : Intersect | FALSE : not intersect or parallel
+***********************************************************************************/
+GBool SweepIntersector::intersect(GInt nSeg1, GInt nSeg2, GDouble& x, GDouble& y) const
+{
+	const SweepSeg& a = m_vecSeg[nSeg1];
+	const SweepSeg& b = m_vecSeg[nSeg2];
+
+	// Overlapping part of collinear segments start and end at end point events
+	if (is_parallel(nSeg1, nSeg2))
+		return GFalse;
+
+	GDouble rx = a.x2 - a.x1, ry = a.y2 - a.y1;
+	GDouble sx = b.x2 - b.x1, sy = b.y2 - b.y1;
+	GDouble qx = b.x1 - a.x1, qy = b.y1 - a.y1;
+
+	GDouble dDet = rx * sy - ry * sx;
+	GDouble t = (qx * sy - qy * sx) / dDet;
+	GDouble u = (qx * ry - qy * rx) / dDet;
+
+	const GDouble dTol = 1e-12;
+
+	if (t < -dTol || t > 1.0 + dTol || u < -dTol || u > 1.0 + dTol)
+		return GFalse;
+
+	x = a.x1 + t * rx;
+	y = a.y1 + t * ry;
+
+	// Snap to end point : the same point must give the same event
+	const GDouble arEnd[4][2] = { { a.x1, a.y1 }, { a.x2, a.y2 }, { b.x1, b.y1 }, { b.x2, b.y2 } };
+
+	for (int k = 0; k < 4; k++)
+	{
+		if (std::fabs(x - arEnd[k][0]) <= m_dEps && std::fabs(y - arEnd[k][1]) <= m_dEps)
+		{
+			x = arEnd[k][0];
+			y = arEnd[k][1];
+			break;
+		}
+	}
+
+	return GTrue;
+}
+
+/***********************************************************************************
+*! @brief  : Run sweep line and report intersections
+*! @param  : [out] vecInter   : intersection list (sorted by x then y)
+*! @param  : [in ] bOnlyCheck : stop at the first intersection
+*! @param  : [in ] bDiffGroup : only report pair of segments of different group
+*! @param  : [in ] bSkipParallel : don't report pair of parallel segments
+*! @return : number of intersecting pair
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Bentley-Ottmann (handle event point : de Berg et al.)
+*!           Segments sharing an end point are reported at that point.
+*!           Collinear overlapping segments are reported at the end points of
+*!           the overlapping part
+***********************************************************************************/
+GInt SweepIntersector::run(VecSegInter* vecInter    /*= NULL*/,
+						   GBool		bOnlyCheck  /*= FALSE*/,
+						   GBool		bDiffGroup  /*= FALSE*/,
+						   GBool		bSkipParallel /*= FALSE*/)
+{
+	return run_sweep(vecInter, bOnlyCheck, bDiffGroup, bSkipParallel);
+}
+
+/***********************************************************************************
+*! @brief  : Run sweep line and report intersections (result in scratch memory)
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Same as run(VecSegInter*)
+***********************************************************************************/
+GInt SweepIntersector::run(ScratchVecSegInter* vecInter,
+						   GBool		bOnlyCheck  /*= FALSE*/,
+						   GBool		bDiffGroup  /*= FALSE*/,
+						   GBool		bSkipParallel /*= FALSE*/)
+{
+	return run_sweep(vecInter, bOnlyCheck, bDiffGroup, bSkipParallel);
+}
+
+/***********************************************************************************
+*! @brief  : Bentley-Ottmann sweep, queue and status use m_pScratch (NULL : heap)
+***********************************************************************************/
+template<typename TVecInter>
+GInt SweepIntersector::run_sweep(TVecInter* vecInter, GBool bOnlyCheck, GBool bDiffGroup, GBool bSkipParallel)
+{
+	typedef std::vector<GInt, ScratchAllocator<GInt>> VecIndex;
+	typedef std::pair<const SweepEvent, VecIndex> EventItem;
+	typedef std::map<SweepEvent, VecIndex, std::less<SweepEvent>, ScratchAllocator<EventItem>> MapEvent;
+	typedef std::set<GInt, SweepStatusLess, ScratchAllocator<GInt>> SetStatus;
+
+	ScratchAllocator<GInt> alloc(m_pScratch);
+
+	GInt nInter = 0;
+	GInt nSegCnt = static_cast<GInt>(m_vecSeg.size());
+
+	if (nSegCnt < 2)
+		return 0;
+
+	// 1. Tolerance from extent of data
+	GDouble dMax = 1.0;
+
+	for (const SweepSeg& seg : m_vecSeg)
+	{
+		dMax = std::max(dMax, std::max(std::max(std::fabs(seg.x1), std::fabs(seg.y1)),
+									   std::max(std::fabs(seg.x2), std::fabs(seg.y2))));
+	}
+
+	m_dEps = dMax * 1e-9;
+
+	// 2. Event queue : U(p) is stored in event
+	MapEvent mapEvent(alloc);
+
+	// Value is created with the allocator of the map (operator[] uses default one)
+	auto funEvent = [&](GDouble x, GDouble y) -> VecIndex&
+	{
+		SweepEvent ev{ x, y };
+		auto itEvent = mapEvent.lower_bound(ev);
+
+		if (itEvent == mapEvent.end() || ev < itEvent->first)
+		{
+			itEvent = mapEvent.emplace_hint(itEvent, ev, VecIndex(alloc));
+		}
+
+		return itEvent->second;
+	};
+
+	for (GInt i = 0; i < nSegCnt; i++)
+	{
+		const SweepSeg& seg = m_vecSeg[i];
+
+		if (seg.x1 == seg.x2 && seg.y1 == seg.y2)
+			continue;
+
+		funEvent(seg.x1, seg.y1).push_back(i);
+		funEvent(seg.x2, seg.y2);
+	}
+
+	SweepStatusLess cmpStatus; cmpStatus.m_pSweep = this;
+	SetStatus setStatus(cmpStatus, alloc);
+
+	VecIndex vecU(alloc), vecL(alloc), vecC(alloc), vecAll(alloc);
+
+	auto funFindNewEvent = [&](GInt nSeg1, GInt nSeg2, const SweepEvent& ev)
+	{
+		GDouble x, y;
+
+		if (intersect(nSeg1, nSeg2, x, y) == GFalse)
+			return;
+
+		// Intersection is the current event or already passed
+		if (std::fabs(x - ev.x) <= m_dEps && std::fabs(y - ev.y) <= m_dEps)
+			return;
+
+		if (x < ev.x || (x == ev.x && y <= ev.y))
+			return;
+
+		funEvent(x, y);
+	};
+
+	while (!mapEvent.empty())
+	{
+		auto itEvent = mapEvent.begin();
+		SweepEvent ev = itEvent->first;
+		vecU.swap(itEvent->second);
+		mapEvent.erase(itEvent);
+
+		m_dSweepX = ev.x;
+		m_dSweepY = ev.y;
+
+		// 3. Segments in status passing through event point : L(p) and C(p)
+		vecL.clear(); vecC.clear();
+
+		auto itFirst = setStatus.lower_bound(SweepProbe{ ev.y });
+		auto itLast  = itFirst;
+
+		while (itLast != setStatus.end() && y_at(m_vecSeg[*itLast]) <= ev.y + m_dEps)
+		{
+			const SweepSeg& seg = m_vecSeg[*itLast];
+
+			if (seg.x2 == ev.x && seg.y2 == ev.y)
+				vecL.push_back(*itLast);
+			else
+				vecC.push_back(*itLast);
+
+			++itLast;
+		}
+
+		// 4. Report all pairs at event point
+		vecAll.clear();
+		vecAll.insert(vecAll.end(), vecU.begin(), vecU.end());
+		vecAll.insert(vecAll.end(), vecL.begin(), vecL.end());
+		vecAll.insert(vecAll.end(), vecC.begin(), vecC.end());
+
+		int nAllCnt = static_cast<int>(vecAll.size());
+
+		for (int i = 0; i < nAllCnt; i++)
+		{
+			for (int j = i + 1; j < nAllCnt; j++)
+			{
+				GInt nSeg1 = std::min(vecAll[i], vecAll[j]);
+				GInt nSeg2 = std::max(vecAll[i], vecAll[j]);
+
+				if (bDiffGroup && m_vecSeg[nSeg1].nGroup == m_vecSeg[nSeg2].nGroup)
+					continue;
+
+				if (bSkipParallel && is_parallel(nSeg1, nSeg2))
+					continue;
+
+				nInter++;
+
+				if (vecInter)
+				{
+					vecInter->push_back(SegInter{ nSeg1, nSeg2, Point2D(ev.x, ev.y) });
+				}
+
+				if (bOnlyCheck)
+				{
+					return nInter;
+				}
+			}
+		}
+
+		// 5. Remove L(p), C(p) and insert U(p), C(p) with the order after event point
+		setStatus.erase(itFirst, itLast);
+
+		for (GInt nSeg : vecU) setStatus.insert(nSeg);
+		for (GInt nSeg : vecC) setStatus.insert(nSeg);
+
+		// 6. Find new events between new neighbors
+		if (vecU.empty() && vecC.empty())
+		{
+			auto itAbove = setStatus.lower_bound(SweepProbe{ ev.y });
+
+			if (itAbove != setStatus.end() && itAbove != setStatus.begin())
+			{
+				funFindNewEvent(*std::prev(itAbove), *itAbove, ev);
+			}
+		}
+		else
+		{
+			auto itLow  = setStatus.lower_bound(SweepProbe{ ev.y });
+			auto itHigh = std::prev(setStatus.upper_bound(SweepProbe{ ev.y }));
+
+			if (itLow != setStatus.begin())
+			{
+				funFindNewEvent(*std::prev(itLow), *itLow, ev);
+			}
+
+			auto itNext = std::next(itHigh);
+
+			if (itNext != setStatus.end())
+			{
+				funFindNewEvent(*itHigh, *itNext, ev);
+			}
+		}
+
+		vecU.clear();
+	}
+
+	return nInter;
+}
+
+/***********************************************************************************
+*! @brief  : Get intersections between edges of two polygons (sweep line)
+*! @param  : [in ] poly1      : first polygon
+*! @param  : [in ] poly2      : second polygon
+*! @param  : [out] vecInter   : nSeg1 : edge index of poly1 | nSeg2 : edge index of poly2
+*! @param  : [in ] bOnlyCheck : stop at the first intersection
+*! @return : INT : intersection number.
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Edge i : poly[i] -> poly[i + 1]. Parallel edges are not reported
+*!           (same as intersect_2lsegment)
+***********************************************************************************/
+Dllexport GInt intersect_2polygon(const VecPoint2D& poly1, const VecPoint2D& poly2, VecSegInter* vecInter /*= NULL*/, GBool bOnlyCheck /*= FALSE*/)
+{
+	SweepIntersector sweep;
+	sweep.reserve(poly1.size() + poly2.size());
+
+	sweep.add_polygon(poly1, 0);
+	GInt nOffset = sweep.add_polygon(poly2, 1);
+
+	size_t nStart = (vecInter) ? vecInter->size() : 0;
+
+	GInt nInter = sweep.run(vecInter, bOnlyCheck, GTrue, GTrue);
+
+	// Edge index of second polygon
+	if (vecInter)
+	{
+		for (size_t i = nStart; i < vecInter->size(); i++)
+		{
+			(*vecInter)[i].nSeg2 -= nOffset;
+		}
+	}
+
+	return nInter;
+}
+
+/***********************************************************************************
+*! @brief  : Get intersections between edges of two polygons (scratch memory)
+*! @param  : [in ] poly1      : first polygon
+*! @param  : [in ] poly2      : second polygon
+*! @param  : [in ] scratch    : temporary memory (event queue, sweep status)
+*! @param  : [out] vecInter   : nSeg1 : edge index of poly1 | nSeg2 : edge index of poly2
+*! @param  : [in ] bOnlyCheck : stop at the first intersection
+*! @return : INT : intersection number.
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Same result as intersect_2polygon
+***********************************************************************************/
+Dllexport GInt intersect_2polygon(const RingView2D& poly1, const RingView2D& poly2, GeoScratch& scratch,
+								  ScratchVecSegInter* vecInter /*= NULL*/, GBool bOnlyCheck /*= FALSE*/)
+{
+	SweepIntersector sweep(&scratch);
+	sweep.reserve(poly1.size() + poly2.size());
+
+	sweep.add_polygon(poly1, 0);
+	GInt nOffset = sweep.add_polygon(poly2, 1);
+
+	size_t nStart = (vecInter) ? vecInter->size() : 0;
+
+	GInt nInter = sweep.run(vecInter, bOnlyCheck, GTrue, GTrue);
+
+	// Edge index of second polygon
+	if (vecInter)
+	{
+		for (size_t i = nStart; i < vecInter->size(); i++)
+		{
+			(*vecInter)[i].nSeg2 -= nOffset;
+		}
+	}
+
+	return nInter;
+}
+
+}}
@@ -0,0 +1,1009 @@
+#include "x2dtrig.h"
+
+#include <deque>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+namespace geo { namespace v2 {
+
+/***********************************************************************************
+*! @brief  : Vertex of linked ring
+***********************************************************************************/
+typedef struct tagEarNode
+{
+	uint32_t	i;				// vertex index
+	GDouble		x, y;
+	int32_t		z;				// z-order curve value
+
+	tagEarNode*	prev;			// ring order
+	tagEarNode*	next;
+	tagEarNode*	prevZ;			// z-order
+	tagEarNode*	nextZ;
+
+	GBool		bSteiner;
+
+} EarNode;
+
+/***********************************************************************************
+* ⮟⮟ Class name: EarTriangulator
+* Ear clipping on doubly linked ring. Points inside candidate ear are searched in
+* z-order (no full ring scan). Holes are bridged to the outer ring. Nodes are
+* allocated on GeoScratch (NULL : heap)
+* @refer : https://github.com/mapbox/earcut
+***********************************************************************************/
+class EarTriangulator
+{
+protected:
+	typedef std::deque<EarNode, ScratchAllocator<EarNode>> DeqEarNode;
+
+	DeqEarNode				m_deqNode;		// node storage (stable address)
+	std::vector<uint32_t>*	m_pIndex;
+
+	GDouble		m_dMinX;
+	GDouble		m_dMinY;
+	GDouble		m_dInvSize;					// 0 : don't use z-order
+
+public:
+	explicit EarTriangulator(GeoScratch* pScratch = NULL) : m_deqNode(ScratchAllocator<EarNode>(pScratch)), m_pIndex(NULL),
+															 m_dMinX(0.0), m_dMinY(0.0), m_dInvSize(0.0) {}
+
+public:
+	GInt run(const Point2D* pts, const uint32_t* arRing, size_t nRing, uint32_t nBase, std::vector<uint32_t>& vecIndex);
+
+protected:
+	EarNode*	linked_list(const Point2D* pts, uint32_t nStart, uint32_t nEnd, uint32_t nBase, GBool bCCW);
+	EarNode*	filter_points(EarNode* start, EarNode* end = NULL);
+	void		earcut_linked(EarNode* ear, int nPass);
+	GBool		is_ear(EarNode* ear) const;
+	GBool		is_ear_hashed(EarNode* ear) const;
+	EarNode*	cure_local_intersections(EarNode* start);
+	void		split_earcut(EarNode* start);
+	EarNode*	eliminate_holes(const Point2D* pts, const uint32_t* arRing, size_t nRing, uint32_t nBase, EarNode* outer);
+	EarNode*	eliminate_hole(EarNode* hole, EarNode* outer);
+	EarNode*	find_hole_bridge(EarNode* hole, EarNode* outer) const;
+	void		index_curve(EarNode* start);
+	int32_t		z_order(GDouble x, GDouble y) const;
+
+	EarNode*	split_polygon(EarNode* a, EarNode* b);
+	EarNode*	insert_node(uint32_t i, GDouble x, GDouble y, EarNode* last);
+	void		add_triangle(const EarNode* a, const EarNode* b, const EarNode* c);
+
+	static EarNode*	sort_linked(EarNode* list);
+	static EarNode*	get_leftmost(EarNode* start);
+	static void		remove_node(EarNode* p);
+	static GDouble	area(const EarNode* p, const EarNode* q, const EarNode* r);
+	static GBool	equals(const EarNode* p1, const EarNode* p2);
+	static GBool	intersects(const EarNode* p1, const EarNode* q1, const EarNode* p2, const EarNode* q2);
+	static GBool	on_segment(const EarNode* p, const EarNode* q, const EarNode* r);
+	static GBool	intersects_polygon(const EarNode* a, const EarNode* b);
+	static GBool	locally_inside(const EarNode* a, const EarNode* b);
+	static GBool	middle_inside(const EarNode* a, const EarNode* b);
+	static GBool	is_valid_diagonal(EarNode* a, EarNode* b);
+	static GBool	sector_contains_sector(const EarNode* m, const EarNode* p);
+	static GBool	point_in_triangle(GDouble ax, GDouble ay, GDouble bx, GDouble by,
+									  GDouble cx, GDouble cy, GDouble px, GDouble py);
+};
+
+/***********************************************************************************
+*! @brief  : Triangulate rings of one polygon
+*! @param  : [in ] pts      : point array
+*! @param  : [in ] arRing   : ring offsets into pts (nRing + 1). First ring is outer
+*! @param  : [in ] nRing    : number of ring
+*! @param  : [in ] nBase    : value added to output index
+*! @param  : [out] vecIndex : triangle list (append)
+*! @return : number of triangle
+***********************************************************************************/
+GInt EarTriangulator::run(const Point2D* pts, const uint32_t* arRing, size_t nRing, uint32_t nBase, std::vector<uint32_t>& vecIndex)
+{
+	m_pIndex = &vecIndex;
+	m_deqNode.clear();
+	m_dInvSize = 0.0;
+
+	if (nRing == 0)
+		return 0;
+
+	size_t nStart = vecIndex.size();
+
+	EarNode* outer = linked_list(pts, arRing[0], arRing[1], nBase, GTrue);
+
+	if (outer == NULL || outer->next == outer->prev)
+		return 0;
+
+	if (nRing > 1)
+	{
+		outer = eliminate_holes(pts, arRing, nRing, nBase, outer);
+	}
+
+	// Use z-order curve hash when shape is not too simple
+	if (arRing[1] - arRing[0] > 80)
+	{
+		GDouble dMaxX, dMaxY;
+
+		m_dMinX = dMaxX = pts[arRing[0]].x;
+		m_dMinY = dMaxY = pts[arRing[0]].y;
+
+		for (uint32_t i = arRing[0] + 1; i < arRing[1]; i++)
+		{
+			m_dMinX = std::min(m_dMinX, GDouble(pts[i].x));
+			m_dMinY = std::min(m_dMinY, GDouble(pts[i].y));
+			dMaxX   = std::max(dMaxX, GDouble(pts[i].x));
+			dMaxY   = std::max(dMaxY, GDouble(pts[i].y));
+		}
+
+		GDouble dSize = std::max(dMaxX - m_dMinX, dMaxY - m_dMinY);
+		m_dInvSize = (dSize != 0.0) ? 32767.0 / dSize : 0.0;
+	}
+
+	earcut_linked(outer, 0);
+
+	return static_cast<GInt>((vecIndex.size() - nStart) / 3);
+}
+
+/***********************************************************************************
+*! @brief  : Create linked ring (bCCW : counterclockwise order)
+***********************************************************************************/
+EarNode* EarTriangulator::linked_list(const Point2D* pts, uint32_t nStart, uint32_t nEnd, uint32_t nBase, GBool bCCW)
+{
+	EarNode* last = NULL;
+
+	if (nEnd <= nStart)
+		return NULL;
+
+	GDouble dSum = 0.0;
+
+	for (uint32_t i = nStart, j = nEnd - 1; i < nEnd; j = i++)
+	{
+		dSum += (GDouble(pts[j].x) - pts[i].x) * (GDouble(pts[i].y) + pts[j].y);
+	}
+
+	if (bCCW == (dSum > 0.0))
+	{
+		for (uint32_t i = nStart; i < nEnd; i++)
+			last = insert_node(nBase + i, pts[i].x, pts[i].y, last);
+	}
+	else
+	{
+		for (uint32_t i = nEnd; i-- > nStart; )
+			last = insert_node(nBase + i, pts[i].x, pts[i].y, last);
+	}
+
+	if (last && equals(last, last->next))
+	{
+		remove_node(last);
+		last = last->next;
+	}
+
+	return last;
+}
+
+/***********************************************************************************
+*! @brief  : Remove duplicate and collinear points
+***********************************************************************************/
+EarNode* EarTriangulator::filter_points(EarNode* start, EarNode* end /*= NULL*/)
+{
+	if (start == NULL)
+		return start;
+
+	if (end == NULL)
+		end = start;
+
+	EarNode* p = start;
+	GBool bAgain;
+
+	do
+	{
+		bAgain = GFalse;
+
+		if (!p->bSteiner && (equals(p, p->next) || area(p->prev, p, p->next) == 0.0))
+		{
+			remove_node(p);
+			p = end = p->prev;
+
+			if (p == p->next)
+				break;
+
+			bAgain = GTrue;
+		}
+		else
+		{
+			p = p->next;
+		}
+	} while (bAgain || p != end);
+
+	return end;
+}
+
+/***********************************************************************************
+*! @brief  : Main ear slicing loop
+*! @param  : [in] nPass : 0 : normal | 1 : filtered | 2 : cured local intersections
+***********************************************************************************/
+void EarTriangulator::earcut_linked(EarNode* ear, int nPass)
+{
+	if (ear == NULL)
+		return;
+
+	if (nPass == 0 && m_dInvSize != 0.0)
+	{
+		index_curve(ear);
+	}
+
+	EarNode* stop = ear;
+
+	while (ear->prev != ear->next)
+	{
+		EarNode* prev = ear->prev;
+		EarNode* next = ear->next;
+
+		if ((m_dInvSize != 0.0) ? is_ear_hashed(ear) : is_ear(ear))
+		{
+			add_triangle(prev, ear, next);
+			remove_node(ear);
+
+			// Skipping the next vertex leads to less sliver triangles
+			ear  = next->next;
+			stop = next->next;
+			continue;
+		}
+
+		ear = next;
+
+		// Whole ring is passed without finding ear
+		if (ear == stop)
+		{
+			if (nPass == 0)
+			{
+				earcut_linked(filter_points(ear), 1);
+			}
+			else if (nPass == 1)
+			{
+				ear = cure_local_intersections(filter_points(ear));
+				earcut_linked(ear, 2);
+			}
+			else if (nPass == 2)
+			{
+				split_earcut(ear);
+			}
+
+			break;
+		}
+	}
+}
+
+/***********************************************************************************
+*! @brief  : Check ear (no point of ring inside triangle)
+***********************************************************************************/
+GBool EarTriangulator::is_ear(EarNode* ear) const
+{
+	const EarNode* a = ear->prev;
+	const EarNode* b = ear;
+	const EarNode* c = ear->next;
+
+	// Reflex, can't be an ear
+	if (area(a, b, c) >= 0.0)
+		return GFalse;
+
+	GDouble x0 = std::min(std::min(a->x, b->x), c->x), y0 = std::min(std::min(a->y, b->y), c->y);
+	GDouble x1 = std::max(std::max(a->x, b->x), c->x), y1 = std::max(std::max(a->y, b->y), c->y);
+
+	for (const EarNode* p = c->next; p != a; p = p->next)
+	{
+		if (p->x >= x0 && p->x <= x1 && p->y >= y0 && p->y <= y1 &&
+			point_in_triangle(a->x, a->y, b->x, b->y, c->x, c->y, p->x, p->y) &&
+			area(p->prev, p, p->next) >= 0.0)
+			return GFalse;
+	}
+
+	return GTrue;
+}
+
+/***********************************************************************************
+*! @brief  : Check ear : only points with z-order in range of ear box are checked
+***********************************************************************************/
+GBool EarTriangulator::is_ear_hashed(EarNode* ear) const
+{
+	const EarNode* a = ear->prev;
+	const EarNode* b = ear;
+	const EarNode* c = ear->next;
+
+	if (area(a, b, c) >= 0.0)
+		return GFalse;
+
+	GDouble x0 = std::min(std::min(a->x, b->x), c->x), y0 = std::min(std::min(a->y, b->y), c->y);
+	GDouble x1 = std::max(std::max(a->x, b->x), c->x), y1 = std::max(std::max(a->y, b->y), c->y);
+
+	int32_t nMinZ = z_order(x0, y0);
+	int32_t nMaxZ = z_order(x1, y1);
+
+	auto funInside = [&](const EarNode* p)
+	{
+		return p->x >= x0 && p->x <= x1 && p->y >= y0 && p->y <= y1 && p != a && p != c &&
+			   point_in_triangle(a->x, a->y, b->x, b->y, c->x, c->y, p->x, p->y) &&
+			   area(p->prev, p, p->next) >= 0.0;
+	};
+
+	const EarNode* p = ear->prevZ;
+	const EarNode* n = ear->nextZ;
+
+	// Both directions
+	while (p && p->z >= nMinZ && n && n->z <= nMaxZ)
+	{
+		if (funInside(p)) return GFalse;
+		p = p->prevZ;
+
+		if (funInside(n)) return GFalse;
+		n = n->nextZ;
+	}
+
+	// Decreasing z-order
+	while (p && p->z >= nMinZ)
+	{
+		if (funInside(p)) return GFalse;
+		p = p->prevZ;
+	}
+
+	// Increasing z-order
+	while (n && n->z <= nMaxZ)
+	{
+		if (funInside(n)) return GFalse;
+		n = n->nextZ;
+	}
+
+	return GTrue;
+}
+
+/***********************************************************************************
+*! @brief  : Go through all polygon nodes and cure small local self-intersections
+***********************************************************************************/
+EarNode* EarTriangulator::cure_local_intersections(EarNode* start)
+{
+	EarNode* p = start;
+
+	do
+	{
+		EarNode* a = p->prev;
+		EarNode* b = p->next->next;
+
+		if (!equals(a, b) && intersects(a, p, p->next, b) && locally_inside(a, b) && locally_inside(b, a))
+		{
+			add_triangle(a, p, b);
+
+			// Remove two nodes involved
+			remove_node(p);
+			remove_node(p->next);
+
+			p = start = b;
+		}
+
+		p = p->next;
+	} while (p != start);
+
+	return filter_points(p);
+}
+
+/***********************************************************************************
+*! @brief  : Try splitting polygon into two by a valid diagonal and triangulate them
+***********************************************************************************/
+void EarTriangulator::split_earcut(EarNode* start)
+{
+	EarNode* a = start;
+
+	do
+	{
+		EarNode* b = a->next->next;
+
+		while (b != a->prev)
+		{
+			if (a->i != b->i && is_valid_diagonal(a, b))
+			{
+				EarNode* c = split_polygon(a, b);
+
+				a = filter_points(a, a->next);
+				c = filter_points(c, c->next);
+
+				earcut_linked(a, 0);
+				earcut_linked(c, 0);
+				return;
+			}
+
+			b = b->next;
+		}
+
+		a = a->next;
+	} while (a != start);
+}
+
+/***********************************************************************************
+*! @brief  : Link every hole into the outer ring (from left to right)
+***********************************************************************************/
+EarNode* EarTriangulator::eliminate_holes(const Point2D* pts, const uint32_t* arRing, size_t nRing, uint32_t nBase, EarNode* outer)
+{
+	std::vector<EarNode*, ScratchAllocator<EarNode*>> vecQueue(m_deqNode.get_allocator());
+	vecQueue.reserve(nRing - 1);
+
+	for (size_t r = 1; r < nRing; r++)
+	{
+		EarNode* list = linked_list(pts, arRing[r], arRing[r + 1], nBase, GFalse);
+
+		if (list == NULL)
+			continue;
+
+		if (list == list->next)
+			list->bSteiner = GTrue;
+
+		vecQueue.push_back(get_leftmost(list));
+	}
+
+	std::sort(vecQueue.begin(), vecQueue.end(), [](const EarNode* a, const EarNode* b)
+	{
+		return a->x < b->x;
+	});
+
+	for (EarNode* hole : vecQueue)
+	{
+		outer = eliminate_hole(hole, outer);
+	}
+
+	return outer;
+}
+
+/***********************************************************************************
+*! @brief  : Find a bridge between hole and outer ring and link them
+***********************************************************************************/
+EarNode* EarTriangulator::eliminate_hole(EarNode* hole, EarNode* outer)
+{
+	EarNode* bridge = find_hole_bridge(hole, outer);
+
+	if (bridge == NULL)
+		return outer;
+
+	EarNode* bridgeReverse = split_polygon(bridge, hole);
+
+	// Filter collinear points around the cuts
+	filter_points(bridgeReverse, bridgeReverse->next);
+
+	return filter_points(bridge, bridge->next);
+}
+
+/***********************************************************************************
+*! @brief  : David Eberly's algorithm for finding a bridge between hole and outer ring
+***********************************************************************************/
+EarNode* EarTriangulator::find_hole_bridge(EarNode* hole, EarNode* outer) const
+{
+	EarNode* p = outer;
+	EarNode* m = NULL;
+
+	GDouble hx = hole->x;
+	GDouble hy = hole->y;
+	GDouble qx = -std::numeric_limits<GDouble>::infinity();
+
+	// Find a segment intersected by a ray from the hole's leftmost point to the left
+	do
+	{
+		if (hy <= p->y && hy >= p->next->y && p->next->y != p->y)
+		{
+			GDouble x = p->x + (hy - p->y) * (p->next->x - p->x) / (p->next->y - p->y);
+
+			if (x <= hx && x > qx)
+			{
+				qx = x;
+				m  = (p->x < p->next->x) ? p : p->next;
+
+				// Hole touches outer segment : pick leftmost end point
+				if (x == hx)
+					return m;
+			}
+		}
+
+		p = p->next;
+	} while (p != outer);
+
+	if (m == NULL)
+		return NULL;
+
+	// Look for points inside the triangle of hole point, segment intersection and end
+	// point. If there are no points found, we have a valid connection. Otherwise
+	// choose the point of the minimum angle with the ray as connection point
+	EarNode* stop = m;
+
+	GDouble mx = m->x;
+	GDouble my = m->y;
+	GDouble dTanMin = std::numeric_limits<GDouble>::infinity();
+
+	p = m;
+
+	do
+	{
+		if (hx >= p->x && p->x >= mx && hx != p->x &&
+			point_in_triangle(hy < my ? hx : qx, hy, mx, my, hy < my ? qx : hx, hy, p->x, p->y))
+		{
+			GDouble dTan = std::fabs(hy - p->y) / (hx - p->x);
+
+			if (locally_inside(p, hole) &&
+				(dTan < dTanMin || (dTan == dTanMin && (p->x > m->x || (p->x == m->x && sector_contains_sector(m, p))))))
+			{
+				m = p;
+				dTanMin = dTan;
+			}
+		}
+
+		p = p->next;
+	} while (p != stop);
+
+	return m;
+}
+
+/***********************************************************************************
+*! @brief  : Interlink ring nodes in z-order
+***********************************************************************************/
+void EarTriangulator::index_curve(EarNode* start)
+{
+	EarNode* p = start;
+
+	do
+	{
+		if (p->z == 0)
+			p->z = z_order(p->x, p->y);
+
+		p->prevZ = p->prev;
+		p->nextZ = p->next;
+		p = p->next;
+	} while (p != start);
+
+	p->prevZ->nextZ = NULL;
+	p->prevZ = NULL;
+
+	sort_linked(p);
+}
+
+/***********************************************************************************
+*! @brief  : Z-order of a point (coords are transformed into 15 bits integer)
+***********************************************************************************/
+int32_t EarTriangulator::z_order(GDouble x, GDouble y) const
+{
+	int32_t nX = static_cast<int32_t>((x - m_dMinX) * m_dInvSize);
+	int32_t nY = static_cast<int32_t>((y - m_dMinY) * m_dInvSize);
+
+	nX = (nX | (nX << 8)) & 0x00FF00FF;
+	nX = (nX | (nX << 4)) & 0x0F0F0F0F;
+	nX = (nX | (nX << 2)) & 0x33333333;
+	nX = (nX | (nX << 1)) & 0x55555555;
+
+	nY = (nY | (nY << 8)) & 0x00FF00FF;
+	nY = (nY | (nY << 4)) & 0x0F0F0F0F;
+	nY = (nY | (nY << 2)) & 0x33333333;
+	nY = (nY | (nY << 1)) & 0x55555555;
+
+	return nX | (nY << 1);
+}
+
+/***********************************************************************************
+*! @brief  : Simon Tatham's linked list merge sort (by z-order)
+***********************************************************************************/
+EarNode* EarTriangulator::sort_linked(EarNode* list)
+{
+	int nInSize = 1;
+	int nMerges;
+
+	do
+	{
+		EarNode* p = list;
+		EarNode* tail = NULL;
+
+		list = NULL;
+		nMerges = 0;
+
+		while (p)
+		{
+			nMerges++;
+
+			EarNode* q = p;
+			int nPSize = 0;
+
+			for (int i = 0; i < nInSize; i++)
+			{
+				nPSize++;
+				q = q->nextZ;
+				if (q == NULL) break;
+			}
+
+			int nQSize = nInSize;
+
+			while (nPSize > 0 || (nQSize > 0 && q))
+			{
+				EarNode* e;
+
+				if (nPSize != 0 && (nQSize == 0 || q == NULL || p->z <= q->z))
+				{
+					e = p;
+					p = p->nextZ;
+					nPSize--;
+				}
+				else
+				{
+					e = q;
+					q = q->nextZ;
+					nQSize--;
+				}
+
+				if (tail) tail->nextZ = e;
+				else list = e;
+
+				e->prevZ = tail;
+				tail = e;
+			}
+
+			p = q;
+		}
+
+		tail->nextZ = NULL;
+		nInSize *= 2;
+
+	} while (nMerges > 1);
+
+	return list;
+}
+
+/***********************************************************************************
+*! @brief  : Leftmost node of ring
+***********************************************************************************/
+EarNode* EarTriangulator::get_leftmost(EarNode* start)
+{
+	EarNode* p = start;
+	EarNode* leftmost = start;
+
+	do
+	{
+		if (p->x < leftmost->x || (p->x == leftmost->x && p->y < leftmost->y))
+			leftmost = p;
+
+		p = p->next;
+	} while (p != start);
+
+	return leftmost;
+}
+
+/***********************************************************************************
+*! @brief  : Check point lies within a triangle
+***********************************************************************************/
+GBool EarTriangulator::point_in_triangle(GDouble ax, GDouble ay, GDouble bx, GDouble by,
+										 GDouble cx, GDouble cy, GDouble px, GDouble py)
+{
+	return ((cx - px) * (ay - py) >= (ax - px) * (cy - py) &&
+			(ax - px) * (by - py) >= (bx - px) * (ay - py) &&
+			(bx - px) * (cy - py) >= (cx - px) * (by - py)) ? GTrue : GFalse;
+}
+
+/***********************************************************************************
+*! @brief  : Check diagonal between two nodes is valid (lies in polygon interior)
+***********************************************************************************/
+GBool EarTriangulator::is_valid_diagonal(EarNode* a, EarNode* b)
+{
+	// Doesn't intersect other edges
+	if (a->next->i == b->i || a->prev->i == b->i || intersects_polygon(a, b))
+		return GFalse;
+
+	// Locally visible and doesn't create opposite-facing sectors
+	if (locally_inside(a, b) && locally_inside(b, a) && middle_inside(a, b) &&
+		(area(a->prev, a, b->prev) != 0.0 || area(a, b->prev, b) != 0.0))
+		return GTrue;
+
+	// Special zero-length case
+	return (equals(a, b) && area(a->prev, a, a->next) > 0.0 && area(b->prev, b, b->next) > 0.0) ? GTrue : GFalse;
+}
+
+/***********************************************************************************
+*! @brief  : Signed area of triangle (negative : counterclockwise)
+***********************************************************************************/
+GDouble EarTriangulator::area(const EarNode* p, const EarNode* q, const EarNode* r)
+{
+	return (q->y - p->y) * (r->x - q->x) - (q->x - p->x) * (r->y - q->y);
+}
+
+GBool EarTriangulator::equals(const EarNode* p1, const EarNode* p2)
+{
+	return (p1->x == p2->x && p1->y == p2->y) ? GTrue : GFalse;
+}
+
+/***********************************************************************************
+*! @brief  : Check two segments intersect (touching included)
+***********************************************************************************/
+GBool EarTriangulator::intersects(const EarNode* p1, const EarNode* q1, const EarNode* p2, const EarNode* q2)
+{
+	auto funSign = [](GDouble d) { return (d > 0.0) ? 1 : ((d < 0.0) ? -1 : 0); };
+
+	int o1 = funSign(area(p1, q1, p2));
+	int o2 = funSign(area(p1, q1, q2));
+	int o3 = funSign(area(p2, q2, p1));
+	int o4 = funSign(area(p2, q2, q1));
+
+	if (o1 != o2 && o3 != o4) return GTrue;
+
+	if (o1 == 0 && on_segment(p1, p2, q1)) return GTrue;
+	if (o2 == 0 && on_segment(p1, q2, q1)) return GTrue;
+	if (o3 == 0 && on_segment(p2, p1, q2)) return GTrue;
+	if (o4 == 0 && on_segment(p2, q1, q2)) return GTrue;
+
+	return GFalse;
+}
+
+/***********************************************************************************
+*! @brief  : For collinear points p, q, r, check q lies on segment pr
+***********************************************************************************/
+GBool EarTriangulator::on_segment(const EarNode* p, const EarNode* q, const EarNode* r)
+{
+	return (q->x <= std::max(p->x, r->x) && q->x >= std::min(p->x, r->x) &&
+			q->y <= std::max(p->y, r->y) && q->y >= std::min(p->y, r->y)) ? GTrue : GFalse;
+}
+
+/***********************************************************************************
+*! @brief  : Check diagonal ab intersects any ring edge
+***********************************************************************************/
+GBool EarTriangulator::intersects_polygon(const EarNode* a, const EarNode* b)
+{
+	const EarNode* p = a;
+
+	do
+	{
+		if (p->i != a->i && p->next->i != a->i && p->i != b->i && p->next->i != b->i &&
+			intersects(p, p->next, a, b))
+			return GTrue;
+
+		p = p->next;
+	} while (p != a);
+
+	return GFalse;
+}
+
+/***********************************************************************************
+*! @brief  : Check diagonal ab is locally inside the ring
+***********************************************************************************/
+GBool EarTriangulator::locally_inside(const EarNode* a, const EarNode* b)
+{
+	if (area(a->prev, a, a->next) < 0.0)
+		return (area(a, b, a->next) >= 0.0 && area(a, a->prev, b) >= 0.0) ? GTrue : GFalse;
+
+	return (area(a, b, a->prev) < 0.0 || area(a, a->next, b) < 0.0) ? GTrue : GFalse;
+}
+
+/***********************************************************************************
+*! @brief  : Check the middle point of diagonal ab is inside the ring
+***********************************************************************************/
+GBool EarTriangulator::middle_inside(const EarNode* a, const EarNode* b)
+{
+	const EarNode* p = a;
+
+	GBool bInside = GFalse;
+	GDouble px = (a->x + b->x) / 2.0;
+	GDouble py = (a->y + b->y) / 2.0;
+
+	do
+	{
+		if (((p->y > py) != (p->next->y > py)) && p->next->y != p->y &&
+			(px < (p->next->x - p->x) * (py - p->y) / (p->next->y - p->y) + p->x))
+			bInside = !bInside;
+
+		p = p->next;
+	} while (p != a);
+
+	return bInside;
+}
+
+/***********************************************************************************
+*! @brief  : Check sector of m contains sector of p (both share the same point)
+***********************************************************************************/
+GBool EarTriangulator::sector_contains_sector(const EarNode* m, const EarNode* p)
+{
+	return (area(m->prev, m, p->prev) < 0.0 && area(p->next, m, m->next) < 0.0) ? GTrue : GFalse;
+}
+
+/***********************************************************************************
+*! @brief  : Link two nodes with a bridge, split ring into two
+*! @return : node of the second ring
+***********************************************************************************/
+EarNode* EarTriangulator::split_polygon(EarNode* a, EarNode* b)
+{
+	EarNode* a2 = insert_node(a->i, a->x, a->y, NULL);
+	EarNode* b2 = insert_node(b->i, b->x, b->y, NULL);
+	EarNode* an = a->next;
+	EarNode* bp = b->prev;
+
+	a->next = b;   b->prev = a;
+	a2->next = an; an->prev = a2;
+	b2->next = a2; a2->prev = b2;
+	bp->next = b2; b2->prev = bp;
+
+	return b2;
+}
+
+/***********************************************************************************
+*! @brief  : Create node and insert it after last node
+***********************************************************************************/
+EarNode* EarTriangulator::insert_node(uint32_t i, GDouble x, GDouble y, EarNode* last)
+{
+	m_deqNode.push_back(EarNode{ i, x, y, 0, NULL, NULL, NULL, NULL, GFalse });
+	EarNode* p = &m_deqNode.back();
+
+	if (last == NULL)
+	{
+		p->prev = p;
+		p->next = p;
+	}
+	else
+	{
+		p->next = last->next;
+		p->prev = last;
+		last->next->prev = p;
+		last->next = p;
+	}
+
+	return p;
+}
+
+void EarTriangulator::remove_node(EarNode* p)
+{
+	p->next->prev = p->prev;
+	p->prev->next = p->next;
+
+	if (p->prevZ) p->prevZ->nextZ = p->nextZ;
+	if (p->nextZ) p->nextZ->prevZ = p->prevZ;
+}
+
+void EarTriangulator::add_triangle(const EarNode* a, const EarNode* b, const EarNode* c)
+{
+	m_pIndex->push_back(a->i);
+	m_pIndex->push_back(b->i);
+	m_pIndex->push_back(c->i);
+}
+
+/***********************************************************************************
+*! @brief  : Triangulate polygon without hole
+*! @param  : [in ] poly     : polygon (CW or CCW)
+*! @param  : [out] vecIndex : triangle list (3 indices into poly per triangle)
+*! @return : number of triangle
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Triangles are counterclockwise (CCW)
+***********************************************************************************/
+Dllexport GInt triangulate_polygon(const VecPoint2D& poly, std::vector<uint32_t>& vecIndex)
+{
+	return triangulate_polygon(RingView2D(poly), vecIndex);
+}
+
+Dllexport GInt triangulate_polygon(const RingView2D& poly, std::vector<uint32_t>& vecIndex)
+{
+	GeoScratch scratch;
+	return triangulate_polygon(poly, vecIndex, scratch);
+}
+
+/***********************************************************************************
+*! @brief  : Triangulate polygon without hole (scratch memory)
+*! @param  : [in ] poly     : polygon (CW or CCW)
+*! @param  : [out] vecIndex : triangle list (3 indices into poly per triangle)
+*! @param  : [in ] scratch  : temporary memory (ring nodes, hole queue)
+*! @return : number of triangle
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Same result as triangulate_polygon. Temporary memory is given back
+*!           to scratch on return, reuse scratch and vecIndex between calls
+***********************************************************************************/
+Dllexport GInt triangulate_polygon(const RingView2D& poly, std::vector<uint32_t>& vecIndex, GeoScratch& scratch)
+{
+	vecIndex.clear();
+
+	if (poly.size() < 3)
+		return 0;
+
+	vecIndex.reserve((poly.size() - 2) * 3);
+
+	uint32_t arRing[2] = { 0, static_cast<uint32_t>(poly.size()) };
+
+	GeoScratchFrame frame(scratch);
+
+	EarTriangulator trig(&scratch);
+	return trig.run(poly.data(), arRing, 1, 0, vecIndex);
+}
+
+/***********************************************************************************
+*! @brief  : Triangulate polygon with holes
+*! @param  : [in ] rings     : rings[0] : outer ring | other : holes
+*! @param  : [out] vecVertex : vertex array (all rings in order)
+*! @param  : [out] vecIndex  : triangle list (3 indices into vecVertex per triangle)
+*! @return : number of triangle
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Triangles are counterclockwise (CCW)
+***********************************************************************************/
+Dllexport GInt triangulate_polygon(const VecPolyList& rings, VecPoint2D& vecVertex, std::vector<uint32_t>& vecIndex)
+{
+	GeoScratch scratch;
+	return triangulate_polygon(rings, vecVertex, vecIndex, scratch);
+}
+
+Dllexport GInt triangulate_polygon(const VecPolyList& rings, VecPoint2D& vecVertex, std::vector<uint32_t>& vecIndex, GeoScratch& scratch)
+{
+	vecVertex.clear();
+	vecIndex.clear();
+
+	GeoScratchFrame frame(scratch);
+
+	std::vector<uint32_t, ScratchAllocator<uint32_t>> vecRing{ ScratchAllocator<uint32_t>(&scratch) };
+	vecRing.reserve(rings.size() + 1);
+	vecRing.push_back(0);
+
+	for (const VecPoint2D& ring : rings)
+	{
+		vecVertex.insert(vecVertex.end(), ring.begin(), ring.end());
+		vecRing.push_back(static_cast<uint32_t>(vecVertex.size()));
+	}
+
+	if (vecVertex.size() < 3)
+		return 0;
+
+	vecIndex.reserve((vecVertex.size() + 2 * rings.size()) * 3);
+
+	EarTriangulator trig(&scratch);
+	return trig.run(vecVertex.data(), vecRing.data(), rings.size(), 0, vecIndex);
+}
+
+/***********************************************************************************
+*! @brief  : Triangulate all polygons of multipolygon
+*! @param  : [in ] mpoly    : multipolygon
+*! @param  : [out] vecIndex : triangle list (3 indices into mpoly.points() per triangle)
+*! @return : number of triangle
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Triangles are counterclockwise (CCW)
+***********************************************************************************/
+Dllexport GInt triangulate_polygon(const MultiPolygon2D& mpoly, std::vector<uint32_t>& vecIndex)
+{
+	GeoScratch scratch;
+	return triangulate_polygon(mpoly, vecIndex, scratch);
+}
+
+/***********************************************************************************
+*! @brief  : Triangulate all polygons of multipolygon (scratch memory)
+*! @param  : [in ] mpoly    : multipolygon
+*! @param  : [out] vecIndex : triangle list (3 indices into mpoly.points() per triangle)
+*! @param  : [in ] scratch  : temporary memory (ring nodes, hole queue)
+*! @return : number of triangle
+*! @author : thuong.nv			- [Date] : 10/17/2026
+*! @note   : Same result as triangulate_polygon. Nodes of each polygon are given
+*!           back to scratch before the next polygon
+***********************************************************************************/
+Dllexport GInt triangulate_polygon(const MultiPolygon2D& mpoly, std::vector<uint32_t>& vecIndex, GeoScratch& scratch)
+{
+	vecIndex.clear();
+	vecIndex.reserve((mpoly.point_count() + 2 * mpoly.ring_count()) * 3);
+
+	GeoScratchFrame frame(scratch);
+
+	std::vector<uint32_t, ScratchAllocator<uint32_t>> vecRing{ ScratchAllocator<uint32_t>(&scratch) };
+	vecRing.reserve(mpoly.ring_count() + 1);
+
+	GInt nTrig = 0;
+
+	for (size_t p = 0; p < mpoly.poly_count(); p++)
+	{
+		size_t nRingBegin = mpoly.poly_ring_begin(p);
+		size_t nRingEnd   = mpoly.poly_ring_end(p);
+
+		if (nRingBegin == nRingEnd)
+			continue;
+
+		// Ring offsets relative to the first point of polygon
+		uint32_t nBase = static_cast<uint32_t>(mpoly.ring_begin(nRingBegin));
+
+		vecRing.clear();
+
+		for (size_t r = nRingBegin; r <= nRingEnd; r++)
+		{
+			vecRing.push_back(static_cast<uint32_t>(mpoly.ring_begin(r)) - nBase);
+		}
+
+		GeoScratchFrame framePoly(scratch);
+
+		EarTriangulator trig(&scratch);
+		nTrig += trig.run(mpoly.ring_data(nRingBegin), vecRing.data(), vecRing.size() - 1, nBase, vecIndex);
+	}
+
+	return nTrig;
+}
+
+}}
@@ -34,6 +34,19 @@ Dllexport VecPoint2D convert_rectf_to_points(const Rect2D& rect)
 	return vecPointPoly;
 }
 
+/*******************************************************************************
+@brief		Convert a rect into 4 points (no allocation)
+@param		[in]  rect	  : RectF
+@param		[out] arPoint : 4 points (same order as convert_rectf_to_points)
+********************************************************************************/
+Dllexport void convert_rectf_to_points(const Rect2D& rect, Point2D* arPoint)
+{
+	arPoint[0] = { rect.x, rect.y };
+	arPoint[1] = { rect.x + rect.width, rect.y };
+	arPoint[2] = { rect.x + rect.width, rect.y + rect.height };
+	arPoint[3] = { rect.x, rect.y + rect.height };
+}
+
 /***********************************************************************************
 *! @brief  : Convert from Radian to Degree
 *! @param  : [in] fRad : angle float (radian)
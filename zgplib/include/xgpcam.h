@@ -12,6 +12,7 @@
 #define XGPCAMERA_H
 
 #include "xsysdef.h"
+#include "xgeotype.h"
 
 #include <GL/glew.h>
 
@@ -231,6 +232,13 @@ public:
 
 	float GetZoom() const;
 
+	/*******************************************************************************
+	*! @brief  : Vùng nhìn của camera trên tọa độ thực tế (dùng để clip / cull)
+	*! @return : Rect2D [x, y] : góc trái dưới | [width, height] : kích thước
+	*! @author : thuong.nv          - [Date] : 17/10/2026
+	*******************************************************************************/
+	Rect2D GetViewRect() const;
+
 	/*******************************************************************************
 	*! @brief  : Target camera vào một vị trí (tọa độ local) với lượng zoom delta
 	*! @return : void
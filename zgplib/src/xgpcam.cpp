@@ -321,6 +321,19 @@ float Camera2D::GetZoom() const
 	return m_fZoom;
 }
 
+/*******************************************************************************
+*! @brief  : Vùng nhìn của camera trên tọa độ thực tế (dùng để clip / cull)
+*! @return : Rect2D [x, y] : góc trái dưới | [width, height] : kích thước
+*! @author : thuong.nv          - [Date] : 17/10/2026
+*******************************************************************************/
+Rect2D Camera2D::GetViewRect() const
+{
+	glm::vec2 ptLeftTop     = PointLocal2Global(glm::vec2(0.f, 0.f));
+	glm::vec2 ptRightBottom = PointLocal2Global(glm::vec2(float(m_iWidth), float(m_iHeight)));
+
+	return Rect2D(ptLeftTop.x, ptRightBottom.y, ptRightBottom.x - ptLeftTop.x, ptLeftTop.y - ptRightBottom.y);
+}
+
 /*******************************************************************************
 *! @brief  : Target camera vào một vị trí (tọa độ local) với lượng zoom delta
 *! @return : void